@@ -0,0 +1,167 @@
+// Void Bench — Microbenchmark harness
+
+#include "bench.h"
+#include "../src/core/trace.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- Types ---
+
+typedef struct BenchResult {
+	char     name[64];
+	double   median_ns;     // per operation
+	double   min_ns;
+	uint64_t iterations;    // per sample
+	double   mb_per_s;      // 0 when not a throughput benchmark
+	double   threshold;
+} BenchResult;
+
+static BenchResult s_results[VOID_BENCH_MAX_RESULTS];
+static uint32_t    s_count = 0;
+
+static volatile uint8_t s_sink;
+
+void void_bench_sink(const void *p, uint64_t size) {
+	const uint8_t *b = (const uint8_t *)p;
+	uint8_t x = 0;
+	for (uint64_t i = 0; i < size; i++) x ^= b[i];
+	s_sink ^= x;
+}
+
+static int compare_double(const void *a, const void *b) {
+	double x = *(const double *)a, y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+// --- Running ---
+
+static uint64_t time_sample(VoidBenchFn fn, void *ctx, uint64_t iterations) {
+	uint64_t start = void_trace_now_ns();
+	fn(ctx, iterations);
+	return void_trace_now_ns() - start;
+}
+
+void void_bench_run(const char *name, VoidBenchFn fn, VoidBenchSettleFn settle,
+	void *ctx, uint64_t bytes_per_op, double threshold
+) {
+	if (s_count >= VOID_BENCH_MAX_RESULTS) return;
+
+	// Calibrate (also warms caches and lazily created state)
+	uint64_t iterations = 1;
+	for (;;) {
+		uint64_t ns = time_sample(fn, ctx, iterations);
+		if (settle) settle(ctx);
+		if (ns >= VOID_BENCH_SAMPLE_NS || iterations >= (1ull << 40)) break;
+		// Jump close to the target once a sample is long enough to trust
+		if (ns > VOID_BENCH_SAMPLE_NS / 16) {
+			iterations = iterations * VOID_BENCH_SAMPLE_NS / ns + 1;
+		} else {
+			iterations *= 2;
+		}
+	}
+
+	double per_op[VOID_BENCH_SAMPLES];
+	for (uint32_t i = 0; i < VOID_BENCH_SAMPLES; i++) {
+		per_op[i] = (double)time_sample(fn, ctx, iterations) / (double)iterations;
+		if (settle) settle(ctx);
+	}
+	qsort(per_op, VOID_BENCH_SAMPLES, sizeof(double), compare_double);
+
+	BenchResult *r = &s_results[s_count++];
+	memset(r, 0, sizeof(*r));
+	strncpy(r->name, name, sizeof(r->name) - 1);
+	r->median_ns = per_op[VOID_BENCH_SAMPLES / 2];
+	r->min_ns = per_op[0];
+	r->iterations = iterations;
+	r->mb_per_s = bytes_per_op && r->median_ns > 0.0
+		? (double)bytes_per_op / r->median_ns * 1e9 / (1024.0 * 1024.0) : 0.0;
+	r->threshold = threshold > 0.0 ? threshold : VOID_BENCH_THRESHOLD;
+
+	printf("  %-32s %14.2f ns/op", r->name, r->median_ns);
+	if (r->mb_per_s > 0.0) printf(" %10.1f MB/s", r->mb_per_s);
+	printf("\n");
+}
+
+uint32_t void_bench_count(void) {
+	return s_count;
+}
+
+const char *void_bench_name(uint32_t index) {
+	return index < s_count ? s_results[index].name : "";
+}
+
+double void_bench_median_ns(uint32_t index) {
+	return index < s_count ? s_results[index].median_ns : 0.0;
+}
+
+// --- Results ---
+
+int void_bench_write_json(const char *path) {
+	FILE *f = fopen(path, "w");
+	if (!f) {
+		fprintf(stderr, "void_bench: cannot write %s\n", path);
+		return 0;
+	}
+	fprintf(f, "{\n  \"samples\": %d,\n  \"results\": [\n", VOID_BENCH_SAMPLES);
+	for (uint32_t i = 0; i < s_count; i++) {
+		const BenchResult *r = &s_results[i];
+		fprintf(f, "    {\"name\": \"%s\", \"median_ns\": %.4f, \"min_ns\": %.4f, "
+			"\"iterations\": %llu, \"mb_per_s\": %.2f, \"threshold\": %.2f}%s\n",
+			r->name, r->median_ns, r->min_ns, (unsigned long long)r->iterations,
+			r->mb_per_s, r->threshold, i + 1 < s_count ? "," : "");
+	}
+	fprintf(f, "  ]\n}\n");
+	fclose(f);
+	return 1;
+}
+
+// Reads `"key": value` from a result line written by void_bench_write_json
+static int read_number(const char *line, const char *key, double *out) {
+	const char *p = strstr(line, key);
+	if (!p) return 0;
+	return sscanf(p + strlen(key), " : %lf", out) == 1;
+}
+
+int void_bench_compare(const char *baseline_path) {
+	FILE *f = fopen(baseline_path, "r");
+	if (!f) return -1;
+
+	int regressions = 0;
+	uint32_t matched = 0;
+	char line[512];
+	printf("\n  %-32s %12s %12s %8s\n", "benchmark", "baseline", "now", "change");
+	while (fgets(line, sizeof(line), f)) {
+		const char *n = strstr(line, "\"name\": \"");
+		if (!n) continue;
+		n += strlen("\"name\": \"");
+		const char *end = strchr(n, '"');
+		if (!end || end - n >= 64) continue;
+		char name[64];
+		memcpy(name, n, (size_t)(end - n));
+		name[end - n] = '\0';
+
+		double base_ns = 0.0, threshold = VOID_BENCH_THRESHOLD;
+		if (!read_number(line, "\"median_ns\"", &base_ns) || base_ns <= 0.0) continue;
+		read_number(line, "\"threshold\"", &threshold);
+
+		const BenchResult *r = NULL;
+		for (uint32_t i = 0; i < s_count; i++) {
+			if (strcmp(s_results[i].name, name) == 0) r = &s_results[i];
+		}
+		if (!r) {
+			printf("  %-32s %12.2f %12s\n", name, base_ns, "missing");
+			continue;
+		}
+		matched++;
+		double change = r->median_ns / base_ns - 1.0;
+		int regressed = change > threshold;
+		regressions += regressed;
+		printf("  %-32s %12.2f %12.2f %+7.1f%%%s\n", name, base_ns, r->median_ns,
+			change * 100.0, regressed ? "  REGRESSED" : "");
+	}
+	fclose(f);
+	printf("  %u compared, %d regressed\n", matched, regressions);
+	return regressions;
+}
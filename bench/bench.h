@@ -0,0 +1,42 @@
+// Void Bench — Microbenchmark harness
+// Each benchmark is a function that performs `iterations` operations. The
+// harness doubles the count until one sample takes VOID_BENCH_SAMPLE_NS,
+// then records the median and minimum of VOID_BENCH_SAMPLES samples. Results
+// are written as JSON (one benchmark per line, so baselines diff cleanly) and
+// compared against a baseline file: a benchmark regresses when its median is
+// slower than the baseline median by more than the baseline's threshold.
+
+#ifndef VOID_BENCH_H
+#define VOID_BENCH_H
+
+#include <stdint.h>
+
+#define VOID_BENCH_SAMPLES       7
+#define VOID_BENCH_SAMPLE_NS     20000000ull   // 20 ms per sample
+#define VOID_BENCH_MAX_RESULTS   128
+#define VOID_BENCH_THRESHOLD     0.10          // default allowed slowdown
+#define VOID_BENCH_THRESHOLD_GPU 0.25          // submission / decode: noisier
+
+// Perform `iterations` operations
+typedef void (*VoidBenchFn)(void *ctx, uint64_t iterations);
+// Called between samples, outside the timed region (may be NULL)
+typedef void (*VoidBenchSettleFn)(void *ctx);
+
+// bytes_per_op > 0 adds a throughput figure (MB/s)
+void void_bench_run(const char *name, VoidBenchFn fn, VoidBenchSettleFn settle,
+    void *ctx, uint64_t bytes_per_op, double threshold);
+
+uint32_t    void_bench_count(void);
+const char *void_bench_name(uint32_t index);
+double      void_bench_median_ns(uint32_t index);   // per operation
+
+// 1 on success
+int void_bench_write_json(const char *path);
+// Prints a comparison table. Returns the number of regressions, or -1 when
+// the baseline cannot be read (nothing to compare against).
+int void_bench_compare(const char *baseline_path);
+
+// Keeps a computed value alive so the work producing it is not optimised out
+void void_bench_sink(const void *p, uint64_t size);
+
+#endif
@@ -0,0 +1,359 @@
+// Void Bench — Engine microbenchmarks
+
+#include "suite.h"
+#include "bench.h"
+#include "../src/math/mat4.h"
+#include "../src/assets/image.h"
+#include "../src/assets/pixels.h"
+#include "../src/audio/audio.h"
+#include "../src/gpu/dawn.h"
+#include "../src/gpu/enums.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MATRIX_COUNT     64      // inputs cycled through (fits in L1)
+#define DRAWS_PER_PASS   1000
+#define BENCH_IMAGE      "assets/test.png"
+
+// --- mat4 ---
+
+typedef struct MatrixCtx {
+	float a[MATRIX_COUNT][16];
+	float b[MATRIX_COUNT][16];
+	float out[16];
+} MatrixCtx;
+
+static void init_matrices(MatrixCtx *m) {
+	for (uint32_t i = 0; i < MATRIX_COUNT; i++) {
+		for (uint32_t j = 0; j < 16; j++) {
+			m->a[i][j] = (j % 5 == 0 ? 1.0f : 0.0f) + (float)((i * 16 + j) % 7) * 0.01f;
+			m->b[i][j] = (j % 5 == 0 ? 2.0f : 0.0f) - (float)((i * 16 + j) % 5) * 0.02f;
+		}
+	}
+}
+
+static void bench_mat4_multiply(void *ctx, uint64_t iterations) {
+	MatrixCtx *m = (MatrixCtx *)ctx;
+	for (uint64_t i = 0; i < iterations; i++) {
+		void_mat4_multiply(m->out, m->a[i % MATRIX_COUNT], m->b[(i + 7) % MATRIX_COUNT]);
+	}
+	void_bench_sink(m->out, sizeof(m->out));
+}
+
+static void bench_mat4_invert(void *ctx, uint64_t iterations) {
+	MatrixCtx *m = (MatrixCtx *)ctx;
+	for (uint64_t i = 0; i < iterations; i++) {
+		void_mat4_invert(m->out, m->a[i % MATRIX_COUNT]);
+	}
+	void_bench_sink(m->out, sizeof(m->out));
+}
+
+// Per-frame camera path: look-at + MVP
+static void bench_mat4_view_mvp(void *ctx, uint64_t iterations) {
+	(void)ctx;
+	for (uint64_t i = 0; i < iterations; i++) {
+		float t = (float)(i % 360) * 0.0174533f;
+		void_math_set_look_at(void_math_sinf(t) * 3.0f, 1.5f, void_math_cosf(t) * 3.0f,
+			0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f);
+		void_math_multiply_mvp();
+	}
+	void_bench_sink(void_math_get_mvp(), 64);
+}
+
+// --- Image decode ---
+
+static void bench_image_decode(void *ctx, uint64_t iterations) {
+	(void)ctx;
+	for (uint64_t i = 0; i < iterations; i++) {
+		void *pixels = void_load_image(BENCH_IMAGE, 4);
+		void_bench_sink(pixels, 4);
+		void_free_image(pixels);
+	}
+}
+
+// --- Pixel kernels ---
+
+typedef struct PixelCtx {
+	uint8_t *pixels;
+	uint32_t size;
+} PixelCtx;
+
+static void bench_checkerboard(void *ctx, uint64_t iterations) {
+	PixelCtx *p = (PixelCtx *)ctx;
+	for (uint64_t i = 0; i < iterations; i++) {
+		void_gen_checkerboard(p->pixels, p->size, 200, 60, 60, 60, 60, 200);
+	}
+	void_bench_sink(p->pixels, 4);
+}
+
+static void bench_swizzle(void *ctx, uint64_t iterations) {
+	PixelCtx *p = (PixelCtx *)ctx;
+	uint32_t count = p->size * p->size;
+	for (uint64_t i = 0; i < iterations; i++) {
+		void_pixels_swizzle(p->pixels, p->pixels, count, VOID_PIXELS_RGBA_TO_BGRA);
+	}
+	void_bench_sink(p->pixels, 4);
+}
+
+static void bench_premultiply(void *ctx, uint64_t iterations) {
+	PixelCtx *p = (PixelCtx *)ctx;
+	uint32_t count = p->size * p->size;
+	for (uint64_t i = 0; i < iterations; i++) {
+		void_pixels_premultiply(p->pixels, p->pixels, count);
+	}
+	void_bench_sink(p->pixels, 4);
+}
+
+// Level 1 goes after level 0 in the same buffer
+static void bench_downsample(void *ctx, uint64_t iterations) {
+	PixelCtx *p = (PixelCtx *)ctx;
+	uint8_t *dst = p->pixels + (size_t)p->size * p->size * 4;
+	for (uint64_t i = 0; i < iterations; i++) {
+		void_pixels_downsample(dst, p->pixels, p->size, p->size);
+	}
+	void_bench_sink(dst, 4);
+}
+
+static void bench_resize_half(void *ctx, uint64_t iterations) {
+	PixelCtx *p = (PixelCtx *)ctx;
+	uint8_t *dst = p->pixels + (size_t)p->size * p->size * 4;
+	for (uint64_t i = 0; i < iterations; i++) {
+		void_pixels_resize(dst, p->size / 2, p->size / 2, p->pixels, p->size, p->size);
+	}
+	void_bench_sink(dst, 4);
+}
+
+// --- Audio mixer (offline) ---
+
+#define MIX_VOICES 256
+#define MIX_FRAMES 1024
+
+typedef struct MixCtx {
+	void  *mixer;
+	void  *sound;
+	float *out;
+} MixCtx;
+
+// One second of a quiet tone at `rate`: voices resample unless it is 48 kHz
+static void mix_setup(MixCtx *x, uint32_t rate) {
+	float *tone = malloc(rate * sizeof(float));
+	for (uint32_t i = 0; i < rate; i++) tone[i] = void_math_sinf((float)i * 0.05f) * 0.01f;
+	x->mixer = void_audio_create(48000, MIX_VOICES, MIX_VOICES);
+	x->sound = void_audio_sound_create(tone, rate, 1, rate);
+	free(tone);
+	for (uint32_t v = 0; v < MIX_VOICES; v++) {
+		void_audio_play(x->mixer, x->sound, 0.5f, (float)(v % 9) * 0.25f - 1.0f, 1.0f, 1);
+	}
+}
+
+static void mix_teardown(MixCtx *x) {
+	void_audio_destroy(x->mixer);
+	void_audio_sound_destroy(NULL, x->sound);
+}
+
+static void bench_audio_mix(void *ctx, uint64_t iterations) {
+	MixCtx *x = (MixCtx *)ctx;
+	for (uint64_t i = 0; i < iterations; i++) {
+		void_audio_render(x->mixer, x->out, MIX_FRAMES);
+	}
+	void_bench_sink(x->out, 4);
+}
+
+// --- GPU (CPU adapter) ---
+
+typedef struct GpuCtx {
+	void    *instance;
+	void    *adapter;
+	void    *device;
+	void    *queue;
+	void    *buffer;
+	uint8_t *data;
+	uint64_t write_size;
+	void    *shader;
+	void    *pipeline;
+	void    *target;
+	void    *target_view;
+} GpuCtx;
+
+static const char *s_draw_wgsl =
+"@vertex fn vs(@builtin(vertex_index) i: u32) -> @builtin(position) vec4f {\n"
+"  let p = vec2f(f32(i & 1u), f32(i >> 1u)) * 0.01;\n"
+"  return vec4f(p, 0.0, 1.0);\n"
+"}\n"
+"@fragment fn fs() -> @location(0) vec4f {\n"
+"  return vec4f(1.0);\n"
+"}\n";
+
+// Submitted work must not pile up between samples
+static void gpu_settle(void *ctx) {
+	GpuCtx *g = (GpuCtx *)ctx;
+	void_gpu_queue_wait_idle(g->instance, g->queue);
+}
+
+static void bench_queue_write_buffer(void *ctx, uint64_t iterations) {
+	GpuCtx *g = (GpuCtx *)ctx;
+	for (uint64_t i = 0; i < iterations; i++) {
+		void_gpu_queue_write_buffer(g->queue, g->buffer, 0, g->data, g->write_size);
+	}
+}
+
+static void bench_mapped_write(void *ctx, uint64_t iterations) {
+	GpuCtx *g = (GpuCtx *)ctx;
+	for (uint64_t i = 0; i < iterations; i++) {
+		void *buffer = void_gpu_create_buffer(g->device, g->write_size, BUFFER_USAGE_VERTEX, 1);
+		void_gpu_buffer_write_floats(buffer, (const float *)g->data, (uint32_t)(g->write_size / sizeof(float)));
+		void_gpu_release_buffer(buffer);
+	}
+}
+
+// One operation = one draw; passes of DRAWS_PER_PASS draws, one submit each
+static void bench_draw_submit(void *ctx, uint64_t iterations) {
+	GpuCtx *g = (GpuCtx *)ctx;
+	uint64_t remaining = iterations;
+	while (remaining > 0) {
+		uint64_t draws = remaining < DRAWS_PER_PASS ? remaining : DRAWS_PER_PASS;
+		remaining -= draws;
+		void *encoder = void_gpu_create_command_encoder(g->device);
+		void *pass = void_gpu_begin_render_pass(encoder, g->target_view, 0.0, 0.0, 0.0, 1.0);
+		void_gpu_render_pass_set_pipeline(pass, g->pipeline);
+		for (uint64_t d = 0; d < draws; d++) void_gpu_render_pass_draw(pass, 3);
+		void_gpu_end_render_pass(pass);
+		void *cmd = void_gpu_finish_encoder(encoder);
+		void_gpu_submit(g->queue, cmd);
+		void_gpu_release_command_buffer(cmd);
+		void_gpu_release_command_encoder(encoder);
+	}
+}
+
+static void bench_empty_submit(void *ctx, uint64_t iterations) {
+	GpuCtx *g = (GpuCtx *)ctx;
+	for (uint64_t i = 0; i < iterations; i++) {
+		void *encoder = void_gpu_create_command_encoder(g->device);
+		void *cmd = void_gpu_finish_encoder(encoder);
+		void_gpu_submit(g->queue, cmd);
+		void_gpu_release_command_buffer(cmd);
+		void_gpu_release_command_encoder(encoder);
+	}
+}
+
+static int gpu_init(GpuCtx *g) {
+	memset(g, 0, sizeof(*g));
+	g->instance = void_gpu_create_instance();
+	g->adapter = g->instance ? void_gpu_request_adapter_fallback(g->instance) : NULL;
+	g->device = g->adapter ? void_gpu_request_device(g->adapter) : NULL;
+	if (!g->device) return 0;
+	g->queue = void_gpu_get_queue(g->device);
+
+	g->buffer = void_gpu_create_buffer(g->device, 1 << 20,
+		BUFFER_USAGE_UNIFORM | BUFFER_USAGE_COPY_DST, 0);
+	g->data = calloc(1, 1 << 20);
+	g->shader = void_gpu_create_shader(g->device, s_draw_wgsl);
+	g->pipeline = void_gpu_create_render_pipeline(g->device, g->shader, "vs", "fs");
+	g->target = void_gpu_create_texture(g->device, 256, 256, FMT_BGRA8_UNORM,
+		TEXTURE_USAGE_RENDER_ATTACHMENT, 1);
+	g->target_view = void_gpu_create_texture_view(g->target);
+	return 1;
+}
+
+static void gpu_shutdown(GpuCtx *g) {
+	if (!g->device) {
+		void_gpu_release_adapter(g->adapter);
+		void_gpu_release_instance(g->instance);
+		return;
+	}
+	void_gpu_queue_wait_idle(g->instance, g->queue);
+	void_gpu_release_texture_view(g->target_view);
+	void_gpu_release_texture(g->target);
+	void_gpu_release_pipeline(g->pipeline);
+	void_gpu_release_shader(g->shader);
+	void_gpu_release_buffer(g->buffer);
+	free(g->data);
+	void_gpu_release_queue(g->queue);
+	void_gpu_release_device(g->device);
+	void_gpu_release_adapter(g->adapter);
+	void_gpu_release_instance(g->instance);
+}
+
+// --- Suite ---
+
+int void_bench_main(const char *results_path, const char *baseline_path) {
+	printf("mat4\n");
+	MatrixCtx *m = calloc(1, sizeof(MatrixCtx));
+	init_matrices(m);
+	void_math_set_perspective(1.0472f, 16.0f / 9.0f, 0.1f, 100.0f);
+	void_math_set_rotate_y(0.5f);
+	void_bench_run("mat4_multiply", bench_mat4_multiply, NULL, m, 0, 0.0);
+	void_bench_run("mat4_invert", bench_mat4_invert, NULL, m, 0, 0.0);
+	void_bench_run("mat4_look_at_mvp", bench_mat4_view_mvp, NULL, m, 0, 0.0);
+	free(m);
+
+	printf("image\n");
+	void *probe = void_load_image(BENCH_IMAGE, 4);
+	if (probe) {
+		uint64_t decoded = (uint64_t)void_image_width() * void_image_height() * 4;
+		void_free_image(probe);
+		void_bench_run("image_decode_png", bench_image_decode, NULL, NULL, decoded, VOID_BENCH_THRESHOLD_GPU);
+	} else {
+		printf("  skipped: %s not found (run from the repository root)\n", BENCH_IMAGE);
+	}
+
+	printf("pixels\n");
+	PixelCtx px = { malloc(1024 * 1024 * 4 * 2), 256 };
+	void_bench_run("checkerboard_256", bench_checkerboard, NULL, &px, 256 * 256 * 4, 0.0);
+	px.size = 1024;
+	void_bench_run("checkerboard_1024", bench_checkerboard, NULL, &px, 1024 * 1024 * 4, 0.0);
+	void_bench_run("swizzle_1024", bench_swizzle, NULL, &px, 1024 * 1024 * 4, 0.0);
+	void_bench_run("premultiply_1024", bench_premultiply, NULL, &px, 1024 * 1024 * 4, 0.0);
+	void_bench_run("downsample_1024", bench_downsample, NULL, &px, 1024 * 1024 * 4, 0.0);
+	void_bench_run("resize_half_1024", bench_resize_half, NULL, &px, 1024 * 1024 * 4, 0.0);
+	free(px.pixels);
+
+	printf("audio\n");
+	MixCtx mix;
+	mix.out = malloc(MIX_FRAMES * VOID_AUDIO_CHANNELS * sizeof(float));
+	mix_setup(&mix, 48000);
+	void_bench_run("audio_mix_256", bench_audio_mix, NULL, &mix, MIX_FRAMES * VOID_AUDIO_CHANNELS * sizeof(float), 0.0);
+	mix_teardown(&mix);
+	mix_setup(&mix, 44100);
+	void_bench_run("audio_mix_256_resampled", bench_audio_mix, NULL, &mix, MIX_FRAMES * VOID_AUDIO_CHANNELS * sizeof(float), 0.0);
+	mix_teardown(&mix);
+	free(mix.out);
+
+	printf("gpu (CPU adapter)\n");
+	GpuCtx g;
+	if (gpu_init(&g)) {
+		static const uint64_t sizes[] = { 64, 64 * 1024, 1024 * 1024 };
+		static const char *write_names[] = {
+			"queue_write_buffer_64b", "queue_write_buffer_64k", "queue_write_buffer_1m" };
+		static const char *mapped_names[] = {
+			"mapped_write_64b", "mapped_write_64k", "mapped_write_1m" };
+		for (uint32_t i = 0; i < 3; i++) {
+			g.write_size = sizes[i];
+			void_bench_run(write_names[i], bench_queue_write_buffer, gpu_settle, &g, sizes[i], VOID_BENCH_THRESHOLD_GPU);
+			void_bench_run(mapped_names[i], bench_mapped_write, gpu_settle, &g, sizes[i], VOID_BENCH_THRESHOLD_GPU);
+		}
+		void_bench_run("draw_submit", bench_draw_submit, gpu_settle, &g, 0, VOID_BENCH_THRESHOLD_GPU);
+		void_bench_run("empty_submit", bench_empty_submit, gpu_settle, &g, 0, VOID_BENCH_THRESHOLD_GPU);
+	} else {
+		printf("  skipped: no CPU adapter\n");
+	}
+	gpu_shutdown(&g);
+
+	if (!void_bench_write_json(results_path)) return 1;
+	printf("\nResults written to %s\n", results_path);
+
+	const char *update = getenv("VOID_BENCH_UPDATE");
+	if (update && strcmp(update, "1") == 0) {
+		if (!void_bench_write_json(baseline_path)) return 1;
+		printf("Baseline updated: %s\n", baseline_path);
+		return 0;
+	}
+	int regressions = void_bench_compare(baseline_path);
+	if (regressions < 0) {
+		printf("No baseline at %s; run with VOID_BENCH_UPDATE=1 to record one\n", baseline_path);
+		return 0;
+	}
+	return regressions > 0 ? 1 : 0;
+}
@@ -0,0 +1,15 @@
+// Void Bench — Engine microbenchmarks
+// CPU kernels (mat4, image decode, pixel generation) and, on the headless
+// CPU adapter so results do not depend on the machine's GPU, buffer writes
+// and draw submission through dawn.c.
+
+#ifndef VOID_BENCH_SUITE_H
+#define VOID_BENCH_SUITE_H
+
+// Runs every benchmark, writes results_path and compares against
+// baseline_path. With VOID_BENCH_UPDATE=1 in the environment the results
+// also replace the baseline. Returns the process exit code: 1 when a
+// benchmark regressed past its threshold, else 0.
+int void_bench_main(const char *results_path, const char *baseline_path);
+
+#endif
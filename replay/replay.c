@@ -0,0 +1,648 @@
+// Void Replay — headless replay of a GPU capture
+
+#include "replay.h"
+#include "../src/gpu/capture.h"
+#include "../src/gpu/cache.h"
+#include "../src/gpu/dawn.h"
+#include "../src/gpu/enums.h"
+#include "../src/core/trace.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_ARGS  32
+#define MAX_OWNED 16    // strings and blobs per record
+
+// --- Types ---
+
+typedef struct Arg {
+	uint64_t    u;       // ids, u32, u64; blob size
+	int32_t     i;
+	double      d;       // f32, f64
+	const char *s;
+	const void *data;    // blob
+	void       *p;       // resolved object
+} Arg;
+
+typedef struct Record {
+	Arg   args[MAX_ARGS];
+	void *owned[MAX_OWNED];
+	uint32_t owned_count;
+	VoidRenderPipelineDesc pipeline;
+	VoidRenderPassDesc     pass;
+	VoidComputePassDesc    compute;
+	void    *handles[4];
+	uint32_t handle_count;
+} Record;
+
+typedef struct Reader {
+	const uint8_t *p;
+	const uint8_t *end;
+	int ok;
+} Reader;
+
+typedef struct OpStats {
+	uint64_t count;
+	uint64_t total_ns;
+	uint64_t max_ns;
+} OpStats;
+
+typedef struct Replay {
+	void *instance;
+	void *adapter;
+	void *device;
+	void *queue;
+	void *offscreen;        // stands in for the surface
+	int   sync;
+
+	void   **objects;       // capture id -> live object
+	uint32_t object_cap;
+
+	OpStats  ops[VOID_CAP_OP_COUNT];
+	double  *frames_ms;     // [0] runs from the start: loading + first frame
+	uint32_t frame_count;
+	uint32_t frame_cap;
+} Replay;
+
+static char s_surface;      // non-NULL placeholder for surface handles
+
+// --- Reading ---
+
+static void read_bytes(Reader *r, void *out, uint64_t size) {
+	if (!r->ok || (uint64_t)(r->end - r->p) < size) {
+		r->ok = 0;
+		memset(out, 0, (size_t)size);
+		return;
+	}
+	memcpy(out, r->p, (size_t)size);
+	r->p += size;
+}
+
+static uint32_t read_u32(Reader *r) { uint32_t v; read_bytes(r, &v, sizeof(v)); return v; }
+static int32_t  read_i32(Reader *r) { int32_t v;  read_bytes(r, &v, sizeof(v)); return v; }
+static uint64_t read_u64(Reader *r) { uint64_t v; read_bytes(r, &v, sizeof(v)); return v; }
+static float    read_f32(Reader *r) { float v;    read_bytes(r, &v, sizeof(v)); return v; }
+static double   read_f64(Reader *r) { double v;   read_bytes(r, &v, sizeof(v)); return v; }
+
+// Copied out of the file so strings are terminated and blobs aligned
+static void *own(Record *rec, Reader *r, uint64_t size, int terminate) {
+	if (!r->ok || (uint64_t)(r->end - r->p) < size || rec->owned_count >= MAX_OWNED) {
+		r->ok = 0;
+		return NULL;
+	}
+	uint8_t *copy = malloc((size_t)size + 1);
+	memcpy(copy, r->p, (size_t)size);
+	if (terminate) copy[size] = '\0';
+	r->p += size;
+	rec->owned[rec->owned_count++] = copy;
+	return copy;
+}
+
+static const char *read_str(Record *rec, Reader *r) {
+	uint32_t len = read_u32(r);
+	if (len == 0xFFFFFFFFu) return NULL;
+	return (const char *)own(rec, r, len, 1);
+}
+
+static void *object(Replay *rp, uint32_t id) {
+	return id < rp->object_cap ? rp->objects[id] : NULL;
+}
+
+static void set_object(Replay *rp, uint32_t id, void *p) {
+	if (id == 0) return;
+	if (id >= rp->object_cap) {
+		uint32_t cap = rp->object_cap ? rp->object_cap : 1024;
+		while (cap <= id) cap *= 2;
+		void **grown = realloc(rp->objects, cap * sizeof(void *));
+		if (!grown) return;
+		memset(grown + rp->object_cap, 0, (cap - rp->object_cap) * sizeof(void *));
+		rp->objects = grown;
+		rp->object_cap = cap;
+	}
+	rp->objects[id] = p;
+}
+
+static void read_pipeline_desc(Replay *rp, Record *rec, Reader *r) {
+	VoidRenderPipelineDesc *d = &rec->pipeline;
+	memset(d, 0, sizeof(*d));
+	d->shader = object(rp, read_u32(r));
+	d->vs_entry = read_str(rec, r);
+	d->fs_entry = read_str(rec, r);
+	d->layout = object(rp, read_u32(r));
+	d->stride = read_u64(r);
+	d->attr_count = read_u32(r);
+	if (d->attr_count > VOID_GPU_MAX_VERTEX_ATTRS) {
+		r->ok = 0;
+		return;
+	}
+	for (uint32_t i = 0; i < d->attr_count; i++) {
+		d->attrs[i].format = read_u32(r);
+		d->attrs[i].offset = read_u64(r);
+		d->attrs[i].location = read_u32(r);
+	}
+	d->instanced = read_i32(r);
+	d->color_format = read_u32(r);
+	d->depth_only = read_i32(r);
+	d->cull_mode = read_u32(r);
+	d->sample_count = read_u32(r);
+	d->depth_format = read_u32(r);
+	d->depth_write = read_i32(r);
+	d->depth_compare = read_u32(r);
+	d->depth_bias = read_i32(r);
+	d->depth_bias_slope_scale = read_f32(r);
+	d->depth_bias_clamp = read_f32(r);
+	d->has_blend = read_i32(r);
+	d->blend_color_src = read_u32(r);
+	d->blend_color_dst = read_u32(r);
+	d->blend_color_op = read_u32(r);
+	d->blend_alpha_src = read_u32(r);
+	d->blend_alpha_dst = read_u32(r);
+	d->blend_alpha_op = read_u32(r);
+}
+
+static void read_pass_desc(Replay *rp, Record *rec, Reader *r) {
+	VoidRenderPassDesc *d = &rec->pass;
+	memset(d, 0, sizeof(*d));
+	d->label = read_str(rec, r);
+	d->color_count = read_u32(r);
+	if (d->color_count > VOID_GPU_MAX_COLOR_ATTACHMENTS) {
+		r->ok = 0;
+		return;
+	}
+	for (uint32_t i = 0; i < d->color_count; i++) {
+		VoidColorAttachment *c = &d->colors[i];
+		c->view = object(rp, read_u32(r));
+		c->resolve_target = object(rp, read_u32(r));
+		c->clear = read_i32(r);
+		c->store = read_i32(r);
+		c->clear_r = read_f64(r);
+		c->clear_g = read_f64(r);
+		c->clear_b = read_f64(r);
+		c->clear_a = read_f64(r);
+	}
+	d->depth_view = object(rp, read_u32(r));
+	d->depth_clear = read_i32(r);
+	d->depth_store = read_i32(r);
+	d->depth_read_only = read_i32(r);
+	d->depth_clear_value = read_f32(r);
+}
+
+// Decodes the payload of `op` into rec->args; 0 on a malformed record
+static int decode(Replay *rp, uint32_t op, Reader *r, Record *rec) {
+	const char *format = void_capture_op_format(op);
+	uint32_t n = 0;
+	for (const char *f = format; *f && n < MAX_ARGS; f++, n++) {
+		Arg *a = &rec->args[n];
+		memset(a, 0, sizeof(*a));
+		switch (*f) {
+		case 'n': a->u = read_u32(r); break;
+		case 'h': a->u = read_u32(r); a->p = object(rp, (uint32_t)a->u); break;
+		case 'u': a->u = read_u32(r); break;
+		case 'i': a->i = read_i32(r); break;
+		case 'U': a->u = read_u64(r); break;
+		case 'f': a->d = read_f32(r); break;
+		case 'd': a->d = read_f64(r); break;
+		case 's': a->s = read_str(rec, r); break;
+		case 'b':
+			a->u = read_u64(r);
+			a->data = own(rec, r, a->u, 0);
+			break;
+		case 'H':
+			rec->handle_count = read_u32(r);
+			if (rec->handle_count > 4) return 0;
+			for (uint32_t i = 0; i < rec->handle_count; i++) rec->handles[i] = object(rp, read_u32(r));
+			break;
+		case 'P': read_pipeline_desc(rp, rec, r); break;
+		case 'R': read_pass_desc(rp, rec, r); break;
+		case 'C':
+			memset(&rec->compute, 0, sizeof(rec->compute));
+			rec->compute.label = read_str(rec, r);
+			break;
+		}
+	}
+	return r->ok;
+}
+
+static void release_record(Record *rec) {
+	for (uint32_t i = 0; i < rec->owned_count; i++) free(rec->owned[i]);
+	rec->owned_count = 0;
+}
+
+// --- Execution ---
+
+static void configure_offscreen(Replay *rp, uint32_t width, uint32_t height) {
+	void_gpu_release_texture(rp->offscreen);
+	rp->offscreen = void_gpu_create_texture(rp->device, width, height, FMT_BGRA8_UNORM,
+		TEXTURE_USAGE_RENDER_ATTACHMENT | TEXTURE_USAGE_TEXTURE_BINDING, 1);
+}
+
+#define H(k)   (a[k].p)
+#define U(k)   ((uint32_t)a[k].u)
+#define U64(k) (a[k].u)
+#define I(k)   (a[k].i)
+#define F(k)   ((float)a[k].d)
+#define D(k)   (a[k].d)
+#define S(k)   (a[k].s)
+#define B(k)   (a[k].data)
+
+// Issues one call; returns the object an 'n' op creates
+static void *execute(Replay *rp, uint32_t op, Record *rec) {
+	Arg *a = rec->args;
+	switch (op) {
+	// Replay owns the instance, adapter, device and queue
+	case VOID_CAP_INSTANCE: return rp->instance;
+	case VOID_CAP_SURFACE:  return &s_surface;
+	case VOID_CAP_ADAPTER:  return rp->adapter;
+	case VOID_CAP_DEVICE:   return rp->device;
+	case VOID_CAP_QUEUE:    return rp->queue;
+	case VOID_CAP_CONFIGURE_SURFACE: configure_offscreen(rp, U(2), U(3)); return NULL;
+	case VOID_CAP_GET_CURRENT_TEXTURE_VIEW:
+		return rp->offscreen ? void_gpu_create_texture_view(rp->offscreen) : NULL;
+	case VOID_CAP_PRESENT:
+	case VOID_CAP_RELEASE_SURFACE:
+		return NULL;
+
+	// Buffers
+	case VOID_CAP_CREATE_BUFFER: return void_gpu_create_buffer(H(1), U64(2), U(3), I(4));
+	case VOID_CAP_BUFFER_DATA: {
+		void *mapped = void_gpu_buffer_get_mapped_range(H(0), U64(1), U64(2));
+		if (mapped && B(2)) memcpy(mapped, B(2), (size_t)U64(2));
+		return NULL;
+	}
+	case VOID_CAP_BUFFER_UNMAP:        void_gpu_buffer_unmap(H(0)); return NULL;
+	case VOID_CAP_QUEUE_WRITE_BUFFER:  void_gpu_queue_write_buffer(H(0), H(1), U64(2), B(3), U64(3)); return NULL;
+	case VOID_CAP_BUFFER_WRITE_FLOATS: void_gpu_buffer_write_floats(H(0), (const float *)B(1), (uint32_t)(U64(1) / sizeof(float))); return NULL;
+
+	// Shaders & pipelines
+	case VOID_CAP_CREATE_SHADER: return void_gpu_create_shader(H(1), S(2));
+	case VOID_CAP_CREATE_RENDER_PIPELINE: return void_gpu_create_render_pipeline(H(1), H(2), S(3), S(4));
+	case VOID_CAP_CREATE_RENDER_PIPELINE_VB:
+		return void_gpu_create_render_pipeline_vb(H(1), H(2), S(3), S(4), U(5),
+			(uint64_t *)B(6), (uint32_t *)B(7), (uint32_t *)B(8), (uint64_t *)B(9), (uint32_t *)B(10));
+	case VOID_CAP_CREATE_RENDER_PIPELINE_1VB:
+		return void_gpu_create_render_pipeline_1vb(H(1), H(2), S(3), S(4), U64(5), U(6),
+			U(7), U64(8), U(9), U(10), U64(11), U(12));
+	case VOID_CAP_CREATE_RENDER_PIPELINE_EXT:
+		return void_gpu_create_render_pipeline_ext(H(1), H(2), S(3), S(4), H(5), U64(6), U(7),
+			U(8), U64(9), U(10), U(11), U64(12), U(13), I(14), U(15));
+	case VOID_CAP_CREATE_RENDER_PIPELINE_EXT2:
+		return void_gpu_create_render_pipeline_ext2(H(1), H(2), S(3), S(4), H(5), U64(6), U(7),
+			U(8), U64(9), U(10), U(11), U64(12), U(13), U(14), U64(15), U(16),
+			I(17), U(18), I(19), U(20), U(21), U(22), U(23), U(24), U(25));
+	case VOID_CAP_CREATE_RENDER_PIPELINE_DESC: return void_gpu_create_render_pipeline_desc(H(1), &rec->pipeline);
+	case VOID_CAP_CREATE_COMPUTE_PIPELINE:     return void_gpu_create_compute_pipeline(H(1), H(2), S(3), H(4));
+
+	// Encoding
+	case VOID_CAP_CREATE_COMMAND_ENCODER:  return void_gpu_create_command_encoder(H(1));
+	case VOID_CAP_BEGIN_RENDER_PASS:       return void_gpu_begin_render_pass(H(1), H(2), D(3), D(4), D(5), D(6));
+	case VOID_CAP_BEGIN_RENDER_PASS_DEPTH: return void_gpu_begin_render_pass_depth(H(1), H(2), D(3), D(4), D(5), D(6), H(7));
+	case VOID_CAP_BEGIN_RENDER_PASS_DESC:  return void_gpu_begin_render_pass_desc(H(1), &rec->pass);
+	case VOID_CAP_SET_PIPELINE:      void_gpu_render_pass_set_pipeline(H(0), H(1)); return NULL;
+	case VOID_CAP_SET_VERTEX_BUFFER: void_gpu_render_pass_set_vertex_buffer(H(0), U(1), H(2), U64(3), U64(4)); return NULL;
+	case VOID_CAP_SET_INDEX_BUFFER:  void_gpu_render_pass_set_index_buffer(H(0), H(1), U(2), U64(3), U64(4)); return NULL;
+	case VOID_CAP_SET_BIND_GROUP:    void_gpu_render_pass_set_bind_group(H(0), U(1), H(2)); return NULL;
+	case VOID_CAP_SET_VIEWPORT:      void_gpu_render_pass_set_viewport(H(0), F(1), F(2), F(3), F(4), F(5), F(6)); return NULL;
+	case VOID_CAP_SET_SCISSOR_RECT:  void_gpu_render_pass_set_scissor_rect(H(0), U(1), U(2), U(3), U(4)); return NULL;
+	case VOID_CAP_DRAW:              void_gpu_render_pass_draw(H(0), U(1)); return NULL;
+	case VOID_CAP_DRAW_INSTANCED:    void_gpu_render_pass_draw_instanced(H(0), U(1), U(2), U(3), U(4)); return NULL;
+	case VOID_CAP_DRAW_INDEXED:      void_gpu_render_pass_draw_indexed(H(0), U(1), U(2), U(3), I(4), U(5)); return NULL;
+	case VOID_CAP_DRAW_INDIRECT:     void_gpu_render_pass_draw_indirect(H(0), H(1), U64(2)); return NULL;
+	case VOID_CAP_END_RENDER_PASS:   void_gpu_end_render_pass(H(0)); return NULL;
+	case VOID_CAP_BEGIN_COMPUTE_PASS:      return void_gpu_begin_compute_pass(H(1));
+	case VOID_CAP_BEGIN_COMPUTE_PASS_DESC: return void_gpu_begin_compute_pass_desc(H(1), &rec->compute);
+	case VOID_CAP_COMPUTE_SET_PIPELINE:          void_gpu_compute_pass_set_pipeline(H(0), H(1)); return NULL;
+	case VOID_CAP_COMPUTE_SET_BIND_GROUP:        void_gpu_compute_pass_set_bind_group(H(0), U(1), H(2)); return NULL;
+	case VOID_CAP_COMPUTE_SET_BIND_GROUP_OFFSET: void_gpu_compute_pass_set_bind_group_offset(H(0), U(1), H(2), U(3)); return NULL;
+	case VOID_CAP_DISPATCH:          void_gpu_compute_pass_dispatch(H(0), U(1), U(2), U(3)); return NULL;
+	case VOID_CAP_DISPATCH_INDIRECT: void_gpu_compute_pass_dispatch_indirect(H(0), H(1), U64(2)); return NULL;
+	case VOID_CAP_END_COMPUTE_PASS:  void_gpu_end_compute_pass(H(0)); return NULL;
+	case VOID_CAP_FINISH_ENCODER:    return void_gpu_finish_encoder(H(1));
+	case VOID_CAP_SUBMIT:            void_gpu_submit(H(0), H(1)); return NULL;
+
+	// Debug groups & markers
+	case VOID_CAP_ENCODER_PUSH_DEBUG_GROUP:    void_gpu_encoder_push_debug_group(H(0), S(1)); return NULL;
+	case VOID_CAP_ENCODER_POP_DEBUG_GROUP:     void_gpu_encoder_pop_debug_group(H(0)); return NULL;
+	case VOID_CAP_ENCODER_INSERT_DEBUG_MARKER: void_gpu_encoder_insert_debug_marker(H(0), S(1)); return NULL;
+	case VOID_CAP_PASS_PUSH_DEBUG_GROUP:       void_gpu_render_pass_push_debug_group(H(0), S(1)); return NULL;
+	case VOID_CAP_PASS_POP_DEBUG_GROUP:        void_gpu_render_pass_pop_debug_group(H(0)); return NULL;
+	case VOID_CAP_PASS_INSERT_DEBUG_MARKER:    void_gpu_render_pass_insert_debug_marker(H(0), S(1)); return NULL;
+	case VOID_CAP_COMPUTE_PUSH_DEBUG_GROUP:    void_gpu_compute_pass_push_debug_group(H(0), S(1)); return NULL;
+	case VOID_CAP_COMPUTE_POP_DEBUG_GROUP:     void_gpu_compute_pass_pop_debug_group(H(0)); return NULL;
+
+	// Bind groups & layouts
+	case VOID_CAP_CREATE_BIND_GROUP_LAYOUT_1BUF: return void_gpu_create_bind_group_layout_1buf(H(1), U(2), U(3), U64(4));
+	case VOID_CAP_CREATE_BIND_GROUP_1BUF:        return void_gpu_create_bind_group_1buf(H(1), H(2), U(3), H(4), U64(5), U64(6));
+	case VOID_CAP_CREATE_PIPELINE_LAYOUT_1BG:    return void_gpu_create_pipeline_layout_1bg(H(1), H(2));
+	case VOID_CAP_CREATE_BIND_GROUP_LAYOUT_TS:   return void_gpu_create_bind_group_layout_1tex_1samp(H(1), U(2), U(3), U(4), U(5));
+	case VOID_CAP_CREATE_BIND_GROUP_LAYOUT_TS_DIM:
+		return void_gpu_create_bind_group_layout_1tex_1samp_dim(H(1), U(2), U(3), U(4), U(5), U(6));
+	case VOID_CAP_CREATE_BIND_GROUP_TS:          return void_gpu_create_bind_group_1tex_1samp(H(1), H(2), U(3), H(4), U(5), H(6));
+	case VOID_CAP_CREATE_PIPELINE_LAYOUT_2BG:    return void_gpu_create_pipeline_layout_2bg(H(1), H(2), H(3));
+
+	// Textures & samplers
+	case VOID_CAP_CREATE_DEPTH_TEXTURE:      return void_gpu_create_depth_texture(H(1), U(2), U(3));
+	case VOID_CAP_CREATE_TEXTURE:            return void_gpu_create_texture(H(1), U(2), U(3), U(4), U(5), U(6));
+	case VOID_CAP_CREATE_TEXTURE_MS:         return void_gpu_create_texture_ms(H(1), U(2), U(3), U(4), U(5), U(6));
+	case VOID_CAP_CREATE_TEXTURE_LAYERS:     return void_gpu_create_texture_layers(H(1), U(2), U(3), U(4), U(5), U(6), U(7));
+	case VOID_CAP_CREATE_TEXTURE_3D:         return void_gpu_create_texture_3d(H(1), U(2), U(3), U(4), U(5), U(6));
+	case VOID_CAP_CREATE_TEXTURE_VIEW:       return void_gpu_create_texture_view(H(1));
+	case VOID_CAP_CREATE_TEXTURE_VIEW_RANGE: return void_gpu_create_texture_view_range(H(1), U(2), U(3), U(4), U(5), U(6), U(7));
+	case VOID_CAP_QUEUE_WRITE_TEXTURE:
+		void_gpu_queue_write_texture(H(0), H(1), B(2), U64(2), U(3), U(4), U(5));
+		return NULL;
+	case VOID_CAP_QUEUE_WRITE_TEXTURE_REGION:
+		void_gpu_queue_write_texture_region(H(0), H(1), U(2), U(3), B(4), U64(4), U(5), U(6), U(7));
+		return NULL;
+	case VOID_CAP_QUEUE_WRITE_TEXTURE_MIP:
+		void_gpu_queue_write_texture_mip(H(0), H(1), U(2), B(3), U64(3), U(4), U(5), U(6));
+		return NULL;
+	case VOID_CAP_QUEUE_WRITE_TEXTURE_LEVEL:
+		void_gpu_queue_write_texture_level(H(0), H(1), U(2), U(3), U(4), B(5), U64(5), U(6), U(7));
+		return NULL;
+	case VOID_CAP_QUEUE_WRITE_TEXTURE_3D:
+		void_gpu_queue_write_texture_3d(H(0), H(1), B(2), U64(2), U(3), U(4), U(5), U(6));
+		return NULL;
+	case VOID_CAP_CREATE_SAMPLER: return void_gpu_create_sampler(H(1), U(2), U(3), U(4));
+
+	// Releases
+	case VOID_CAP_RELEASE_SHADER:            void_gpu_release_shader(H(0)); return NULL;
+	case VOID_CAP_RELEASE_PIPELINE:          void_gpu_release_pipeline(H(0)); return NULL;
+	case VOID_CAP_RELEASE_COMMAND_ENCODER:   void_gpu_release_command_encoder(H(0)); return NULL;
+	case VOID_CAP_RELEASE_COMMAND_BUFFER:    void_gpu_release_command_buffer(H(0)); return NULL;
+	case VOID_CAP_RELEASE_TEXTURE_VIEW:      void_gpu_release_texture_view(H(0)); return NULL;
+	case VOID_CAP_RELEASE_BUFFER:            void_gpu_release_buffer(H(0)); return NULL;
+	case VOID_CAP_RELEASE_TEXTURE:           void_gpu_release_texture(H(0)); return NULL;
+	case VOID_CAP_RELEASE_BIND_GROUP_LAYOUT: void_gpu_release_bind_group_layout(H(0)); return NULL;
+	case VOID_CAP_RELEASE_BIND_GROUP:        void_gpu_release_bind_group(H(0)); return NULL;
+	case VOID_CAP_RELEASE_COMPUTE_PIPELINE:  void_gpu_release_compute_pipeline(H(0)); return NULL;
+	case VOID_CAP_RELEASE_PIPELINE_LAYOUT:   void_gpu_release_pipeline_layout(H(0)); return NULL;
+	case VOID_CAP_RELEASE_SAMPLER:           void_gpu_release_sampler(H(0)); return NULL;
+
+	// Cache (replays hit and evict exactly as the capture did)
+	case VOID_CAP_LAYOUT_BEGIN:           return void_gpu_layout_begin();
+	case VOID_CAP_LAYOUT_BUFFER:          void_gpu_layout_buffer(H(0), U(1), U(2), U(3), U64(4), I(5)); return NULL;
+	case VOID_CAP_LAYOUT_TEXTURE:         void_gpu_layout_texture(H(0), U(1), U(2), U(3), U(4), I(5)); return NULL;
+	case VOID_CAP_LAYOUT_STORAGE_TEXTURE: void_gpu_layout_storage_texture(H(0), U(1), U(2), U(3), U(4), U(5)); return NULL;
+	case VOID_CAP_LAYOUT_SAMPLER:         void_gpu_layout_sampler(H(0), U(1), U(2), U(3)); return NULL;
+	case VOID_CAP_LAYOUT_FINISH:          return void_gpu_layout_finish(H(1), H(2));
+	case VOID_CAP_GROUP_BEGIN:            return void_gpu_group_begin(H(1));
+	case VOID_CAP_GROUP_BUFFER:           void_gpu_group_buffer(H(0), U(1), H(2), U64(3), U64(4)); return NULL;
+	case VOID_CAP_GROUP_TEXTURE:          void_gpu_group_texture(H(0), U(1), H(2)); return NULL;
+	case VOID_CAP_GROUP_SAMPLER:          void_gpu_group_sampler(H(0), U(1), H(2)); return NULL;
+	case VOID_CAP_GROUP_FINISH:           return void_gpu_group_finish(H(1), H(2));
+	case VOID_CAP_CACHED_PIPELINE_LAYOUT:
+		return void_gpu_cached_pipeline_layout(H(1), rec->handle_count, rec->handles);
+	case VOID_CAP_CACHED_SAMPLER:
+		return void_gpu_cached_sampler(H(1), U(2), U(3), U(4), U(5), U(6), U(7), U(8), U(9));
+	case VOID_CAP_CACHE_RETAIN:    void_gpu_cache_retain(H(0)); return NULL;
+	case VOID_CAP_CACHE_RELEASE:   void_gpu_cache_release(H(0)); return NULL;
+	case VOID_CAP_CACHE_END_FRAME: void_gpu_cache_end_frame(); return NULL;
+	case VOID_CAP_CACHE_CLEAR:     void_gpu_cache_clear(); return NULL;
+	}
+	return NULL;
+}
+
+#undef H
+#undef U
+#undef U64
+#undef I
+#undef F
+#undef D
+#undef S
+#undef B
+
+static void add_frame(Replay *rp, double ms) {
+	if (rp->frame_count == rp->frame_cap) {
+		uint32_t cap = rp->frame_cap ? rp->frame_cap * 2 : 256;
+		double *grown = realloc(rp->frames_ms, cap * sizeof(double));
+		if (!grown) return;
+		rp->frames_ms = grown;
+		rp->frame_cap = cap;
+	}
+	rp->frames_ms[rp->frame_count++] = ms;
+}
+
+// Runs every record; 0 when the file is malformed
+static int run(Replay *rp, const uint8_t *data, uint64_t size) {
+	Reader r = { data + 8, data + size, 1 };
+	Record *rec = calloc(1, sizeof(Record));
+	uint64_t frame_start = void_trace_now_ns();
+	uint64_t records = 0;
+	int ok = 1;
+
+	while (r.p < r.end) {
+		uint16_t op = 0;
+		read_bytes(&r, &op, sizeof(op));
+		uint32_t payload = read_u32(&r);
+		if (!r.ok || (uint64_t)(r.end - r.p) < payload) {
+			ok = 0;
+			break;
+		}
+		Reader body = { r.p, r.p + payload, 1 };
+		r.p += payload;
+		records++;
+
+		// Ops this build does not know are skipped whole
+		if (strcmp(void_capture_op_name(op), "?") == 0) continue;
+		if (!decode(rp, op, &body, rec)) {
+			fprintf(stderr, "void_replay: malformed %s record (#%llu)\n",
+				void_capture_op_name(op), (unsigned long long)records);
+			release_record(rec);
+			ok = 0;
+			break;
+		}
+
+		uint64_t start = void_trace_now_ns();
+		void *created = execute(rp, op, rec);
+		uint64_t ns = void_trace_now_ns() - start;
+		if (void_capture_op_format(op)[0] == 'n') set_object(rp, (uint32_t)rec->args[0].u, created);
+		release_record(rec);
+
+		OpStats *st = &rp->ops[op];
+		st->count++;
+		st->total_ns += ns;
+		if (ns > st->max_ns) st->max_ns = ns;
+
+		if (op == VOID_CAP_PRESENT) {
+			if (rp->sync) void_gpu_queue_wait_idle(rp->instance, rp->queue);
+			uint64_t now = void_trace_now_ns();
+			add_frame(rp, (double)(now - frame_start) / 1e6);
+			frame_start = now;
+		}
+	}
+	if (rp->sync) void_gpu_queue_wait_idle(rp->instance, rp->queue);
+	free(rec);
+	return ok;
+}
+
+// --- Results ---
+
+static int compare_double(const void *a, const void *b) {
+	double x = *(const double *)a, y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+static int compare_ops(const void *a, const void *b) {
+	const OpStats *x = *(const OpStats *const *)a, *y = *(const OpStats *const *)b;
+	return (y->total_ns > x->total_ns) - (y->total_ns < x->total_ns);
+}
+
+typedef struct FrameSummary {
+	uint32_t count;          // frames after the first (the first includes loading)
+	double   mean, p50, p95, max;
+} FrameSummary;
+
+static FrameSummary summarize(const Replay *rp) {
+	FrameSummary s = {0};
+	if (rp->frame_count < 2) return s;
+	s.count = rp->frame_count - 1;
+	double *sorted = malloc(s.count * sizeof(double));
+	memcpy(sorted, rp->frames_ms + 1, s.count * sizeof(double));
+	qsort(sorted, s.count, sizeof(double), compare_double);
+	double sum = 0.0;
+	for (uint32_t i = 0; i < s.count; i++) sum += sorted[i];
+	s.mean = sum / s.count;
+	s.p50 = sorted[s.count / 2];
+	s.p95 = sorted[(uint32_t)((s.count - 1) * 0.95)];
+	s.max = sorted[s.count - 1];
+	free(sorted);
+	return s;
+}
+
+static void print_results(const Replay *rp, const FrameSummary *fs) {
+	const OpStats *order[VOID_CAP_OP_COUNT];
+	uint32_t n = 0;
+	uint64_t total = 0;
+	for (uint32_t op = 0; op < VOID_CAP_OP_COUNT; op++) {
+		if (rp->ops[op].count) order[n++] = &rp->ops[op];
+		total += rp->ops[op].total_ns;
+	}
+	qsort(order, n, sizeof(order[0]), compare_ops);
+
+	printf("\n  %-36s %10s %12s %10s %10s %6s\n", "op", "calls", "total ms", "mean us", "max us", "share");
+	for (uint32_t i = 0; i < n; i++) {
+		const OpStats *st = order[i];
+		uint32_t op = (uint32_t)(st - rp->ops);
+		printf("  %-36s %10llu %12.3f %10.2f %10.2f %5.1f%%\n", void_capture_op_name(op),
+			(unsigned long long)st->count, (double)st->total_ns / 1e6,
+			(double)st->total_ns / (double)st->count / 1e3, (double)st->max_ns / 1e3,
+			total ? 100.0 * (double)st->total_ns / (double)total : 0.0);
+	}
+
+	printf("\n  setup (to first present) %.2f ms\n", rp->frame_count ? rp->frames_ms[0] : 0.0);
+	if (fs->count) {
+		printf("  %u frames: mean %.3f ms, p50 %.3f ms, p95 %.3f ms, max %.3f ms%s\n",
+			fs->count, fs->mean, fs->p50, fs->p95, fs->max,
+			rp->sync ? "" : " (CPU only, VOID_REPLAY_SYNC=0)");
+	}
+}
+
+static int write_json(const Replay *rp, const FrameSummary *fs, const char *capture_path, const char *path) {
+	FILE *f = fopen(path, "w");
+	if (!f) {
+		fprintf(stderr, "void_replay: cannot write %s\n", path);
+		return 0;
+	}
+	fprintf(f, "{\n  \"capture\": \"%s\",\n  \"sync\": %d,\n", capture_path, rp->sync);
+	fprintf(f, "  \"setup_ms\": %.4f,\n", rp->frame_count ? rp->frames_ms[0] : 0.0);
+	fprintf(f, "  \"frames\": {\"count\": %u, \"mean_ms\": %.4f, \"p50_ms\": %.4f, \"p95_ms\": %.4f, \"max_ms\": %.4f},\n",
+		fs->count, fs->mean, fs->p50, fs->p95, fs->max);
+	fprintf(f, "  \"ops\": [\n");
+	uint32_t remaining = 0;
+	for (uint32_t op = 0; op < VOID_CAP_OP_COUNT; op++) remaining += rp->ops[op].count ? 1 : 0;
+	for (uint32_t op = 0; op < VOID_CAP_OP_COUNT; op++) {
+		const OpStats *st = &rp->ops[op];
+		if (!st->count) continue;
+		fprintf(f, "    {\"name\": \"%s\", \"calls\": %llu, \"total_ns\": %llu, \"max_ns\": %llu}%s\n",
+			void_capture_op_name(op), (unsigned long long)st->count,
+			(unsigned long long)st->total_ns, (unsigned long long)st->max_ns,
+			--remaining ? "," : "");
+	}
+	fprintf(f, "  ],\n  \"frame_ms\": [");
+	for (uint32_t i = 0; i < rp->frame_count; i++) {
+		fprintf(f, "%s%.4f", i ? ", " : "", rp->frames_ms[i]);
+	}
+	fprintf(f, "]\n}\n");
+	fclose(f);
+	return 1;
+}
+
+// --- Main ---
+
+static uint8_t *read_file(const char *path, uint64_t *size) {
+	FILE *f = fopen(path, "rb");
+	if (!f) return NULL;
+	fseek(f, 0, SEEK_END);
+	long len = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	uint8_t *data = len > 0 ? malloc((size_t)len) : NULL;
+	if (data && fread(data, 1, (size_t)len, f) != (size_t)len) {
+		free(data);
+		data = NULL;
+	}
+	fclose(f);
+	*size = data ? (uint64_t)len : 0;
+	return data;
+}
+
+int void_replay_main(const char *capture_path, const char *results_path) {
+	// A capture of the replay would be opened by void_gpu_create_instance
+	if (getenv("VOID_GPU_CAPTURE")) {
+		fprintf(stderr, "void_replay: unset VOID_GPU_CAPTURE before replaying\n");
+		return 1;
+	}
+
+	const char *override = getenv("VOID_REPLAY_FILE");
+	if (override && *override) capture_path = override;
+
+	uint64_t size = 0;
+	uint8_t *data = read_file(capture_path, &size);
+	uint32_t version = 0;
+	if (data && size >= 8) memcpy(&version, data + 4, sizeof(version));
+	if (!data || size < 8 || memcmp(data, VOID_CAPTURE_MAGIC, 4) != 0 || version != VOID_CAPTURE_VERSION) {
+		fprintf(stderr, "void_replay: %s is not a version %d capture\n", capture_path, VOID_CAPTURE_VERSION);
+		free(data);
+		return 1;
+	}
+
+	Replay *rp = calloc(1, sizeof(Replay));
+	const char *adapter = getenv("VOID_REPLAY_ADAPTER");
+	const char *sync = getenv("VOID_REPLAY_SYNC");
+	int use_cpu = adapter && strcmp(adapter, "cpu") == 0;
+	rp->sync = !(sync && strcmp(sync, "0") == 0);
+
+	rp->instance = void_gpu_create_instance();
+	if (rp->instance) {
+		rp->adapter = use_cpu ? void_gpu_request_adapter_fallback(rp->instance)
+			: void_gpu_request_adapter(rp->instance, NULL);
+	}
+	rp->device = rp->adapter ? void_gpu_request_device(rp->adapter) : NULL;
+	int code = 1;
+	if (rp->device) {
+		rp->queue = void_gpu_get_queue(rp->device);
+		printf("Replaying %s (%.1f MB) on the %s adapter\n", capture_path,
+			(double)size / (1024.0 * 1024.0), use_cpu ? "CPU" : "default");
+
+		int ok = run(rp, data, size);
+		FrameSummary fs = summarize(rp);
+		print_results(rp, &fs);
+		if (!ok) fprintf(stderr, "void_replay: capture ends early or is malformed; results are partial\n");
+		code = write_json(rp, &fs, capture_path, results_path) && ok ? 0 : 1;
+		if (code == 0) printf("\nResults written to %s\n", results_path);
+
+		void_gpu_release_texture(rp->offscreen);
+		void_gpu_release_queue(rp->queue);
+		void_gpu_release_device(rp->device);
+	} else {
+		fprintf(stderr, "void_replay: no %s adapter\n", use_cpu ? "CPU" : "GPU");
+	}
+	void_gpu_release_adapter(rp->adapter);
+	void_gpu_release_instance(rp->instance);
+
+	free(rp->objects);
+	free(rp->frames_ms);
+	free(rp);
+	free(data);
+	return code;
+}
@@ -0,0 +1,21 @@
+// Void Replay — headless replay of a GPU capture (src/gpu/capture.h)
+// Re-issues every recorded bridge call in order on a device without a
+// window: the surface becomes an offscreen BGRA8 texture of the configured
+// size, and each present ends a frame. Every call is timed on the CPU; with
+// sync on (the default) each frame also waits for the GPU, so frame times
+// cover the GPU work the frame submitted.
+//
+// Environment:
+//   VOID_REPLAY_FILE=<path>   capture to replay instead of capture_path
+//   VOID_REPLAY_ADAPTER=cpu   replay on the CPU fallback adapter
+//   VOID_REPLAY_SYNC=0        do not wait for the GPU at frame boundaries
+
+#ifndef VOID_REPLAY_H
+#define VOID_REPLAY_H
+
+// Replays capture_path, prints the per-op and per-frame tables and writes
+// them to results_path as JSON (for A/B comparison of two builds or
+// machines). Returns the process exit code.
+int void_replay_main(const char *capture_path, const char *results_path);
+
+#endif
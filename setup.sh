@@ -30,6 +30,45 @@ else
 	echo "Dawn installed"
 fi
 
+# --- libktx (KTX2 loading + Basis Universal transcoding), library only ---
+KTX_VERSION="4.3.2"
+KTX_DEST="deps/ktx"
+if [ -d "$KTX_DEST" ]; then
+	echo "libktx already at ${KTX_DEST}"
+else
+	echo "Building libktx ${KTX_VERSION}..."
+	rm -rf /tmp/ktx-src
+	git clone -q --depth 1 -b "v${KTX_VERSION}" https://github.com/KhronosGroup/KTX-Software /tmp/ktx-src
+	cmake -S /tmp/ktx-src -B /tmp/ktx-src/build -DCMAKE_BUILD_TYPE=Release \
+		-DKTX_FEATURE_TOOLS=OFF -DKTX_FEATURE_TESTS=OFF \
+		-DCMAKE_INSTALL_PREFIX="$(pwd)/${KTX_DEST}" > /dev/null
+	cmake --build /tmp/ktx-src/build --target install -j 8 > /dev/null
+	rm -rf /tmp/ktx-src
+	echo "libktx installed"
+fi
+
+# --- stb_vorbis (Ogg Vorbis decoding for src/audio), single file ---
+STB_VORBIS="deps/stb/stb_vorbis.c"
+if [ -f "$STB_VORBIS" ]; then
+	echo "stb_vorbis already at ${STB_VORBIS}"
+else
+	echo "Downloading stb_vorbis..."
+	mkdir -p deps/stb
+	curl -sSfL https://raw.githubusercontent.com/nothings/stb/master/stb_vorbis.c -o "$STB_VORBIS"
+	echo "stb_vorbis installed"
+fi
+
+# --- stb_truetype (glyph rasterization for src/render/text), single file ---
+STB_TRUETYPE="deps/stb/stb_truetype.h"
+if [ -f "$STB_TRUETYPE" ]; then
+	echo "stb_truetype already at ${STB_TRUETYPE}"
+else
+	echo "Downloading stb_truetype..."
+	mkdir -p deps/stb
+	curl -sSfL https://raw.githubusercontent.com/nothings/stb/master/stb_truetype.h -o "$STB_TRUETYPE"
+	echo "stb_truetype installed"
+fi
+
 # --- sdl3webgpu (pre-compile, needs ObjC on macOS) ---
 SDL3WEBGPU_OBJ="deps/sdl3webgpu/sdl3webgpu.o"
 if [ -f "$SDL3WEBGPU_OBJ" ]; then
@@ -0,0 +1,660 @@
+// Void Anim — Skeletal animation runtime
+
+#include "skeleton.h"
+#include "../core/jobs.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- 4-wide float vectors (SSE2 / NEON / scalar fallback) ---
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+typedef __m128 v4;
+static inline v4 v4_load(const float *p) { return _mm_loadu_ps(p); }
+static inline void v4_store(float *p, v4 a) { _mm_storeu_ps(p, a); }
+static inline v4 v4_splat(float s) { return _mm_set1_ps(s); }
+static inline v4 v4_add(v4 a, v4 b) { return _mm_add_ps(a, b); }
+static inline v4 v4_sub(v4 a, v4 b) { return _mm_sub_ps(a, b); }
+static inline v4 v4_mul(v4 a, v4 b) { return _mm_mul_ps(a, b); }
+static inline v4 v4_max(v4 a, v4 b) { return _mm_max_ps(a, b); }
+static inline v4 v4_madd(v4 a, v4 b, v4 c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+// a with its sign flipped in the lanes where s is negative
+static inline v4 v4_flip_sign(v4 a, v4 s) { return _mm_xor_ps(a, _mm_and_ps(s, _mm_set1_ps(-0.0f))); }
+static inline v4 v4_rsqrt(v4 a) { return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(a)); }
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+typedef float32x4_t v4;
+static inline v4 v4_load(const float *p) { return vld1q_f32(p); }
+static inline void v4_store(float *p, v4 a) { vst1q_f32(p, a); }
+static inline v4 v4_splat(float s) { return vdupq_n_f32(s); }
+static inline v4 v4_add(v4 a, v4 b) { return vaddq_f32(a, b); }
+static inline v4 v4_sub(v4 a, v4 b) { return vsubq_f32(a, b); }
+static inline v4 v4_mul(v4 a, v4 b) { return vmulq_f32(a, b); }
+static inline v4 v4_max(v4 a, v4 b) { return vmaxq_f32(a, b); }
+static inline v4 v4_madd(v4 a, v4 b, v4 c) { return vmlaq_f32(c, a, b); }
+static inline v4 v4_flip_sign(v4 a, v4 s) {
+	uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(s), vdupq_n_u32(0x80000000u));
+	return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a), sign));
+}
+static inline v4 v4_rsqrt(v4 a) {
+	// Estimate + two Newton-Raphson steps (~full float precision)
+	v4 e = vrsqrteq_f32(a);
+	e = vmulq_f32(e, vrsqrtsq_f32(vmulq_f32(a, e), e));
+	return vmulq_f32(e, vrsqrtsq_f32(vmulq_f32(a, e), e));
+}
+#else
+typedef struct { float f[4]; } v4;
+static inline v4 v4_load(const float *p) { v4 r; memcpy(r.f, p, sizeof(r.f)); return r; }
+static inline void v4_store(float *p, v4 a) { memcpy(p, a.f, sizeof(a.f)); }
+static inline v4 v4_splat(float s) { v4 r = {{ s, s, s, s }}; return r; }
+#define V4_LANES(expr) v4 r; for (int i = 0; i < 4; i++) r.f[i] = (expr); return r
+static inline v4 v4_add(v4 a, v4 b) { V4_LANES(a.f[i] + b.f[i]); }
+static inline v4 v4_sub(v4 a, v4 b) { V4_LANES(a.f[i] - b.f[i]); }
+static inline v4 v4_mul(v4 a, v4 b) { V4_LANES(a.f[i] * b.f[i]); }
+static inline v4 v4_max(v4 a, v4 b) { V4_LANES(a.f[i] > b.f[i] ? a.f[i] : b.f[i]); }
+static inline v4 v4_madd(v4 a, v4 b, v4 c) { V4_LANES(a.f[i] * b.f[i] + c.f[i]); }
+static inline v4 v4_flip_sign(v4 a, v4 s) { V4_LANES(signbit(s.f[i]) ? -a.f[i] : a.f[i]); }
+static inline v4 v4_rsqrt(v4 a) { V4_LANES(1.0f / sqrtf(a.f[i])); }
+#endif
+
+// --- Skeleton ---
+
+typedef struct Skeleton {
+	uint32_t joint_count;
+	uint32_t padded;         // joint_count rounded up to 4 (SoA lanes)
+	int32_t *parents;
+	float   *inverse_bind;   // 3x4 row-major per joint
+} Skeleton;
+
+// Column-major mat4 -> 3x4 row-major affine
+static void mat4_to_34(float *out, const float *m) {
+	for (int r = 0; r < 3; r++) {
+		for (int c = 0; c < 4; c++) out[r * 4 + c] = m[c * 4 + r];
+	}
+}
+
+void *void_anim_skeleton_create(uint32_t joint_count, const int32_t *parents,
+	const float *inverse_bind
+) {
+	if (joint_count == 0) return NULL;
+	for (uint32_t j = 0; j < joint_count; j++) {
+		if (parents[j] >= (int32_t)j) {
+			fprintf(stderr, "void_anim: joint %u has parent %d; parents must come first\n", j, parents[j]);
+			return NULL;
+		}
+	}
+	Skeleton *s = calloc(1, sizeof(Skeleton));
+	s->joint_count = joint_count;
+	s->padded = (joint_count + 3) & ~3u;
+	s->parents = malloc(joint_count * sizeof(int32_t));
+	memcpy(s->parents, parents, joint_count * sizeof(int32_t));
+	s->inverse_bind = malloc(joint_count * VOID_ANIM_PALETTE_FLOATS * sizeof(float));
+	for (uint32_t j = 0; j < joint_count; j++) {
+		mat4_to_34(s->inverse_bind + j * VOID_ANIM_PALETTE_FLOATS, inverse_bind + j * 16);
+	}
+	return s;
+}
+
+void void_anim_skeleton_destroy(void *skeleton) {
+	Skeleton *s = (Skeleton *)skeleton;
+	if (!s) return;
+	free(s->parents);
+	free(s->inverse_bind);
+	free(s);
+}
+
+uint32_t void_anim_skeleton_joint_count(void *skeleton) {
+	return ((Skeleton *)skeleton)->joint_count;
+}
+
+// --- Clips ---
+
+#define SAMPLE_FLOATS 10         // t xyz, q xyzw, s xyz
+#define QUANT_MAX     32767.0f   // 15 bits per component
+#define SQRT1_2       0.70710678f
+
+typedef struct Track {
+	uint32_t first;
+	uint32_t count;
+} Track;
+
+typedef struct VecKey {
+	uint16_t frame;
+	uint16_t pad;
+	float    v[3];
+} VecKey;
+
+typedef struct Clip {
+	uint32_t joint_count;
+	uint32_t frame_count;
+	float    fps;
+	float    duration;
+	Track   *translation;    // per joint, into vec_keys
+	Track   *scale;          // per joint, into vec_keys
+	Track   *rotation;       // per joint, into rot_keys
+	VecKey  *vec_keys;
+	uint32_t vec_key_count;
+	// frame(16) | largest component(2) | three smallest (3 x 15)
+	uint64_t *rot_keys;
+	uint32_t rot_key_count;
+} Clip;
+
+static uint64_t quat_pack(const float *q, uint32_t frame) {
+	uint32_t largest = 0;
+	for (uint32_t i = 1; i < 4; i++) {
+		if (fabsf(q[i]) > fabsf(q[largest])) largest = i;
+	}
+	// q and -q are the same rotation: keep the dropped component positive
+	float sign = q[largest] < 0.0f ? -1.0f : 1.0f;
+	uint64_t bits = (uint64_t)frame << 48 | (uint64_t)largest << 45;
+	uint32_t shift = 30;
+	for (uint32_t i = 0; i < 4; i++) {
+		if (i == largest) continue;
+		float v = q[i] * sign * (1.0f / SQRT1_2);   // [-1, 1]
+		if (v < -1.0f) v = -1.0f;
+		if (v > 1.0f) v = 1.0f;
+		bits |= (uint64_t)(uint32_t)lrintf((v * 0.5f + 0.5f) * QUANT_MAX) << shift;
+		shift -= 15;
+	}
+	return bits;
+}
+
+static void quat_unpack(uint64_t bits, float *q) {
+	uint32_t largest = (uint32_t)(bits >> 45) & 3u;
+	uint32_t shift = 30;
+	float sum = 0.0f;
+	for (uint32_t i = 0; i < 4; i++) {
+		if (i == largest) continue;
+		float u = (float)((bits >> shift) & 0x7FFFu) * (1.0f / QUANT_MAX);
+		q[i] = (u * 2.0f - 1.0f) * SQRT1_2;
+		sum += q[i] * q[i];
+		shift -= 15;
+	}
+	q[largest] = sqrtf(fmaxf(1.0f - sum, 0.0f));
+}
+
+static inline uint32_t key_frame(uint64_t bits) {
+	return (uint32_t)(bits >> 48);
+}
+
+// Greedy key reduction over one channel of `dim` floats (at `stride` floats
+// per frame): extend each segment while interpolating its ends reproduces
+// every frame in between within tolerance. Writes kept frame indices.
+static uint32_t reduce_keys(const float *values, uint32_t stride, uint32_t dim,
+	uint32_t frames, float tolerance, int normalize, uint32_t *out
+) {
+	uint32_t count = 0;
+	out[count++] = 0;
+	uint32_t start = 0;
+	while (start + 1 < frames) {
+		uint32_t end = start + 1;
+		while (end + 1 < frames) {
+			uint32_t next = end + 1;
+			int ok = 1;
+			const float *a = values + (size_t)start * stride;
+			const float *b = values + (size_t)next * stride;
+			for (uint32_t f = start + 1; f < next && ok; f++) {
+				float t = (float)(f - start) / (float)(next - start);
+				float v[4], len = 0.0f;
+				for (uint32_t i = 0; i < dim; i++) {
+					v[i] = a[i] + (b[i] - a[i]) * t;
+					len += v[i] * v[i];
+				}
+				float inv = normalize && len > 0.0f ? 1.0f / sqrtf(len) : 1.0f;
+				const float *ref = values + (size_t)f * stride;
+				for (uint32_t i = 0; i < dim; i++) {
+					if (fabsf(v[i] * inv - ref[i]) > tolerance) { ok = 0; break; }
+				}
+			}
+			if (!ok) break;
+			end = next;
+		}
+		out[count++] = end;
+		start = end;
+	}
+
+	// A constant track needs only its first key
+	if (count == 2) {
+		int constant = 1;
+		for (uint32_t f = 1; f < frames && constant; f++) {
+			for (uint32_t i = 0; i < dim; i++) {
+				if (fabsf(values[(size_t)f * stride + i] - values[i]) > tolerance) { constant = 0; break; }
+			}
+		}
+		if (constant) count = 1;
+	}
+	return count;
+}
+
+void *void_anim_clip_create(uint32_t joint_count, uint32_t frame_count, float fps,
+	const float *samples, float tolerance
+) {
+	if (joint_count == 0 || frame_count == 0 || frame_count > 0xFFFF) {
+		fprintf(stderr, "void_anim: clip needs 1..65535 frames and at least one joint\n");
+		return NULL;
+	}
+	Clip *c = calloc(1, sizeof(Clip));
+	c->joint_count = joint_count;
+	c->frame_count = frame_count;
+	c->fps = fps > 0.0f ? fps : 30.0f;
+	c->duration = (float)(frame_count - 1) / c->fps;
+	c->translation = calloc(joint_count, sizeof(Track));
+	c->scale = calloc(joint_count, sizeof(Track));
+	c->rotation = calloc(joint_count, sizeof(Track));
+	c->vec_keys = malloc((size_t)joint_count * 2 * frame_count * sizeof(VecKey));
+	c->rot_keys = malloc((size_t)joint_count * frame_count * sizeof(uint64_t));
+
+	uint32_t *kept = malloc(frame_count * sizeof(uint32_t));
+	float *quats = malloc((size_t)frame_count * 4 * sizeof(float));
+	uint32_t joint_stride = joint_count * SAMPLE_FLOATS;
+
+	for (uint32_t j = 0; j < joint_count; j++) {
+		const float *base = samples + j * SAMPLE_FLOATS;
+
+		// Translation (offset 0) and scale (offset 7)
+		for (uint32_t pass = 0; pass < 2; pass++) {
+			uint32_t offset = pass == 0 ? 0 : 7;
+			Track *track = pass == 0 ? &c->translation[j] : &c->scale[j];
+			uint32_t n = reduce_keys(base + offset, joint_stride, 3, frame_count, tolerance, 0, kept);
+			track->first = c->vec_key_count;
+			track->count = n;
+			for (uint32_t k = 0; k < n; k++) {
+				VecKey *key = &c->vec_keys[c->vec_key_count++];
+				const float *v = base + (size_t)kept[k] * joint_stride + offset;
+				key->frame = (uint16_t)kept[k];
+				key->pad = 0;
+				memcpy(key->v, v, sizeof(key->v));
+			}
+		}
+
+		// Rotation: normalised, signs made continuous so neighbours interpolate
+		// the short way, then reduced and quantized
+		for (uint32_t f = 0; f < frame_count; f++) {
+			const float *q = base + (size_t)f * joint_stride + 3;
+			float len = sqrtf(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+			float inv = len > 0.0f ? 1.0f / len : 0.0f;
+			float *dst = quats + f * 4;
+			for (uint32_t i = 0; i < 4; i++) dst[i] = len > 0.0f ? q[i] * inv : (i == 3 ? 1.0f : 0.0f);
+			if (f > 0) {
+				const float *prev = dst - 4;
+				float d = prev[0] * dst[0] + prev[1] * dst[1] + prev[2] * dst[2] + prev[3] * dst[3];
+				if (d < 0.0f) for (uint32_t i = 0; i < 4; i++) dst[i] = -dst[i];
+			}
+		}
+		uint32_t n = reduce_keys(quats, 4, 4, frame_count, tolerance, 1, kept);
+		c->rotation[j].first = c->rot_key_count;
+		c->rotation[j].count = n;
+		for (uint32_t k = 0; k < n; k++) {
+			c->rot_keys[c->rot_key_count++] = quat_pack(quats + kept[k] * 4, kept[k]);
+		}
+	}
+	free(quats);
+	free(kept);
+
+	c->vec_keys = realloc(c->vec_keys, (c->vec_key_count ? c->vec_key_count : 1) * sizeof(VecKey));
+	c->rot_keys = realloc(c->rot_keys, (c->rot_key_count ? c->rot_key_count : 1) * sizeof(uint64_t));
+	return c;
+}
+
+void void_anim_clip_destroy(void *clip) {
+	Clip *c = (Clip *)clip;
+	if (!c) return;
+	free(c->translation);
+	free(c->scale);
+	free(c->rotation);
+	free(c->vec_keys);
+	free(c->rot_keys);
+	free(c);
+}
+
+float void_anim_clip_duration(void *clip) {
+	return ((Clip *)clip)->duration;
+}
+
+uint32_t void_anim_clip_key_count(void *clip) {
+	Clip *c = (Clip *)clip;
+	return c->vec_key_count + c->rot_key_count;
+}
+
+uint32_t void_anim_clip_bytes(void *clip) {
+	Clip *c = (Clip *)clip;
+	return (uint32_t)(c->vec_key_count * sizeof(VecKey) + c->rot_key_count * sizeof(uint64_t)
+		+ c->joint_count * 3 * sizeof(Track));
+}
+
+// --- Sampling ---
+
+// Pose channels, each `padded` floats (structure of arrays)
+#define CH_TX 0
+#define CH_QX 3
+#define CH_QW 6
+#define CH_SX 7
+#define POSE_CHANNELS 10
+
+// Last key at or before `frame` (keys sorted by frame, count >= 1)
+static uint32_t find_vec_key(const VecKey *keys, uint32_t count, float frame) {
+	uint32_t lo = 0, hi = count - 1;
+	while (lo < hi) {
+		uint32_t mid = (lo + hi + 1) >> 1;
+		if ((float)keys[mid].frame <= frame) lo = mid; else hi = mid - 1;
+	}
+	return lo;
+}
+
+static uint32_t find_rot_key(const uint64_t *keys, uint32_t count, float frame) {
+	uint32_t lo = 0, hi = count - 1;
+	while (lo < hi) {
+		uint32_t mid = (lo + hi + 1) >> 1;
+		if ((float)key_frame(keys[mid]) <= frame) lo = mid; else hi = mid - 1;
+	}
+	return lo;
+}
+
+static void sample_vec(const Clip *c, const Track *track, float frame, float *pose,
+	uint32_t padded, uint32_t channel, uint32_t joint
+) {
+	const VecKey *keys = c->vec_keys + track->first;
+	uint32_t k = find_vec_key(keys, track->count, frame);
+	const float *a = keys[k].v;
+	float v[3] = { a[0], a[1], a[2] };
+	if (k + 1 < track->count) {
+		const float *b = keys[k + 1].v;
+		float t = (frame - keys[k].frame) / (float)(keys[k + 1].frame - keys[k].frame);
+		for (int i = 0; i < 3; i++) v[i] += (b[i] - a[i]) * t;
+	}
+	for (int i = 0; i < 3; i++) pose[(channel + i) * padded + joint] = v[i];
+}
+
+static void sample_rot(const Clip *c, const Track *track, float frame, float *pose,
+	uint32_t padded, uint32_t joint
+) {
+	const uint64_t *keys = c->rot_keys + track->first;
+	uint32_t k = find_rot_key(keys, track->count, frame);
+	float q[4];
+	quat_unpack(keys[k], q);
+	if (k + 1 < track->count) {
+		// nlerp the short way; the blend normalises afterwards
+		float b[4];
+		quat_unpack(keys[k + 1], b);
+		uint32_t fa = key_frame(keys[k]), fb = key_frame(keys[k + 1]);
+		float t = (frame - (float)fa) / (float)(fb - fa);
+		float d = q[0] * b[0] + q[1] * b[1] + q[2] * b[2] + q[3] * b[3];
+		float sb = d < 0.0f ? -t : t;
+		for (int i = 0; i < 4; i++) q[i] = q[i] * (1.0f - t) + b[i] * sb;
+	}
+	for (int i = 0; i < 4; i++) pose[(CH_QX + i) * padded + joint] = q[i];
+}
+
+// Local pose of every joint at `time` (looping) into SoA `pose`
+static void sample_clip(const Clip *c, float time, float *pose, uint32_t padded) {
+	float frame = 0.0f;
+	if (c->duration > 0.0f) {
+		float t = fmodf(time, c->duration);
+		if (t < 0.0f) t += c->duration;
+		frame = t * c->fps;
+	}
+	for (uint32_t j = 0; j < c->joint_count; j++) {
+		sample_vec(c, &c->translation[j], frame, pose, padded, CH_TX, j);
+		sample_rot(c, &c->rotation[j], frame, pose, padded, j);
+		sample_vec(c, &c->scale[j], frame, pose, padded, CH_SX, j);
+	}
+}
+
+// --- Crowd ---
+
+typedef struct Layer {
+	Clip *clip;
+	float time;
+	float speed;
+	float weight;
+} Layer;
+
+typedef struct Crowd {
+	Skeleton *skeleton;
+	uint32_t  capacity;
+	uint32_t  count;
+	Layer    *layers;        // capacity x VOID_ANIM_MAX_LAYERS
+	float    *palettes;      // capacity x joints x 12
+
+	// Per-thread scratch (indexed by job worker)
+	uint32_t  scratch_threads;
+	size_t    scratch_floats;
+	float    *scratch;
+} Crowd;
+
+void *void_anim_crowd_create(void *skeleton, uint32_t capacity) {
+	Skeleton *s = (Skeleton *)skeleton;
+	Crowd *c = calloc(1, sizeof(Crowd));
+	c->skeleton = s;
+	c->capacity = capacity;
+	c->layers = calloc((size_t)capacity * VOID_ANIM_MAX_LAYERS, sizeof(Layer));
+	c->palettes = calloc((size_t)capacity * s->joint_count * VOID_ANIM_PALETTE_FLOATS, sizeof(float));
+	// Two SoA poses (blended + one layer's sample) and local + model matrices
+	c->scratch_floats = (size_t)s->padded * POSE_CHANNELS * 2
+		+ (size_t)s->joint_count * VOID_ANIM_PALETTE_FLOATS * 2;
+	return c;
+}
+
+void void_anim_crowd_destroy(void *crowd) {
+	Crowd *c = (Crowd *)crowd;
+	if (!c) return;
+	free(c->layers);
+	free(c->palettes);
+	free(c->scratch);
+	free(c);
+}
+
+uint32_t void_anim_crowd_add(void *crowd) {
+	Crowd *c = (Crowd *)crowd;
+	if (c->count >= c->capacity) return VOID_ANIM_NONE;
+	return c->count++;
+}
+
+uint32_t void_anim_crowd_count(void *crowd) {
+	return ((Crowd *)crowd)->count;
+}
+
+void void_anim_crowd_set_layer(void *crowd, uint32_t instance, uint32_t layer,
+	void *clip, float time, float speed, float weight
+) {
+	Crowd *c = (Crowd *)crowd;
+	if (instance >= c->count || layer >= VOID_ANIM_MAX_LAYERS) return;
+	Clip *cl = (Clip *)clip;
+	if (cl && cl->joint_count != c->skeleton->joint_count) {
+		fprintf(stderr, "void_anim: clip has %u joints, skeleton has %u\n",
+			cl->joint_count, c->skeleton->joint_count);
+		cl = NULL;
+	}
+	Layer *l = &c->layers[instance * VOID_ANIM_MAX_LAYERS + layer];
+	l->clip = cl;
+	l->time = time;
+	l->speed = speed;
+	l->weight = weight;
+}
+
+void void_anim_crowd_set_weight(void *crowd, uint32_t instance, uint32_t layer, float weight) {
+	Crowd *c = (Crowd *)crowd;
+	if (instance >= c->count || layer >= VOID_ANIM_MAX_LAYERS) return;
+	c->layers[instance * VOID_ANIM_MAX_LAYERS + layer].weight = weight;
+}
+
+float void_anim_crowd_time(void *crowd, uint32_t instance, uint32_t layer) {
+	Crowd *c = (Crowd *)crowd;
+	if (instance >= c->count || layer >= VOID_ANIM_MAX_LAYERS) return 0.0f;
+	return c->layers[instance * VOID_ANIM_MAX_LAYERS + layer].time;
+}
+
+// acc += w x sample, quaternions sign-aligned with what is accumulated so far
+static void blend_layer(float *acc, const float *sample, uint32_t padded, float weight) {
+	v4 w = v4_splat(weight);
+	for (uint32_t j = 0; j < padded; j += 4) {
+		for (uint32_t ch = CH_TX; ch < CH_TX + 3; ch++) {
+			float *a = acc + ch * padded + j;
+			v4_store(a, v4_madd(v4_load(sample + ch * padded + j), w, v4_load(a)));
+		}
+		for (uint32_t ch = CH_SX; ch < CH_SX + 3; ch++) {
+			float *a = acc + ch * padded + j;
+			v4_store(a, v4_madd(v4_load(sample + ch * padded + j), w, v4_load(a)));
+		}
+		v4 q[4], a[4];
+		v4 d = v4_splat(0.0f);
+		for (int i = 0; i < 4; i++) {
+			q[i] = v4_load(sample + (CH_QX + i) * padded + j);
+			a[i] = v4_load(acc + (CH_QX + i) * padded + j);
+			d = v4_madd(q[i], a[i], d);
+		}
+		v4 ws = v4_flip_sign(w, d);
+		for (int i = 0; i < 4; i++) {
+			v4_store(acc + (CH_QX + i) * padded + j, v4_madd(q[i], ws, a[i]));
+		}
+	}
+}
+
+// Normalise the blend and build 3x4 local matrices (4 joints per step)
+static void local_matrices(const float *pose, uint32_t padded, float inv_weight,
+	uint32_t joint_count, float *local
+) {
+	v4 iw = v4_splat(inv_weight);
+	v4 one = v4_splat(1.0f);
+	v4 two = v4_splat(2.0f);
+	for (uint32_t j = 0; j < padded; j += 4) {
+		v4 tx = v4_mul(v4_load(pose + (CH_TX + 0) * padded + j), iw);
+		v4 ty = v4_mul(v4_load(pose + (CH_TX + 1) * padded + j), iw);
+		v4 tz = v4_mul(v4_load(pose + (CH_TX + 2) * padded + j), iw);
+		v4 sx = v4_mul(v4_load(pose + (CH_SX + 0) * padded + j), iw);
+		v4 sy = v4_mul(v4_load(pose + (CH_SX + 1) * padded + j), iw);
+		v4 sz = v4_mul(v4_load(pose + (CH_SX + 2) * padded + j), iw);
+		v4 qx = v4_load(pose + (CH_QX + 0) * padded + j);
+		v4 qy = v4_load(pose + (CH_QX + 1) * padded + j);
+		v4 qz = v4_load(pose + (CH_QX + 2) * padded + j);
+		v4 qw = v4_load(pose + (CH_QW) * padded + j);
+		v4 len2 = v4_madd(qx, qx, v4_madd(qy, qy, v4_madd(qz, qz, v4_mul(qw, qw))));
+		v4 inv = v4_rsqrt(v4_max(len2, v4_splat(1e-12f)));
+		qx = v4_mul(qx, inv); qy = v4_mul(qy, inv); qz = v4_mul(qz, inv); qw = v4_mul(qw, inv);
+
+		v4 xx = v4_mul(qx, qx), yy = v4_mul(qy, qy), zz = v4_mul(qz, qz);
+		v4 xy = v4_mul(qx, qy), xz = v4_mul(qx, qz), yz = v4_mul(qy, qz);
+		v4 wx = v4_mul(qw, qx), wy = v4_mul(qw, qy), wz = v4_mul(qw, qz);
+
+		// Rows of R x S, translation in the 4th column
+		v4 m[12];
+		m[0]  = v4_mul(v4_sub(one, v4_mul(two, v4_add(yy, zz))), sx);
+		m[1]  = v4_mul(v4_mul(two, v4_sub(xy, wz)), sy);
+		m[2]  = v4_mul(v4_mul(two, v4_add(xz, wy)), sz);
+		m[3]  = tx;
+		m[4]  = v4_mul(v4_mul(two, v4_add(xy, wz)), sx);
+		m[5]  = v4_mul(v4_sub(one, v4_mul(two, v4_add(xx, zz))), sy);
+		m[6]  = v4_mul(v4_mul(two, v4_sub(yz, wx)), sz);
+		m[7]  = ty;
+		m[8]  = v4_mul(v4_mul(two, v4_sub(xz, wy)), sx);
+		m[9]  = v4_mul(v4_mul(two, v4_add(yz, wx)), sy);
+		m[10] = v4_mul(v4_sub(one, v4_mul(two, v4_add(xx, yy))), sz);
+		m[11] = tz;
+
+		float lanes[12][4];
+		for (int e = 0; e < 12; e++) v4_store(lanes[e], m[e]);
+		for (uint32_t l = 0; l < 4 && j + l < joint_count; l++) {
+			float *dst = local + (j + l) * VOID_ANIM_PALETTE_FLOATS;
+			for (int e = 0; e < 12; e++) dst[e] = lanes[e][l];
+		}
+	}
+}
+
+// out = a x b (3x4 affine, implicit last row 0 0 0 1); out must not alias b
+static void mul34(float *out, const float *a, const float *b) {
+	static const float unit_w[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+	v4 b0 = v4_load(b), b1 = v4_load(b + 4), b2 = v4_load(b + 8);
+	v4 b3 = v4_load(unit_w);
+	for (int r = 0; r < 3; r++) {
+		const float *ar = a + r * 4;
+		v4 row = v4_mul(v4_splat(ar[3]), b3);
+		row = v4_madd(v4_splat(ar[0]), b0, row);
+		row = v4_madd(v4_splat(ar[1]), b1, row);
+		row = v4_madd(v4_splat(ar[2]), b2, row);
+		v4_store(out + r * 4, row);
+	}
+}
+
+static void update_instance(Crowd *c, uint32_t instance, float *scratch) {
+	const Skeleton *s = c->skeleton;
+	uint32_t padded = s->padded;
+	float *acc = scratch;
+	float *sample = acc + (size_t)padded * POSE_CHANNELS;
+	float *local = sample + (size_t)padded * POSE_CHANNELS;
+	float *model = local + (size_t)s->joint_count * VOID_ANIM_PALETTE_FLOATS;
+	float *palette = c->palettes + (size_t)instance * s->joint_count * VOID_ANIM_PALETTE_FLOATS;
+
+	memset(acc, 0, (size_t)padded * POSE_CHANNELS * sizeof(float));
+	// Padding lanes sample as identity so the vector math stays finite
+	for (uint32_t j = s->joint_count; j < padded; j++) {
+		for (uint32_t ch = 0; ch < POSE_CHANNELS; ch++) sample[ch * padded + j] = 0.0f;
+		sample[CH_QW * padded + j] = 1.0f;
+	}
+
+	float total = 0.0f;
+	const Layer *layers = c->layers + (size_t)instance * VOID_ANIM_MAX_LAYERS;
+	for (uint32_t l = 0; l < VOID_ANIM_MAX_LAYERS; l++) {
+		if (!layers[l].clip || layers[l].weight <= 0.0f) continue;
+		sample_clip(layers[l].clip, layers[l].time, sample, padded);
+		blend_layer(acc, sample, padded, layers[l].weight);
+		total += layers[l].weight;
+	}
+
+	// No active layer: bind pose
+	if (total <= 0.0f) {
+		for (uint32_t j = 0; j < s->joint_count; j++) {
+			float *p = palette + j * VOID_ANIM_PALETTE_FLOATS;
+			memset(p, 0, VOID_ANIM_PALETTE_FLOATS * sizeof(float));
+			p[0] = p[5] = p[10] = 1.0f;
+		}
+		return;
+	}
+
+	local_matrices(acc, padded, 1.0f / total, s->joint_count, local);
+	for (uint32_t j = 0; j < s->joint_count; j++) {
+		float *m = model + j * VOID_ANIM_PALETTE_FLOATS;
+		const float *l = local + j * VOID_ANIM_PALETTE_FLOATS;
+		if (s->parents[j] < 0) {
+			memcpy(m, l, VOID_ANIM_PALETTE_FLOATS * sizeof(float));
+		} else {
+			mul34(m, model + s->parents[j] * VOID_ANIM_PALETTE_FLOATS, l);
+		}
+		mul34(palette + j * VOID_ANIM_PALETTE_FLOATS, m, s->inverse_bind + j * VOID_ANIM_PALETTE_FLOATS);
+	}
+}
+
+static void update_range(void *ctx, uint32_t begin, uint32_t end, uint32_t worker) {
+	Crowd *c = (Crowd *)ctx;
+	float *scratch = c->scratch + worker * c->scratch_floats;
+	for (uint32_t i = begin; i < end; i++) update_instance(c, i, scratch);
+}
+
+void void_anim_crowd_update(void *crowd, float dt) {
+	Crowd *c = (Crowd *)crowd;
+	if (c->count == 0) return;
+
+	for (uint32_t i = 0; i < c->count * VOID_ANIM_MAX_LAYERS; i++) {
+		Layer *l = &c->layers[i];
+		if (!l->clip) continue;
+		l->time += dt * l->speed;
+		// Keep the time near the loop so float precision never degrades
+		if (l->clip->duration > 0.0f && fabsf(l->time) > l->clip->duration) {
+			l->time = fmodf(l->time, l->clip->duration);
+		}
+	}
+
+	uint32_t threads = void_jobs_thread_count();
+	if (threads > c->scratch_threads) {
+		free(c->scratch);
+		c->scratch = malloc(threads * c->scratch_floats * sizeof(float));
+		c->scratch_threads = threads;
+	}
+	void_jobs_parallel_for(c->count, 8, update_range, c);
+}
+
+const float *void_anim_crowd_palettes(void *crowd) {
+	return ((Crowd *)crowd)->palettes;
+}
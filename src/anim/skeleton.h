@@ -0,0 +1,62 @@
+// Void Anim — Skeletal animation runtime
+// Skeleton: joint hierarchy + inverse bind matrices.
+// Clip: per-joint translation / rotation / scale tracks, compressed at
+// creation: keys that linear (nlerp for rotations) interpolation of their
+// neighbours reproduces within `tolerance` are dropped, and rotation keys
+// are quantized to 48 bits (smallest three components, 15 bits each).
+// Crowd: many instances of one skeleton, each blending up to
+// VOID_ANIM_MAX_LAYERS clips. update() samples, blends (4 joints at a time
+// with SSE / NEON), walks the hierarchy and writes every instance's joint
+// palette into one array, spread over the job pool.
+//
+// Palettes are 3x4 row-major affine matrices (12 floats per joint,
+// instance-major), ready for one upload into a shared storage buffer
+// (see src/render/skinning).
+
+#ifndef VOID_ANIM_SKELETON_H
+#define VOID_ANIM_SKELETON_H
+
+#include <stdint.h>
+
+#define VOID_ANIM_MAX_LAYERS 4
+#define VOID_ANIM_PALETTE_FLOATS 12   // per joint
+#define VOID_ANIM_NONE 0xFFFFFFFFu
+
+// --- Skeleton ---
+// parents[j] < j (-1 = root); inverse_bind: joint_count column-major mat4s.
+// NULL on an invalid hierarchy.
+void *void_anim_skeleton_create(uint32_t joint_count, const int32_t *parents,
+    const float *inverse_bind);
+void  void_anim_skeleton_destroy(void *skeleton);
+uint32_t void_anim_skeleton_joint_count(void *skeleton);
+
+// --- Clips ---
+// samples: frame_count x joint_count x 10 floats, frame-major:
+// translation xyz, rotation quaternion xyzw, scale xyz.
+// Loops over (frame_count - 1) / fps seconds.
+void *void_anim_clip_create(uint32_t joint_count, uint32_t frame_count, float fps,
+    const float *samples, float tolerance);
+void  void_anim_clip_destroy(void *clip);
+float void_anim_clip_duration(void *clip);
+// Keys kept after reduction (all tracks) and their storage size
+uint32_t void_anim_clip_key_count(void *clip);
+uint32_t void_anim_clip_bytes(void *clip);
+
+// --- Crowd ---
+void *void_anim_crowd_create(void *skeleton, uint32_t capacity);
+void  void_anim_crowd_destroy(void *crowd);
+// New instance (all layers off = bind pose); VOID_ANIM_NONE when full
+uint32_t void_anim_crowd_add(void *crowd);
+uint32_t void_anim_crowd_count(void *crowd);
+// clip NULL or weight 0 disables the layer. Time advances by dt x speed
+// on every update. Weights are normalised across layers.
+void void_anim_crowd_set_layer(void *crowd, uint32_t instance, uint32_t layer,
+    void *clip, float time, float speed, float weight);
+void void_anim_crowd_set_weight(void *crowd, uint32_t instance, uint32_t layer, float weight);
+float void_anim_crowd_time(void *crowd, uint32_t instance, uint32_t layer);
+// Advance, sample, blend and rebuild every palette
+void void_anim_crowd_update(void *crowd, float dt);
+// count x joint_count x VOID_ANIM_PALETTE_FLOATS floats
+const float *void_anim_crowd_palettes(void *crowd);
+
+#endif
@@ -1,13 +1,20 @@
 // Void Asset — Image loading via stb_image
 
 #include "image.h"
+#include "../core/trace.h"
+
+#include <SDL3/SDL.h>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "../../deps/stb/stb_image.h"
 
+#include <stdlib.h>
+#include <string.h>
+
 static int s_width = 0, s_height = 0;
 
 void *void_load_image(const char *path, int desired_channels) {
+	VOID_TRACE_SCOPE("load_image");
 	int channels;
 	unsigned char *data = stbi_load(path, &s_width, &s_height, &channels, desired_channels);
 	return (void *)data;
@@ -19,3 +26,79 @@ int void_image_height(void) { return s_height; }
 void void_free_image(void *data) {
 	if (data) stbi_image_free(data);
 }
+
+// --- Background decode ---
+
+typedef struct ImageDecode {
+	SDL_Thread *thread;
+	SDL_AtomicInt done;
+	char *path;
+	int channels;
+	int width, height;
+	unsigned char *pixels;      // handed to the caller by wait
+	uint64_t start_ns, end_ns;
+} ImageDecode;
+
+static void decode_run(ImageDecode *d) {
+	d->start_ns = SDL_GetTicksNS();
+	{
+		VOID_TRACE_SCOPE("decode_image");
+		int channels;
+		d->pixels = stbi_load(d->path, &d->width, &d->height, &channels, d->channels);
+	}
+	d->end_ns = SDL_GetTicksNS();
+	SDL_SetAtomicInt(&d->done, 1);
+}
+
+static int decode_main(void *userdata) {
+	void_trace_thread_name("image_decode");
+	decode_run((ImageDecode *)userdata);
+	return 0;
+}
+
+void *void_image_decode_start(const char *path, int desired_channels) {
+	ImageDecode *d = (ImageDecode *)calloc(1, sizeof(ImageDecode));
+	if (!d) return NULL;
+	size_t len = strlen(path) + 1;
+	d->path = (char *)malloc(len);
+	if (!d->path) { free(d); return NULL; }
+	memcpy(d->path, path, len);
+	d->channels = desired_channels;
+	d->thread = SDL_CreateThread(decode_main, "void_image", d);
+	if (!d->thread) decode_run(d);
+	return d;
+}
+
+int void_image_decode_done(void *decode) {
+	ImageDecode *d = (ImageDecode *)decode;
+	return d ? SDL_GetAtomicInt(&d->done) : 1;
+}
+
+void *void_image_decode_wait(void *decode) {
+	ImageDecode *d = (ImageDecode *)decode;
+	if (!d) return NULL;
+	if (d->thread) {
+		SDL_WaitThread(d->thread, NULL);
+		d->thread = NULL;
+	}
+	void *pixels = d->pixels;
+	d->pixels = NULL;
+	if (pixels) {
+		s_width = d->width;
+		s_height = d->height;
+	}
+	return pixels;
+}
+
+int void_image_decode_width(void *decode) { return decode ? ((ImageDecode *)decode)->width : 0; }
+int void_image_decode_height(void *decode) { return decode ? ((ImageDecode *)decode)->height : 0; }
+uint64_t void_image_decode_start_ns(void *decode) { return decode ? ((ImageDecode *)decode)->start_ns : 0; }
+uint64_t void_image_decode_end_ns(void *decode) { return decode ? ((ImageDecode *)decode)->end_ns : 0; }
+
+void void_image_decode_release(void *decode) {
+	ImageDecode *d = (ImageDecode *)decode;
+	if (!d) return;
+	void_free_image(void_image_decode_wait(d));
+	free(d->path);
+	free(d);
+}
@@ -3,9 +3,28 @@
 #ifndef VOID_ASSET_IMAGE_H
 #define VOID_ASSET_IMAGE_H
 
+#include <stdint.h>
+
 void *void_load_image(const char *path, int desired_channels);
 int void_image_width(void);
 int void_image_height(void);
 void void_free_image(void *data);
 
+// --- Background decode ---
+// Loads and decodes on its own thread so startup can overlap file I/O and
+// decoding with GPU setup. start never blocks (it decodes inline only if
+// the thread cannot be created); wait joins the thread and returns the
+// pixels, owned by the caller (void_free_image), or NULL on failure. It
+// also sets void_image_width/height like a sync load. The decode handle
+// stays valid for the getters until release.
+void *void_image_decode_start(const char *path, int desired_channels);
+int   void_image_decode_done(void *decode);
+void *void_image_decode_wait(void *decode);
+int   void_image_decode_width(void *decode);
+int   void_image_decode_height(void *decode);
+// Decode thread start / finish (SDL_GetTicksNS clock)
+uint64_t void_image_decode_start_ns(void *decode);
+uint64_t void_image_decode_end_ns(void *decode);
+void  void_image_decode_release(void *decode);
+
 #endif
@@ -0,0 +1,311 @@
+// Void Asset — KTX2 textures via libktx
+
+#include "ktx2.h"
+#include "../core/jobs.h"
+#include "../core/trace.h"
+#include "../gpu/dawn.h"
+#include "../gpu/enums.h"
+
+#include <ktx.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- Types ---
+
+typedef struct KtxImage {
+	ktxTexture2 *texture;
+	uint32_t     format;
+	uint32_t     width, height;
+	uint32_t     levels;
+	int          transcoded;
+} KtxImage;
+
+// Vulkan formats a file may already be in
+typedef struct VkFormatMap {
+	uint32_t vk_format;
+	uint32_t format;
+	uint32_t family;    // 0 = always available
+} VkFormatMap;
+
+static const VkFormatMap s_vk_formats[] = {
+	{  37, FMT_RGBA8_UNORM,      0 },
+	{  43, FMT_RGBA8_UNORM_SRGB, 0 },
+	{ 131, FMT_BC1_RGBA_UNORM,   VOID_GPU_COMPRESSION_BC },   // BC1 RGB
+	{ 132, FMT_BC1_RGBA_SRGB,    VOID_GPU_COMPRESSION_BC },
+	{ 133, FMT_BC1_RGBA_UNORM,   VOID_GPU_COMPRESSION_BC },
+	{ 134, FMT_BC1_RGBA_SRGB,    VOID_GPU_COMPRESSION_BC },
+	{ 137, FMT_BC3_RGBA_UNORM,   VOID_GPU_COMPRESSION_BC },
+	{ 138, FMT_BC3_RGBA_SRGB,    VOID_GPU_COMPRESSION_BC },
+	{ 139, FMT_BC4_R_UNORM,      VOID_GPU_COMPRESSION_BC },
+	{ 141, FMT_BC5_RG_UNORM,     VOID_GPU_COMPRESSION_BC },
+	{ 145, FMT_BC7_RGBA_UNORM,   VOID_GPU_COMPRESSION_BC },
+	{ 146, FMT_BC7_RGBA_SRGB,    VOID_GPU_COMPRESSION_BC },
+	{ 147, FMT_ETC2_RGB8_UNORM,  VOID_GPU_COMPRESSION_ETC2 },
+	{ 148, FMT_ETC2_RGB8_SRGB,   VOID_GPU_COMPRESSION_ETC2 },
+	{ 151, FMT_ETC2_RGBA8_UNORM, VOID_GPU_COMPRESSION_ETC2 },
+	{ 152, FMT_ETC2_RGBA8_SRGB,  VOID_GPU_COMPRESSION_ETC2 },
+	{ 155, FMT_EAC_RG11_UNORM,   VOID_GPU_COMPRESSION_ETC2 },
+	{ 157, FMT_ASTC_4X4_UNORM,   VOID_GPU_COMPRESSION_ASTC },
+	{ 158, FMT_ASTC_4X4_SRGB,    VOID_GPU_COMPRESSION_ASTC },
+};
+
+// --- Format choice ---
+
+// Transcode target for a Basis payload; returns the Dawn format
+static uint32_t pick_target(ktxTexture2 *t, uint32_t families, ktx_transcode_fmt_e *target) {
+	int srgb = ktxTexture2_GetOETF(t) == KHR_DF_TRANSFER_SRGB;
+	uint32_t components = ktxTexture2_GetNumComponents(t);
+	int etc1s = t->supercompressionScheme == KTX_SS_BASIS_LZ;
+
+	// Block formats need the base level in whole blocks
+	if (t->baseWidth % 4 != 0 || t->baseHeight % 4 != 0) families = 0;
+
+	if (components == 2) {
+		if (families & VOID_GPU_COMPRESSION_BC) { *target = KTX_TTF_BC5_RG; return FMT_BC5_RG_UNORM; }
+		if (families & VOID_GPU_COMPRESSION_ETC2) { *target = KTX_TTF_ETC2_EAC_RG11; return FMT_EAC_RG11_UNORM; }
+	} else if (etc1s && components < 4) {
+		if (families & VOID_GPU_COMPRESSION_BC) {
+			*target = KTX_TTF_BC1_RGB;
+			return srgb ? FMT_BC1_RGBA_SRGB : FMT_BC1_RGBA_UNORM;
+		}
+		// ETC1 blocks are valid ETC2 RGB8 blocks
+		if (families & VOID_GPU_COMPRESSION_ETC2) {
+			*target = KTX_TTF_ETC1_RGB;
+			return srgb ? FMT_ETC2_RGB8_SRGB : FMT_ETC2_RGB8_UNORM;
+		}
+	} else {
+		if (families & VOID_GPU_COMPRESSION_BC) {
+			*target = KTX_TTF_BC7_RGBA;
+			return srgb ? FMT_BC7_RGBA_SRGB : FMT_BC7_RGBA_UNORM;
+		}
+		if (families & VOID_GPU_COMPRESSION_ETC2) {
+			*target = KTX_TTF_ETC2_RGBA;
+			return srgb ? FMT_ETC2_RGBA8_SRGB : FMT_ETC2_RGBA8_UNORM;
+		}
+	}
+	if (families & VOID_GPU_COMPRESSION_ASTC) {
+		*target = KTX_TTF_ASTC_4x4_RGBA;
+		return srgb ? FMT_ASTC_4X4_SRGB : FMT_ASTC_4X4_UNORM;
+	}
+	*target = KTX_TTF_RGBA32;
+	return srgb ? FMT_RGBA8_UNORM_SRGB : FMT_RGBA8_UNORM;
+}
+
+// Dawn format of an untranscoded payload, 0 if unsupported here
+static uint32_t map_vk_format(uint32_t vk_format, uint32_t families) {
+	for (size_t i = 0; i < sizeof(s_vk_formats) / sizeof(s_vk_formats[0]); i++) {
+		const VkFormatMap *m = &s_vk_formats[i];
+		if (m->vk_format != vk_format) continue;
+		return (m->family == 0 || (families & m->family)) ? m->format : 0;
+	}
+	return 0;
+}
+
+// --- Loading ---
+
+// Reads and parses the file; pre-encoded payloads get their format here,
+// Basis payloads are left for transcode(). Safe on any thread.
+static KtxImage *open_image(const char *path, uint32_t families) {
+	ktxTexture2 *t = NULL;
+	KTX_error_code err = ktxTexture2_CreateFromNamedFile(path,
+		KTX_TEXTURE_CREATE_LOAD_IMAGE_DATA_BIT, &t);
+	if (err != KTX_SUCCESS) {
+		fprintf(stderr, "void_ktx2: %s: %s\n", path, ktxErrorString(err));
+		return NULL;
+	}
+	if (t->numDimensions != 2 || t->numLayers > 1 || t->numFaces > 1) {
+		fprintf(stderr, "void_ktx2: %s: only 2D textures are supported\n", path);
+		ktxTexture2_Destroy(t);
+		return NULL;
+	}
+
+	KtxImage *img = calloc(1, sizeof(KtxImage));
+	img->texture = t;
+	img->width = t->baseWidth;
+	img->height = t->baseHeight;
+	img->levels = t->numLevels ? t->numLevels : 1;
+	if (ktxTexture2_NeedsTranscoding(t)) return img;
+
+	img->format = map_vk_format(t->vkFormat, families);
+	if (!img->format) {
+		fprintf(stderr, "void_ktx2: %s: format %u is not supported on this device\n",
+			path, t->vkFormat);
+		void_ktx2_free(img);
+		return NULL;
+	}
+	// Block formats need the base level in whole blocks; unlike a Basis
+	// payload there is nothing to fall back to
+	if (img->format != FMT_RGBA8_UNORM && img->format != FMT_RGBA8_UNORM_SRGB &&
+		(img->width % 4 != 0 || img->height % 4 != 0)) {
+		fprintf(stderr, "void_ktx2: %s: %ux%u is not a multiple of the 4x4 block\n",
+			path, img->width, img->height);
+		void_ktx2_free(img);
+		return NULL;
+	}
+	return img;
+}
+
+static int needs_transcode(KtxImage *img) {
+	return img && !img->format;
+}
+
+// Transcodes a Basis payload to the device's best format. Frees img and
+// returns NULL on failure.
+static KtxImage *transcode(KtxImage *img, const char *path, uint32_t families) {
+	VOID_TRACE_SCOPE("transcode");
+	ktx_transcode_fmt_e target;
+	img->format = pick_target(img->texture, families, &target);
+	KTX_error_code err = ktxTexture2_TranscodeBasis(img->texture, target, 0);
+	if (err != KTX_SUCCESS) {
+		fprintf(stderr, "void_ktx2: %s: transcoding failed: %s\n", path, ktxErrorString(err));
+		void_ktx2_free(img);
+		return NULL;
+	}
+	img->transcoded = 1;
+	return img;
+}
+
+void *void_ktx2_load(const char *path, uint32_t families) {
+	VOID_TRACE_SCOPE("load_ktx2");
+	KtxImage *img = open_image(path, families);
+	return needs_transcode(img) ? transcode(img, path, families) : img;
+}
+
+void void_ktx2_free(void *image) {
+	KtxImage *img = (KtxImage *)image;
+	if (!img) return;
+	if (img->texture) ktxTexture2_Destroy(img->texture);
+	free(img);
+}
+
+uint32_t void_ktx2_width(void *image)       { return ((KtxImage *)image)->width; }
+uint32_t void_ktx2_height(void *image)      { return ((KtxImage *)image)->height; }
+uint32_t void_ktx2_level_count(void *image) { return ((KtxImage *)image)->levels; }
+uint32_t void_ktx2_format(void *image)      { return ((KtxImage *)image)->format; }
+
+uint64_t void_ktx2_bytes(void *image) {
+	KtxImage *img = (KtxImage *)image;
+	uint64_t total = 0;
+	for (uint32_t l = 0; l < img->levels; l++) total += ktxTexture2_GetImageSize(img->texture, l);
+	return total;
+}
+
+// --- Upload ---
+
+void *void_ktx2_create_texture(void *image, void *device, void *queue) {
+	KtxImage *img = (KtxImage *)image;
+	void *texture = void_gpu_create_texture(device, img->width, img->height, img->format,
+		TEXTURE_USAGE_TEXTURE_BINDING | TEXTURE_USAGE_COPY_DST, img->levels);
+	if (!texture) return NULL;
+
+	const uint8_t *data = ktxTexture_GetData(ktxTexture(img->texture));
+	for (uint32_t l = 0; l < img->levels; l++) {
+		ktx_size_t offset = 0;
+		if (ktxTexture2_GetImageOffset(img->texture, l, 0, 0, &offset) != KTX_SUCCESS) break;
+		uint32_t w = img->width >> l, h = img->height >> l;
+		void_gpu_queue_write_texture_level(queue, texture, img->format, l, 0,
+			data + offset, ktxTexture2_GetImageSize(img->texture, l),
+			w ? w : 1, h ? h : 1);
+	}
+	return texture;
+}
+
+// --- Batches ---
+
+typedef struct KtxBatch {
+	char    **paths;
+	void    **images;
+	uint32_t  count;
+	uint32_t  cap;
+	uint32_t  families;
+} KtxBatch;
+
+// libktx initialises the Basis transcoder on first use without a lock, so
+// the first transcode of the process runs on the calling thread.
+static int s_transcoder_ready = 0;
+
+void *void_ktx2_batch_begin(void) {
+	return calloc(1, sizeof(KtxBatch));
+}
+
+uint32_t void_ktx2_batch_add(void *batch, const char *path) {
+	KtxBatch *b = (KtxBatch *)batch;
+	if (b->count == b->cap) {
+		uint32_t cap = b->cap ? b->cap * 2 : 16;
+		b->paths = realloc(b->paths, cap * sizeof(char *));
+		b->images = realloc(b->images, cap * sizeof(void *));
+		b->cap = cap;
+	}
+	size_t len = strlen(path);
+	b->paths[b->count] = malloc(len + 1);
+	memcpy(b->paths[b->count], path, len + 1);
+	b->images[b->count] = NULL;
+	return b->count++;
+}
+
+static void open_range(void *ctx, uint32_t begin, uint32_t end, uint32_t worker) {
+	(void)worker;
+	VOID_TRACE_SCOPE("load_ktx2");
+	KtxBatch *b = (KtxBatch *)ctx;
+	for (uint32_t i = begin; i < end; i++) {
+		b->images[i] = open_image(b->paths[i], b->families);
+	}
+}
+
+static void transcode_range(void *ctx, uint32_t begin, uint32_t end, uint32_t worker) {
+	(void)worker;
+	KtxBatch *b = (KtxBatch *)ctx;
+	for (uint32_t i = begin; i < end; i++) {
+		if (needs_transcode(b->images[i])) {
+			b->images[i] = transcode(b->images[i], b->paths[i], b->families);
+		}
+	}
+}
+
+uint32_t void_ktx2_batch_load(void *batch, uint32_t families) {
+	VOID_TRACE_SCOPE("load_ktx2_batch");
+	KtxBatch *b = (KtxBatch *)batch;
+	b->families = families;
+
+	// Read and parse every file across the pool (one file per job: files
+	// vary too much in size for larger chunks)
+	void_jobs_parallel_for(b->count, 1, open_range, b);
+
+	// Then transcode, the first Basis payload of the process on this thread
+	uint32_t pending = 0;
+	for (uint32_t i = 0; i < b->count; i++) {
+		if (!needs_transcode(b->images[i])) continue;
+		if (!s_transcoder_ready) {
+			b->images[i] = transcode(b->images[i], b->paths[i], families);
+			s_transcoder_ready = b->images[i] != NULL;
+			continue;
+		}
+		pending++;
+	}
+	if (pending) void_jobs_parallel_for(b->count, 1, transcode_range, b);
+
+	uint32_t loaded = 0;
+	for (uint32_t i = 0; i < b->count; i++) loaded += b->images[i] != NULL;
+	return loaded;
+}
+
+void *void_ktx2_batch_take(void *batch, uint32_t index) {
+	KtxBatch *b = (KtxBatch *)batch;
+	if (index >= b->count) return NULL;
+	void *img = b->images[index];
+	b->images[index] = NULL;
+	return img;
+}
+
+void void_ktx2_batch_release(void *batch) {
+	KtxBatch *b = (KtxBatch *)batch;
+	if (!b) return;
+	for (uint32_t i = 0; i < b->count; i++) {
+		void_ktx2_free(b->images[i]);
+		free(b->paths[i]);
+	}
+	free(b->images);
+	free(b->paths);
+	free(b);
+}
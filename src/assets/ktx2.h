@@ -0,0 +1,44 @@
+// Void Asset — KTX2 textures via libktx
+// Basis Universal payloads (ETC1S or UASTC) are transcoded to the best
+// block format the device enabled (VOID_GPU_COMPRESSION_* families):
+//   two channels (normal maps)  BC5, EAC RG11, ASTC 4x4
+//   ETC1S without alpha         BC1, ETC2 RGB8, ASTC 4x4
+//   anything else               BC7, ETC2 RGBA8, ASTC 4x4
+// and to RGBA8 when none is available or the base size is not a multiple
+// of the 4x4 block. Files already in a block or RGBA8 format load as they
+// are (zstd inflated) when the device supports them; block formats must
+// then be in whole 4x4 blocks, as there is nothing to fall back to. The transfer function
+// picks the sRGB variant. Mip chains come from the file (toktx --genmipmap);
+// nothing is generated here. 2D textures only.
+
+#ifndef VOID_ASSET_KTX2_H
+#define VOID_ASSET_KTX2_H
+
+#include <stdint.h>
+
+// Loads and transcodes on the calling thread; NULL on failure.
+// families: void_gpu_device_texture_compression() of the target device.
+void *void_ktx2_load(const char *path, uint32_t families);
+void  void_ktx2_free(void *image);
+
+uint32_t void_ktx2_width(void *image);
+uint32_t void_ktx2_height(void *image);
+uint32_t void_ktx2_level_count(void *image);
+uint32_t void_ktx2_format(void *image);   // Dawn texture format
+uint64_t void_ktx2_bytes(void *image);    // all levels
+
+// Creates a sampled texture with every level uploaded (block-aligned)
+void *void_ktx2_create_texture(void *image, void *device, void *queue);
+
+// --- Batches: many files read, parsed and transcoded across the job pool ---
+void    *void_ktx2_batch_begin(void);
+// Path is copied; returns the index of the image in the batch
+uint32_t void_ktx2_batch_add(void *batch, const char *path);
+// Loads every file (blocks); returns how many succeeded
+uint32_t void_ktx2_batch_load(void *batch, uint32_t families);
+// Hands over image `index` (NULL if it failed); the batch no longer frees it
+void    *void_ktx2_batch_take(void *batch, uint32_t index);
+// Frees the batch and any image not taken
+void     void_ktx2_batch_release(void *batch);
+
+#endif
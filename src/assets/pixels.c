@@ -0,0 +1,539 @@
+// Void Asset — CPU pixel kernels for asset preparation
+
+#include "pixels.h"
+#include "../core/jobs.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PIXEL_GRAIN 16384    // pixels per job chunk (below this the overhead dominates)
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PIXELS_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#define PIXELS_NEON 1
+#include <arm_neon.h>
+#endif
+
+static uint32_t row_grain(uint32_t width) {
+	uint32_t rows = PIXEL_GRAIN / (width ? width : 1);
+	return rows ? rows : 1;
+}
+
+// --- 4-wide float pixels (one RGBA pixel per vector) ---
+
+#if PIXELS_SSE2
+typedef __m128 v4;
+static inline v4 v4_splat(float s) { return _mm_set1_ps(s); }
+static inline v4 v4_add(v4 a, v4 b) { return _mm_add_ps(a, b); }
+static inline v4 v4_madd(v4 a, v4 b, v4 c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+static inline v4 px_load(const uint8_t *p) {
+	int32_t bits;
+	memcpy(&bits, p, 4);
+	__m128i zero = _mm_setzero_si128();
+	__m128i w = _mm_unpacklo_epi8(_mm_cvtsi32_si128(bits), zero);
+	return _mm_cvtepi32_ps(_mm_unpacklo_epi16(w, zero));
+}
+static inline void px_store(uint8_t *p, v4 a) {
+	__m128i i = _mm_cvtps_epi32(a);              // round to nearest
+	i = _mm_packs_epi32(i, i);
+	i = _mm_packus_epi16(i, i);                  // saturate to 0..255
+	int32_t bits = _mm_cvtsi128_si32(i);
+	memcpy(p, &bits, 4);
+}
+#elif PIXELS_NEON
+typedef float32x4_t v4;
+static inline v4 v4_splat(float s) { return vdupq_n_f32(s); }
+static inline v4 v4_add(v4 a, v4 b) { return vaddq_f32(a, b); }
+static inline v4 v4_madd(v4 a, v4 b, v4 c) { return vmlaq_f32(c, a, b); }
+static inline v4 px_load(const uint8_t *p) {
+	uint32_t bits;
+	memcpy(&bits, p, 4);
+	uint16x8_t w = vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(bits)));
+	return vcvtq_f32_u32(vmovl_u16(vget_low_u16(w)));
+}
+static inline void px_store(uint8_t *p, v4 a) {
+	a = vmaxq_f32(vminq_f32(a, vdupq_n_f32(255.0f)), vdupq_n_f32(0.0f));
+	uint32x4_t i = vcvtq_u32_f32(vaddq_f32(a, vdupq_n_f32(0.5f)));
+	uint8x8_t b = vmovn_u16(vcombine_u16(vmovn_u32(i), vmovn_u32(i)));
+	uint32_t bits = vget_lane_u32(vreinterpret_u32_u8(b), 0);
+	memcpy(p, &bits, 4);
+}
+#else
+typedef struct { float f[4]; } v4;
+static inline v4 v4_splat(float s) { v4 r = {{ s, s, s, s }}; return r; }
+#define V4_LANES(expr) v4 r; for (int i = 0; i < 4; i++) r.f[i] = (expr); return r
+static inline v4 v4_add(v4 a, v4 b) { V4_LANES(a.f[i] + b.f[i]); }
+static inline v4 v4_madd(v4 a, v4 b, v4 c) { V4_LANES(a.f[i] * b.f[i] + c.f[i]); }
+static inline v4 px_load(const uint8_t *p) { V4_LANES((float)p[i]); }
+static inline void px_store(uint8_t *p, v4 a) {
+	for (int i = 0; i < 4; i++) {
+		float f = a.f[i] + 0.5f;
+		p[i] = f <= 0.0f ? 0 : f >= 255.0f ? 255 : (uint8_t)f;
+	}
+}
+#endif
+
+// --- Swizzle ---
+
+typedef struct SwizzleJob {
+	uint8_t *dst;
+	const uint8_t *src;
+	uint32_t order;
+} SwizzleJob;
+
+static void swizzle_scalar(uint8_t *dst, const uint8_t *src, uint32_t begin, uint32_t end, uint32_t order) {
+	uint32_t c0 = order & 3, c1 = (order >> 2) & 3, c2 = (order >> 4) & 3, c3 = (order >> 6) & 3;
+	for (uint32_t i = begin; i < end; i++) {
+		const uint8_t *s = src + (size_t)i * 4;
+		uint8_t p[4] = { s[c0], s[c1], s[c2], s[c3] };
+		memcpy(dst + (size_t)i * 4, p, 4);
+	}
+}
+
+static void swizzle_range(void *ctx, uint32_t begin, uint32_t end, uint32_t worker) {
+	(void)worker;
+	SwizzleJob *j = (SwizzleJob *)ctx;
+	uint32_t i = begin;
+#if defined(__AVX2__) || defined(__SSSE3__) || (PIXELS_NEON && defined(__aarch64__))
+	uint8_t mask[32];
+	for (int k = 0; k < 32; k++) mask[k] = (uint8_t)((k & ~3) + ((j->order >> ((k & 3) * 2)) & 3));
+#endif
+#if defined(__AVX2__)
+	__m256i m8 = _mm256_loadu_si256((const __m256i *)mask);
+	for (; i + 8 <= end; i += 8) {
+		__m256i p = _mm256_loadu_si256((const __m256i *)(j->src + (size_t)i * 4));
+		_mm256_storeu_si256((__m256i *)(j->dst + (size_t)i * 4), _mm256_shuffle_epi8(p, m8));
+	}
+#endif
+#if defined(__AVX2__) || defined(__SSSE3__)
+	__m128i m4 = _mm_loadu_si128((const __m128i *)mask);
+	for (; i + 4 <= end; i += 4) {
+		__m128i p = _mm_loadu_si128((const __m128i *)(j->src + (size_t)i * 4));
+		_mm_storeu_si128((__m128i *)(j->dst + (size_t)i * 4), _mm_shuffle_epi8(p, m4));
+	}
+#elif PIXELS_SSE2
+	// No byte shuffle before SSSE3: only the R/B swap has a mask form
+	if (j->order == VOID_PIXELS_RGBA_TO_BGRA) {
+		__m128i ga = _mm_set1_epi32((int32_t)0xFF00FF00u), lo = _mm_set1_epi32(0xFF);
+		for (; i + 4 <= end; i += 4) {
+			__m128i p = _mm_loadu_si128((const __m128i *)(j->src + (size_t)i * 4));
+			__m128i r = _mm_or_si128(_mm_and_si128(p, ga),
+				_mm_or_si128(_mm_and_si128(_mm_srli_epi32(p, 16), lo), _mm_slli_epi32(_mm_and_si128(p, lo), 16)));
+			_mm_storeu_si128((__m128i *)(j->dst + (size_t)i * 4), r);
+		}
+	}
+#elif PIXELS_NEON && defined(__aarch64__)
+	uint8x16_t m4 = vld1q_u8(mask);
+	for (; i + 4 <= end; i += 4) {
+		uint8x16_t p = vld1q_u8(j->src + (size_t)i * 4);
+		vst1q_u8(j->dst + (size_t)i * 4, vqtbl1q_u8(p, m4));
+	}
+#endif
+	swizzle_scalar(j->dst, j->src, i, end, j->order);
+}
+
+void void_pixels_swizzle(uint8_t *dst, const uint8_t *src, uint32_t pixel_count, uint32_t order) {
+	SwizzleJob j = { dst, src, order & 0xFF };
+	void_jobs_parallel_for(pixel_count, PIXEL_GRAIN, swizzle_range, &j);
+}
+
+// --- Premultiply ---
+
+// x * a / 255 rounded: t = x * a + 128, (t + (t >> 8)) >> 8 (exact for 8-bit)
+static void premultiply_range(void *ctx, uint32_t begin, uint32_t end, uint32_t worker) {
+	(void)worker;
+	SwizzleJob *j = (SwizzleJob *)ctx;
+	uint32_t i = begin;
+#if defined(__AVX2__)
+	{
+		__m256i zero = _mm256_setzero_si256(), half = _mm256_set1_epi16(128);
+		// Alpha lanes multiply by 255, which the rounding maps back to a
+		__m256i keep = _mm256_set1_epi64x(0x0000FFFFFFFFFFFFll);
+		__m256i a255 = _mm256_set1_epi64x((long long)0x00FF000000000000ull);
+		for (; i + 8 <= end; i += 8) {
+			__m256i p = _mm256_loadu_si256((const __m256i *)(j->src + (size_t)i * 4));
+			__m256i out[2];
+			for (int h = 0; h < 2; h++) {
+				__m256i x = h ? _mm256_unpackhi_epi8(p, zero) : _mm256_unpacklo_epi8(p, zero);
+				__m256i a = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(x, 0xFF), 0xFF);
+				a = _mm256_or_si256(_mm256_and_si256(a, keep), a255);
+				__m256i t = _mm256_add_epi16(_mm256_mullo_epi16(x, a), half);
+				out[h] = _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+			}
+			_mm256_storeu_si256((__m256i *)(j->dst + (size_t)i * 4), _mm256_packus_epi16(out[0], out[1]));
+		}
+	}
+#endif
+#if PIXELS_SSE2
+	{
+		__m128i zero = _mm_setzero_si128(), half = _mm_set1_epi16(128);
+		__m128i keep = _mm_set1_epi64x(0x0000FFFFFFFFFFFFll);
+		__m128i a255 = _mm_set1_epi64x((long long)0x00FF000000000000ull);
+		for (; i + 4 <= end; i += 4) {
+			__m128i p = _mm_loadu_si128((const __m128i *)(j->src + (size_t)i * 4));
+			__m128i out[2];
+			for (int h = 0; h < 2; h++) {
+				__m128i x = h ? _mm_unpackhi_epi8(p, zero) : _mm_unpacklo_epi8(p, zero);
+				__m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, 0xFF), 0xFF);
+				a = _mm_or_si128(_mm_and_si128(a, keep), a255);
+				__m128i t = _mm_add_epi16(_mm_mullo_epi16(x, a), half);
+				out[h] = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+			}
+			_mm_storeu_si128((__m128i *)(j->dst + (size_t)i * 4), _mm_packus_epi16(out[0], out[1]));
+		}
+	}
+#elif PIXELS_NEON
+	for (; i + 8 <= end; i += 8) {
+		uint8x8x4_t p = vld4_u8(j->src + (size_t)i * 4);
+		for (int c = 0; c < 3; c++) {
+			uint16x8_t t = vmull_u8(p.val[c], p.val[3]);
+			p.val[c] = vraddhn_u16(t, vrshrq_n_u16(t, 8));
+		}
+		vst4_u8(j->dst + (size_t)i * 4, p);
+	}
+#endif
+	for (; i < end; i++) {
+		const uint8_t *s = j->src + (size_t)i * 4;
+		uint8_t *d = j->dst + (size_t)i * 4;
+		uint32_t a = s[3];
+		for (int c = 0; c < 3; c++) {
+			uint32_t t = s[c] * a + 128;
+			d[c] = (uint8_t)((t + (t >> 8)) >> 8);
+		}
+		d[3] = (uint8_t)a;
+	}
+}
+
+void void_pixels_premultiply(uint8_t *dst, const uint8_t *src, uint32_t pixel_count) {
+	SwizzleJob j = { dst, src, 0 };
+	void_jobs_parallel_for(pixel_count, PIXEL_GRAIN, premultiply_range, &j);
+}
+
+// --- sRGB ---
+// Decoding is a 256-entry table. Encoding counts the code midpoints below
+// the value (branchless binary search over 255 thresholds), which rounds
+// to the nearest code exactly.
+
+static float s_srgb_to_linear[256];
+static float s_srgb_threshold[256];   // [i]: linear midpoint of codes i, i+1
+static int   s_srgb_ready = 0;
+
+static float srgb_decode(float s) {
+	return s <= 0.04045f ? s / 12.92f : powf((s + 0.055f) / 1.055f, 2.4f);
+}
+
+// Called on the calling thread before any job reads the tables
+static void srgb_init(void) {
+	if (s_srgb_ready) return;
+	for (int i = 0; i < 256; i++) {
+		s_srgb_to_linear[i] = srgb_decode((float)i / 255.0f);
+		s_srgb_threshold[i] = i < 255 ? srgb_decode(((float)i + 0.5f) / 255.0f) : INFINITY;
+	}
+	s_srgb_ready = 1;
+}
+
+typedef struct SrgbJob {
+	float *linear;
+	uint8_t *encoded;
+	const float *linear_src;
+	const uint8_t *encoded_src;
+} SrgbJob;
+
+static void srgb_decode_range(void *ctx, uint32_t begin, uint32_t end, uint32_t worker) {
+	(void)worker;
+	SrgbJob *j = (SrgbJob *)ctx;
+	for (uint32_t i = begin; i < end; i++) {
+		const uint8_t *s = j->encoded_src + (size_t)i * 4;
+		float *d = j->linear + (size_t)i * 4;
+		d[0] = s_srgb_to_linear[s[0]];
+		d[1] = s_srgb_to_linear[s[1]];
+		d[2] = s_srgb_to_linear[s[2]];
+		d[3] = (float)s[3] * (1.0f / 255.0f);
+	}
+}
+
+static inline uint8_t srgb_encode(float x) {
+	uint32_t code = 0;
+	for (uint32_t step = 128; step > 0; step >>= 1) {
+		code += s_srgb_threshold[code + step - 1] <= x ? step : 0;
+	}
+	return (uint8_t)code;
+}
+
+static void srgb_encode_range(void *ctx, uint32_t begin, uint32_t end, uint32_t worker) {
+	(void)worker;
+	SrgbJob *j = (SrgbJob *)ctx;
+	for (uint32_t i = begin; i < end; i++) {
+		const float *s = j->linear_src + (size_t)i * 4;
+		uint8_t *d = j->encoded + (size_t)i * 4;
+		d[0] = srgb_encode(s[0]);
+		d[1] = srgb_encode(s[1]);
+		d[2] = srgb_encode(s[2]);
+		float a = s[3] * 255.0f + 0.5f;
+		d[3] = a <= 0.0f ? 0 : a >= 255.0f ? 255 : (uint8_t)a;
+	}
+}
+
+void void_pixels_srgb_to_linear(float *dst, const uint8_t *src, uint32_t pixel_count) {
+	srgb_init();
+	SrgbJob j = { dst, NULL, NULL, src };
+	void_jobs_parallel_for(pixel_count, PIXEL_GRAIN, srgb_decode_range, &j);
+}
+
+void void_pixels_linear_to_srgb(uint8_t *dst, const float *src, uint32_t pixel_count) {
+	srgb_init();
+	SrgbJob j = { NULL, dst, src, NULL };
+	void_jobs_parallel_for(pixel_count, PIXEL_GRAIN, srgb_encode_range, &j);
+}
+
+// --- Mip downsampling ---
+
+typedef struct DownsampleJob {
+	uint8_t *dst;
+	const uint8_t *src;
+	uint32_t sw, sh, dw;
+} DownsampleJob;
+
+static void downsample_rows(void *ctx, uint32_t begin, uint32_t end, uint32_t worker) {
+	(void)worker;
+	DownsampleJob *j = (DownsampleJob *)ctx;
+	uint32_t sw = j->sw, sh = j->sh, dw = j->dw;
+	for (uint32_t y = begin; y < end; y++) {
+		const uint8_t *r0 = j->src + (size_t)(y * 2 < sh ? y * 2 : sh - 1) * sw * 4;
+		const uint8_t *r1 = j->src + (size_t)(y * 2 + 1 < sh ? y * 2 + 1 : sh - 1) * sw * 4;
+		uint8_t *o = j->dst + (size_t)y * dw * 4;
+		uint32_t x = 0;
+		// Two output pixels from 2x2 blocks of four source pixels per row
+#if PIXELS_SSE2
+		__m128i zero = _mm_setzero_si128(), two = _mm_set1_epi16(2);
+		for (; x + 2 <= dw && x * 2 + 4 <= sw; x += 2) {
+			__m128i a = _mm_loadu_si128((const __m128i *)(r0 + (size_t)x * 8));
+			__m128i b = _mm_loadu_si128((const __m128i *)(r1 + (size_t)x * 8));
+			__m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+			__m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+			lo = _mm_add_epi16(lo, _mm_srli_si128(lo, 8));
+			hi = _mm_add_epi16(hi, _mm_srli_si128(hi, 8));
+			__m128i s = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(lo, hi), two), 2);
+			_mm_storel_epi64((__m128i *)(o + (size_t)x * 4), _mm_packus_epi16(s, s));
+		}
+#elif PIXELS_NEON
+		for (; x + 2 <= dw && x * 2 + 4 <= sw; x += 2) {
+			uint8x16_t a = vld1q_u8(r0 + (size_t)x * 8);
+			uint8x16_t b = vld1q_u8(r1 + (size_t)x * 8);
+			uint16x8_t lo = vaddl_u8(vget_low_u8(a), vget_low_u8(b));
+			uint16x8_t hi = vaddl_u8(vget_high_u8(a), vget_high_u8(b));
+			uint16x8_t s = vcombine_u16(vadd_u16(vget_low_u16(lo), vget_high_u16(lo)),
+				vadd_u16(vget_low_u16(hi), vget_high_u16(hi)));
+			vst1_u8(o + (size_t)x * 4, vrshrn_n_u16(s, 2));
+		}
+#endif
+		for (; x < dw; x++) {
+			uint32_t x0 = x * 2 < sw ? x * 2 : sw - 1;
+			uint32_t x1 = x * 2 + 1 < sw ? x * 2 + 1 : sw - 1;
+			const uint8_t *a = r0 + (size_t)x0 * 4, *b = r0 + (size_t)x1 * 4;
+			const uint8_t *c = r1 + (size_t)x0 * 4, *d = r1 + (size_t)x1 * 4;
+			for (int i = 0; i < 4; i++) o[x * 4 + i] = (uint8_t)((a[i] + b[i] + c[i] + d[i] + 2) / 4);
+		}
+	}
+}
+
+void void_pixels_downsample(uint8_t *dst, const uint8_t *src, uint32_t src_width, uint32_t src_height) {
+	uint32_t dw = src_width > 1 ? src_width / 2 : 1;
+	uint32_t dh = src_height > 1 ? src_height / 2 : 1;
+	DownsampleJob j = { dst, src, src_width, src_height, dw };
+	void_jobs_parallel_for(dh, row_grain(dw), downsample_rows, &j);
+}
+
+uint32_t void_pixels_mip_count(uint32_t width, uint32_t height) {
+	uint32_t larger = width > height ? width : height;
+	uint32_t count = 1;
+	while ((larger >> count) > 0) count++;
+	return count;
+}
+
+uint64_t void_pixels_mip_chain_bytes(uint32_t width, uint32_t height) {
+	uint64_t total = 0;
+	uint32_t levels = void_pixels_mip_count(width, height);
+	for (uint32_t m = 0; m < levels; m++) {
+		uint64_t w = width >> m ? width >> m : 1, h = height >> m ? height >> m : 1;
+		total += w * h * 4;
+	}
+	return total;
+}
+
+uint32_t void_pixels_build_mips(uint8_t *chain, uint32_t width, uint32_t height) {
+	uint32_t levels = void_pixels_mip_count(width, height);
+	uint8_t *level = chain;
+	uint32_t w = width, h = height;
+	for (uint32_t m = 1; m < levels; m++) {
+		uint8_t *next = level + (size_t)w * h * 4;
+		void_pixels_downsample(next, level, w, h);
+		level = next;
+		w = w > 1 ? w / 2 : 1;
+		h = h > 1 ? h / 2 : 1;
+	}
+	return levels;
+}
+
+// --- Resize ---
+
+// Taps of one output coordinate: weights[first .. first + count) of the
+// shared weight array, applied to source texels start .. start + count
+typedef struct Taps {
+	uint32_t start;
+	uint32_t count;
+	uint32_t first;
+} Taps;
+
+typedef struct ResizeJob {
+	uint8_t *dst;
+	const uint8_t *src;
+	float *tmp;              // src_height rows x dst_width pixels
+	uint32_t sw, dw;
+	const Taps *xt, *yt;
+	const float *xw, *yw;
+} ResizeJob;
+
+static float *build_taps(uint32_t src_size, uint32_t dst_size, Taps *taps) {
+	float scale = (float)src_size / (float)dst_size;
+	float support = scale > 1.0f ? scale : 1.0f;
+	uint32_t max_taps = (uint32_t)ceilf(support * 2.0f) + 2;
+	float *weights = malloc((size_t)dst_size * max_taps * sizeof(float));
+	for (uint32_t i = 0; i < dst_size; i++) {
+		float center = ((float)i + 0.5f) * scale;
+		int32_t lo = (int32_t)floorf(center - support);
+		int32_t hi = (int32_t)ceilf(center + support);
+		if (lo < 0) lo = 0;
+		if (hi > (int32_t)src_size) hi = (int32_t)src_size;
+		Taps *t = &taps[i];
+		t->start = (uint32_t)lo;
+		t->first = i * max_taps;
+		t->count = 0;
+		float sum = 0.0f;
+		for (int32_t s = lo; s < hi && t->count < max_taps; s++) {
+			float w = 1.0f - fabsf(((float)s + 0.5f - center) / support);
+			if (w <= 0.0f && t->count == 0) {
+				t->start++;
+				continue;
+			}
+			weights[t->first + t->count++] = w > 0.0f ? w : 0.0f;
+			sum += w > 0.0f ? w : 0.0f;
+		}
+		if (t->count == 0) {
+			t->start = (uint32_t)(center < (float)src_size ? center : (float)src_size - 1);
+			t->count = 1;
+			weights[t->first] = 1.0f;
+			sum = 1.0f;
+		}
+		for (uint32_t k = 0; k < t->count; k++) weights[t->first + k] /= sum;
+	}
+	return weights;
+}
+
+static void resize_rows_h(void *ctx, uint32_t begin, uint32_t end, uint32_t worker) {
+	(void)worker;
+	ResizeJob *j = (ResizeJob *)ctx;
+	for (uint32_t y = begin; y < end; y++) {
+		const uint8_t *row = j->src + (size_t)y * j->sw * 4;
+		float *out = j->tmp + (size_t)y * j->dw * 4;
+		for (uint32_t x = 0; x < j->dw; x++) {
+			const Taps *t = &j->xt[x];
+			const float *w = j->xw + t->first;
+			v4 acc = v4_splat(0.0f);
+			for (uint32_t k = 0; k < t->count; k++) {
+				acc = v4_madd(px_load(row + (size_t)(t->start + k) * 4), v4_splat(w[k]), acc);
+			}
+			memcpy(out + (size_t)x * 4, &acc, sizeof(float) * 4);
+		}
+	}
+}
+
+static void resize_rows_v(void *ctx, uint32_t begin, uint32_t end, uint32_t worker) {
+	(void)worker;
+	ResizeJob *j = (ResizeJob *)ctx;
+	for (uint32_t y = begin; y < end; y++) {
+		const Taps *t = &j->yt[y];
+		const float *w = j->yw + t->first;
+		uint8_t *out = j->dst + (size_t)y * j->dw * 4;
+		for (uint32_t x = 0; x < j->dw; x++) {
+			v4 acc = v4_splat(0.0f);
+			for (uint32_t k = 0; k < t->count; k++) {
+				v4 p;
+				memcpy(&p, j->tmp + ((size_t)(t->start + k) * j->dw + x) * 4, sizeof(p));
+				acc = v4_madd(p, v4_splat(w[k]), acc);
+			}
+			px_store(out + (size_t)x * 4, acc);
+		}
+	}
+}
+
+void void_pixels_resize(uint8_t *dst, uint32_t dst_width, uint32_t dst_height,
+	const uint8_t *src, uint32_t src_width, uint32_t src_height
+) {
+	if (!dst_width || !dst_height || !src_width || !src_height) return;
+	Taps *xt = malloc(dst_width * sizeof(Taps));
+	Taps *yt = malloc(dst_height * sizeof(Taps));
+	float *xw = build_taps(src_width, dst_width, xt);
+	float *yw = build_taps(src_height, dst_height, yt);
+	float *tmp = malloc((size_t)src_height * dst_width * 4 * sizeof(float));
+
+	ResizeJob j = { dst, src, tmp, src_width, dst_width, xt, yt, xw, yw };
+	void_jobs_parallel_for(src_height, row_grain(dst_width), resize_rows_h, &j);
+	void_jobs_parallel_for(dst_height, row_grain(dst_width), resize_rows_v, &j);
+
+	free(tmp);
+	free(yw);
+	free(xw);
+	free(yt);
+	free(xt);
+}
+
+// --- Procedural ---
+
+typedef struct CheckerJob {
+	uint8_t *dst;
+	const uint8_t *rows[2];   // even / odd cell-row patterns
+	uint32_t width;
+	uint32_t cell;
+} CheckerJob;
+
+static void checker_rows(void *ctx, uint32_t begin, uint32_t end, uint32_t worker) {
+	(void)worker;
+	CheckerJob *j = (CheckerJob *)ctx;
+	size_t row_bytes = (size_t)j->width * 4;
+	for (uint32_t y = begin; y < end; y++) {
+		memcpy(j->dst + y * row_bytes, j->rows[(y / j->cell) & 1], row_bytes);
+	}
+}
+
+void void_pixels_checkerboard(uint8_t *dst, uint32_t width, uint32_t height,
+	uint32_t cell, uint32_t color1, uint32_t color2
+) {
+	if (!width || !height) return;
+	if (cell < 1) cell = 1;
+	uint8_t c[2][4];
+	for (int i = 0; i < 4; i++) {
+		c[0][i] = (uint8_t)(color1 >> (i * 8));
+		c[1][i] = (uint8_t)(color2 >> (i * 8));
+	}
+
+	// The two row patterns are built once; every row is a copy of one
+	uint8_t *rows = malloc((size_t)width * 8);
+	for (uint32_t x = 0; x < width; x++) {
+		uint32_t parity = (x / cell) & 1;
+		memcpy(rows + (size_t)x * 4, c[parity], 4);
+		memcpy(rows + ((size_t)width + x) * 4, c[parity ^ 1], 4);
+	}
+	CheckerJob j = { dst, { rows, rows + (size_t)width * 4 }, width, cell };
+	void_jobs_parallel_for(height, row_grain(width), checker_rows, &j);
+	free(rows);
+}
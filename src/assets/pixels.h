@@ -0,0 +1,49 @@
+// Void Asset — CPU pixel kernels for asset preparation
+// RGBA8 (4 bytes per pixel, tightly packed rows) unless noted. Kernels use
+// SSE2 / SSSE3 / AVX2 or NEON when the build targets them, with a scalar
+// fallback, and split the work across the job pool (src/core/jobs) by rows
+// or pixel runs; they run inline when the pool is busy or not started, so
+// they are safe to call from jobs. dst may equal src where noted.
+
+#ifndef VOID_ASSET_PIXELS_H
+#define VOID_ASSET_PIXELS_H
+
+#include <stdint.h>
+
+// Swizzle orders: output channel i takes input channel (order >> 2i) & 3
+#define VOID_PIXELS_ORDER(c0, c1, c2, c3) ((c0) | (c1) << 2 | (c2) << 4 | (c3) << 6)
+#define VOID_PIXELS_RGBA_TO_BGRA VOID_PIXELS_ORDER(2, 1, 0, 3)   // and back
+#define VOID_PIXELS_RGBA_TO_ARGB VOID_PIXELS_ORDER(3, 0, 1, 2)
+
+// Channel reorder (e.g. stb's RGBA to the BGRA swapchain). dst may equal src.
+void void_pixels_swizzle(uint8_t *dst, const uint8_t *src, uint32_t pixel_count, uint32_t order);
+
+// rgb *= a / 255, rounded exactly. dst may equal src.
+void void_pixels_premultiply(uint8_t *dst, const uint8_t *src, uint32_t pixel_count);
+
+// sRGB-encoded RGBA8 to linear RGBA float (alpha stays linear: a / 255)
+void void_pixels_srgb_to_linear(float *dst, const uint8_t *src, uint32_t pixel_count);
+// Linear RGBA float to sRGB-encoded RGBA8, rounded to the nearest code
+void void_pixels_linear_to_srgb(uint8_t *dst, const float *src, uint32_t pixel_count);
+
+// 2x2 box filter to the next mip level: dst is max(w/2, 1) x max(h/2, 1);
+// odd edges repeat the last texel
+void void_pixels_downsample(uint8_t *dst, const uint8_t *src, uint32_t src_width, uint32_t src_height);
+// Levels of a full mip chain and their total size in bytes
+uint32_t void_pixels_mip_count(uint32_t width, uint32_t height);
+uint64_t void_pixels_mip_chain_bytes(uint32_t width, uint32_t height);
+// chain holds level 0 followed by room for the rest (mip_chain_bytes);
+// fills every further level, finest first. Returns the level count.
+uint32_t void_pixels_build_mips(uint8_t *chain, uint32_t width, uint32_t height);
+
+// Separable triangle-filter resize (bilinear when magnifying, widened to
+// cover every source texel when minifying); filters the stored values
+void void_pixels_resize(uint8_t *dst, uint32_t dst_width, uint32_t dst_height,
+    const uint8_t *src, uint32_t src_width, uint32_t src_height);
+
+// --- Procedural ---
+// Colors are packed 0xAABBGGRR (byte order R, G, B, A in memory)
+void void_pixels_checkerboard(uint8_t *dst, uint32_t width, uint32_t height,
+    uint32_t cell, uint32_t color1, uint32_t color2);
+
+#endif
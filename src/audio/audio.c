@@ -0,0 +1,1001 @@
+// Void Audio — Voice mixer on an SDL3 audio stream
+
+#include "audio.h"
+#include "../core/trace.h"
+
+#include <SDL3/SDL.h>
+
+#define STB_VORBIS_NO_PUSHDATA_API
+#include "../../deps/stb/stb_vorbis.c"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DEFAULT_RATE     48000
+#define DEFAULT_COMMANDS 1024
+#define MUSIC_CHUNK      1024      // frames decoded per step on the music thread
+#define MUSIC_RING_MS    500       // decoded music kept ahead of the mixer
+#define FIXED_ONE        (1ull << 32)
+#define MIN_PITCH        (1.0f / 64.0f)
+#define MAX_PITCH        64.0f
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define AUDIO_SSE 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define AUDIO_NEON 1
+#endif
+
+enum {
+	CMD_PLAY,
+	CMD_STOP,
+	CMD_GAIN,
+	CMD_PAN,
+	CMD_PITCH,
+	CMD_STOP_SOUND,
+	CMD_MASTER,
+	CMD_MUSIC,
+	CMD_MUSIC_GAIN,
+};
+
+enum {
+	EVT_VOICE_END,
+	EVT_MUSIC_END,
+};
+
+typedef struct Sound {
+	float   *samples;          // interleaved
+	uint32_t frames;
+	uint32_t channels;         // 1 or 2
+	uint32_t rate;
+} Sound;
+
+typedef struct Command {
+	uint32_t type;
+	uint32_t voice;
+	void    *ptr;              // Sound (PLAY, STOP_SOUND) or Music (MUSIC)
+	float    gain;
+	float    pan;
+	float    pitch;
+	uint32_t loop;
+} Command;
+
+typedef struct Event {
+	uint32_t type;
+	uint32_t voice;
+	void    *ptr;              // Music (MUSIC_END)
+} Event;
+
+// Single producer, single consumer; counters run freely and wrap
+typedef struct Ring {
+	uint8_t      *items;
+	uint32_t      item_size;
+	uint32_t      mask;
+	SDL_AtomicInt head;        // items written (producer)
+	uint8_t       pad[60];     // keep the two counters on separate cache lines
+	SDL_AtomicInt tail;        // items read (consumer)
+} Ring;
+
+// Decoded, resampled music between the music thread and the mixer
+typedef struct Music {
+	stb_vorbis   *vorbis;
+	uint32_t      rate;        // output rate
+	int           loop;
+	float        *ring;        // interleaved stereo at the output rate
+	uint32_t      mask;        // frames - 1
+	SDL_AtomicInt written;     // frames (music thread)
+	SDL_AtomicInt read;        // frames (mixer)
+	SDL_AtomicInt ended;       // last frame written
+	SDL_AtomicInt quit;
+	SDL_Semaphore *wake;       // cuts the music thread's idle wait short on quit
+	SDL_Thread   *thread;
+	// Mixer thread
+	float         gain;
+	float         current;     // ramped gain
+	int           started;     // first frames arrived (no underruns before)
+} Music;
+
+typedef struct Voice {
+	const Sound *sound;        // NULL = free
+	uint32_t     id;
+	uint64_t     pos;          // source frames, 32.32 fixed point
+	uint64_t     step;
+	float        gain, pan, pitch;
+	float        left, right;  // per-channel gains reached
+	float        target_left, target_right;
+	uint32_t     active_index;
+	int          loop;
+	int          stopping;     // fade to silence over one block, then free
+} Voice;
+
+typedef enum { RETIRED_SOUND, RETIRED_MUSIC } RetiredType;
+
+typedef struct Retired {
+	RetiredType type;
+	void       *ptr;
+	uint32_t    issued;        // freed once the mixer consumed this many commands
+} Retired;
+
+typedef struct Mixer {
+	uint32_t rate;
+	uint32_t max_voices;
+
+	// --- Game thread ---
+	uint16_t *generation;
+	uint8_t  *busy;
+	uint32_t *free_slots;
+	uint32_t  free_count;
+	Command  *backlog;
+	uint32_t  backlog_count;
+	uint32_t  backlog_capacity;
+	uint32_t  issued;          // commands issued, backlog included
+	Retired  *retired;
+	uint32_t  retired_count;
+	uint32_t  retired_capacity;
+	Music    *music;
+	SDL_AudioStream *stream;
+
+	// --- Shared ---
+	Ring          commands;
+	Ring          events;
+	SDL_AtomicInt consumed;    // commands applied by the mixer (after its block)
+	SDL_AtomicInt active_stat;
+	SDL_AtomicInt frames_mixed;
+	SDL_AtomicInt underruns;
+	SDL_AtomicInt load;        // last callback's mixing time / audio time, x 1e6
+
+	// --- Mixer thread ---
+	Voice    *voices;
+	uint32_t *active;
+	uint32_t  active_count;
+	Music    *playing;
+	float     master;
+	float     master_current;
+	uint32_t  applied;
+	float     mix_left[VOID_AUDIO_BLOCK];
+	float     mix_right[VOID_AUDIO_BLOCK];
+	float     scratch[VOID_AUDIO_BLOCK * 2];
+	float     out[VOID_AUDIO_BLOCK * 2];
+} Mixer;
+
+// --- Rings ---
+
+static uint32_t next_pow2(uint32_t v) {
+	uint32_t p = 1;
+	while (p < v) p <<= 1;
+	return p;
+}
+
+static void ring_init(Ring *r, uint32_t item_size, uint32_t capacity) {
+	capacity = next_pow2(capacity);
+	r->items = malloc((size_t)item_size * capacity);
+	r->item_size = item_size;
+	r->mask = capacity - 1;
+	SDL_SetAtomicInt(&r->head, 0);
+	SDL_SetAtomicInt(&r->tail, 0);
+}
+
+static int ring_push(Ring *r, const void *item) {
+	uint32_t head = (uint32_t)SDL_GetAtomicInt(&r->head);
+	uint32_t tail = (uint32_t)SDL_GetAtomicInt(&r->tail);
+	if (head - tail > r->mask) return 0;
+	memcpy(r->items + (size_t)(head & r->mask) * r->item_size, item, r->item_size);
+	SDL_SetAtomicInt(&r->head, (int)(head + 1));
+	return 1;
+}
+
+static int ring_pop(Ring *r, void *item) {
+	uint32_t tail = (uint32_t)SDL_GetAtomicInt(&r->tail);
+	if ((uint32_t)SDL_GetAtomicInt(&r->head) == tail) return 0;
+	memcpy(item, r->items + (size_t)(tail & r->mask) * r->item_size, r->item_size);
+	SDL_SetAtomicInt(&r->tail, (int)(tail + 1));
+	return 1;
+}
+
+// --- Mix kernels ---
+// acc += src * gain, gain ramping linearly from g by dg per frame
+
+static void mix_mono(float *left, float *right, const float *src, uint32_t n,
+	float gl, float dgl, float gr, float dgr) {
+	uint32_t i = 0;
+#if AUDIO_SSE
+	__m128 ramp = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+	__m128 vl = _mm_add_ps(_mm_set1_ps(gl), _mm_mul_ps(ramp, _mm_set1_ps(dgl)));
+	__m128 vr = _mm_add_ps(_mm_set1_ps(gr), _mm_mul_ps(ramp, _mm_set1_ps(dgr)));
+	__m128 sl = _mm_set1_ps(dgl * 4.0f), sr = _mm_set1_ps(dgr * 4.0f);
+	for (; i + 4 <= n; i += 4) {
+		__m128 s = _mm_loadu_ps(src + i);
+		_mm_storeu_ps(left + i, _mm_add_ps(_mm_loadu_ps(left + i), _mm_mul_ps(s, vl)));
+		_mm_storeu_ps(right + i, _mm_add_ps(_mm_loadu_ps(right + i), _mm_mul_ps(s, vr)));
+		vl = _mm_add_ps(vl, sl);
+		vr = _mm_add_ps(vr, sr);
+	}
+#elif AUDIO_NEON
+	static const float ramp_init[4] = { 0.0f, 1.0f, 2.0f, 3.0f };
+	float32x4_t ramp = vld1q_f32(ramp_init);
+	float32x4_t vl = vmlaq_n_f32(vdupq_n_f32(gl), ramp, dgl);
+	float32x4_t vr = vmlaq_n_f32(vdupq_n_f32(gr), ramp, dgr);
+	float32x4_t sl = vdupq_n_f32(dgl * 4.0f), sr = vdupq_n_f32(dgr * 4.0f);
+	for (; i + 4 <= n; i += 4) {
+		float32x4_t s = vld1q_f32(src + i);
+		vst1q_f32(left + i, vmlaq_f32(vld1q_f32(left + i), s, vl));
+		vst1q_f32(right + i, vmlaq_f32(vld1q_f32(right + i), s, vr));
+		vl = vaddq_f32(vl, sl);
+		vr = vaddq_f32(vr, sr);
+	}
+#endif
+	for (; i < n; i++) {
+		left[i] += src[i] * (gl + dgl * (float)i);
+		right[i] += src[i] * (gr + dgr * (float)i);
+	}
+}
+
+// src: interleaved stereo
+static void mix_stereo(float *left, float *right, const float *src, uint32_t n,
+	float gl, float dgl, float gr, float dgr) {
+	uint32_t i = 0;
+#if AUDIO_SSE
+	__m128 ramp = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+	__m128 vl = _mm_add_ps(_mm_set1_ps(gl), _mm_mul_ps(ramp, _mm_set1_ps(dgl)));
+	__m128 vr = _mm_add_ps(_mm_set1_ps(gr), _mm_mul_ps(ramp, _mm_set1_ps(dgr)));
+	__m128 sl = _mm_set1_ps(dgl * 4.0f), sr = _mm_set1_ps(dgr * 4.0f);
+	for (; i + 4 <= n; i += 4) {
+		__m128 a = _mm_loadu_ps(src + i * 2);
+		__m128 b = _mm_loadu_ps(src + i * 2 + 4);
+		__m128 l = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+		__m128 r = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+		_mm_storeu_ps(left + i, _mm_add_ps(_mm_loadu_ps(left + i), _mm_mul_ps(l, vl)));
+		_mm_storeu_ps(right + i, _mm_add_ps(_mm_loadu_ps(right + i), _mm_mul_ps(r, vr)));
+		vl = _mm_add_ps(vl, sl);
+		vr = _mm_add_ps(vr, sr);
+	}
+#elif AUDIO_NEON
+	static const float ramp_init[4] = { 0.0f, 1.0f, 2.0f, 3.0f };
+	float32x4_t ramp = vld1q_f32(ramp_init);
+	float32x4_t vl = vmlaq_n_f32(vdupq_n_f32(gl), ramp, dgl);
+	float32x4_t vr = vmlaq_n_f32(vdupq_n_f32(gr), ramp, dgr);
+	float32x4_t sl = vdupq_n_f32(dgl * 4.0f), sr = vdupq_n_f32(dgr * 4.0f);
+	for (; i + 4 <= n; i += 4) {
+		float32x4x2_t s = vld2q_f32(src + i * 2);
+		vst1q_f32(left + i, vmlaq_f32(vld1q_f32(left + i), s.val[0], vl));
+		vst1q_f32(right + i, vmlaq_f32(vld1q_f32(right + i), s.val[1], vr));
+		vl = vaddq_f32(vl, sl);
+		vr = vaddq_f32(vr, sr);
+	}
+#endif
+	for (; i < n; i++) {
+		left[i] += src[i * 2] * (gl + dgl * (float)i);
+		right[i] += src[i * 2 + 1] * (gr + dgr * (float)i);
+	}
+}
+
+// Interleaves the mix into out, scaled and clamped to [-1, 1]
+static void write_output(float *out, const float *left, const float *right, uint32_t n, float g, float dg) {
+	uint32_t i = 0;
+#if AUDIO_SSE
+	__m128 vg = _mm_add_ps(_mm_set1_ps(g), _mm_mul_ps(_mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f), _mm_set1_ps(dg)));
+	__m128 step = _mm_set1_ps(dg * 4.0f);
+	__m128 lo = _mm_set1_ps(-1.0f), hi = _mm_set1_ps(1.0f);
+	for (; i + 4 <= n; i += 4) {
+		__m128 l = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(left + i), vg), lo), hi);
+		__m128 r = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(right + i), vg), lo), hi);
+		_mm_storeu_ps(out + i * 2, _mm_unpacklo_ps(l, r));
+		_mm_storeu_ps(out + i * 2 + 4, _mm_unpackhi_ps(l, r));
+		vg = _mm_add_ps(vg, step);
+	}
+#elif AUDIO_NEON
+	static const float ramp_init[4] = { 0.0f, 1.0f, 2.0f, 3.0f };
+	float32x4_t vg = vmlaq_n_f32(vdupq_n_f32(g), vld1q_f32(ramp_init), dg);
+	float32x4_t step = vdupq_n_f32(dg * 4.0f);
+	float32x4_t lo = vdupq_n_f32(-1.0f), hi = vdupq_n_f32(1.0f);
+	for (; i + 4 <= n; i += 4) {
+		float32x4x2_t o;
+		o.val[0] = vminq_f32(vmaxq_f32(vmulq_f32(vld1q_f32(left + i), vg), lo), hi);
+		o.val[1] = vminq_f32(vmaxq_f32(vmulq_f32(vld1q_f32(right + i), vg), lo), hi);
+		vst2q_f32(out + i * 2, o);
+		vg = vaddq_f32(vg, step);
+	}
+#endif
+	for (; i < n; i++) {
+		float gi = g + dg * (float)i;
+		float l = left[i] * gi, r = right[i] * gi;
+		out[i * 2] = l < -1.0f ? -1.0f : (l > 1.0f ? 1.0f : l);
+		out[i * 2 + 1] = r < -1.0f ? -1.0f : (r > 1.0f ? 1.0f : r);
+	}
+}
+
+// --- Voices (mixer thread) ---
+
+static void voice_targets(Voice *v) {
+	float pan = v->pan < -1.0f ? -1.0f : (v->pan > 1.0f ? 1.0f : v->pan);
+	if (v->sound->channels == 1) {
+		// Constant power: center is -3 dB per side
+		float angle = (pan + 1.0f) * 0.785398163f;
+		v->target_left = v->gain * cosf(angle);
+		v->target_right = v->gain * sinf(angle);
+	} else {
+		// Balance: the far side fades out, the near side stays at full gain
+		v->target_left = v->gain * (pan > 0.0f ? 1.0f - pan : 1.0f);
+		v->target_right = v->gain * (pan < 0.0f ? 1.0f + pan : 1.0f);
+	}
+}
+
+static void voice_step(Mixer *m, Voice *v) {
+	float pitch = v->pitch < MIN_PITCH ? MIN_PITCH : (v->pitch > MAX_PITCH ? MAX_PITCH : v->pitch);
+	double step = (double)pitch * (double)v->sound->rate / (double)m->rate;
+	v->step = (uint64_t)(step * (double)FIXED_ONE + 0.5);
+}
+
+static void voice_free(Mixer *m, Voice *v) {
+	uint32_t last = m->active[--m->active_count];
+	m->active[v->active_index] = last;
+	m->voices[last].active_index = v->active_index;
+	Event e = { EVT_VOICE_END, v->id, NULL };
+	ring_push(&m->events, &e);   // sized for every voice, cannot fill
+	v->sound = NULL;
+}
+
+static Voice *voice_get(Mixer *m, uint32_t id) {
+	uint32_t slot = id & 0xFFFF;
+	if (slot >= m->max_voices) return NULL;
+	Voice *v = &m->voices[slot];
+	return (v->sound && v->id == id) ? v : NULL;
+}
+
+// Linearly interpolated source frames into dst (interleaved like the
+// sound). Returns fewer than n when a one-shot reaches its end.
+static uint32_t resample(Voice *v, float *dst, uint32_t n) {
+	const Sound *s = v->sound;
+	uint64_t length = (uint64_t)s->frames << 32;
+	uint32_t last = s->frames - 1;
+	const float scale = 1.0f / 4294967296.0f;
+	const float *src = s->samples;
+	uint64_t pos = v->pos;
+	uint32_t i = 0;
+	while (i < n) {
+		if (pos >= length) {
+			if (!v->loop) break;
+			pos %= length;
+		}
+		// Frames before the last source frame need no wrap or end handling
+		uint64_t run = ((uint64_t)last << 32) > pos ? (((uint64_t)last << 32) - pos + v->step - 1) / v->step : 0;
+		uint32_t end = run < n - i ? i + (uint32_t)run : n;
+		if (s->channels == 1) {
+			for (; i < end; i++, pos += v->step) {
+				const float *f = src + (pos >> 32);
+				dst[i] = f[0] + (f[1] - f[0]) * ((float)(uint32_t)pos * scale);
+			}
+		} else {
+			for (; i < end; i++, pos += v->step) {
+				const float *f = src + (pos >> 32) * 2;
+				float t = (float)(uint32_t)pos * scale;
+				dst[i * 2] = f[0] + (f[2] - f[0]) * t;
+				dst[i * 2 + 1] = f[1] + (f[3] - f[1]) * t;
+			}
+		}
+		if (i < n && pos < length) {
+			// Last frame: blends toward the first when looping, holds otherwise
+			uint32_t i1 = v->loop ? 0 : last;
+			float t = (float)(uint32_t)pos * scale;
+			for (uint32_t c = 0; c < s->channels; c++) {
+				float a = src[last * s->channels + c];
+				dst[i * s->channels + c] = a + (src[i1 * s->channels + c] - a) * t;
+			}
+			i++;
+			pos += v->step;
+		}
+	}
+	v->pos = pos;
+	return i;
+}
+
+// Adds n frames of the voice to the mix. Returns 0 once the voice is done.
+static int mix_voice(Mixer *m, Voice *v, uint32_t n) {
+	const Sound *s = v->sound;
+	uint64_t length = (uint64_t)s->frames << 32;
+	if (v->stopping) v->target_left = v->target_right = 0.0f;
+	float dgl = (v->target_left - v->left) / (float)n;
+	float dgr = (v->target_right - v->right) / (float)n;
+	uint32_t done = 0;
+	int ended = 0;
+	while (done < n && !ended) {
+		uint32_t want = n - done, count;
+		const float *src;
+		if (v->step == FIXED_ONE && (uint32_t)v->pos == 0) {
+			// Source rate matches the output: read the samples directly
+			uint32_t at = (uint32_t)(v->pos >> 32);
+			count = s->frames - at < want ? s->frames - at : want;
+			src = s->samples + (size_t)at * s->channels;
+			v->pos += (uint64_t)count << 32;
+			if (v->pos >= length) {
+				if (v->loop) v->pos = 0;
+				else ended = 1;
+			}
+		} else {
+			count = resample(v, m->scratch, want);
+			src = m->scratch;
+			if (count < want) ended = 1;
+		}
+		float gl = v->left + dgl * (float)done, gr = v->right + dgr * (float)done;
+		if (s->channels == 1) mix_mono(m->mix_left + done, m->mix_right + done, src, count, gl, dgl, gr, dgr);
+		else mix_stereo(m->mix_left + done, m->mix_right + done, src, count, gl, dgl, gr, dgr);
+		done += count;
+	}
+	v->left = v->target_left;
+	v->right = v->target_right;
+	return !ended && !v->stopping;
+}
+
+// --- Music (mixer thread) ---
+
+static void mix_music(Mixer *m, uint32_t n) {
+	Music *mu = m->playing;
+	if (!mu) return;
+	int ended = SDL_GetAtomicInt(&mu->ended);   // before written: final frames are in
+	uint32_t written = (uint32_t)SDL_GetAtomicInt(&mu->written);
+	uint32_t read = (uint32_t)SDL_GetAtomicInt(&mu->read);
+	uint32_t avail = written - read;
+	if (avail) mu->started = 1;
+	if (avail < n && !ended && mu->started) SDL_AddAtomicInt(&m->underruns, 1);
+	uint32_t count = avail < n ? avail : n;
+
+	float dg = (mu->gain - mu->current) / (float)n;
+	uint32_t done = 0;
+	while (done < count) {
+		uint32_t at = (read + done) & mu->mask;
+		uint32_t run = mu->mask + 1 - at;
+		if (run > count - done) run = count - done;
+		float g = mu->current + dg * (float)done;
+		mix_stereo(m->mix_left + done, m->mix_right + done, mu->ring + (size_t)at * 2, run, g, dg, g, dg);
+		done += run;
+	}
+	mu->current = mu->gain;
+	SDL_SetAtomicInt(&mu->read, (int)(read + count));
+
+	if (ended && count == avail) {
+		Event e = { EVT_MUSIC_END, 0, mu };
+		ring_push(&m->events, &e);
+		m->playing = NULL;
+	}
+}
+
+// --- Mixing ---
+
+static void apply_commands(Mixer *m) {
+	Command c;
+	while (ring_pop(&m->commands, &c)) {
+		m->applied++;
+		if (c.type == CMD_PLAY) {
+			Voice *v = &m->voices[c.voice & 0xFFFF];
+			memset(v, 0, sizeof(*v));
+			v->sound = (const Sound *)c.ptr;
+			v->id = c.voice;
+			v->gain = c.gain;
+			v->pan = c.pan;
+			v->pitch = c.pitch;
+			v->loop = (int)c.loop;
+			voice_step(m, v);
+			voice_targets(v);
+			v->left = v->target_left;
+			v->right = v->target_right;
+			v->active_index = m->active_count;
+			m->active[m->active_count++] = c.voice & 0xFFFF;
+		} else if (c.type == CMD_STOP_SOUND) {
+			// Freed by the game thread once this command is consumed: drop now
+			for (uint32_t i = 0; i < m->active_count;) {
+				Voice *v = &m->voices[m->active[i]];
+				if (v->sound == c.ptr) voice_free(m, v);
+				else i++;
+			}
+		} else if (c.type == CMD_MASTER) {
+			m->master = c.gain;
+		} else if (c.type == CMD_MUSIC) {
+			m->playing = (Music *)c.ptr;
+			if (m->playing) m->playing->gain = m->playing->current = c.gain;
+		} else if (c.type == CMD_MUSIC_GAIN) {
+			if (m->playing) m->playing->gain = c.gain;
+		} else {
+			Voice *v = voice_get(m, c.voice);
+			if (!v) continue;
+			if (c.type == CMD_STOP) v->stopping = 1;
+			else if (c.type == CMD_GAIN) { v->gain = c.gain; voice_targets(v); }
+			else if (c.type == CMD_PAN) { v->pan = c.pan; voice_targets(v); }
+			else if (c.type == CMD_PITCH) { v->pitch = c.pitch; voice_step(m, v); }
+		}
+	}
+}
+
+static void render_block(Mixer *m, float *out, uint32_t n) {
+	memset(m->mix_left, 0, n * sizeof(float));
+	memset(m->mix_right, 0, n * sizeof(float));
+	for (uint32_t i = 0; i < m->active_count;) {
+		Voice *v = &m->voices[m->active[i]];
+		if (mix_voice(m, v, n)) i++;
+		else voice_free(m, v);
+	}
+	mix_music(m, n);
+	float dg = (m->master - m->master_current) / (float)n;
+	write_output(out, m->mix_left, m->mix_right, n, m->master_current, dg);
+	m->master_current = m->master;
+}
+
+static void render(Mixer *m, float *out, uint32_t frames) {
+	apply_commands(m);
+	for (uint32_t done = 0; done < frames;) {
+		uint32_t n = frames - done < VOID_AUDIO_BLOCK ? frames - done : VOID_AUDIO_BLOCK;
+		render_block(m, out + (size_t)done * 2, n);
+		done += n;
+	}
+	SDL_SetAtomicInt(&m->active_stat, (int)m->active_count);
+	SDL_AddAtomicInt(&m->frames_mixed, (int)frames);
+	// Published after mixing: retired sounds were not touched in this block
+	SDL_SetAtomicInt(&m->consumed, (int)m->applied);
+}
+
+static void SDLCALL audio_callback(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount) {
+	(void)total_amount;
+	Mixer *m = (Mixer *)userdata;
+	uint32_t frames = (uint32_t)additional_amount / (sizeof(float) * VOID_AUDIO_CHANNELS);
+	if (frames == 0) return;
+	uint64_t start = SDL_GetTicksNS();
+	for (uint32_t done = 0; done < frames;) {
+		uint32_t n = frames - done < VOID_AUDIO_BLOCK ? frames - done : VOID_AUDIO_BLOCK;
+		render(m, m->out, n);
+		SDL_PutAudioStreamData(stream, m->out, (int)(n * sizeof(float) * VOID_AUDIO_CHANNELS));
+		done += n;
+	}
+	double spent = (double)(SDL_GetTicksNS() - start);
+	double audio = (double)frames * 1e9 / (double)m->rate;
+	SDL_SetAtomicInt(&m->load, (int)(spent / audio * 1e6));
+}
+
+// --- Subsystem ---
+
+int void_audio_init(const char *driver) {
+	if (driver && driver[0]) SDL_SetHint(SDL_HINT_AUDIO_DRIVER, driver);
+	if (!SDL_InitSubSystem(SDL_INIT_AUDIO)) {
+		fprintf(stderr, "void_audio: init failed: %s\n", SDL_GetError());
+		return 0;
+	}
+	return 1;
+}
+
+void void_audio_quit(void) {
+	SDL_QuitSubSystem(SDL_INIT_AUDIO);
+}
+
+// --- Mixer ---
+
+void *void_audio_create(uint32_t sample_rate, uint32_t max_voices, uint32_t queue_capacity) {
+	Mixer *m = calloc(1, sizeof(Mixer));
+	m->rate = sample_rate ? sample_rate : DEFAULT_RATE;
+	if (max_voices == 0) max_voices = 1;
+	if (max_voices > VOID_AUDIO_MAX_VOICES) max_voices = VOID_AUDIO_MAX_VOICES;
+	m->max_voices = max_voices;
+	m->generation = calloc(max_voices, sizeof(uint16_t));
+	m->busy = calloc(max_voices, 1);
+	m->free_slots = malloc(max_voices * sizeof(uint32_t));
+	for (uint32_t i = 0; i < max_voices; i++) m->free_slots[i] = max_voices - 1 - i;
+	m->free_count = max_voices;
+	m->voices = calloc(max_voices, sizeof(Voice));
+	m->active = malloc(max_voices * sizeof(uint32_t));
+	ring_init(&m->commands, sizeof(Command), queue_capacity ? queue_capacity : DEFAULT_COMMANDS);
+	// Every voice ends at most once before its slot is reused, plus music endings
+	ring_init(&m->events, sizeof(Event), max_voices + 16);
+	m->master = m->master_current = 1.0f;
+	return m;
+}
+
+static void music_quit(Music *mu) {
+	SDL_SetAtomicInt(&mu->quit, 1);
+	SDL_SignalSemaphore(mu->wake);
+}
+
+// The thread has normally exited by now: it quit when the music was retired
+static void music_free(Music *mu) {
+	music_quit(mu);
+	if (mu->thread) SDL_WaitThread(mu->thread, NULL);
+	SDL_DestroySemaphore(mu->wake);
+	stb_vorbis_close(mu->vorbis);
+	free(mu->ring);
+	free(mu);
+}
+
+static void retired_free(Retired *r) {
+	if (r->type == RETIRED_MUSIC) {
+		music_free((Music *)r->ptr);
+	} else {
+		Sound *s = (Sound *)r->ptr;
+		free(s->samples);
+		free(s);
+	}
+}
+
+void void_audio_destroy(void *mixer) {
+	Mixer *m = (Mixer *)mixer;
+	if (!m) return;
+	void_audio_close(m);
+	for (uint32_t i = 0; i < m->retired_count; i++) retired_free(&m->retired[i]);
+	if (m->music) music_free(m->music);
+	free(m->retired);
+	free(m->backlog);
+	free(m->commands.items);
+	free(m->events.items);
+	free(m->voices);
+	free(m->active);
+	free(m->generation);
+	free(m->busy);
+	free(m->free_slots);
+	free(m);
+}
+
+int void_audio_open(void *mixer, uint32_t device_frames) {
+	Mixer *m = (Mixer *)mixer;
+	if (m->stream) return 1;
+	if (device_frames) {
+		char frames[16];
+		snprintf(frames, sizeof(frames), "%u", device_frames);
+		SDL_SetHint(SDL_HINT_AUDIO_DEVICE_SAMPLE_FRAMES, frames);
+	}
+	SDL_AudioSpec spec = { SDL_AUDIO_F32, VOID_AUDIO_CHANNELS, (int)m->rate };
+	m->stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, audio_callback, m);
+	if (!m->stream) {
+		fprintf(stderr, "void_audio: cannot open playback device: %s\n", SDL_GetError());
+		return 0;
+	}
+	SDL_ResumeAudioStreamDevice(m->stream);
+	return 1;
+}
+
+void void_audio_close(void *mixer) {
+	Mixer *m = (Mixer *)mixer;
+	if (!m->stream) return;
+	SDL_DestroyAudioStream(m->stream);   // waits for a running callback
+	m->stream = NULL;
+}
+
+void void_audio_render(void *mixer, float *out, uint32_t frames) {
+	Mixer *m = (Mixer *)mixer;
+	if (m->stream) return;
+	render(m, out, frames);
+}
+
+// --- Commands (game thread) ---
+
+static void flush_backlog(Mixer *m) {
+	uint32_t sent = 0;
+	while (sent < m->backlog_count && ring_push(&m->commands, &m->backlog[sent])) sent++;
+	if (sent == 0) return;
+	m->backlog_count -= sent;
+	memmove(m->backlog, m->backlog + sent, m->backlog_count * sizeof(Command));
+}
+
+static void push_command(Mixer *m, const Command *c) {
+	m->issued++;
+	// Keep order: nothing jumps ahead of the backlog
+	if (m->backlog_count == 0 && ring_push(&m->commands, c)) return;
+	if (m->backlog_count >= m->backlog_capacity) {
+		m->backlog_capacity = m->backlog_capacity ? m->backlog_capacity * 2 : 64;
+		m->backlog = realloc(m->backlog, m->backlog_capacity * sizeof(Command));
+	}
+	m->backlog[m->backlog_count++] = *c;
+}
+
+static void retire(Mixer *m, RetiredType type, void *ptr) {
+	if (m->retired_count >= m->retired_capacity) {
+		m->retired_capacity = m->retired_capacity ? m->retired_capacity * 2 : 16;
+		m->retired = realloc(m->retired, m->retired_capacity * sizeof(Retired));
+	}
+	m->retired[m->retired_count++] = (Retired){ type, ptr, m->issued };
+}
+
+static void release_slot(Mixer *m, uint32_t voice) {
+	uint32_t slot = voice & 0xFFFF;
+	if (slot >= m->max_voices || !m->busy[slot] || m->generation[slot] != (voice >> 16)) return;
+	m->busy[slot] = 0;
+	m->generation[slot]++;
+	m->free_slots[m->free_count++] = slot;
+}
+
+void void_audio_update(void *mixer) {
+	Mixer *m = (Mixer *)mixer;
+	flush_backlog(m);
+
+	Event e;
+	while (ring_pop(&m->events, &e)) {
+		if (e.type == EVT_VOICE_END) {
+			release_slot(m, e.voice);
+		} else if (e.type == EVT_MUSIC_END && e.ptr == m->music) {
+			music_quit(m->music);
+			retire(m, RETIRED_MUSIC, m->music);
+			m->music = NULL;
+		}
+	}
+
+	uint32_t consumed = (uint32_t)SDL_GetAtomicInt(&m->consumed);
+	uint32_t kept = 0;
+	for (uint32_t i = 0; i < m->retired_count; i++) {
+		Retired *r = &m->retired[i];
+		if ((int32_t)(consumed - r->issued) >= 0) retired_free(r);
+		else m->retired[kept++] = *r;
+	}
+	m->retired_count = kept;
+}
+
+void void_audio_set_master(void *mixer, float gain) {
+	Command c = { CMD_MASTER, 0, NULL, gain, 0.0f, 0.0f, 0 };
+	push_command((Mixer *)mixer, &c);
+}
+
+// --- Sounds ---
+
+static int has_extension(const char *path, const char *ext) {
+	size_t n = strlen(path), e = strlen(ext);
+	return n >= e && SDL_strcasecmp(path + n - e, ext) == 0;
+}
+
+static Sound *sound_alloc(uint32_t frames, uint32_t channels, uint32_t rate) {
+	Sound *s = calloc(1, sizeof(Sound));
+	s->samples = malloc((size_t)frames * channels * sizeof(float));
+	s->frames = frames;
+	s->channels = channels;
+	s->rate = rate;
+	return s;
+}
+
+static Sound *load_vorbis(const char *path) {
+	int error = 0;
+	stb_vorbis *v = stb_vorbis_open_filename(path, &error, NULL);
+	if (!v) return NULL;
+	stb_vorbis_info info = stb_vorbis_get_info(v);
+	uint32_t frames = stb_vorbis_stream_length_in_samples(v);
+	uint32_t channels = info.channels >= 2 ? 2 : 1;
+	Sound *s = NULL;
+	if (frames > 0) {
+		s = sound_alloc(frames, channels, info.sample_rate);
+		// Asks for the output channel count: stb_vorbis mixes wider files down
+		s->frames = (uint32_t)stb_vorbis_get_samples_float_interleaved(v, (int)channels,
+			s->samples, (int)(frames * channels));
+	}
+	stb_vorbis_close(v);
+	if (s && s->frames == 0) {
+		free(s->samples);
+		free(s);
+		s = NULL;
+	}
+	return s;
+}
+
+static Sound *load_wav(const char *path) {
+	SDL_AudioSpec spec;
+	Uint8 *data = NULL;
+	Uint32 size = 0;
+	if (!SDL_LoadWAV(path, &spec, &data, &size)) return NULL;
+	SDL_AudioSpec dst = { SDL_AUDIO_F32, spec.channels >= 2 ? 2 : 1, spec.freq };
+	Uint8 *converted = NULL;
+	int converted_size = 0;
+	int ok = SDL_ConvertAudioSamples(&spec, data, (int)size, &dst, &converted, &converted_size);
+	SDL_free(data);
+	if (!ok) return NULL;
+	uint32_t frames = (uint32_t)converted_size / (sizeof(float) * (uint32_t)dst.channels);
+	Sound *s = NULL;
+	if (frames > 0) {
+		s = sound_alloc(frames, (uint32_t)dst.channels, (uint32_t)dst.freq);
+		memcpy(s->samples, converted, (size_t)frames * dst.channels * sizeof(float));
+	}
+	SDL_free(converted);
+	return s;
+}
+
+void *void_audio_sound_load(const char *path) {
+	VOID_TRACE_SCOPE("sound_load");
+	Sound *s = has_extension(path, ".ogg") ? load_vorbis(path) : load_wav(path);
+	if (!s) fprintf(stderr, "void_audio: cannot load sound %s\n", path);
+	return s;
+}
+
+void *void_audio_sound_create(const float *samples, uint32_t frames, uint32_t channels, uint32_t rate) {
+	if (!samples || frames == 0 || channels < 1 || channels > 2 || rate == 0) {
+		fprintf(stderr, "void_audio: sound needs frames, 1 or 2 channels and a rate\n");
+		return NULL;
+	}
+	Sound *s = sound_alloc(frames, channels, rate);
+	memcpy(s->samples, samples, (size_t)frames * channels * sizeof(float));
+	return s;
+}
+
+void void_audio_sound_destroy(void *mixer, void *sound) {
+	Sound *s = (Sound *)sound;
+	if (!s) return;
+	Mixer *m = (Mixer *)mixer;
+	if (!m) {
+		free(s->samples);
+		free(s);
+		return;
+	}
+	Command c = { CMD_STOP_SOUND, 0, s, 0.0f, 0.0f, 0.0f, 0 };
+	push_command(m, &c);
+	retire(m, RETIRED_SOUND, s);
+}
+
+uint32_t void_audio_sound_frames(void *sound) {
+	return sound ? ((Sound *)sound)->frames : 0;
+}
+
+uint32_t void_audio_sound_rate(void *sound) {
+	return sound ? ((Sound *)sound)->rate : 0;
+}
+
+// --- Voices ---
+
+uint32_t void_audio_play(void *mixer, void *sound, float gain, float pan, float pitch, int loop) {
+	Mixer *m = (Mixer *)mixer;
+	if (!sound || m->free_count == 0) return VOID_AUDIO_NONE;
+	uint32_t slot = m->free_slots[--m->free_count];
+	m->busy[slot] = 1;
+	uint32_t voice = slot | (uint32_t)m->generation[slot] << 16;
+	Command c = { CMD_PLAY, voice, sound, gain, pan, pitch, loop ? 1u : 0u };
+	push_command(m, &c);
+	return voice;
+}
+
+static void voice_command(void *mixer, uint32_t type, uint32_t voice, float gain, float pan, float pitch) {
+	Mixer *m = (Mixer *)mixer;
+	if (!void_audio_playing(m, voice)) return;
+	Command c = { type, voice, NULL, gain, pan, pitch, 0 };
+	push_command(m, &c);
+}
+
+void void_audio_stop(void *mixer, uint32_t voice) {
+	voice_command(mixer, CMD_STOP, voice, 0.0f, 0.0f, 0.0f);
+}
+
+void void_audio_set_gain(void *mixer, uint32_t voice, float gain) {
+	voice_command(mixer, CMD_GAIN, voice, gain, 0.0f, 0.0f);
+}
+
+void void_audio_set_pan(void *mixer, uint32_t voice, float pan) {
+	voice_command(mixer, CMD_PAN, voice, 0.0f, pan, 0.0f);
+}
+
+void void_audio_set_pitch(void *mixer, uint32_t voice, float pitch) {
+	voice_command(mixer, CMD_PITCH, voice, 0.0f, 0.0f, pitch);
+}
+
+int void_audio_playing(void *mixer, uint32_t voice) {
+	Mixer *m = (Mixer *)mixer;
+	uint32_t slot = voice & 0xFFFF;
+	return slot < m->max_voices && m->busy[slot] && m->generation[slot] == (voice >> 16);
+}
+
+// --- Music ---
+
+static void music_write(Music *mu, const float *frames, uint32_t count) {
+	uint32_t written = (uint32_t)SDL_GetAtomicInt(&mu->written);
+	for (uint32_t done = 0; done < count;) {
+		uint32_t at = (written + done) & mu->mask;
+		uint32_t run = mu->mask + 1 - at;
+		if (run > count - done) run = count - done;
+		memcpy(mu->ring + (size_t)at * 2, frames + (size_t)done * 2, (size_t)run * 2 * sizeof(float));
+		done += run;
+	}
+	SDL_SetAtomicInt(&mu->written, (int)(written + count));
+}
+
+// Decodes ahead of the mixer and converts to the output rate (SDL's
+// resampler, off the audio thread)
+static int SDLCALL music_thread(void *data) {
+	Music *mu = (Music *)data;
+	void_trace_thread_name("audio_music");
+	stb_vorbis_info info = stb_vorbis_get_info(mu->vorbis);
+	SDL_AudioSpec src = { SDL_AUDIO_F32, 2, (int)info.sample_rate };
+	SDL_AudioSpec dst = { SDL_AUDIO_F32, 2, (int)mu->rate };
+	SDL_AudioStream *convert = SDL_CreateAudioStream(&src, &dst);
+	float chunk[MUSIC_CHUNK * 2];
+	uint32_t idle_ms = MUSIC_RING_MS / 8;
+	uint32_t since_start = 0;   // frames decoded since the last rewind
+	int flushed = 0;
+
+	while (convert && !SDL_GetAtomicInt(&mu->quit)) {
+		uint32_t used = (uint32_t)SDL_GetAtomicInt(&mu->written) - (uint32_t)SDL_GetAtomicInt(&mu->read);
+		if (mu->mask + 1 - used < MUSIC_CHUNK) {
+			SDL_WaitSemaphoreTimeout(mu->wake, (Sint32)idle_ms);
+			continue;
+		}
+		int bytes = SDL_GetAudioStreamData(convert, chunk, (int)sizeof(chunk));
+		if (bytes > 0) {
+			music_write(mu, chunk, (uint32_t)bytes / (2 * sizeof(float)));
+			continue;
+		}
+		if (flushed) break;
+		int frames = stb_vorbis_get_samples_float_interleaved(mu->vorbis, 2, chunk, MUSIC_CHUNK * 2);
+		if (frames > 0) {
+			since_start += (uint32_t)frames;
+			SDL_PutAudioStreamData(convert, chunk, frames * 2 * (int)sizeof(float));
+		} else if (mu->loop && since_start > 0) {
+			stb_vorbis_seek_start(mu->vorbis);
+			since_start = 0;
+		} else {
+			SDL_FlushAudioStream(convert);
+			flushed = 1;
+		}
+	}
+	SDL_DestroyAudioStream(convert);
+	SDL_SetAtomicInt(&mu->ended, 1);
+	return 0;
+}
+
+int void_audio_music_play(void *mixer, const char *path, float gain, int loop) {
+	Mixer *m = (Mixer *)mixer;
+	int error = 0;
+	stb_vorbis *v = stb_vorbis_open_filename(path, &error, NULL);
+	if (!v) {
+		fprintf(stderr, "void_audio: cannot open music %s (stb_vorbis error %d)\n", path, error);
+		return 0;
+	}
+	Music *mu = calloc(1, sizeof(Music));
+	mu->vorbis = v;
+	mu->rate = m->rate;
+	mu->loop = loop;
+	uint32_t frames = next_pow2(m->rate * MUSIC_RING_MS / 1000);
+	mu->ring = malloc((size_t)frames * 2 * sizeof(float));
+	mu->mask = frames - 1;
+	mu->wake = SDL_CreateSemaphore(0);
+	mu->thread = SDL_CreateThread(music_thread, "void_audio_music", mu);
+	if (!mu->thread) {
+		fprintf(stderr, "void_audio: cannot start music thread: %s\n", SDL_GetError());
+		music_free(mu);
+		return 0;
+	}
+	void_audio_music_stop(m);
+	m->music = mu;
+	Command c = { CMD_MUSIC, 0, mu, gain, 0.0f, 0.0f, 0 };
+	push_command(m, &c);
+	return 1;
+}
+
+void void_audio_music_stop(void *mixer) {
+	Mixer *m = (Mixer *)mixer;
+	if (!m->music) return;
+	Command c = { CMD_MUSIC, 0, NULL, 0.0f, 0.0f, 0.0f, 0 };
+	push_command(m, &c);
+	music_quit(m->music);
+	retire(m, RETIRED_MUSIC, m->music);
+	m->music = NULL;
+}
+
+void void_audio_music_set_gain(void *mixer, float gain) {
+	Mixer *m = (Mixer *)mixer;
+	if (!m->music) return;
+	Command c = { CMD_MUSIC_GAIN, 0, NULL, gain, 0.0f, 0.0f, 0 };
+	push_command(m, &c);
+}
+
+int void_audio_music_playing(void *mixer) {
+	return ((Mixer *)mixer)->music != NULL;
+}
+
+// --- Stats ---
+
+uint32_t void_audio_active_voices(void *mixer) {
+	return (uint32_t)SDL_GetAtomicInt(&((Mixer *)mixer)->active_stat);
+}
+
+uint32_t void_audio_frames_mixed(void *mixer) {
+	return (uint32_t)SDL_GetAtomicInt(&((Mixer *)mixer)->frames_mixed);
+}
+
+uint32_t void_audio_music_underruns(void *mixer) {
+	return (uint32_t)SDL_GetAtomicInt(&((Mixer *)mixer)->underruns);
+}
+
+float void_audio_mix_load(void *mixer) {
+	return (float)SDL_GetAtomicInt(&((Mixer *)mixer)->load) * 1e-6f;
+}
+
+uint32_t void_audio_backlog(void *mixer) {
+	return ((Mixer *)mixer)->backlog_count;
+}
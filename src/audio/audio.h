@@ -0,0 +1,97 @@
+// Void Audio — Voice mixer on an SDL3 audio stream
+// One mixer renders interleaved float stereo at a fixed rate. Sounds are
+// decoded PCM (mono or stereo, any rate) played by voices with gain,
+// constant-power pan and pitch; voices resample with linear interpolation
+// and gain changes ramp over one block, so nothing clicks. Music is an Ogg
+// Vorbis file decoded and resampled on its own thread into a ring the
+// mixer reads from.
+//
+// Threads: the game thread owns the mixer API. It reaches the mixer
+// callback only through a single-producer / single-consumer command ring
+// and gets voice and music endings back through a second ring, so neither
+// side ever waits on the other. Commands that do not fit wait in a
+// game-side backlog until the next update. The callback never allocates,
+// locks or touches files; SDL copies each mixed block into the stream.
+// Sounds and music handed to the mixer are freed by update() once the
+// callback has moved past every command that used them.
+//
+// Per frame: play/stop/set_* as needed → update(). Headless: init("dummy")
+// runs the real device path without hardware; render() mixes offline on
+// the calling thread while no device is open.
+
+#ifndef VOID_AUDIO_AUDIO_H
+#define VOID_AUDIO_AUDIO_H
+
+#include <stdint.h>
+
+#define VOID_AUDIO_NONE      0xFFFFFFFFu
+#define VOID_AUDIO_CHANNELS  2       // output frames are interleaved L, R floats
+#define VOID_AUDIO_BLOCK     512     // frames mixed per pass
+#define VOID_AUDIO_MAX_VOICES 65535  // voice handles are slot | generation << 16
+
+// --- Subsystem ---
+// driver: SDL audio driver name ("dummy" for tests), NULL or "" = platform
+// default. Returns 1 on success.
+int  void_audio_init(const char *driver);
+void void_audio_quit(void);
+
+// --- Mixer ---
+// sample_rate: output rate (0 = 48000); queue_capacity: commands in flight
+// between update() calls (0 = 1024)
+void *void_audio_create(uint32_t sample_rate, uint32_t max_voices, uint32_t queue_capacity);
+void  void_audio_destroy(void *mixer);     // closes the device, stops music
+// Opens the default playback device and starts mixing. device_frames asks
+// SDL for that device buffer size (0 = SDL's choice; smaller = lower
+// latency). Returns 1 on success.
+int   void_audio_open(void *mixer, uint32_t device_frames);
+void  void_audio_close(void *mixer);
+// Mixes `frames` interleaved stereo frames into out on the calling thread
+// (tests, benchmarks, offline bounces). Only while the device is closed.
+void  void_audio_render(void *mixer, float *out, uint32_t frames);
+// Game thread, once per frame: flushes backlogged commands, collects voice
+// and music endings, frees retired sounds and music
+void  void_audio_update(void *mixer);
+void  void_audio_set_master(void *mixer, float gain);
+
+// --- Sounds ---
+// Decoded in full to float: WAV (SDL) or Ogg Vorbis (stb_vorbis); more than
+// two channels are mixed down to stereo. NULL on error.
+void *void_audio_sound_load(const char *path);
+// Copies frames * channels interleaved floats (channels 1 or 2)
+void *void_audio_sound_create(const float *samples, uint32_t frames, uint32_t channels, uint32_t rate);
+// Stops the sound's voices; the sound is freed once the mixer lets go of it.
+// Sounds never played may pass mixer = NULL.
+void  void_audio_sound_destroy(void *mixer, void *sound);
+uint32_t void_audio_sound_frames(void *sound);
+uint32_t void_audio_sound_rate(void *sound);
+
+// --- Voices ---
+// pan -1 (left) .. 1 (right); pitch scales the playback rate (1 = as
+// recorded, clamped to 1/64 .. 64). Returns the voice, NONE when every
+// voice is busy. Voices free themselves when a one-shot ends.
+uint32_t void_audio_play(void *mixer, void *sound, float gain, float pan, float pitch, int loop);
+void void_audio_stop(void *mixer, uint32_t voice);    // fades out over one block
+void void_audio_set_gain(void *mixer, uint32_t voice, float gain);
+void void_audio_set_pan(void *mixer, uint32_t voice, float pan);
+void void_audio_set_pitch(void *mixer, uint32_t voice, float pitch);
+// As of the last update()
+int  void_audio_playing(void *mixer, uint32_t voice);
+
+// --- Music ---
+// Streams an Ogg Vorbis file, replacing the current music. Returns 1 when
+// the file opened.
+int  void_audio_music_play(void *mixer, const char *path, float gain, int loop);
+void void_audio_music_stop(void *mixer);
+void void_audio_music_set_gain(void *mixer, float gain);
+int  void_audio_music_playing(void *mixer);   // as of the last update()
+
+// --- Stats (written by the mixer, readable from any thread) ---
+uint32_t void_audio_active_voices(void *mixer);
+uint32_t void_audio_frames_mixed(void *mixer);     // wraps at 2^32
+uint32_t void_audio_music_underruns(void *mixer);  // blocks the decoder fell behind on
+// Share of real time the last callback spent mixing (0..1)
+float    void_audio_mix_load(void *mixer);
+// Commands waiting in the game-side backlog (ring was full)
+uint32_t void_audio_backlog(void *mixer);
+
+#endif
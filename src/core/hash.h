@@ -0,0 +1,114 @@
+// Void Core — FNV-1a hashing and a uint64 -> index hash map
+// Header-only (static inline) so each module keeps its own maps.
+
+#ifndef VOID_CORE_HASH_H
+#define VOID_CORE_HASH_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- Hashing ---
+
+#define FNV_OFFSET 0xcbf29ce484222325ULL
+#define FNV_PRIME  0x100000001b3ULL
+
+static inline uint64_t fnv_bytes(uint64_t h, const void *data, size_t size) {
+	const uint8_t *p = (const uint8_t *)data;
+	for (size_t i = 0; i < size; i++) {
+		h ^= p[i];
+		h *= FNV_PRIME;
+	}
+	return h;
+}
+
+static inline uint64_t fnv_str(uint64_t h, const char *s) {
+	h = fnv_bytes(h, s, strlen(s));
+	return fnv_bytes(h, "", 1);  // terminator keeps sections distinct
+}
+
+static inline uint64_t fnv_u64(uint64_t h, uint64_t v) {
+	return fnv_bytes(h, &v, sizeof(v));
+}
+
+// --- Hash map (uint64 key -> slot index, open addressing) ---
+
+typedef struct HashMap {
+	uint64_t *keys;
+	int32_t  *values;
+	uint32_t  capacity;  // power of two
+	uint32_t  count;
+} HashMap;
+
+static inline int32_t map_get(const HashMap *m, uint64_t key) {
+	if (!m->capacity) return -1;
+	uint32_t i = (uint32_t)key & (m->capacity - 1);
+	while (m->values[i] >= 0) {
+		if (m->keys[i] == key) return m->values[i];
+		i = (i + 1) & (m->capacity - 1);
+	}
+	return -1;
+}
+
+static inline void map_put(HashMap *m, uint64_t key, int32_t value);
+
+static inline void map_grow(HashMap *m) {
+	HashMap old = *m;
+	m->capacity = old.capacity ? old.capacity * 2 : 64;
+	m->count = 0;
+	m->keys = calloc(m->capacity, sizeof(uint64_t));
+	m->values = malloc(m->capacity * sizeof(int32_t));
+	for (uint32_t i = 0; i < m->capacity; i++) m->values[i] = -1;
+	for (uint32_t i = 0; i < old.capacity; i++) {
+		if (old.values[i] >= 0) map_put(m, old.keys[i], old.values[i]);
+	}
+	free(old.keys);
+	free(old.values);
+}
+
+static inline void map_put(HashMap *m, uint64_t key, int32_t value) {
+	if ((m->count + 1) * 2 > m->capacity) map_grow(m);
+	uint32_t i = (uint32_t)key & (m->capacity - 1);
+	while (m->values[i] >= 0 && m->keys[i] != key) i = (i + 1) & (m->capacity - 1);
+	if (m->values[i] < 0) m->count++;
+	m->keys[i] = key;
+	m->values[i] = value;
+}
+
+static inline void map_remove(HashMap *m, uint64_t key) {
+	if (!m->capacity) return;
+	uint32_t i = (uint32_t)key & (m->capacity - 1);
+	while (m->values[i] >= 0 && m->keys[i] != key) i = (i + 1) & (m->capacity - 1);
+	if (m->values[i] < 0) return;
+	m->values[i] = -1;
+	m->count--;
+	// Re-insert the rest of the probe run so lookups stay correct
+	i = (i + 1) & (m->capacity - 1);
+	while (m->values[i] >= 0) {
+		uint64_t k = m->keys[i];
+		int32_t v = m->values[i];
+		m->values[i] = -1;
+		m->count--;
+		map_put(m, k, v);
+		i = (i + 1) & (m->capacity - 1);
+	}
+}
+
+static inline void map_clear(HashMap *m) {
+	free(m->keys);
+	free(m->values);
+	memset(m, 0, sizeof(*m));
+}
+
+// Bijective 64-bit mix (splitmix64 finalizer). Spreads pointer keys, whose
+// low bits are alignment zeros, across map slots.
+static inline uint64_t hash_mix(uint64_t x) {
+	x ^= x >> 30;
+	x *= 0xbf58476d1ce4e5b9ULL;
+	x ^= x >> 27;
+	x *= 0x94d049bb133111ebULL;
+	x ^= x >> 31;
+	return x;
+}
+
+#endif
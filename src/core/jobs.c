@@ -0,0 +1,140 @@
+// Void Core — Worker pool with chunked parallel-for
+
+#include "jobs.h"
+#include "trace.h"
+
+#include <SDL3/SDL.h>
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define VOID_JOBS_MAX_WORKERS 31
+
+// --- Pool state ---
+
+static SDL_Thread    *s_threads[VOID_JOBS_MAX_WORKERS];
+static uint32_t       s_worker_count = 0;
+static SDL_Semaphore *s_wake = NULL;   // one post per worker asked to join
+static SDL_Semaphore *s_done = NULL;   // one post per worker leaving a job
+static SDL_AtomicInt  s_busy;          // one parallel_for in flight at a time
+static SDL_AtomicInt  s_quit;
+static SDL_AtomicInt  s_next_worker_id;
+static SDL_TLSID      s_worker_tls;    // pool thread's worker id (unset = 0, caller)
+
+// Current job (written by the caller before waking workers)
+static VoidJobRangeFn s_fn = NULL;
+static void          *s_ctx = NULL;
+static uint32_t       s_count = 0;
+static uint32_t       s_chunk = 0;
+static uint32_t       s_chunks = 0;
+static SDL_AtomicInt  s_next_chunk;
+
+static void run_chunks(uint32_t worker) {
+	for (;;) {
+		uint32_t c = (uint32_t)SDL_AddAtomicInt(&s_next_chunk, 1);
+		if (c >= s_chunks) break;
+		uint32_t begin = c * s_chunk;
+		uint32_t end = begin + s_chunk;
+		if (end > s_count) end = s_count;
+		s_fn(s_ctx, begin, end, worker);
+	}
+}
+
+static int worker_main(void *data) {
+	(void)data;
+	uint32_t id = (uint32_t)SDL_AddAtomicInt(&s_next_worker_id, 1) + 1;
+	SDL_SetTLS(&s_worker_tls, (void *)(uintptr_t)id, NULL);
+	char name[VOID_TRACE_NAME_MAX];
+	snprintf(name, sizeof(name), "worker %u", id);
+	void_trace_thread_name(name);
+	for (;;) {
+		SDL_WaitSemaphore(s_wake);
+		if (SDL_GetAtomicInt(&s_quit)) break;
+		void_trace_begin("jobs");
+		run_chunks(id);
+		void_trace_end();
+		SDL_SignalSemaphore(s_done);
+	}
+	return 0;
+}
+
+// --- Lifecycle ---
+
+int void_jobs_init(uint32_t worker_count) {
+	if (s_wake) return 1;
+	if (worker_count == 0) {
+		int cores = SDL_GetNumLogicalCPUCores();
+		worker_count = cores > 1 ? (uint32_t)(cores - 1) : 0;
+	}
+	if (worker_count > VOID_JOBS_MAX_WORKERS) worker_count = VOID_JOBS_MAX_WORKERS;
+
+	s_wake = SDL_CreateSemaphore(0);
+	s_done = SDL_CreateSemaphore(0);
+	if (!s_wake || !s_done) {
+		void_jobs_shutdown();
+		return 0;
+	}
+	SDL_SetAtomicInt(&s_busy, 0);
+	SDL_SetAtomicInt(&s_quit, 0);
+	SDL_SetAtomicInt(&s_next_worker_id, 0);
+
+	s_worker_count = 0;
+	for (uint32_t i = 0; i < worker_count; i++) {
+		SDL_Thread *t = SDL_CreateThread(worker_main, "void_worker", NULL);
+		if (!t) break;
+		s_threads[s_worker_count++] = t;
+	}
+	return 1;
+}
+
+void void_jobs_shutdown(void) {
+	SDL_SetAtomicInt(&s_quit, 1);
+	for (uint32_t i = 0; i < s_worker_count; i++) SDL_SignalSemaphore(s_wake);
+	for (uint32_t i = 0; i < s_worker_count; i++) SDL_WaitThread(s_threads[i], NULL);
+	s_worker_count = 0;
+	if (s_wake) { SDL_DestroySemaphore(s_wake); s_wake = NULL; }
+	if (s_done) { SDL_DestroySemaphore(s_done); s_done = NULL; }
+}
+
+uint32_t void_jobs_thread_count(void) {
+	return s_worker_count + 1;
+}
+
+// --- Parallel for ---
+
+void void_jobs_parallel_for(uint32_t count, uint32_t grain, VoidJobRangeFn fn, void *ctx) {
+	if (count == 0) return;
+	if (grain == 0) grain = 1;
+
+	// Aim for a few chunks per thread so uneven chunks still balance.
+	uint32_t threads = s_worker_count + 1;
+	uint32_t chunk = (count + threads * 4 - 1) / (threads * 4);
+	if (chunk < grain) chunk = grain;
+	uint32_t chunks = (count + chunk - 1) / chunk;
+
+	// A flag, not a mutex: SDL mutexes are recursive, so a nested call from a
+	// chunk the caller runs itself would take the lock and overwrite the job.
+	// Inline runs use the calling thread's own slot, which no one else holds.
+	if (s_worker_count == 0 || chunks < 2 || !SDL_CompareAndSwapAtomicInt(&s_busy, 0, 1)) {
+		fn(ctx, 0, count, (uint32_t)(uintptr_t)SDL_GetTLS(&s_worker_tls));
+		return;
+	}
+
+	s_fn = fn;
+	s_ctx = ctx;
+	s_count = count;
+	s_chunk = chunk;
+	s_chunks = chunks;
+	SDL_SetAtomicInt(&s_next_chunk, 0);
+
+	uint32_t wake = chunks - 1;
+	if (wake > s_worker_count) wake = s_worker_count;
+	for (uint32_t i = 0; i < wake; i++) SDL_SignalSemaphore(s_wake);
+
+	run_chunks(0);
+
+	// Every woken worker checks out before the job fields can change.
+	for (uint32_t i = 0; i < wake; i++) SDL_WaitSemaphore(s_done);
+
+	SDL_SetAtomicInt(&s_busy, 0);
+}
@@ -0,0 +1,30 @@
+// Void Core — Worker pool with chunked parallel-for
+// Workers are SDL threads; the calling thread always participates.
+
+#ifndef VOID_CORE_JOBS_H
+#define VOID_CORE_JOBS_H
+
+#include <stdint.h>
+
+// Range callback: process items [begin, end). `worker` is 0 for the
+// calling thread and 1..N for pool threads (usable as a scratch slot index).
+typedef void (*VoidJobRangeFn)(void *ctx, uint32_t begin, uint32_t end, uint32_t worker);
+
+// Start the pool. worker_count = 0 picks (logical cores - 1).
+// Returns 1 on success; safe to call more than once.
+int void_jobs_init(uint32_t worker_count);
+void void_jobs_shutdown(void);
+
+// Threads that can take part in a parallel_for (pool + caller).
+uint32_t void_jobs_thread_count(void);
+
+// Split [0, count) into chunks of at least `grain` items and run them
+// across the pool. Blocks until every chunk is done. Runs inline when the
+// pool is not started, already busy, or the range is a single chunk; an
+// inline run passes the calling thread's own worker slot.
+// Call only from the game thread or from inside a range callback (nested
+// calls run inline): any other thread would share slot 0 with the game
+// thread.
+void void_jobs_parallel_for(uint32_t count, uint32_t grain, VoidJobRangeFn fn, void *ctx);
+
+#endif
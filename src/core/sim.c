@@ -0,0 +1,429 @@
+// Void Core — Fixed-timestep simulation thread
+
+#include "sim.h"
+#include "trace.h"
+
+#include <SDL3/SDL.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_SYSTEMS  8
+#define MAX_CATCHUP  5          // steps run back to back before dropping time
+#define FRESH        4          // triple buffer: middle slot holds a new snapshot
+
+enum {
+	CMD_POSITION,
+	CMD_VELOCITY,
+	CMD_ANGULAR_VELOCITY,
+	CMD_IMPULSE,
+	CMD_GRAVITY,
+	CMD_GROUND,
+};
+
+typedef struct Command {
+	uint32_t type;
+	uint32_t body;
+	float    v[3];
+} Command;
+
+// One published step: transforms before and after it
+typedef struct Snapshot {
+	uint64_t step;
+	uint64_t due_ns;         // clock time the current transforms stand for
+	uint32_t body_count;
+	float   *prev;
+	float   *curr;
+	// Stats travel with the snapshot so the reader never races the thread
+	uint64_t dropped;
+	float    step_ms;
+} Snapshot;
+
+typedef struct System {
+	VoidSimSystemFn fn;
+	void           *ctx;
+} System;
+
+typedef struct Sim {
+	uint64_t     step_ns;
+	float        dt;
+	uint32_t     max_bodies;
+	uint32_t     body_count;
+	VoidSimBody *bodies;
+	System       systems[MAX_SYSTEMS];
+	uint32_t     system_count;
+
+	// World (simulation thread)
+	float gravity[3];
+	float ground_y;
+	float restitution;
+	int   has_ground;
+
+	// Commands: producers append under the lock, the step swaps the arrays
+	SDL_Mutex *lock;
+	Command   *pending;
+	uint32_t   pending_count;
+	uint32_t   pending_capacity;
+	Command   *applying;
+	uint32_t   applying_capacity;
+
+	// Triple buffer: the thread owns back, the reader owns front
+	Snapshot      slots[3];
+	SDL_AtomicInt middle;    // slot index | FRESH
+	int           back;
+	int           front;
+	float        *last;      // transforms after the previous step
+
+	// Reader
+	float *interpolated;
+	float  model[16];
+	float  alpha;
+
+	SDL_Thread   *thread;
+	SDL_AtomicInt running;
+	uint64_t      step;
+	uint64_t      dropped;
+	double        cost_ms;   // running average
+} Sim;
+
+static void write_transforms(const Sim *s, float *out) {
+	for (uint32_t i = 0; i < s->body_count; i++) {
+		memcpy(out + i * VOID_SIM_TRANSFORM_FLOATS, s->bodies[i].position, 3 * sizeof(float));
+		memcpy(out + i * VOID_SIM_TRANSFORM_FLOATS + 3, s->bodies[i].rotation, 4 * sizeof(float));
+	}
+}
+
+void *void_sim_create(uint32_t step_hz, uint32_t max_bodies) {
+	Sim *s = calloc(1, sizeof(Sim));
+	if (step_hz == 0) step_hz = 60;
+	s->step_ns = 1000000000ull / step_hz;
+	s->dt = 1.0f / (float)step_hz;
+	s->max_bodies = max_bodies ? max_bodies : 1;
+	s->bodies = calloc(s->max_bodies, sizeof(VoidSimBody));
+	s->gravity[1] = -9.81f;
+	s->lock = SDL_CreateMutex();
+	s->pending_capacity = s->applying_capacity = 64;
+	s->pending = malloc(s->pending_capacity * sizeof(Command));
+	s->applying = malloc(s->applying_capacity * sizeof(Command));
+
+	size_t floats = (size_t)s->max_bodies * VOID_SIM_TRANSFORM_FLOATS;
+	for (int i = 0; i < 3; i++) {
+		s->slots[i].prev = calloc(floats, sizeof(float));
+		s->slots[i].curr = calloc(floats, sizeof(float));
+	}
+	s->last = calloc(floats, sizeof(float));
+	s->interpolated = calloc(floats, sizeof(float));
+	s->front = 0;
+	SDL_SetAtomicInt(&s->middle, 1);
+	s->back = 2;
+	return s;
+}
+
+void void_sim_destroy(void *sim) {
+	Sim *s = (Sim *)sim;
+	if (!s) return;
+	void_sim_stop(s);
+	for (int i = 0; i < 3; i++) {
+		free(s->slots[i].prev);
+		free(s->slots[i].curr);
+	}
+	free(s->last);
+	free(s->interpolated);
+	free(s->pending);
+	free(s->applying);
+	SDL_DestroyMutex(s->lock);
+	free(s->bodies);
+	free(s);
+}
+
+uint32_t void_sim_add_body(void *sim, float x, float y, float z, float gravity_scale) {
+	Sim *s = (Sim *)sim;
+	if (s->thread || s->body_count >= s->max_bodies) return VOID_SIM_NONE;
+	VoidSimBody *b = &s->bodies[s->body_count];
+	memset(b, 0, sizeof(*b));
+	b->position[0] = x;
+	b->position[1] = y;
+	b->position[2] = z;
+	b->rotation[3] = 1.0f;
+	b->gravity_scale = gravity_scale;
+	return s->body_count++;
+}
+
+int void_sim_add_system(void *sim, VoidSimSystemFn fn, void *ctx) {
+	Sim *s = (Sim *)sim;
+	if (s->thread || s->system_count >= MAX_SYSTEMS) return 0;
+	s->systems[s->system_count++] = (System){ fn, ctx };
+	return 1;
+}
+
+// --- Commands ---
+
+static void push_command(Sim *s, uint32_t type, uint32_t body, float x, float y, float z) {
+	SDL_LockMutex(s->lock);
+	if (s->pending_count >= s->pending_capacity) {
+		s->pending_capacity *= 2;
+		s->pending = realloc(s->pending, s->pending_capacity * sizeof(Command));
+	}
+	s->pending[s->pending_count++] = (Command){ type, body, { x, y, z } };
+	SDL_UnlockMutex(s->lock);
+}
+
+void void_sim_set_position(void *sim, uint32_t body, float x, float y, float z) {
+	push_command((Sim *)sim, CMD_POSITION, body, x, y, z);
+}
+
+void void_sim_set_velocity(void *sim, uint32_t body, float x, float y, float z) {
+	push_command((Sim *)sim, CMD_VELOCITY, body, x, y, z);
+}
+
+void void_sim_set_angular_velocity(void *sim, uint32_t body, float x, float y, float z) {
+	push_command((Sim *)sim, CMD_ANGULAR_VELOCITY, body, x, y, z);
+}
+
+void void_sim_add_impulse(void *sim, uint32_t body, float x, float y, float z) {
+	push_command((Sim *)sim, CMD_IMPULSE, body, x, y, z);
+}
+
+void void_sim_set_gravity(void *sim, float x, float y, float z) {
+	push_command((Sim *)sim, CMD_GRAVITY, 0, x, y, z);
+}
+
+void void_sim_set_ground(void *sim, float ground_y, float restitution) {
+	push_command((Sim *)sim, CMD_GROUND, 0, ground_y, restitution, 0.0f);
+}
+
+static void apply_commands(Sim *s) {
+	SDL_LockMutex(s->lock);
+	Command *list = s->pending;
+	uint32_t count = s->pending_count;
+	uint32_t capacity = s->pending_capacity;
+	s->pending = s->applying;
+	s->pending_capacity = s->applying_capacity;
+	s->pending_count = 0;
+	SDL_UnlockMutex(s->lock);
+
+	for (uint32_t i = 0; i < count; i++) {
+		const Command *c = &list[i];
+		if (c->type == CMD_GRAVITY) {
+			memcpy(s->gravity, c->v, sizeof(s->gravity));
+			continue;
+		}
+		if (c->type == CMD_GROUND) {
+			s->ground_y = c->v[0];
+			s->restitution = c->v[1];
+			s->has_ground = 1;
+			continue;
+		}
+		if (c->body >= s->body_count) continue;
+		VoidSimBody *b = &s->bodies[c->body];
+		for (int k = 0; k < 3; k++) {
+			switch (c->type) {
+				case CMD_POSITION:         b->position[k] = c->v[k]; break;
+				case CMD_VELOCITY:         b->velocity[k] = c->v[k]; break;
+				case CMD_ANGULAR_VELOCITY: b->angular_velocity[k] = c->v[k]; break;
+				case CMD_IMPULSE:          b->velocity[k] += c->v[k]; break;
+			}
+		}
+	}
+	s->applying = list;
+	s->applying_capacity = capacity;
+}
+
+// --- Step ---
+
+static void integrate(Sim *s) {
+	float dt = s->dt;
+	for (uint32_t i = 0; i < s->body_count; i++) {
+		VoidSimBody *b = &s->bodies[i];
+		// Semi-implicit Euler
+		for (int k = 0; k < 3; k++) {
+			b->velocity[k] += s->gravity[k] * b->gravity_scale * dt;
+			b->position[k] += b->velocity[k] * dt;
+		}
+		if (s->has_ground && b->position[1] < s->ground_y) {
+			b->position[1] = s->ground_y;
+			if (b->velocity[1] < 0.0f) {
+				b->velocity[1] = -b->velocity[1] * s->restitution;
+				// Settle instead of bouncing forever on tiny velocities
+				if (b->velocity[1] < -s->gravity[1] * b->gravity_scale * dt * 2.0f) b->velocity[1] = 0.0f;
+			}
+		}
+
+		// q += 0.5 * dt * (w, 0) * q, renormalized
+		const float *w = b->angular_velocity;
+		float *q = b->rotation;
+		float h = 0.5f * dt;
+		float dx = (w[0] * q[3] + w[1] * q[2] - w[2] * q[1]) * h;
+		float dy = (w[1] * q[3] + w[2] * q[0] - w[0] * q[2]) * h;
+		float dz = (w[2] * q[3] + w[0] * q[1] - w[1] * q[0]) * h;
+		float dw = (-w[0] * q[0] - w[1] * q[1] - w[2] * q[2]) * h;
+		q[0] += dx;
+		q[1] += dy;
+		q[2] += dz;
+		q[3] += dw;
+		float len = sqrtf(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+		float inv = len > 0.0f ? 1.0f / len : 0.0f;
+		for (int k = 0; k < 4; k++) q[k] *= inv;
+	}
+}
+
+static void publish(Sim *s, uint64_t due_ns) {
+	Snapshot *snap = &s->slots[s->back];
+	size_t bytes = (size_t)s->body_count * VOID_SIM_TRANSFORM_FLOATS * sizeof(float);
+	memcpy(snap->prev, s->last, bytes);
+	write_transforms(s, snap->curr);
+	memcpy(s->last, snap->curr, bytes);
+	snap->step = s->step;
+	snap->due_ns = due_ns;
+	snap->body_count = s->body_count;
+	snap->dropped = s->dropped;
+	snap->step_ms = (float)s->cost_ms;
+	s->back = SDL_SetAtomicInt(&s->middle, s->back | FRESH) & 3;
+}
+
+static int sim_main(void *data) {
+	Sim *s = (Sim *)data;
+	void_trace_thread_name("sim");
+	uint64_t due = SDL_GetTicksNS() + s->step_ns;
+	while (SDL_GetAtomicInt(&s->running)) {
+		uint64_t now = SDL_GetTicksNS();
+		if (now < due) {
+			SDL_DelayNS(due - now);
+			continue;
+		}
+		// After a stall, run at most MAX_CATCHUP steps late and drop the rest
+		uint64_t behind = (now - due) / s->step_ns;
+		if (behind > MAX_CATCHUP) {
+			uint64_t skip = behind - MAX_CATCHUP;
+			due += skip * s->step_ns;
+			s->dropped += skip;
+		}
+
+		void_trace_begin("sim_step");
+		apply_commands(s);
+		integrate(s);
+		for (uint32_t i = 0; i < s->system_count; i++) {
+			s->systems[i].fn(s->systems[i].ctx, s->bodies, s->body_count, s->dt, s->step);
+		}
+		s->step++;
+		double ms = (double)(SDL_GetTicksNS() - now) / 1e6;
+		s->cost_ms = s->step == 1 ? ms : s->cost_ms * 0.95 + ms * 0.05;
+		publish(s, due);
+		void_trace_end();
+		due += s->step_ns;
+	}
+	return 0;
+}
+
+int void_sim_start(void *sim) {
+	Sim *s = (Sim *)sim;
+	if (s->thread) return 1;
+	// The reader starts from the initial state
+	Snapshot *front = &s->slots[s->front];
+	write_transforms(s, front->curr);
+	write_transforms(s, front->prev);
+	write_transforms(s, s->last);
+	front->body_count = s->body_count;
+	front->due_ns = SDL_GetTicksNS();
+	memcpy(s->interpolated, front->curr, (size_t)s->body_count * VOID_SIM_TRANSFORM_FLOATS * sizeof(float));
+
+	SDL_SetAtomicInt(&s->running, 1);
+	s->thread = SDL_CreateThread(sim_main, "void_sim", s);
+	if (!s->thread) {
+		fprintf(stderr, "void_sim: failed to create the simulation thread\n");
+		SDL_SetAtomicInt(&s->running, 0);
+		return 0;
+	}
+	return 1;
+}
+
+void void_sim_stop(void *sim) {
+	Sim *s = (Sim *)sim;
+	if (!s->thread) return;
+	SDL_SetAtomicInt(&s->running, 0);
+	SDL_WaitThread(s->thread, NULL);
+	s->thread = NULL;
+}
+
+// --- Render side ---
+
+void void_sim_interpolate(void *sim, uint64_t now_ns) {
+	Sim *s = (Sim *)sim;
+	if (SDL_GetAtomicInt(&s->middle) & FRESH) {
+		s->front = SDL_SetAtomicInt(&s->middle, s->front) & 3;
+	}
+	const Snapshot *snap = &s->slots[s->front];
+	float t = now_ns > snap->due_ns ? (float)((double)(now_ns - snap->due_ns) / (double)s->step_ns) : 0.0f;
+	if (t > 1.0f) t = 1.0f;
+	s->alpha = t;
+
+	for (uint32_t i = 0; i < snap->body_count; i++) {
+		const float *a = snap->prev + i * VOID_SIM_TRANSFORM_FLOATS;
+		const float *b = snap->curr + i * VOID_SIM_TRANSFORM_FLOATS;
+		float *out = s->interpolated + i * VOID_SIM_TRANSFORM_FLOATS;
+		for (int k = 0; k < 3; k++) out[k] = a[k] + (b[k] - a[k]) * t;
+		// nlerp along the shorter arc
+		float d = a[3] * b[3] + a[4] * b[4] + a[5] * b[5] + a[6] * b[6];
+		float sign = d < 0.0f ? -1.0f : 1.0f;
+		float len2 = 0.0f;
+		for (int k = 3; k < 7; k++) {
+			out[k] = a[k] + (b[k] * sign - a[k]) * t;
+			len2 += out[k] * out[k];
+		}
+		float inv = len2 > 0.0f ? 1.0f / sqrtf(len2) : 0.0f;
+		for (int k = 3; k < 7; k++) out[k] *= inv;
+	}
+}
+
+const float *void_sim_transform(void *sim, uint32_t body) {
+	Sim *s = (Sim *)sim;
+	if (body >= s->body_count) body = 0;
+	return s->interpolated + (size_t)body * VOID_SIM_TRANSFORM_FLOATS;
+}
+
+const float *void_sim_model_matrix(void *sim, uint32_t body) {
+	Sim *s = (Sim *)sim;
+	const float *t = void_sim_transform(sim, body);
+	float x = t[3], y = t[4], z = t[5], w = t[6];
+	float *m = s->model;
+	m[0]  = 1.0f - 2.0f * (y * y + z * z);
+	m[1]  = 2.0f * (x * y + w * z);
+	m[2]  = 2.0f * (x * z - w * y);
+	m[3]  = 0.0f;
+	m[4]  = 2.0f * (x * y - w * z);
+	m[5]  = 1.0f - 2.0f * (x * x + z * z);
+	m[6]  = 2.0f * (y * z + w * x);
+	m[7]  = 0.0f;
+	m[8]  = 2.0f * (x * z + w * y);
+	m[9]  = 2.0f * (y * z - w * x);
+	m[10] = 1.0f - 2.0f * (x * x + y * y);
+	m[11] = 0.0f;
+	m[12] = t[0];
+	m[13] = t[1];
+	m[14] = t[2];
+	m[15] = 1.0f;
+	return m;
+}
+
+float void_sim_alpha(void *sim) {
+	return ((Sim *)sim)->alpha;
+}
+
+// --- Stats (from the reader's snapshot) ---
+
+uint64_t void_sim_step_count(void *sim) {
+	Sim *s = (Sim *)sim;
+	return s->slots[s->front].step;
+}
+
+uint64_t void_sim_dropped_steps(void *sim) {
+	Sim *s = (Sim *)sim;
+	return s->slots[s->front].dropped;
+}
+
+float void_sim_step_ms(void *sim) {
+	Sim *s = (Sim *)sim;
+	return s->slots[s->front].step_ms;
+}
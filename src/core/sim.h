@@ -0,0 +1,72 @@
+// Void Core — Fixed-timestep simulation thread
+// The simulation steps a set of bodies (position, orientation, linear and
+// angular velocity) at a fixed rate on its own SDL thread, so its cost no
+// longer adds to frame time and results do not depend on frame pacing.
+// Each step publishes the previous and current transforms through a triple
+// buffer; the render thread picks up the newest pair without waiting and
+// interpolates to its own clock (rendering at most one step behind).
+// Changes from other threads go through a command queue applied at the
+// start of the next step. Nothing here touches SDL video or the GPU.
+//
+// Setup: create → add_body/add_system → start. Per frame: interpolate(now)
+// → transform/model_matrix per body.
+
+#ifndef VOID_CORE_SIM_H
+#define VOID_CORE_SIM_H
+
+#include <stdint.h>
+
+#define VOID_SIM_NONE 0xFFFFFFFFu
+
+// Floats per published transform: position xyz, rotation quaternion xyzw
+#define VOID_SIM_TRANSFORM_FLOATS 7
+
+// Body state as seen by systems (simulation thread only)
+typedef struct VoidSimBody {
+    float position[3];
+    float rotation[4];          // unit quaternion xyzw
+    float velocity[3];
+    float angular_velocity[3];  // world space, radians per second
+    float gravity_scale;
+} VoidSimBody;
+
+// Extra per-step logic run on the simulation thread after integration
+typedef void (*VoidSimSystemFn)(void *ctx, VoidSimBody *bodies, uint32_t count,
+    float dt, uint64_t step);
+
+// step_hz: steps per second (0 = 60)
+void *void_sim_create(uint32_t step_hz, uint32_t max_bodies);
+void  void_sim_destroy(void *sim);      // stops the thread first
+
+// Before start only (VOID_SIM_NONE afterwards or when full)
+uint32_t void_sim_add_body(void *sim, float x, float y, float z, float gravity_scale);
+int      void_sim_add_system(void *sim, VoidSimSystemFn fn, void *ctx);
+
+int  void_sim_start(void *sim);
+void void_sim_stop(void *sim);
+
+// --- Commands (any thread, applied at the next step) ---
+void void_sim_set_position(void *sim, uint32_t body, float x, float y, float z);
+void void_sim_set_velocity(void *sim, uint32_t body, float x, float y, float z);
+void void_sim_set_angular_velocity(void *sim, uint32_t body, float x, float y, float z);
+void void_sim_add_impulse(void *sim, uint32_t body, float x, float y, float z);
+void void_sim_set_gravity(void *sim, float x, float y, float z);
+// Bodies stop at y >= ground_y; restitution scales the bounce
+void void_sim_set_ground(void *sim, float ground_y, float restitution);
+
+// --- Render side (one reader thread) ---
+// Pick up the newest snapshot and interpolate to now_ns (getTicksNS clock)
+void void_sim_interpolate(void *sim, uint64_t now_ns);
+// VOID_SIM_TRANSFORM_FLOATS floats of the interpolated transform
+const float *void_sim_transform(void *sim, uint32_t body);
+// Column-major model matrix of the interpolated transform (sim scratch,
+// valid until the next call)
+const float *void_sim_model_matrix(void *sim, uint32_t body);
+float void_sim_alpha(void *sim);        // last interpolation factor
+
+// --- Stats ---
+uint64_t void_sim_step_count(void *sim);
+uint64_t void_sim_dropped_steps(void *sim);   // skipped to catch up after stalls
+float    void_sim_step_ms(void *sim);         // average cost of one step
+
+#endif
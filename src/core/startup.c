@@ -0,0 +1,116 @@
+// Void Core — Startup timing and critical path
+
+#include "startup.h"
+
+#include <SDL3/SDL.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct StartupTask {
+	char name[32];
+	uint64_t start_ns, end_ns;    // end 0 = still running
+	uint32_t deps[VOID_STARTUP_MAX_DEPS];
+	uint32_t dep_count;
+} StartupTask;
+
+static StartupTask s_tasks[VOID_STARTUP_MAX_TASKS];
+static uint32_t s_task_count = 0;
+
+static uint32_t task_push(const char *name, uint64_t start_ns, uint64_t end_ns) {
+	if (s_task_count >= VOID_STARTUP_MAX_TASKS) return VOID_STARTUP_NONE;
+	StartupTask *t = &s_tasks[s_task_count];
+	memset(t, 0, sizeof(*t));
+	SDL_strlcpy(t->name, name ? name : "?", sizeof(t->name));
+	t->start_ns = start_ns;
+	t->end_ns = end_ns;
+	return s_task_count++;
+}
+
+uint32_t void_startup_begin(const char *name) {
+	return task_push(name, SDL_GetTicksNS(), 0);
+}
+
+void void_startup_end(uint32_t task) {
+	if (task < s_task_count) s_tasks[task].end_ns = SDL_GetTicksNS();
+}
+
+uint32_t void_startup_add(const char *name, uint64_t start_ns, uint64_t end_ns) {
+	if (end_ns < start_ns) end_ns = start_ns;
+	return task_push(name, start_ns, end_ns);
+}
+
+void void_startup_after(uint32_t task, uint32_t dep) {
+	if (task >= s_task_count || dep >= s_task_count || task == dep) return;
+	StartupTask *t = &s_tasks[task];
+	if (t->dep_count < VOID_STARTUP_MAX_DEPS) t->deps[t->dep_count++] = dep;
+}
+
+// --- Report ---
+
+static void timeline(uint64_t *origin, uint64_t *last_end, uint32_t *last) {
+	*origin = UINT64_MAX;
+	*last_end = 0;
+	*last = VOID_STARTUP_NONE;
+	for (uint32_t i = 0; i < s_task_count; i++) {
+		StartupTask *t = &s_tasks[i];
+		if (t->start_ns < *origin) *origin = t->start_ns;
+		if (t->end_ns >= *last_end && t->end_ns) { *last_end = t->end_ns; *last = i; }
+	}
+}
+
+double void_startup_total_ms(void) {
+	uint64_t origin, last_end;
+	uint32_t last;
+	timeline(&origin, &last_end, &last);
+	if (last == VOID_STARTUP_NONE) return 0.0;
+	return (double)(last_end - origin) / 1e6;
+}
+
+void void_startup_report(int verbose) {
+	uint64_t origin, last_end;
+	uint32_t last;
+	timeline(&origin, &last_end, &last);
+	if (last == VOID_STARTUP_NONE) return;
+
+	// Walk back from the last task through the latest-finishing dependency
+	uint8_t critical[VOID_STARTUP_MAX_TASKS] = {0};
+	uint32_t path[VOID_STARTUP_MAX_TASKS];
+	uint32_t path_len = 0;
+	for (uint32_t i = last; i != VOID_STARTUP_NONE && !critical[i]; ) {
+		critical[i] = 1;
+		path[path_len++] = i;
+		StartupTask *t = &s_tasks[i];
+		uint32_t next = VOID_STARTUP_NONE;
+		uint64_t next_end = 0;
+		for (uint32_t d = 0; d < t->dep_count; d++) {
+			uint64_t e = s_tasks[t->deps[d]].end_ns;
+			if (e >= next_end) { next_end = e; next = t->deps[d]; }
+		}
+		i = next;
+	}
+
+	const char *env = getenv("VOID_STARTUP_REPORT");
+	if (verbose || (env && env[0] && env[0] != '0')) {
+		printf("Startup (ms)           start      dur      end\n");
+		for (uint32_t i = 0; i < s_task_count; i++) {
+			StartupTask *t = &s_tasks[i];
+			uint64_t end = t->end_ns ? t->end_ns : t->start_ns;
+			printf("%c %-18s %8.2f %8.2f %8.2f%s\n", critical[i] ? '*' : ' ', t->name,
+				(double)(t->start_ns - origin) / 1e6, (double)(end - t->start_ns) / 1e6,
+				(double)(end - origin) / 1e6, t->end_ns ? "" : "  (unfinished)");
+		}
+	}
+
+	printf("Startup %.2f ms, critical path:", (double)(last_end - origin) / 1e6);
+	for (uint32_t k = path_len; k-- > 0; ) {
+		StartupTask *t = &s_tasks[path[k]];
+		printf("%s %s %.2f", k + 1 == path_len ? "" : " ->", t->name, (double)(t->end_ns - t->start_ns) / 1e6);
+	}
+	printf("\n");
+}
+
+void void_startup_reset(void) {
+	s_task_count = 0;
+}
@@ -0,0 +1,36 @@
+// Void Core — Startup timing and critical path
+// Startup work is recorded as named tasks with start/end times and the
+// tasks each one had to wait for. The report lists every task on a shared
+// timeline and walks the critical path: from the task that finished last,
+// back through whichever dependency finished latest. Shortening anything
+// off that path does not shorten startup.
+//
+// Game thread only. Tasks that ran elsewhere (a decode thread, a GPU
+// compile) are added afterwards with their own timestamps.
+
+#ifndef VOID_CORE_STARTUP_H
+#define VOID_CORE_STARTUP_H
+
+#include <stdint.h>
+
+#define VOID_STARTUP_MAX_TASKS 64
+#define VOID_STARTUP_MAX_DEPS  8     // per task
+#define VOID_STARTUP_NONE      0xFFFFFFFFu
+
+// Starts a task now; names are copied (truncated to 31 chars). NONE once
+// VOID_STARTUP_MAX_TASKS are recorded.
+uint32_t void_startup_begin(const char *name);
+void     void_startup_end(uint32_t task);
+// A task timed elsewhere (SDL_GetTicksNS clock)
+uint32_t void_startup_add(const char *name, uint64_t start_ns, uint64_t end_ns);
+// `task` could not finish before `dep` did
+void     void_startup_after(uint32_t task, uint32_t dep);
+
+// Prints the critical path on one line; the full task table too when
+// `verbose` is set or VOID_STARTUP_REPORT is in the environment
+void     void_startup_report(int verbose);
+// First task start to last task end
+double   void_startup_total_ms(void);
+void     void_startup_reset(void);
+
+#endif
@@ -0,0 +1,339 @@
+// Void Core — Timeline tracing (Chrome trace event JSON)
+
+#include "trace.h"
+
+#include <SDL3/SDL.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GPU_TID 0               // track id of the GPU timeline
+
+enum {
+	EVENT_ZONE,
+	EVENT_INSTANT,
+	EVENT_COUNTER,
+};
+
+// --- Types ---
+
+typedef struct TraceEvent {
+	uint64_t ts_ns;
+	union {
+		uint64_t dur_ns;         // EVENT_ZONE
+		double   value;          // EVENT_COUNTER
+	};
+	uint32_t kind;
+	char     name[VOID_TRACE_NAME_MAX];
+} TraceEvent;
+
+typedef struct Zone {
+	uint64_t begin_ns;
+	char     name[VOID_TRACE_NAME_MAX];
+} Zone;
+
+// One per recording thread, never freed (the thread keeps it in TLS).
+// Only the owner writes events; the exporter reads [0, count).
+typedef struct ThreadBuffer {
+	struct ThreadBuffer *next;
+	uint64_t      tid;
+	char          thread_name[VOID_TRACE_NAME_MAX];
+	SDL_AtomicInt generation;    // capture the events belong to
+	SDL_AtomicInt count;         // published events
+	SDL_AtomicInt dropped;
+	uint32_t      capacity;
+	TraceEvent   *events;
+	uint32_t      depth;         // open zones (owner only)
+	Zone          stack[VOID_TRACE_MAX_DEPTH];
+} ThreadBuffer;
+
+// --- Global state ---
+
+static SDL_AtomicInt s_active;
+static SDL_AtomicInt s_generation;
+static SDL_AtomicInt s_capacity;
+static SDL_TLSID     s_tls;
+static ThreadBuffer *s_buffers = NULL;  // lock-free push-only list
+static uint64_t      s_start_ns = 0;
+
+// GPU track (void_trace_gpu_frame's caller only)
+static ThreadBuffer *s_gpu = NULL;
+static int64_t       s_gpu_offset = 0;  // GPU timestamp -> CPU ns
+static int           s_gpu_calibrated = 0;
+
+static void copy_name(char *dst, const char *src) {
+	if (!src) src = "";
+	strncpy(dst, src, VOID_TRACE_NAME_MAX - 1);
+	dst[VOID_TRACE_NAME_MAX - 1] = '\0';
+}
+
+static ThreadBuffer *new_buffer(uint64_t tid) {
+	ThreadBuffer *b = calloc(1, sizeof(ThreadBuffer));
+	if (!b) return NULL;
+	b->tid = tid;
+	SDL_SetAtomicInt(&b->generation, -1);
+	do {
+		b->next = (ThreadBuffer *)SDL_GetAtomicPointer((void **)&s_buffers);
+	} while (!SDL_CompareAndSwapAtomicPointer((void **)&s_buffers, b->next, b));
+	return b;
+}
+
+// Brings the buffer into the current capture (owner only): the reset is
+// published by the generation store, so the exporter never sees stale counts.
+static void sync_buffer(ThreadBuffer *b) {
+	int gen = SDL_GetAtomicInt(&s_generation);
+	if (SDL_GetAtomicInt(&b->generation) == gen) return;
+	uint32_t capacity = (uint32_t)SDL_GetAtomicInt(&s_capacity);
+	if (b->capacity != capacity || !b->events) {
+		free(b->events);
+		b->events = malloc((size_t)capacity * sizeof(TraceEvent));
+		b->capacity = b->events ? capacity : 0;
+	}
+	SDL_SetAtomicInt(&b->count, 0);
+	SDL_SetAtomicInt(&b->dropped, 0);
+	b->depth = 0;
+	SDL_SetAtomicInt(&b->generation, gen);
+}
+
+static ThreadBuffer *thread_buffer(void) {
+	ThreadBuffer *b = (ThreadBuffer *)SDL_GetTLS(&s_tls);
+	if (!b) {
+		b = new_buffer((uint64_t)SDL_GetCurrentThreadID());
+		if (!b) return NULL;
+		SDL_SetTLS(&s_tls, b, NULL);
+	}
+	sync_buffer(b);
+	return b;
+}
+
+static void push_event(ThreadBuffer *b, uint32_t kind, const char *name, uint64_t ts, uint64_t dur, double value) {
+	int n = SDL_GetAtomicInt(&b->count);
+	if ((uint32_t)n >= b->capacity) {
+		SDL_AddAtomicInt(&b->dropped, 1);
+		return;
+	}
+	TraceEvent *e = &b->events[n];
+	e->ts_ns = ts;
+	if (kind == EVENT_COUNTER) e->value = value;
+	else e->dur_ns = dur;
+	e->kind = kind;
+	copy_name(e->name, name);
+	SDL_SetAtomicInt(&b->count, n + 1);
+}
+
+// --- Capture ---
+
+void void_trace_start(uint32_t events_per_thread) {
+	if (events_per_thread == 0) events_per_thread = VOID_TRACE_DEFAULT_EVENTS;
+	SDL_SetAtomicInt(&s_active, 0);
+	SDL_SetAtomicInt(&s_capacity, (int)events_per_thread);
+	SDL_AddAtomicInt(&s_generation, 1);
+	s_start_ns = SDL_GetTicksNS();
+	SDL_SetAtomicInt(&s_active, 1);
+}
+
+void void_trace_stop(void) {
+	SDL_SetAtomicInt(&s_active, 0);
+}
+
+int void_trace_active(void) {
+	return SDL_GetAtomicInt(&s_active);
+}
+
+void void_trace_shutdown(void) {
+	SDL_SetAtomicInt(&s_active, 0);
+	for (ThreadBuffer *b = (ThreadBuffer *)SDL_GetAtomicPointer((void **)&s_buffers); b; b = b->next) {
+		free(b->events);
+		b->events = NULL;
+		b->capacity = 0;
+		SDL_SetAtomicInt(&b->count, 0);
+		SDL_SetAtomicInt(&b->generation, -1);
+	}
+}
+
+// --- Recording ---
+
+void void_trace_begin(const char *name) {
+	if (!SDL_GetAtomicInt(&s_active)) return;
+	ThreadBuffer *b = thread_buffer();
+	if (!b) return;
+	if (b->depth >= VOID_TRACE_MAX_DEPTH) {
+		// Keep the stack balanced; the zone itself is lost
+		SDL_AddAtomicInt(&b->dropped, 1);
+		b->depth++;
+		return;
+	}
+	Zone *z = &b->stack[b->depth++];
+	copy_name(z->name, name);
+	z->begin_ns = SDL_GetTicksNS();
+}
+
+void void_trace_end(void) {
+	if (!SDL_GetAtomicInt(&s_active)) return;
+	uint64_t now = SDL_GetTicksNS();
+	ThreadBuffer *b = thread_buffer();
+	if (!b || b->depth == 0) return;
+	b->depth--;
+	if (b->depth >= VOID_TRACE_MAX_DEPTH) return;
+	const Zone *z = &b->stack[b->depth];
+	push_event(b, EVENT_ZONE, z->name, z->begin_ns, now - z->begin_ns, 0.0);
+}
+
+void void_trace_scope_end(int *unused) {
+	(void)unused;
+	void_trace_end();
+}
+
+void void_trace_instant(const char *name) {
+	if (!SDL_GetAtomicInt(&s_active)) return;
+	ThreadBuffer *b = thread_buffer();
+	if (b) push_event(b, EVENT_INSTANT, name, SDL_GetTicksNS(), 0, 0.0);
+}
+
+void void_trace_counter(const char *name, double value) {
+	if (!SDL_GetAtomicInt(&s_active)) return;
+	ThreadBuffer *b = thread_buffer();
+	if (b) push_event(b, EVENT_COUNTER, name, SDL_GetTicksNS(), 0, value);
+}
+
+void void_trace_thread_name(const char *name) {
+	ThreadBuffer *b = (ThreadBuffer *)SDL_GetTLS(&s_tls);
+	if (!b) {
+		b = new_buffer((uint64_t)SDL_GetCurrentThreadID());
+		if (!b) return;
+		SDL_SetTLS(&s_tls, b, NULL);
+	}
+	copy_name(b->thread_name, name);
+}
+
+uint64_t void_trace_now_ns(void) {
+	return SDL_GetTicksNS();
+}
+
+// --- GPU ---
+
+void void_trace_gpu_frame(uint64_t submit_ns, uint64_t complete_ns,
+	uint32_t count, const char *names, const uint64_t *timestamps
+) {
+	if (!SDL_GetAtomicInt(&s_active) || count == 0 || submit_ns == 0) return;
+	if (!s_gpu) {
+		s_gpu = new_buffer(GPU_TID);
+		if (!s_gpu) return;
+		copy_name(s_gpu->thread_name, "GPU");
+	}
+	sync_buffer(s_gpu);
+
+	// Same rule as the timer: only well-ordered pairs count
+	uint64_t first = UINT64_MAX, last = 0;
+	for (uint32_t i = 0; i < count; i++) {
+		uint64_t b = timestamps[i * 2], e = timestamps[i * 2 + 1];
+		if (b == 0 || e < b) continue;
+		if (b < first) first = b;
+		if (e > last) last = e;
+	}
+	if (last == 0) return;
+
+	// The frame cannot start before its submit nor end after its readback.
+	// The largest lower bound seen is the tightest one (a frame that started
+	// right away); the upper bound wins if the clocks drifted past it.
+	int64_t lower = (int64_t)submit_ns - (int64_t)first;
+	if (!s_gpu_calibrated || lower > s_gpu_offset) s_gpu_offset = lower;
+	s_gpu_calibrated = 1;
+	if (complete_ns) {
+		int64_t upper = (int64_t)complete_ns - (int64_t)last;
+		if (s_gpu_offset > upper) s_gpu_offset = upper;
+	}
+
+	uint64_t frame_begin = (uint64_t)((int64_t)first + s_gpu_offset);
+	push_event(s_gpu, EVENT_ZONE, "gpu_frame", frame_begin, last - first, 0.0);
+	for (uint32_t i = 0; i < count; i++) {
+		uint64_t b = timestamps[i * 2], e = timestamps[i * 2 + 1];
+		if (b == 0 || e < b) continue;
+		push_event(s_gpu, EVENT_ZONE, names + (size_t)i * VOID_TRACE_NAME_MAX, (uint64_t)((int64_t)b + s_gpu_offset), e - b, 0.0);
+	}
+	double latency_ms = frame_begin > submit_ns ? (double)(frame_begin - submit_ns) * 1e-6 : 0.0;
+	push_event(s_gpu, EVENT_COUNTER, "gpu_latency_ms", submit_ns, 0, latency_ms);
+}
+
+// --- Export ---
+
+static void write_string(FILE *f, const char *s) {
+	fputc('"', f);
+	for (; *s; s++) {
+		unsigned char c = (unsigned char)*s;
+		if (c == '"' || c == '\\') fprintf(f, "\\%c", c);
+		else if (c < 0x20) fprintf(f, "\\u%04x", c);
+		else fputc(c, f);
+	}
+	fputc('"', f);
+}
+
+// Microseconds since start (GPU events may land slightly before it)
+static double trace_us(uint64_t ns) {
+	return (double)((int64_t)ns - (int64_t)s_start_ns) * 1e-3;
+}
+
+int void_trace_write_json(const char *path) {
+	FILE *f = fopen(path, "w");
+	if (!f) {
+		fprintf(stderr, "void_trace: cannot write %s\n", path);
+		return 0;
+	}
+	int gen = SDL_GetAtomicInt(&s_generation);
+	int first = 1;
+	fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", f);
+	for (ThreadBuffer *b = (ThreadBuffer *)SDL_GetAtomicPointer((void **)&s_buffers); b; b = b->next) {
+		if (SDL_GetAtomicInt(&b->generation) != gen) continue;
+		uint32_t n = (uint32_t)SDL_GetAtomicInt(&b->count);
+
+		if (b->thread_name[0]) {
+			fprintf(f, "%s\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%llu,\"args\":{\"name\":",
+				first ? "" : ",", (unsigned long long)b->tid);
+			write_string(f, b->thread_name);
+			fputs("}}", f);
+			first = 0;
+		}
+		for (uint32_t i = 0; i < n; i++) {
+			const TraceEvent *e = &b->events[i];
+			fprintf(f, "%s\n{\"name\":", first ? "" : ",");
+			write_string(f, e->name);
+			fprintf(f, ",\"pid\":1,\"tid\":%llu,\"ts\":%.3f", (unsigned long long)b->tid, trace_us(e->ts_ns));
+			switch (e->kind) {
+			case EVENT_ZONE:
+				fprintf(f, ",\"ph\":\"X\",\"dur\":%.3f}", (double)e->dur_ns * 1e-3);
+				break;
+			case EVENT_INSTANT:
+				fputs(",\"ph\":\"i\",\"s\":\"t\"}", f);
+				break;
+			default:
+				fprintf(f, ",\"ph\":\"C\",\"args\":{\"value\":%.6f}}", e->value);
+				break;
+			}
+			first = 0;
+		}
+	}
+	fputs("\n]}\n", f);
+	int ok = ferror(f) == 0;
+	if (fclose(f) != 0) ok = 0;
+	if (!ok) fprintf(stderr, "void_trace: failed writing %s\n", path);
+	return ok;
+}
+
+uint64_t void_trace_event_count(void) {
+	int gen = SDL_GetAtomicInt(&s_generation);
+	uint64_t total = 0;
+	for (ThreadBuffer *b = (ThreadBuffer *)SDL_GetAtomicPointer((void **)&s_buffers); b; b = b->next) {
+		if (SDL_GetAtomicInt(&b->generation) == gen) total += (uint64_t)SDL_GetAtomicInt(&b->count);
+	}
+	return total;
+}
+
+uint64_t void_trace_dropped_count(void) {
+	int gen = SDL_GetAtomicInt(&s_generation);
+	uint64_t total = 0;
+	for (ThreadBuffer *b = (ThreadBuffer *)SDL_GetAtomicPointer((void **)&s_buffers); b; b = b->next) {
+		if (SDL_GetAtomicInt(&b->generation) == gen) total += (uint64_t)SDL_GetAtomicInt(&b->dropped);
+	}
+	return total;
+}
@@ -0,0 +1,69 @@
+// Void Core — Timeline tracing (Chrome trace event JSON)
+// Scoped CPU zones, instants and counters are recorded into per-thread
+// buffers: each thread appends to its own buffer and publishes the new
+// count with one atomic store, so recording never takes a lock. GPU pass
+// timings from src/gpu/timer land on a separate "GPU" track of the same
+// timeline. Export writes Chrome trace JSON, which chrome://tracing and
+// ui.perfetto.dev both open.
+//
+// Capture: start → record from any thread → stop → write_json. Buffers do
+// not wrap; once a thread's buffer is full its further events are dropped
+// and counted. Recording is a single atomic load while no capture runs.
+//
+// GPU timestamps use their own clock. Each timed frame is placed by its
+// CPU submit time (the GPU cannot start before it) and its readback time
+// (it finished before that); the offset that satisfies both for every
+// frame so far wins, so a frame that starts late after its submit shows up
+// as a gap, and as the gpu_latency_ms counter.
+
+#ifndef VOID_CORE_TRACE_H
+#define VOID_CORE_TRACE_H
+
+#include <stdint.h>
+
+#define VOID_TRACE_NAME_MAX       32     // names are copied, truncated to 31 chars
+#define VOID_TRACE_MAX_DEPTH      32     // nested zones per thread
+#define VOID_TRACE_DEFAULT_EVENTS 65536  // per thread
+
+// --- Capture ---
+// events_per_thread: 0 = VOID_TRACE_DEFAULT_EVENTS. Discards the previous
+// capture; each thread resets its own buffer on its first event.
+void void_trace_start(uint32_t events_per_thread);
+void void_trace_stop(void);
+int  void_trace_active(void);
+// Frees every buffer; no thread may be recording.
+void void_trace_shutdown(void);
+
+// --- Recording (any thread) ---
+// Zones nest per thread. A zone still open at stop is not exported; an end
+// whose begin came before start is ignored.
+void void_trace_begin(const char *name);
+void void_trace_end(void);
+void void_trace_instant(const char *name);
+void void_trace_counter(const char *name, double value);
+// Labels the calling thread's track (kept across captures)
+void void_trace_thread_name(const char *name);
+uint64_t void_trace_now_ns(void);   // same clock as SDL_GetTicksNS
+
+// Scoped zone for C: ends when the enclosing block exits
+#define VOID_TRACE_CONCAT_(a, b) a##b
+#define VOID_TRACE_CONCAT(a, b) VOID_TRACE_CONCAT_(a, b)
+#define VOID_TRACE_SCOPE(name) \
+    __attribute__((cleanup(void_trace_scope_end))) int VOID_TRACE_CONCAT(void_trace_scope_, __LINE__) = \
+        (void_trace_begin(name), 0)
+void void_trace_scope_end(int *unused);
+
+// --- GPU ---
+// One timed frame: count begin/end timestamp pairs (GPU nanoseconds, as
+// written by the queries) and count names packed VOID_TRACE_NAME_MAX bytes
+// apart, with the CPU times of its submit and of its readback completing.
+// Called by src/gpu/timer; single caller thread.
+void void_trace_gpu_frame(uint64_t submit_ns, uint64_t complete_ns,
+    uint32_t count, const char *names, const uint64_t *timestamps);
+
+// --- Export (after stop, from the thread that called start) ---
+int void_trace_write_json(const char *path);  // 1 on success
+uint64_t void_trace_event_count(void);
+uint64_t void_trace_dropped_count(void);
+
+#endif
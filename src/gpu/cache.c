@@ -0,0 +1,537 @@
+// Void GPU Cache — deduplicated bind group layouts, bind groups, pipeline
+// layouts and samplers
+
+#include "cache.h"
+#include "capture.h"
+#include "../core/hash.h"
+
+#include <dawn/webgpu.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- Keys ---
+// Keys are plain zero-initialised structs so they can be hashed and compared
+// bytewise. Builders keep their entries sorted by binding, so the same set of
+// bindings declared in any order produces the same key.
+
+#define KIND_BUFFER          0
+#define KIND_TEXTURE         1
+#define KIND_STORAGE_TEXTURE 2
+#define KIND_SAMPLER         3
+
+typedef struct LayoutEntryKey {
+	uint32_t binding;
+	uint32_t visibility;
+	uint32_t kind;
+	uint32_t type;       // buffer / sampler binding type, sample type, access
+	uint32_t format;     // storage texture format
+	uint32_t dimension;  // view dimension
+	uint32_t flags;      // bit 0: dynamic offset, bit 1: multisampled
+	uint32_t pad;
+	uint64_t min_size;
+} LayoutEntryKey;
+
+typedef struct LayoutBuilder {
+	uint32_t count;
+	uint32_t pad;
+	LayoutEntryKey entries[VOID_GPU_CACHE_MAX_ENTRIES];
+} LayoutBuilder;
+
+typedef struct GroupEntryKey {
+	uint32_t binding;
+	uint32_t kind;
+	void    *resource;
+	uint64_t offset;
+	uint64_t size;
+} GroupEntryKey;
+
+typedef struct GroupBuilder {
+	void    *layout;
+	uint32_t count;
+	uint32_t pad;
+	GroupEntryKey entries[VOID_GPU_CACHE_MAX_ENTRIES];
+} GroupBuilder;
+
+typedef struct SamplerKey {
+	uint32_t address[3];
+	uint32_t mag;
+	uint32_t min;
+	uint32_t mipmap;
+	uint32_t compare;
+	uint32_t anisotropy;
+} SamplerKey;
+
+// --- Entries ---
+
+#define KIND_FREE 0xFFFFFFFFu
+
+typedef struct CacheEntry {
+	uint32_t kind;       // VOID_GPU_CACHE_* or KIND_FREE
+	uint32_t refs;
+	uint64_t hash;
+	void    *key;
+	uint32_t key_size;
+	int      keyed;      // 0 if a hash collision kept it out of s_by_key
+	void    *handle;
+	uint64_t last_used;
+	int32_t  next_free;
+} CacheEntry;
+
+static CacheEntry *s_entries = NULL;
+static uint32_t s_entry_count = 0;
+static uint32_t s_entry_cap = 0;
+static int32_t  s_free = -1;
+
+static HashMap s_by_key;     // key hash -> entry
+static HashMap s_by_handle;  // hash_mix(handle) -> entry
+
+static uint64_t s_frame = 0;
+static uint64_t s_hits = 0;
+static uint64_t s_misses = 0;
+static uint32_t s_live[4];
+
+static uint64_t key_hash(uint32_t kind, const void *key, uint32_t size) {
+	return fnv_bytes(fnv_u64(FNV_OFFSET, kind), key, size);
+}
+
+static void *lookup(uint32_t kind, const void *key, uint32_t size, uint64_t hash) {
+	int32_t idx = map_get(&s_by_key, hash);
+	if (idx < 0) return NULL;
+	CacheEntry *e = &s_entries[idx];
+	if (e->kind != kind || e->key_size != size || memcmp(e->key, key, size) != 0) return NULL;
+	e->refs++;
+	e->last_used = s_frame;
+	s_hits++;
+	return e->handle;
+}
+
+// Takes ownership of `key` (malloc'd).
+static void insert(uint32_t kind, void *key, uint32_t size, uint64_t hash, void *handle) {
+	int32_t idx;
+	if (s_free >= 0) {
+		idx = s_free;
+		s_free = s_entries[idx].next_free;
+	} else {
+		if (s_entry_count == s_entry_cap) {
+			s_entry_cap = s_entry_cap ? s_entry_cap * 2 : 64;
+			s_entries = realloc(s_entries, s_entry_cap * sizeof(CacheEntry));
+		}
+		idx = (int32_t)s_entry_count++;
+	}
+
+	CacheEntry *e = &s_entries[idx];
+	e->kind = kind;
+	e->refs = 1;
+	e->hash = hash;
+	e->key = key;
+	e->key_size = size;
+	e->keyed = map_get(&s_by_key, hash) < 0;
+	e->handle = handle;
+	e->last_used = s_frame;
+	e->next_free = -1;
+
+	if (e->keyed) map_put(&s_by_key, hash, idx);
+	map_put(&s_by_handle, hash_mix((uint64_t)(uintptr_t)handle), idx);
+	s_live[kind]++;
+	s_misses++;
+}
+
+static void release_object(uint32_t kind, void *handle) {
+	switch (kind) {
+	case VOID_GPU_CACHE_LAYOUT:          wgpuBindGroupLayoutRelease((WGPUBindGroupLayout)handle); break;
+	case VOID_GPU_CACHE_GROUP:           wgpuBindGroupRelease((WGPUBindGroup)handle); break;
+	case VOID_GPU_CACHE_PIPELINE_LAYOUT: wgpuPipelineLayoutRelease((WGPUPipelineLayout)handle); break;
+	case VOID_GPU_CACHE_SAMPLER:         wgpuSamplerRelease((WGPUSampler)handle); break;
+	}
+}
+
+static void evict(int32_t idx) {
+	CacheEntry *e = &s_entries[idx];
+	if (e->keyed) map_remove(&s_by_key, e->hash);
+	map_remove(&s_by_handle, hash_mix((uint64_t)(uintptr_t)e->handle));
+	release_object(e->kind, e->handle);
+	s_live[e->kind]--;
+	free(e->key);
+	e->key = NULL;
+	e->handle = NULL;
+	e->kind = KIND_FREE;
+	e->next_free = s_free;
+	s_free = idx;
+}
+
+// --- Bind group layout builder ---
+
+static LayoutEntryKey *layout_slot(LayoutBuilder *b, uint32_t binding) {
+	if (b->count >= VOID_GPU_CACHE_MAX_ENTRIES) {
+		fprintf(stderr, "void_gpu_cache: too many layout entries (binding %u)\n", binding);
+		return NULL;
+	}
+	// Insertion keeps entries sorted by binding
+	uint32_t i = b->count++;
+	while (i > 0 && b->entries[i - 1].binding > binding) {
+		b->entries[i] = b->entries[i - 1];
+		i--;
+	}
+	LayoutEntryKey *k = &b->entries[i];
+	memset(k, 0, sizeof(*k));
+	k->binding = binding;
+	return k;
+}
+
+void *void_gpu_layout_begin(void) {
+	void *builder = calloc(1, sizeof(LayoutBuilder));
+	VOID_CAPTURE(VOID_CAP_LAYOUT_BEGIN, builder);
+	return builder;
+}
+
+void void_gpu_layout_buffer(void *builder, uint32_t binding, uint32_t visibility,
+	uint32_t type, uint64_t minBindingSize, int hasDynamicOffset
+) {
+	VOID_CAPTURE(VOID_CAP_LAYOUT_BUFFER, builder, binding, visibility, type, minBindingSize, hasDynamicOffset);
+	LayoutEntryKey *k = layout_slot((LayoutBuilder *)builder, binding);
+	if (!k) return;
+	k->visibility = visibility;
+	k->kind = KIND_BUFFER;
+	k->type = type;
+	k->min_size = minBindingSize;
+	k->flags = hasDynamicOffset ? 1 : 0;
+}
+
+void void_gpu_layout_texture(void *builder, uint32_t binding, uint32_t visibility,
+	uint32_t sampleType, uint32_t viewDimension, int multisampled
+) {
+	VOID_CAPTURE(VOID_CAP_LAYOUT_TEXTURE, builder, binding, visibility, sampleType, viewDimension, multisampled);
+	LayoutEntryKey *k = layout_slot((LayoutBuilder *)builder, binding);
+	if (!k) return;
+	k->visibility = visibility;
+	k->kind = KIND_TEXTURE;
+	k->type = sampleType;
+	k->dimension = viewDimension;
+	k->flags = multisampled ? 2 : 0;
+}
+
+void void_gpu_layout_storage_texture(void *builder, uint32_t binding, uint32_t visibility,
+	uint32_t access, uint32_t format, uint32_t viewDimension
+) {
+	VOID_CAPTURE(VOID_CAP_LAYOUT_STORAGE_TEXTURE, builder, binding, visibility, access, format, viewDimension);
+	LayoutEntryKey *k = layout_slot((LayoutBuilder *)builder, binding);
+	if (!k) return;
+	k->visibility = visibility;
+	k->kind = KIND_STORAGE_TEXTURE;
+	k->type = access;
+	k->format = format;
+	k->dimension = viewDimension;
+}
+
+void void_gpu_layout_sampler(void *builder, uint32_t binding, uint32_t visibility,
+	uint32_t type
+) {
+	VOID_CAPTURE(VOID_CAP_LAYOUT_SAMPLER, builder, binding, visibility, type);
+	LayoutEntryKey *k = layout_slot((LayoutBuilder *)builder, binding);
+	if (!k) return;
+	k->visibility = visibility;
+	k->kind = KIND_SAMPLER;
+	k->type = type;
+}
+
+void *void_gpu_layout_finish(void *device, void *builder) {
+	LayoutBuilder *b = (LayoutBuilder *)builder;
+	uint32_t size = (uint32_t)(offsetof(LayoutBuilder, entries) + b->count * sizeof(LayoutEntryKey));
+	uint64_t hash = key_hash(VOID_GPU_CACHE_LAYOUT, b, size);
+
+	void *hit = lookup(VOID_GPU_CACHE_LAYOUT, b, size, hash);
+	if (hit) {
+		VOID_CAPTURE(VOID_CAP_LAYOUT_FINISH, hit, device, builder);
+		free(b);
+		return hit;
+	}
+
+	WGPUBindGroupLayoutEntry entries[VOID_GPU_CACHE_MAX_ENTRIES];
+	memset(entries, 0, sizeof(entries));
+	for (uint32_t i = 0; i < b->count; i++) {
+		const LayoutEntryKey *k = &b->entries[i];
+		WGPUBindGroupLayoutEntry *e = &entries[i];
+		e->binding = k->binding;
+		e->visibility = (WGPUShaderStage)k->visibility;
+		switch (k->kind) {
+		case KIND_BUFFER:
+			e->buffer.type = (WGPUBufferBindingType)k->type;
+			e->buffer.hasDynamicOffset = (k->flags & 1) ? 1 : 0;
+			e->buffer.minBindingSize = k->min_size;
+			break;
+		case KIND_TEXTURE:
+			e->texture.sampleType = (WGPUTextureSampleType)k->type;
+			e->texture.viewDimension = (WGPUTextureViewDimension)k->dimension;
+			e->texture.multisampled = (k->flags & 2) ? 1 : 0;
+			break;
+		case KIND_STORAGE_TEXTURE:
+			e->storageTexture.access = (WGPUStorageTextureAccess)k->type;
+			e->storageTexture.format = (WGPUTextureFormat)k->format;
+			e->storageTexture.viewDimension = (WGPUTextureViewDimension)k->dimension;
+			break;
+		case KIND_SAMPLER:
+			e->sampler.type = (WGPUSamplerBindingType)k->type;
+			break;
+		}
+	}
+
+	WGPUBindGroupLayoutDescriptor desc = {0};
+	desc.entryCount = b->count;
+	desc.entries = entries;
+	void *layout = (void *)wgpuDeviceCreateBindGroupLayout((WGPUDevice)device, &desc);
+	VOID_CAPTURE(VOID_CAP_LAYOUT_FINISH, layout, device, builder);
+
+	insert(VOID_GPU_CACHE_LAYOUT, realloc(b, size), size, hash, layout);
+	return layout;
+}
+
+// --- Bind group builder ---
+
+static GroupEntryKey *group_slot(GroupBuilder *b, uint32_t binding) {
+	if (b->count >= VOID_GPU_CACHE_MAX_ENTRIES) {
+		fprintf(stderr, "void_gpu_cache: too many group entries (binding %u)\n", binding);
+		return NULL;
+	}
+	uint32_t i = b->count++;
+	while (i > 0 && b->entries[i - 1].binding > binding) {
+		b->entries[i] = b->entries[i - 1];
+		i--;
+	}
+	GroupEntryKey *k = &b->entries[i];
+	memset(k, 0, sizeof(*k));
+	k->binding = binding;
+	return k;
+}
+
+void *void_gpu_group_begin(void *layout) {
+	GroupBuilder *b = calloc(1, sizeof(GroupBuilder));
+	b->layout = layout;
+	VOID_CAPTURE(VOID_CAP_GROUP_BEGIN, (void *)b, layout);
+	return b;
+}
+
+void void_gpu_group_buffer(void *builder, uint32_t binding, void *buffer,
+	uint64_t offset, uint64_t size
+) {
+	VOID_CAPTURE(VOID_CAP_GROUP_BUFFER, builder, binding, buffer, offset, size);
+	GroupEntryKey *k = group_slot((GroupBuilder *)builder, binding);
+	if (!k) return;
+	k->kind = KIND_BUFFER;
+	k->resource = buffer;
+	k->offset = offset;
+	k->size = (size == 0) ? WGPU_WHOLE_SIZE : size;
+}
+
+void void_gpu_group_texture(void *builder, uint32_t binding, void *textureView) {
+	VOID_CAPTURE(VOID_CAP_GROUP_TEXTURE, builder, binding, textureView);
+	GroupEntryKey *k = group_slot((GroupBuilder *)builder, binding);
+	if (!k) return;
+	k->kind = KIND_TEXTURE;
+	k->resource = textureView;
+}
+
+void void_gpu_group_sampler(void *builder, uint32_t binding, void *sampler) {
+	VOID_CAPTURE(VOID_CAP_GROUP_SAMPLER, builder, binding, sampler);
+	GroupEntryKey *k = group_slot((GroupBuilder *)builder, binding);
+	if (!k) return;
+	k->kind = KIND_SAMPLER;
+	k->resource = sampler;
+}
+
+void *void_gpu_group_finish(void *device, void *builder) {
+	GroupBuilder *b = (GroupBuilder *)builder;
+	uint32_t size = (uint32_t)(offsetof(GroupBuilder, entries) + b->count * sizeof(GroupEntryKey));
+	uint64_t hash = key_hash(VOID_GPU_CACHE_GROUP, b, size);
+
+	void *hit = lookup(VOID_GPU_CACHE_GROUP, b, size, hash);
+	if (hit) {
+		VOID_CAPTURE(VOID_CAP_GROUP_FINISH, hit, device, builder);
+		free(b);
+		return hit;
+	}
+
+	WGPUBindGroupEntry entries[VOID_GPU_CACHE_MAX_ENTRIES];
+	memset(entries, 0, sizeof(entries));
+	for (uint32_t i = 0; i < b->count; i++) {
+		const GroupEntryKey *k = &b->entries[i];
+		WGPUBindGroupEntry *e = &entries[i];
+		e->binding = k->binding;
+		switch (k->kind) {
+		case KIND_BUFFER:
+			e->buffer = (WGPUBuffer)k->resource;
+			e->offset = k->offset;
+			e->size = k->size;
+			break;
+		case KIND_TEXTURE:
+			e->textureView = (WGPUTextureView)k->resource;
+			break;
+		case KIND_SAMPLER:
+			e->sampler = (WGPUSampler)k->resource;
+			break;
+		}
+	}
+
+	WGPUBindGroupDescriptor desc = {0};
+	desc.layout = (WGPUBindGroupLayout)b->layout;
+	desc.entryCount = b->count;
+	desc.entries = entries;
+	void *group = (void *)wgpuDeviceCreateBindGroup((WGPUDevice)device, &desc);
+	VOID_CAPTURE(VOID_CAP_GROUP_FINISH, group, device, builder);
+
+	insert(VOID_GPU_CACHE_GROUP, realloc(b, size), size, hash, group);
+	return group;
+}
+
+// --- Pipeline layout ---
+
+void *void_gpu_cached_pipeline_layout(void *device, uint32_t count, void *const *bindGroupLayouts) {
+	if (count > 4) count = 4;
+	uint32_t size = count * (uint32_t)sizeof(void *);
+	uint64_t hash = key_hash(VOID_GPU_CACHE_PIPELINE_LAYOUT, bindGroupLayouts, size);
+
+	void *hit = lookup(VOID_GPU_CACHE_PIPELINE_LAYOUT, bindGroupLayouts, size, hash);
+	if (hit) {
+		VOID_CAPTURE(VOID_CAP_CACHED_PIPELINE_LAYOUT, hit, device, count, bindGroupLayouts);
+		return hit;
+	}
+
+	WGPUPipelineLayoutDescriptor desc = {0};
+	desc.bindGroupLayoutCount = count;
+	desc.bindGroupLayouts = (const WGPUBindGroupLayout *)bindGroupLayouts;
+	void *layout = (void *)wgpuDeviceCreatePipelineLayout((WGPUDevice)device, &desc);
+	VOID_CAPTURE(VOID_CAP_CACHED_PIPELINE_LAYOUT, layout, device, count, bindGroupLayouts);
+
+	void *key = malloc(size ? size : 1);
+	memcpy(key, bindGroupLayouts, size);
+	insert(VOID_GPU_CACHE_PIPELINE_LAYOUT, key, size, hash, layout);
+	return layout;
+}
+
+void *void_gpu_cached_pipeline_layout_1(void *device, void *bgl0) {
+	return void_gpu_cached_pipeline_layout(device, 1, &bgl0);
+}
+
+void *void_gpu_cached_pipeline_layout_2(void *device, void *bgl0, void *bgl1) {
+	void *layouts[2] = { bgl0, bgl1 };
+	return void_gpu_cached_pipeline_layout(device, 2, layouts);
+}
+
+void *void_gpu_cached_pipeline_layout_3(void *device, void *bgl0, void *bgl1, void *bgl2) {
+	void *layouts[3] = { bgl0, bgl1, bgl2 };
+	return void_gpu_cached_pipeline_layout(device, 3, layouts);
+}
+
+void *void_gpu_cached_pipeline_layout_4(void *device, void *bgl0, void *bgl1, void *bgl2, void *bgl3) {
+	void *layouts[4] = { bgl0, bgl1, bgl2, bgl3 };
+	return void_gpu_cached_pipeline_layout(device, 4, layouts);
+}
+
+// --- Sampler ---
+
+void *void_gpu_cached_sampler(void *device,
+	uint32_t addressU, uint32_t addressV, uint32_t addressW,
+	uint32_t magFilter, uint32_t minFilter, uint32_t mipmapFilter,
+	uint32_t compare, uint32_t maxAnisotropy
+) {
+	SamplerKey k;
+	memset(&k, 0, sizeof(k));
+	k.address[0] = addressU;
+	k.address[1] = addressV;
+	k.address[2] = addressW;
+	k.mag = magFilter;
+	k.min = minFilter;
+	k.mipmap = mipmapFilter;
+	k.compare = compare;
+	// Anisotropy is only valid with all-linear filtering
+	k.anisotropy = maxAnisotropy ? maxAnisotropy : 1;
+	if (magFilter != WGPUFilterMode_Linear || minFilter != WGPUFilterMode_Linear ||
+		mipmapFilter != WGPUMipmapFilterMode_Linear) k.anisotropy = 1;
+	if (k.anisotropy > 16) k.anisotropy = 16;
+
+	uint64_t hash = key_hash(VOID_GPU_CACHE_SAMPLER, &k, sizeof(k));
+	void *hit = lookup(VOID_GPU_CACHE_SAMPLER, &k, sizeof(k), hash);
+	if (hit) {
+		VOID_CAPTURE(VOID_CAP_CACHED_SAMPLER, hit, device, addressU, addressV, addressW,
+			magFilter, minFilter, mipmapFilter, compare, maxAnisotropy);
+		return hit;
+	}
+
+	WGPUSamplerDescriptor desc = {0};
+	desc.addressModeU = (WGPUAddressMode)addressU;
+	desc.addressModeV = (WGPUAddressMode)addressV;
+	desc.addressModeW = (WGPUAddressMode)addressW;
+	desc.magFilter = (WGPUFilterMode)magFilter;
+	desc.minFilter = (WGPUFilterMode)minFilter;
+	desc.mipmapFilter = (WGPUMipmapFilterMode)mipmapFilter;
+	desc.lodMinClamp = 0.0f;
+	desc.lodMaxClamp = 32.0f;
+	desc.compare = (WGPUCompareFunction)compare;
+	desc.maxAnisotropy = (uint16_t)k.anisotropy;
+	void *sampler = (void *)wgpuDeviceCreateSampler((WGPUDevice)device, &desc);
+	VOID_CAPTURE(VOID_CAP_CACHED_SAMPLER, sampler, device, addressU, addressV, addressW,
+		magFilter, minFilter, mipmapFilter, compare, maxAnisotropy);
+
+	SamplerKey *key = malloc(sizeof(SamplerKey));
+	*key = k;
+	insert(VOID_GPU_CACHE_SAMPLER, key, sizeof(k), hash, sampler);
+	return sampler;
+}
+
+// --- References & eviction ---
+
+void void_gpu_cache_retain(void *handle) {
+	if (!handle) return;
+	VOID_CAPTURE(VOID_CAP_CACHE_RETAIN, handle);
+	int32_t idx = map_get(&s_by_handle, hash_mix((uint64_t)(uintptr_t)handle));
+	if (idx >= 0) s_entries[idx].refs++;
+}
+
+// Handles the cache did not create are ignored.
+void void_gpu_cache_release(void *handle) {
+	if (!handle) return;
+	VOID_CAPTURE(VOID_CAP_CACHE_RELEASE, handle);
+	int32_t idx = map_get(&s_by_handle, hash_mix((uint64_t)(uintptr_t)handle));
+	if (idx < 0) return;
+	CacheEntry *e = &s_entries[idx];
+	if (e->refs > 0) e->refs--;
+	e->last_used = s_frame;
+}
+
+void void_gpu_cache_end_frame(void) {
+	if (void_capture_active()) void_capture_record(VOID_CAP_CACHE_END_FRAME);
+	s_frame++;
+	for (uint32_t i = 0; i < s_entry_count; i++) {
+		CacheEntry *e = &s_entries[i];
+		if (e->kind == KIND_FREE || e->refs > 0) continue;
+		if (s_frame - e->last_used > VOID_GPU_CACHE_KEEP_FRAMES) evict((int32_t)i);
+	}
+}
+
+void void_gpu_cache_clear(void) {
+	if (void_capture_active()) void_capture_record(VOID_CAP_CACHE_CLEAR);
+	for (uint32_t i = 0; i < s_entry_count; i++) {
+		if (s_entries[i].kind != KIND_FREE) {
+			release_object(s_entries[i].kind, s_entries[i].handle);
+			free(s_entries[i].key);
+		}
+	}
+	free(s_entries);
+	s_entries = NULL;
+	s_entry_count = 0;
+	s_entry_cap = 0;
+	s_free = -1;
+	map_clear(&s_by_key);
+	map_clear(&s_by_handle);
+	memset(s_live, 0, sizeof(s_live));
+}
+
+// --- Statistics ---
+
+uint32_t void_gpu_cache_count(uint32_t kind) {
+	return kind < 4 ? s_live[kind] : 0;
+}
+
+uint64_t void_gpu_cache_hits(void)   { return s_hits; }
+uint64_t void_gpu_cache_misses(void) { return s_misses; }
@@ -0,0 +1,76 @@
+// Void GPU Cache — deduplicated bind group layouts, bind groups, pipeline
+// layouts and samplers
+// Objects are keyed by their full descriptor (resources by handle) and shared
+// between every caller that asks for the same thing. Each acquire takes a
+// reference; void_gpu_cache_release drops it. Entries with no references are
+// kept for VOID_GPU_CACHE_KEEP_FRAMES frames (so per-frame churn still hits)
+// and then evicted by void_gpu_cache_end_frame.
+// A cached bind group holds a Dawn reference on its layout and resources, so
+// a handle can never be reused by a different object while an entry keyed on
+// it is alive. Not thread-safe: call from the render thread.
+
+#ifndef VOID_GPU_CACHE_H
+#define VOID_GPU_CACHE_H
+
+#include <stdint.h>
+
+#define VOID_GPU_CACHE_MAX_ENTRIES 16   // bindings per layout / group
+#define VOID_GPU_CACHE_KEEP_FRAMES 3
+
+// Entry kinds (for void_gpu_cache_count)
+#define VOID_GPU_CACHE_LAYOUT          0
+#define VOID_GPU_CACHE_GROUP           1
+#define VOID_GPU_CACHE_PIPELINE_LAYOUT 2
+#define VOID_GPU_CACHE_SAMPLER         3
+
+// --- Bind group layout builder ---
+// Types and enums are Dawn values (see src/gpu/constants.ms).
+void *void_gpu_layout_begin(void);
+void void_gpu_layout_buffer(void *builder, uint32_t binding, uint32_t visibility,
+    uint32_t type, uint64_t minBindingSize, int hasDynamicOffset);
+void void_gpu_layout_texture(void *builder, uint32_t binding, uint32_t visibility,
+    uint32_t sampleType, uint32_t viewDimension, int multisampled);
+void void_gpu_layout_storage_texture(void *builder, uint32_t binding, uint32_t visibility,
+    uint32_t access, uint32_t format, uint32_t viewDimension);
+void void_gpu_layout_sampler(void *builder, uint32_t binding, uint32_t visibility,
+    uint32_t type);
+// Consumes the builder; returns a cached layout (one reference).
+void *void_gpu_layout_finish(void *device, void *builder);
+
+// --- Bind group builder ---
+void *void_gpu_group_begin(void *layout);
+void void_gpu_group_buffer(void *builder, uint32_t binding, void *buffer,
+    uint64_t offset, uint64_t size);
+void void_gpu_group_texture(void *builder, uint32_t binding, void *textureView);
+void void_gpu_group_sampler(void *builder, uint32_t binding, void *sampler);
+// Consumes the builder; returns a cached bind group (one reference).
+void *void_gpu_group_finish(void *device, void *builder);
+
+// --- Pipeline layout ---
+void *void_gpu_cached_pipeline_layout(void *device, uint32_t count, void *const *bindGroupLayouts);
+void *void_gpu_cached_pipeline_layout_1(void *device, void *bgl0);
+void *void_gpu_cached_pipeline_layout_2(void *device, void *bgl0, void *bgl1);
+void *void_gpu_cached_pipeline_layout_3(void *device, void *bgl0, void *bgl1, void *bgl2);
+void *void_gpu_cached_pipeline_layout_4(void *device, void *bgl0, void *bgl1, void *bgl2, void *bgl3);
+
+// --- Sampler ---
+// compare = 0 for a regular sampler, else a CompareFunction (comparison
+// sampler). maxAnisotropy > 1 requires linear mag/min/mipmap filtering and
+// is clamped to 1 otherwise.
+void *void_gpu_cached_sampler(void *device,
+    uint32_t addressU, uint32_t addressV, uint32_t addressW,
+    uint32_t magFilter, uint32_t minFilter, uint32_t mipmapFilter,
+    uint32_t compare, uint32_t maxAnisotropy);
+
+// --- References & eviction ---
+void void_gpu_cache_retain(void *handle);
+void void_gpu_cache_release(void *handle);
+void void_gpu_cache_end_frame(void);
+void void_gpu_cache_clear(void);
+
+// Statistics
+uint32_t void_gpu_cache_count(uint32_t kind);
+uint64_t void_gpu_cache_hits(void);
+uint64_t void_gpu_cache_misses(void);
+
+#endif
@@ -0,0 +1,397 @@
+// Void GPU Capture — records the dawn.c / cache.c call stream to a file
+
+#include "capture.h"
+#include "dawn.h"
+#include "../core/hash.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- Op table ---
+
+typedef struct OpInfo {
+	const char *name;
+	const char *format;
+} OpInfo;
+
+static const OpInfo s_ops[VOID_CAP_OP_COUNT] = {
+	[VOID_CAP_INSTANCE]                      = { "instance",                      "n" },
+	[VOID_CAP_SURFACE]                       = { "surface",                       "nh" },
+	[VOID_CAP_ADAPTER]                       = { "adapter",                       "nh" },
+	[VOID_CAP_DEVICE]                        = { "device",                        "nh" },
+	[VOID_CAP_QUEUE]                         = { "queue",                         "nh" },
+	[VOID_CAP_CONFIGURE_SURFACE]             = { "configure_surface",             "hhuu" },
+	[VOID_CAP_CREATE_BUFFER]                 = { "create_buffer",                 "nhUui" },
+	[VOID_CAP_BUFFER_DATA]                   = { "buffer_data",                   "hUb" },
+	[VOID_CAP_BUFFER_UNMAP]                  = { "buffer_unmap",                  "h" },
+	[VOID_CAP_QUEUE_WRITE_BUFFER]            = { "queue_write_buffer",            "hhUb" },
+	[VOID_CAP_BUFFER_WRITE_FLOATS]           = { "buffer_write_floats",           "hb" },
+	[VOID_CAP_CREATE_SHADER]                 = { "create_shader",                 "nhs" },
+	[VOID_CAP_CREATE_RENDER_PIPELINE]        = { "create_render_pipeline",        "nhhss" },
+	[VOID_CAP_CREATE_RENDER_PIPELINE_VB]     = { "create_render_pipeline_vb",     "nhhssubbbbb" },
+	[VOID_CAP_CREATE_RENDER_PIPELINE_1VB]    = { "create_render_pipeline_1vb",    "nhhssUuuUuuUu" },
+	[VOID_CAP_CREATE_RENDER_PIPELINE_EXT]    = { "create_render_pipeline_ext",    "nhhsshUuuUuuUuiu" },
+	[VOID_CAP_CREATE_RENDER_PIPELINE_EXT2]   = { "create_render_pipeline_ext2",   "nhhsshUuuUuuUuuUuiuiuuuuuu" },
+	[VOID_CAP_CREATE_RENDER_PIPELINE_DESC]   = { "create_render_pipeline_desc",   "nhP" },
+	[VOID_CAP_CREATE_COMPUTE_PIPELINE]       = { "create_compute_pipeline",       "nhhsh" },
+	[VOID_CAP_GET_CURRENT_TEXTURE_VIEW]      = { "get_current_texture_view",      "nh" },
+	[VOID_CAP_CREATE_COMMAND_ENCODER]        = { "create_command_encoder",        "nh" },
+	[VOID_CAP_BEGIN_RENDER_PASS]             = { "begin_render_pass",             "nhhdddd" },
+	[VOID_CAP_BEGIN_RENDER_PASS_DEPTH]       = { "begin_render_pass_depth",       "nhhddddh" },
+	[VOID_CAP_BEGIN_RENDER_PASS_DESC]        = { "begin_render_pass_desc",        "nhR" },
+	[VOID_CAP_SET_PIPELINE]                  = { "set_pipeline",                  "hh" },
+	[VOID_CAP_SET_VERTEX_BUFFER]             = { "set_vertex_buffer",             "huhUU" },
+	[VOID_CAP_SET_INDEX_BUFFER]              = { "set_index_buffer",              "hhuUU" },
+	[VOID_CAP_SET_BIND_GROUP]                = { "set_bind_group",                "huh" },
+	[VOID_CAP_SET_VIEWPORT]                  = { "set_viewport",                  "hffffff" },
+	[VOID_CAP_SET_SCISSOR_RECT]              = { "set_scissor_rect",              "huuuu" },
+	[VOID_CAP_DRAW]                          = { "draw",                          "hu" },
+	[VOID_CAP_DRAW_INSTANCED]                = { "draw_instanced",                "huuuu" },
+	[VOID_CAP_DRAW_INDEXED]                  = { "draw_indexed",                  "huuuiu" },
+	[VOID_CAP_DRAW_INDIRECT]                 = { "draw_indirect",                 "hhU" },
+	[VOID_CAP_END_RENDER_PASS]               = { "end_render_pass",               "h" },
+	[VOID_CAP_BEGIN_COMPUTE_PASS]            = { "begin_compute_pass",            "nh" },
+	[VOID_CAP_BEGIN_COMPUTE_PASS_DESC]       = { "begin_compute_pass_desc",       "nhC" },
+	[VOID_CAP_COMPUTE_SET_PIPELINE]          = { "compute_set_pipeline",          "hh" },
+	[VOID_CAP_COMPUTE_SET_BIND_GROUP]        = { "compute_set_bind_group",        "huh" },
+	[VOID_CAP_COMPUTE_SET_BIND_GROUP_OFFSET] = { "compute_set_bind_group_offset", "huhu" },
+	[VOID_CAP_DISPATCH]                      = { "dispatch",                      "huuu" },
+	[VOID_CAP_DISPATCH_INDIRECT]             = { "dispatch_indirect",             "hhU" },
+	[VOID_CAP_END_COMPUTE_PASS]              = { "end_compute_pass",              "h" },
+	[VOID_CAP_FINISH_ENCODER]                = { "finish_encoder",                "nh" },
+	[VOID_CAP_SUBMIT]                        = { "submit",                        "hh" },
+	[VOID_CAP_PRESENT]                       = { "present",                       "h" },
+	[VOID_CAP_ENCODER_PUSH_DEBUG_GROUP]      = { "encoder_push_debug_group",      "hs" },
+	[VOID_CAP_ENCODER_POP_DEBUG_GROUP]       = { "encoder_pop_debug_group",       "h" },
+	[VOID_CAP_ENCODER_INSERT_DEBUG_MARKER]   = { "encoder_insert_debug_marker",   "hs" },
+	[VOID_CAP_PASS_PUSH_DEBUG_GROUP]         = { "pass_push_debug_group",         "hs" },
+	[VOID_CAP_PASS_POP_DEBUG_GROUP]          = { "pass_pop_debug_group",          "h" },
+	[VOID_CAP_PASS_INSERT_DEBUG_MARKER]      = { "pass_insert_debug_marker",      "hs" },
+	[VOID_CAP_COMPUTE_PUSH_DEBUG_GROUP]      = { "compute_push_debug_group",      "hs" },
+	[VOID_CAP_COMPUTE_POP_DEBUG_GROUP]       = { "compute_pop_debug_group",       "h" },
+	[VOID_CAP_CREATE_BIND_GROUP_LAYOUT_1BUF] = { "create_bind_group_layout_1buf", "nhuuU" },
+	[VOID_CAP_CREATE_BIND_GROUP_1BUF]        = { "create_bind_group_1buf",        "nhhuhUU" },
+	[VOID_CAP_CREATE_PIPELINE_LAYOUT_1BG]    = { "create_pipeline_layout_1bg",    "nhh" },
+	[VOID_CAP_CREATE_BIND_GROUP_LAYOUT_TS]   = { "create_bind_group_layout_1tex_1samp", "nhuuuu" },
+	[VOID_CAP_CREATE_BIND_GROUP_TS]          = { "create_bind_group_1tex_1samp",  "nhhuhuh" },
+	[VOID_CAP_CREATE_PIPELINE_LAYOUT_2BG]    = { "create_pipeline_layout_2bg",    "nhhh" },
+	[VOID_CAP_CREATE_DEPTH_TEXTURE]          = { "create_depth_texture",          "nhuu" },
+	[VOID_CAP_CREATE_TEXTURE]                = { "create_texture",                "nhuuuuu" },
+	[VOID_CAP_CREATE_TEXTURE_MS]             = { "create_texture_ms",             "nhuuuuu" },
+	[VOID_CAP_CREATE_TEXTURE_LAYERS]         = { "create_texture_layers",         "nhuuuuuu" },
+	[VOID_CAP_CREATE_TEXTURE_VIEW]           = { "create_texture_view",           "nh" },
+	[VOID_CAP_CREATE_TEXTURE_VIEW_RANGE]     = { "create_texture_view_range",     "nhuuuuuu" },
+	[VOID_CAP_QUEUE_WRITE_TEXTURE]           = { "queue_write_texture",           "hhbuuu" },
+	[VOID_CAP_QUEUE_WRITE_TEXTURE_REGION]    = { "queue_write_texture_region",    "hhuubuuu" },
+	[VOID_CAP_QUEUE_WRITE_TEXTURE_MIP]       = { "queue_write_texture_mip",       "hhubuuu" },
+	[VOID_CAP_QUEUE_WRITE_TEXTURE_LEVEL]     = { "queue_write_texture_level",     "hhuuubuu" },
+	[VOID_CAP_CREATE_SAMPLER]                = { "create_sampler",                "nhuuu" },
+	[VOID_CAP_RELEASE_SURFACE]               = { "release_surface",               "h" },
+	[VOID_CAP_RELEASE_SHADER]                = { "release_shader",                "h" },
+	[VOID_CAP_RELEASE_PIPELINE]              = { "release_pipeline",              "h" },
+	[VOID_CAP_RELEASE_COMMAND_ENCODER]       = { "release_command_encoder",       "h" },
+	[VOID_CAP_RELEASE_COMMAND_BUFFER]        = { "release_command_buffer",        "h" },
+	[VOID_CAP_RELEASE_TEXTURE_VIEW]          = { "release_texture_view",          "h" },
+	[VOID_CAP_RELEASE_BUFFER]                = { "release_buffer",                "h" },
+	[VOID_CAP_RELEASE_TEXTURE]               = { "release_texture",               "h" },
+	[VOID_CAP_RELEASE_BIND_GROUP_LAYOUT]     = { "release_bind_group_layout",     "h" },
+	[VOID_CAP_RELEASE_BIND_GROUP]            = { "release_bind_group",            "h" },
+	[VOID_CAP_RELEASE_COMPUTE_PIPELINE]      = { "release_compute_pipeline",      "h" },
+	[VOID_CAP_RELEASE_PIPELINE_LAYOUT]       = { "release_pipeline_layout",       "h" },
+	[VOID_CAP_RELEASE_SAMPLER]               = { "release_sampler",               "h" },
+	[VOID_CAP_LAYOUT_BEGIN]                  = { "layout_begin",                  "n" },
+	[VOID_CAP_LAYOUT_BUFFER]                 = { "layout_buffer",                 "huuuUi" },
+	[VOID_CAP_LAYOUT_TEXTURE]                = { "layout_texture",                "huuuui" },
+	[VOID_CAP_LAYOUT_STORAGE_TEXTURE]        = { "layout_storage_texture",        "huuuuu" },
+	[VOID_CAP_LAYOUT_SAMPLER]                = { "layout_sampler",                "huuu" },
+	[VOID_CAP_LAYOUT_FINISH]                 = { "layout_finish",                 "nhh" },
+	[VOID_CAP_GROUP_BEGIN]                   = { "group_begin",                   "nh" },
+	[VOID_CAP_GROUP_BUFFER]                  = { "group_buffer",                  "huhUU" },
+	[VOID_CAP_GROUP_TEXTURE]                 = { "group_texture",                 "huh" },
+	[VOID_CAP_GROUP_SAMPLER]                 = { "group_sampler",                 "huh" },
+	[VOID_CAP_GROUP_FINISH]                  = { "group_finish",                  "nhh" },
+	[VOID_CAP_CACHED_PIPELINE_LAYOUT]        = { "cached_pipeline_layout",        "nhH" },
+	[VOID_CAP_CACHED_SAMPLER]                = { "cached_sampler",                "nhuuuuuuuu" },
+	[VOID_CAP_CACHE_RETAIN]                  = { "cache_retain",                  "h" },
+	[VOID_CAP_CACHE_RELEASE]                 = { "cache_release",                 "h" },
+	[VOID_CAP_CACHE_END_FRAME]               = { "cache_end_frame",               "" },
+	[VOID_CAP_CACHE_CLEAR]                   = { "cache_clear",                   "" },
+	[VOID_CAP_CREATE_BIND_GROUP_LAYOUT_TS_DIM] = { "create_bind_group_layout_1tex_1samp_dim", "nhuuuuu" },
+	[VOID_CAP_CREATE_TEXTURE_3D]             = { "create_texture_3d",             "nhuuuuu" },
+	[VOID_CAP_QUEUE_WRITE_TEXTURE_3D]        = { "queue_write_texture_3d",        "hhbuuuu" },
+};
+
+const char *void_capture_op_format(uint32_t op) {
+	return op < VOID_CAP_OP_COUNT && s_ops[op].format ? s_ops[op].format : "";
+}
+
+const char *void_capture_op_name(uint32_t op) {
+	return op < VOID_CAP_OP_COUNT && s_ops[op].name ? s_ops[op].name : "?";
+}
+
+// --- State ---
+
+#define MAX_MAPPED_RANGES 64
+
+typedef struct MappedRange {
+	void    *buffer;
+	void    *mapped;
+	uint64_t offset;
+	uint64_t size;
+} MappedRange;
+
+static FILE    *s_file = NULL;
+static HashMap  s_ids;             // hash_mix(pointer) -> object id
+static uint32_t s_next_id = 1;     // 0 is NULL
+static uint32_t s_unknown = 0;     // handles not created through the bridge
+
+static uint8_t *s_rec = NULL;      // payload of the record being written
+static uint32_t s_rec_size = 0;
+static uint32_t s_rec_cap = 0;
+
+static MappedRange s_mapped[MAX_MAPPED_RANGES];
+static uint32_t    s_mapped_count = 0;
+
+static uint64_t s_bytes = 0;
+static uint32_t s_frames = 0;
+
+// --- Payload ---
+
+static void put(const void *data, uint64_t size) {
+	if (s_rec_size + size > s_rec_cap) {
+		uint64_t cap = s_rec_cap ? s_rec_cap : 4096;
+		while (cap < s_rec_size + size) cap *= 2;
+		uint8_t *grown = realloc(s_rec, (size_t)cap);
+		if (!grown) return;
+		s_rec = grown;
+		s_rec_cap = (uint32_t)cap;
+	}
+	if (size) memcpy(s_rec + s_rec_size, data, (size_t)size);
+	s_rec_size += (uint32_t)size;
+}
+
+static void put_u32(uint32_t v) { put(&v, sizeof(v)); }
+static void put_i32(int32_t v)  { put(&v, sizeof(v)); }
+static void put_u64(uint64_t v) { put(&v, sizeof(v)); }
+static void put_f32(float v)    { put(&v, sizeof(v)); }
+static void put_f64(double v)   { put(&v, sizeof(v)); }
+
+static void put_str(const char *s) {
+	if (!s) {
+		put_u32(0xFFFFFFFFu);
+		return;
+	}
+	uint32_t len = (uint32_t)strlen(s);
+	put_u32(len);
+	put(s, len);
+}
+
+static void put_blob(const void *data, uint64_t size) {
+	if (!data) size = 0;
+	put_u64(size);
+	put(data, size);
+}
+
+static uint64_t id_key(const void *p) {
+	return hash_mix((uint64_t)(uintptr_t)p);
+}
+
+// A created object always gets a fresh id: the same pointer may come back
+// for a new object after a release, or for a cache hit (replay hits too)
+static void put_new(void *p) {
+	if (!p) {
+		put_u32(0);
+		return;
+	}
+	uint32_t id = s_next_id++;
+	map_put(&s_ids, id_key(p), (int32_t)id);
+	put_u32(id);
+}
+
+static void put_handle(void *p) {
+	if (!p) {
+		put_u32(0);
+		return;
+	}
+	int32_t id = map_get(&s_ids, id_key(p));
+	if (id < 0) {
+		if (s_unknown++ == 0) {
+			fprintf(stderr, "void_capture: handle %p was not created through dawn.c; recorded as NULL\n", p);
+		}
+		id = 0;
+	}
+	put_u32((uint32_t)id);
+}
+
+static void put_pipeline_desc(const VoidRenderPipelineDesc *d) {
+	uint32_t attr_count = d->attr_count < VOID_GPU_MAX_VERTEX_ATTRS
+		? d->attr_count : VOID_GPU_MAX_VERTEX_ATTRS;
+	put_handle(d->shader);
+	put_str(d->vs_entry);
+	put_str(d->fs_entry);
+	put_handle(d->layout);
+	put_u64(d->stride);
+	put_u32(attr_count);
+	for (uint32_t i = 0; i < attr_count; i++) {
+		put_u32(d->attrs[i].format);
+		put_u64(d->attrs[i].offset);
+		put_u32(d->attrs[i].location);
+	}
+	put_i32(d->instanced);
+	put_u32(d->color_format);
+	put_i32(d->depth_only);
+	put_u32(d->cull_mode);
+	put_u32(d->sample_count);
+	put_u32(d->depth_format);
+	put_i32(d->depth_write);
+	put_u32(d->depth_compare);
+	put_i32(d->depth_bias);
+	put_f32(d->depth_bias_slope_scale);
+	put_f32(d->depth_bias_clamp);
+	put_i32(d->has_blend);
+	put_u32(d->blend_color_src);
+	put_u32(d->blend_color_dst);
+	put_u32(d->blend_color_op);
+	put_u32(d->blend_alpha_src);
+	put_u32(d->blend_alpha_dst);
+	put_u32(d->blend_alpha_op);
+}
+
+// Timestamp writes are not recorded (the query set belongs to timer.c)
+static void put_pass_desc(const VoidRenderPassDesc *d) {
+	uint32_t count = d->color_count < VOID_GPU_MAX_COLOR_ATTACHMENTS
+		? d->color_count : VOID_GPU_MAX_COLOR_ATTACHMENTS;
+	put_str(d->label);
+	put_u32(count);
+	for (uint32_t i = 0; i < count; i++) {
+		const VoidColorAttachment *c = &d->colors[i];
+		put_handle(c->view);
+		put_handle(c->resolve_target);
+		put_i32(c->clear);
+		put_i32(c->store);
+		put_f64(c->clear_r);
+		put_f64(c->clear_g);
+		put_f64(c->clear_b);
+		put_f64(c->clear_a);
+	}
+	put_handle(d->depth_view);
+	put_i32(d->depth_clear);
+	put_i32(d->depth_store);
+	put_i32(d->depth_read_only);
+	put_f32(d->depth_clear_value);
+}
+
+// --- Recording ---
+
+int void_capture_start(const char *path) {
+	void_capture_stop();
+	s_file = fopen(path, "wb");
+	if (!s_file) {
+		fprintf(stderr, "void_capture: cannot write %s\n", path);
+		return 0;
+	}
+	uint32_t version = VOID_CAPTURE_VERSION;
+	fwrite(VOID_CAPTURE_MAGIC, 1, 4, s_file);
+	fwrite(&version, sizeof(version), 1, s_file);
+	s_bytes = 8;
+	s_frames = 0;
+	s_next_id = 1;
+	s_unknown = 0;
+	s_mapped_count = 0;
+	map_clear(&s_ids);
+	return 1;
+}
+
+void void_capture_stop(void) {
+	if (!s_file) return;
+	fclose(s_file);
+	s_file = NULL;
+	map_clear(&s_ids);
+	free(s_rec);
+	s_rec = NULL;
+	s_rec_size = 0;
+	s_rec_cap = 0;
+	if (s_unknown) {
+		fprintf(stderr, "void_capture: %u reference(s) to unknown handles recorded as NULL\n", s_unknown);
+	}
+}
+
+int void_capture_active(void) {
+	return s_file != NULL;
+}
+
+void void_capture_record(uint32_t op, ...) {
+	if (!s_file || op >= VOID_CAP_OP_COUNT || !s_ops[op].format) return;
+	s_rec_size = 0;
+
+	va_list ap;
+	va_start(ap, op);
+	for (const char *f = s_ops[op].format; *f; f++) {
+		switch (*f) {
+		case 'n': put_new(va_arg(ap, void *)); break;
+		case 'h': put_handle(va_arg(ap, void *)); break;
+		case 'u': put_u32(va_arg(ap, uint32_t)); break;
+		case 'i': put_i32(va_arg(ap, int)); break;
+		case 'U': put_u64(va_arg(ap, uint64_t)); break;
+		case 'f': put_f32((float)va_arg(ap, double)); break;
+		case 'd': put_f64(va_arg(ap, double)); break;
+		case 's': put_str(va_arg(ap, const char *)); break;
+		case 'b': {
+			const void *data = va_arg(ap, const void *);
+			put_blob(data, va_arg(ap, uint64_t));
+			break;
+		}
+		case 'H': {
+			uint32_t count = va_arg(ap, uint32_t);
+			void *const *handles = va_arg(ap, void *const *);
+			put_u32(count);
+			for (uint32_t i = 0; i < count; i++) put_handle(handles[i]);
+			break;
+		}
+		case 'P': put_pipeline_desc(va_arg(ap, const VoidRenderPipelineDesc *)); break;
+		case 'R': put_pass_desc(va_arg(ap, const VoidRenderPassDesc *)); break;
+		case 'C': put_str(va_arg(ap, const VoidComputePassDesc *)->label); break;
+		}
+	}
+	va_end(ap);
+
+	uint16_t op16 = (uint16_t)op;
+	fwrite(&op16, sizeof(op16), 1, s_file);
+	fwrite(&s_rec_size, sizeof(s_rec_size), 1, s_file);
+	fwrite(s_rec, 1, s_rec_size, s_file);
+	s_bytes += sizeof(op16) + sizeof(s_rec_size) + s_rec_size;
+	if (op == VOID_CAP_PRESENT) s_frames++;
+}
+
+// --- Mapped ranges ---
+
+void void_capture_mapped_range(void *buffer, void *mapped, uint64_t offset, uint64_t size) {
+	if (!s_file || !mapped) return;
+	if (s_mapped_count >= MAX_MAPPED_RANGES) {
+		fprintf(stderr, "void_capture: too many mapped ranges; contents will be missing\n");
+		return;
+	}
+	s_mapped[s_mapped_count++] = (MappedRange){ buffer, mapped, offset, size };
+}
+
+void void_capture_unmap(void *buffer) {
+	if (!s_file) return;
+	uint32_t i = 0;
+	while (i < s_mapped_count) {
+		MappedRange *r = &s_mapped[i];
+		if (r->buffer != buffer) {
+			i++;
+			continue;
+		}
+		void_capture_record(VOID_CAP_BUFFER_DATA, buffer, r->offset, (const void *)r->mapped, r->size);
+		*r = s_mapped[--s_mapped_count];
+	}
+	void_capture_record(VOID_CAP_BUFFER_UNMAP, buffer);
+}
+
+// --- Statistics ---
+
+uint64_t void_capture_bytes(void)  { return s_bytes; }
+uint32_t void_capture_frames(void) { return s_frames; }
@@ -0,0 +1,173 @@
+// Void GPU Capture — records the dawn.c / cache.c call stream to a file
+// A capture holds every bridge call with its arguments and data payloads
+// (buffer and texture uploads, mapped-range contents, shader source), with
+// objects named by small ids instead of pointers, so replay/ can re-issue the
+// exact same stream headlessly on any machine and time it call by call.
+//
+// Recording must start before the GPU instance is created (objects made
+// earlier are unknown to the capture): call void_capture_start first, or set
+// VOID_GPU_CAPTURE=<path> and void_gpu_create_instance starts it. Not
+// recorded: queries (has_*, texture_compression), process_events, and work
+// modules issue straight to Dawn (timer.c queries, streaming.c readbacks);
+// pass timestamp writes are dropped. The surface is recorded by size only:
+// replay renders into an offscreen texture and treats present as a frame
+// boundary. Not thread-safe: record from the render thread.
+//
+// File: "VCAP", u32 version, then records of u16 op, u32 payload size,
+// payload. Payload fields follow the op's format string (native byte order):
+//   n  new object id (u32)      h  object id (u32, 0 = NULL)
+//   u  u32    i  i32    U  u64    f  f32    d  f64
+//   s  string (u32 length, bytes; length 0xFFFFFFFF = NULL)
+//   b  blob (u64 size, bytes)
+//   H  id array (u32 count, ids)
+//   P  VoidRenderPipelineDesc   R  VoidRenderPassDesc   C  VoidComputePassDesc
+// Recording arguments are passed in the same order as C values: u/i as
+// uint32_t/int, U as uint64_t, f/d as double, s as const char *, b as
+// (const void *, uint64_t), H as (uint32_t, void *const *), P/R/C as
+// pointers to the struct, n/h as void *.
+
+#ifndef VOID_GPU_CAPTURE_H
+#define VOID_GPU_CAPTURE_H
+
+#include <stdint.h>
+
+#define VOID_CAPTURE_MAGIC   "VCAP"
+#define VOID_CAPTURE_VERSION 1
+
+// --- Ops (numbering is part of the file format: append only) ---
+
+#define VOID_CAP_INSTANCE                      1
+#define VOID_CAP_SURFACE                       2
+#define VOID_CAP_ADAPTER                       3
+#define VOID_CAP_DEVICE                        4
+#define VOID_CAP_QUEUE                         5
+#define VOID_CAP_CONFIGURE_SURFACE             6
+#define VOID_CAP_CREATE_BUFFER                 7
+#define VOID_CAP_BUFFER_DATA                   8    // mapped-range contents, at unmap
+#define VOID_CAP_BUFFER_UNMAP                  9
+#define VOID_CAP_QUEUE_WRITE_BUFFER            10
+#define VOID_CAP_BUFFER_WRITE_FLOATS           11
+#define VOID_CAP_CREATE_SHADER                 12
+#define VOID_CAP_CREATE_RENDER_PIPELINE        13
+#define VOID_CAP_CREATE_RENDER_PIPELINE_VB     14
+#define VOID_CAP_CREATE_RENDER_PIPELINE_1VB    15
+#define VOID_CAP_CREATE_RENDER_PIPELINE_EXT    16
+#define VOID_CAP_CREATE_RENDER_PIPELINE_EXT2   17
+#define VOID_CAP_CREATE_RENDER_PIPELINE_DESC   18
+#define VOID_CAP_CREATE_COMPUTE_PIPELINE       19
+#define VOID_CAP_GET_CURRENT_TEXTURE_VIEW      20
+#define VOID_CAP_CREATE_COMMAND_ENCODER        21
+#define VOID_CAP_BEGIN_RENDER_PASS             22
+#define VOID_CAP_BEGIN_RENDER_PASS_DEPTH       23
+#define VOID_CAP_BEGIN_RENDER_PASS_DESC        24
+#define VOID_CAP_SET_PIPELINE                  25
+#define VOID_CAP_SET_VERTEX_BUFFER             26
+#define VOID_CAP_SET_INDEX_BUFFER              27
+#define VOID_CAP_SET_BIND_GROUP                28
+#define VOID_CAP_SET_VIEWPORT                  29
+#define VOID_CAP_SET_SCISSOR_RECT              30
+#define VOID_CAP_DRAW                          31
+#define VOID_CAP_DRAW_INSTANCED                32
+#define VOID_CAP_DRAW_INDEXED                  33
+#define VOID_CAP_DRAW_INDIRECT                 34
+#define VOID_CAP_END_RENDER_PASS               35
+#define VOID_CAP_BEGIN_COMPUTE_PASS            36
+#define VOID_CAP_BEGIN_COMPUTE_PASS_DESC       37
+#define VOID_CAP_COMPUTE_SET_PIPELINE          38
+#define VOID_CAP_COMPUTE_SET_BIND_GROUP        39
+#define VOID_CAP_COMPUTE_SET_BIND_GROUP_OFFSET 40
+#define VOID_CAP_DISPATCH                      41
+#define VOID_CAP_DISPATCH_INDIRECT             42
+#define VOID_CAP_END_COMPUTE_PASS              43
+#define VOID_CAP_FINISH_ENCODER                44
+#define VOID_CAP_SUBMIT                        45
+#define VOID_CAP_PRESENT                       46   // frame boundary
+#define VOID_CAP_ENCODER_PUSH_DEBUG_GROUP      47
+#define VOID_CAP_ENCODER_POP_DEBUG_GROUP       48
+#define VOID_CAP_ENCODER_INSERT_DEBUG_MARKER   49
+#define VOID_CAP_PASS_PUSH_DEBUG_GROUP         50
+#define VOID_CAP_PASS_POP_DEBUG_GROUP          51
+#define VOID_CAP_PASS_INSERT_DEBUG_MARKER      52
+#define VOID_CAP_COMPUTE_PUSH_DEBUG_GROUP      53
+#define VOID_CAP_COMPUTE_POP_DEBUG_GROUP       54
+#define VOID_CAP_CREATE_BIND_GROUP_LAYOUT_1BUF 55
+#define VOID_CAP_CREATE_BIND_GROUP_1BUF        56
+#define VOID_CAP_CREATE_PIPELINE_LAYOUT_1BG    57
+#define VOID_CAP_CREATE_BIND_GROUP_LAYOUT_TS   58   // 1tex_1samp
+#define VOID_CAP_CREATE_BIND_GROUP_TS          59   // 1tex_1samp
+#define VOID_CAP_CREATE_PIPELINE_LAYOUT_2BG    60
+#define VOID_CAP_CREATE_DEPTH_TEXTURE          61
+#define VOID_CAP_CREATE_TEXTURE                62
+#define VOID_CAP_CREATE_TEXTURE_MS             63
+#define VOID_CAP_CREATE_TEXTURE_LAYERS         64
+#define VOID_CAP_CREATE_TEXTURE_VIEW           65
+#define VOID_CAP_CREATE_TEXTURE_VIEW_RANGE     66
+#define VOID_CAP_QUEUE_WRITE_TEXTURE           67
+#define VOID_CAP_QUEUE_WRITE_TEXTURE_REGION    68
+#define VOID_CAP_QUEUE_WRITE_TEXTURE_MIP       69
+#define VOID_CAP_QUEUE_WRITE_TEXTURE_LEVEL     70
+#define VOID_CAP_CREATE_SAMPLER                71
+#define VOID_CAP_RELEASE_SURFACE               72
+#define VOID_CAP_RELEASE_SHADER                73
+#define VOID_CAP_RELEASE_PIPELINE              74
+#define VOID_CAP_RELEASE_COMMAND_ENCODER       75
+#define VOID_CAP_RELEASE_COMMAND_BUFFER        76
+#define VOID_CAP_RELEASE_TEXTURE_VIEW          77
+#define VOID_CAP_RELEASE_BUFFER                78
+#define VOID_CAP_RELEASE_TEXTURE               79
+#define VOID_CAP_RELEASE_BIND_GROUP_LAYOUT     80
+#define VOID_CAP_RELEASE_BIND_GROUP            81
+#define VOID_CAP_RELEASE_COMPUTE_PIPELINE      82
+#define VOID_CAP_RELEASE_PIPELINE_LAYOUT       83
+#define VOID_CAP_RELEASE_SAMPLER               84
+#define VOID_CAP_LAYOUT_BEGIN                  85
+#define VOID_CAP_LAYOUT_BUFFER                 86
+#define VOID_CAP_LAYOUT_TEXTURE                87
+#define VOID_CAP_LAYOUT_STORAGE_TEXTURE        88
+#define VOID_CAP_LAYOUT_SAMPLER                89
+#define VOID_CAP_LAYOUT_FINISH                 90
+#define VOID_CAP_GROUP_BEGIN                   91
+#define VOID_CAP_GROUP_BUFFER                  92
+#define VOID_CAP_GROUP_TEXTURE                 93
+#define VOID_CAP_GROUP_SAMPLER                 94
+#define VOID_CAP_GROUP_FINISH                  95
+#define VOID_CAP_CACHED_PIPELINE_LAYOUT        96
+#define VOID_CAP_CACHED_SAMPLER                97
+#define VOID_CAP_CACHE_RETAIN                  98
+#define VOID_CAP_CACHE_RELEASE                 99
+#define VOID_CAP_CACHE_END_FRAME               100
+#define VOID_CAP_CACHE_CLEAR                   101
+#define VOID_CAP_CREATE_BIND_GROUP_LAYOUT_TS_DIM 102
+#define VOID_CAP_CREATE_TEXTURE_3D             103
+#define VOID_CAP_QUEUE_WRITE_TEXTURE_3D        104
+#define VOID_CAP_OP_COUNT                      105
+
+// Field format and name of an op ("" / "?" for unknown ops)
+const char *void_capture_op_format(uint32_t op);
+const char *void_capture_op_name(uint32_t op);
+
+// --- Recording ---
+
+// 1 when the file was opened; ends any capture in progress
+int void_capture_start(const char *path);
+// Flushes and closes the file
+void void_capture_stop(void);
+int void_capture_active(void);
+
+// Appends one record; arguments follow the op's format (see above)
+void void_capture_record(uint32_t op, ...);
+
+// Records only while a capture is running (the disabled cost is one call)
+#define VOID_CAPTURE(op, ...) \
+    do { if (void_capture_active()) void_capture_record(op, __VA_ARGS__); } while (0)
+
+// Mapped ranges handed out by void_gpu_buffer_get_mapped_range; their
+// contents are recorded when the buffer is unmapped
+void void_capture_mapped_range(void *buffer, void *mapped, uint64_t offset, uint64_t size);
+void void_capture_unmap(void *buffer);
+
+// Statistics for the capture in progress (or the last one)
+uint64_t void_capture_bytes(void);
+uint32_t void_capture_frames(void);
+
+#endif
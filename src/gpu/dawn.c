@@ -1,25 +1,43 @@
 // Void Dawn/WebGPU — GPU instance, device, pipeline, buffer, render
 
 #include "dawn.h"
+#include "memory.h"
+#include "capture.h"
+#include "../assets/pixels.h"
 
 #include <dawn/webgpu.h>
 #include <SDL3/SDL.h>
 #include <sdl3webgpu.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
-// --- Callback state ---
+// --- Futures ---
+// Adapter, device and async pipeline requests complete through
+// wgpuInstanceWaitAny (callbacks in WaitAnyOnly mode run inside the wait on
+// the caller's thread), so results land in the request, not in globals.
 
-static WGPUAdapter s_adapter = NULL;
-static WGPUDevice  s_device  = NULL;
+enum { REQUEST_ADAPTER, REQUEST_DEVICE, REQUEST_PIPELINE };
+
+typedef struct GpuRequest {
+	uint32_t     kind;
+	WGPUInstance instance;      // owned reference (WaitAny target)
+	WGPUFuture   future;
+	int          done;
+	void        *result;        // NULL on failure
+	void        *parent;        // instance / adapter / device, for the capture
+	VoidRenderPipelineDesc pipeline;   // REQUEST_PIPELINE: recorded on completion
+} GpuRequest;
 
 static void on_adapter_ready(
 	WGPURequestAdapterStatus status, WGPUAdapter adapter,
 	WGPUStringView message, void *u1, void *u2
 ) {
-	(void)message; (void)u1; (void)u2;
+	(void)message; (void)u2;
+	GpuRequest *r = (GpuRequest *)u1;
+	r->done = 1;
 	if (status == WGPURequestAdapterStatus_Success) {
-		s_adapter = adapter;
+		r->result = adapter;
 	} else {
 		fprintf(stderr, "void_gpu: adapter request failed (%d)\n", status);
 	}
@@ -29,14 +47,31 @@ static void on_device_ready(
 	WGPURequestDeviceStatus status, WGPUDevice device,
 	WGPUStringView message, void *u1, void *u2
 ) {
-	(void)message; (void)u1; (void)u2;
+	(void)message; (void)u2;
+	GpuRequest *r = (GpuRequest *)u1;
+	r->done = 1;
 	if (status == WGPURequestDeviceStatus_Success) {
-		s_device = device;
+		r->result = device;
 	} else {
 		fprintf(stderr, "void_gpu: device request failed (%d)\n", status);
 	}
 }
 
+static void on_pipeline_ready(
+	WGPUCreatePipelineAsyncStatus status, WGPURenderPipeline pipeline,
+	WGPUStringView message, void *u1, void *u2
+) {
+	(void)u2;
+	GpuRequest *r = (GpuRequest *)u1;
+	r->done = 1;
+	if (status == WGPUCreatePipelineAsyncStatus_Success) {
+		r->result = pipeline;
+	} else {
+		fprintf(stderr, "void_gpu: async pipeline failed (%d): %.*s\n",
+			status, (int)message.length, message.data);
+	}
+}
+
 static void on_device_error(
 	WGPUDevice const *device, WGPUErrorType type,
 	WGPUStringView message, void *u1, void *u2
@@ -46,41 +81,186 @@ static void on_device_error(
 		type, (int)message.length, message.data);
 }
 
+static GpuRequest *request_new(uint32_t kind, WGPUInstance instance, void *parent) {
+	GpuRequest *r = calloc(1, sizeof(GpuRequest));
+	r->kind = kind;
+	r->instance = instance;
+	r->parent = parent;
+	return r;
+}
+
+static int request_wait(GpuRequest *r, uint64_t timeout_ns) {
+	if (r->done) return 1;
+	WGPUFutureWaitInfo info = { r->future, 0 };
+	WGPUWaitStatus status = wgpuInstanceWaitAny(r->instance, 1, &info, timeout_ns);
+	if (status == WGPUWaitStatus_Success && !r->done) {
+		// Completed without a callback (instance dropped): treat as failed
+		r->done = 1;
+	} else if (status != WGPUWaitStatus_Success && status != WGPUWaitStatus_TimedOut) {
+		fprintf(stderr, "void_gpu: wait failed (%d)\n", status);
+		r->done = 1;
+	}
+	return r->done;
+}
+
+int void_gpu_request_poll(void *request) {
+	return request ? request_wait((GpuRequest *)request, 0) : 1;
+}
+
+void *void_gpu_request_wait(void *request) {
+	GpuRequest *r = (GpuRequest *)request;
+	if (!r) return NULL;
+	request_wait(r, UINT64_MAX);
+	void *result = r->result;
+	switch (r->kind) {
+		case REQUEST_ADAPTER:
+			VOID_CAPTURE(VOID_CAP_ADAPTER, result, r->parent);
+			break;
+		case REQUEST_DEVICE:
+			VOID_CAPTURE(VOID_CAP_DEVICE, result, r->parent);
+			break;
+		case REQUEST_PIPELINE:
+			VOID_CAPTURE(VOID_CAP_CREATE_RENDER_PIPELINE_DESC, result, r->parent, &r->pipeline);
+			break;
+	}
+	wgpuInstanceRelease(r->instance);
+	free(r);
+	return result;
+}
+
 // --- GPU init ---
 
 void *void_gpu_create_instance(void) {
+	// VOID_GPU_CAPTURE=<path> records the whole session (see capture.h)
+	const char *capture = getenv("VOID_GPU_CAPTURE");
+	if (capture && *capture && !void_capture_active()) void_capture_start(capture);
+
+	// Blocking waits on futures (request_wait with a timeout)
+	WGPUInstanceFeatureName features[] = { WGPUInstanceFeatureName_TimedWaitAny };
 	WGPUInstanceDescriptor desc = {0};
-	return (void *)wgpuCreateInstance(&desc);
+	desc.requiredFeatureCount = 1;
+	desc.requiredFeatures = features;
+	void *instance = (void *)wgpuCreateInstance(&desc);
+	VOID_CAPTURE(VOID_CAP_INSTANCE, instance);
+	return instance;
 }
 
 void *void_gpu_create_surface(void *instance, void *window) {
-	return (void *)SDL_GetWGPUSurface((WGPUInstance)instance, (SDL_Window *)window);
+	void *surface = (void *)SDL_GetWGPUSurface((WGPUInstance)instance, (SDL_Window *)window);
+	VOID_CAPTURE(VOID_CAP_SURFACE, surface, instance);
+	return surface;
 }
 
-void *void_gpu_request_adapter(void *instance, void *surface) {
-	s_adapter = NULL;
+static void *request_adapter(void *instance, void *surface, int fallback) {
+	wgpuInstanceAddRef((WGPUInstance)instance);
+	GpuRequest *r = request_new(REQUEST_ADAPTER, (WGPUInstance)instance, instance);
 	WGPURequestAdapterOptions opts = {0};
 	opts.compatibleSurface = (WGPUSurface)surface;
+	opts.forceFallbackAdapter = fallback ? 1 : 0;
 	WGPURequestAdapterCallbackInfo cb = {0};
-	cb.mode = WGPUCallbackMode_AllowSpontaneous;
+	cb.mode = WGPUCallbackMode_WaitAnyOnly;
 	cb.callback = on_adapter_ready;
-	wgpuInstanceRequestAdapter((WGPUInstance)instance, &opts, cb);
-	return (void *)s_adapter;
+	cb.userdata1 = r;
+	r->future = wgpuInstanceRequestAdapter((WGPUInstance)instance, &opts, cb);
+	return r;
 }
 
-void *void_gpu_request_device(void *adapter) {
-	s_device = NULL;
+void *void_gpu_request_adapter_async(void *instance, void *surface) {
+	return request_adapter(instance, surface, 0);
+}
+
+void *void_gpu_request_adapter(void *instance, void *surface) {
+	return void_gpu_request_wait(request_adapter(instance, surface, 0));
+}
+
+void *void_gpu_request_adapter_fallback(void *instance) {
+	return void_gpu_request_wait(request_adapter(instance, NULL, 1));
+}
+
+void *void_gpu_request_device_async(void *adapter) {
+	GpuRequest *r = request_new(REQUEST_DEVICE, wgpuAdapterGetInstance((WGPUAdapter)adapter), adapter);
+
+	// Optional features, enabled when the adapter has them
+	WGPUFeatureName features[5];
+	size_t feature_count = 0;
+	if (wgpuAdapterHasFeature((WGPUAdapter)adapter, WGPUFeatureName_TransientAttachments)) {
+		features[feature_count++] = WGPUFeatureName_TransientAttachments;
+	}
+	if (wgpuAdapterHasFeature((WGPUAdapter)adapter, WGPUFeatureName_TimestampQuery)) {
+		features[feature_count++] = WGPUFeatureName_TimestampQuery;
+	}
+	// Every compressed family the adapter offers; assets pick per device
+	if (wgpuAdapterHasFeature((WGPUAdapter)adapter, WGPUFeatureName_TextureCompressionBC)) {
+		features[feature_count++] = WGPUFeatureName_TextureCompressionBC;
+	}
+	if (wgpuAdapterHasFeature((WGPUAdapter)adapter, WGPUFeatureName_TextureCompressionETC2)) {
+		features[feature_count++] = WGPUFeatureName_TextureCompressionETC2;
+	}
+	if (wgpuAdapterHasFeature((WGPUAdapter)adapter, WGPUFeatureName_TextureCompressionASTC)) {
+		features[feature_count++] = WGPUFeatureName_TextureCompressionASTC;
+	}
+
 	WGPUDeviceDescriptor dev_desc = {0};
+	dev_desc.requiredFeatureCount = feature_count;
+	dev_desc.requiredFeatures = features;
 	dev_desc.uncapturedErrorCallbackInfo.callback = on_device_error;
 	WGPURequestDeviceCallbackInfo cb = {0};
-	cb.mode = WGPUCallbackMode_AllowSpontaneous;
+	cb.mode = WGPUCallbackMode_WaitAnyOnly;
 	cb.callback = on_device_ready;
-	wgpuAdapterRequestDevice((WGPUAdapter)adapter, &dev_desc, cb);
-	return (void *)s_device;
+	cb.userdata1 = r;
+	r->future = wgpuAdapterRequestDevice((WGPUAdapter)adapter, &dev_desc, cb);
+	return r;
+}
+
+void *void_gpu_request_device(void *adapter) {
+	return void_gpu_request_wait(void_gpu_request_device_async(adapter));
+}
+
+int void_gpu_device_has_transient_attachments(void *device) {
+	return wgpuDeviceHasFeature((WGPUDevice)device, WGPUFeatureName_TransientAttachments) ? 1 : 0;
+}
+
+int void_gpu_device_has_timestamps(void *device) {
+	return wgpuDeviceHasFeature((WGPUDevice)device, WGPUFeatureName_TimestampQuery) ? 1 : 0;
+}
+
+uint32_t void_gpu_device_texture_compression(void *device) {
+	uint32_t families = 0;
+	if (wgpuDeviceHasFeature((WGPUDevice)device, WGPUFeatureName_TextureCompressionBC)) {
+		families |= VOID_GPU_COMPRESSION_BC;
+	}
+	if (wgpuDeviceHasFeature((WGPUDevice)device, WGPUFeatureName_TextureCompressionETC2)) {
+		families |= VOID_GPU_COMPRESSION_ETC2;
+	}
+	if (wgpuDeviceHasFeature((WGPUDevice)device, WGPUFeatureName_TextureCompressionASTC)) {
+		families |= VOID_GPU_COMPRESSION_ASTC;
+	}
+	return families;
+}
+
+void void_gpu_process_events(void *instance) {
+	wgpuInstanceProcessEvents((WGPUInstance)instance);
+}
+
+static void on_work_done(WGPUQueueWorkDoneStatus status, WGPUStringView message, void *u1, void *u2) {
+	(void)status; (void)message; (void)u2;
+	*(int *)u1 = 1;
+}
+
+void void_gpu_queue_wait_idle(void *instance, void *queue) {
+	int done = 0;
+	WGPUQueueWorkDoneCallbackInfo cb = {0};
+	cb.mode = WGPUCallbackMode_AllowProcessEvents;
+	cb.callback = on_work_done;
+	cb.userdata1 = &done;
+	wgpuQueueOnSubmittedWorkDone((WGPUQueue)queue, cb);
+	while (!done) wgpuInstanceProcessEvents((WGPUInstance)instance);
 }
 
 void *void_gpu_get_queue(void *device) {
-	return (void *)wgpuDeviceGetQueue((WGPUDevice)device);
+	void *queue = (void *)wgpuDeviceGetQueue((WGPUDevice)device);
+	VOID_CAPTURE(VOID_CAP_QUEUE, queue, device);
+	return queue;
 }
 
 void void_gpu_configure_surface(
@@ -96,6 +276,7 @@ void void_gpu_configure_surface(
 	config.presentMode = WGPUPresentMode_Fifo;
 	config.alphaMode = WGPUCompositeAlphaMode_Auto;
 	wgpuSurfaceConfigure((WGPUSurface)surface, &config);
+	VOID_CAPTURE(VOID_CAP_CONFIGURE_SURFACE, surface, device, width, height);
 }
 
 // --- Buffer ---
@@ -105,19 +286,26 @@ void *void_gpu_create_buffer(void *device, uint64_t size, uint32_t usage, int ma
 	desc.size = size;
 	desc.usage = (WGPUBufferUsage)usage;
 	desc.mappedAtCreation = mapped_at_creation ? 1 : 0;
-	return (void *)wgpuDeviceCreateBuffer((WGPUDevice)device, &desc);
+	WGPUBuffer buffer = wgpuDeviceCreateBuffer((WGPUDevice)device, &desc);
+	void_gpu_memory_track(buffer, VOID_GPU_MEM_BUFFER, size);
+	VOID_CAPTURE(VOID_CAP_CREATE_BUFFER, (void *)buffer, device, size, usage, mapped_at_creation);
+	return (void *)buffer;
 }
 
 void *void_gpu_buffer_get_mapped_range(void *buffer, uint64_t offset, uint64_t size) {
-	return wgpuBufferGetMappedRange((WGPUBuffer)buffer, (size_t)offset, (size_t)size);
+	void *mapped = wgpuBufferGetMappedRange((WGPUBuffer)buffer, (size_t)offset, (size_t)size);
+	void_capture_mapped_range(buffer, mapped, offset, size);
+	return mapped;
 }
 
 void void_gpu_buffer_unmap(void *buffer) {
+	void_capture_unmap(buffer);
 	wgpuBufferUnmap((WGPUBuffer)buffer);
 }
 
 void void_gpu_queue_write_buffer(void *queue, void *buffer, uint64_t offset, const void *data, uint64_t size) {
 	wgpuQueueWriteBuffer((WGPUQueue)queue, (WGPUBuffer)buffer, offset, data, (size_t)size);
+	VOID_CAPTURE(VOID_CAP_QUEUE_WRITE_BUFFER, queue, buffer, offset, data, size);
 }
 
 void void_gpu_buffer_write_floats(void *buffer, const float *data, uint32_t count) {
@@ -126,6 +314,7 @@ void void_gpu_buffer_write_floats(void *buffer, const float *data, uint32_t coun
 		memcpy(mapped, data, count * sizeof(float));
 	}
 	wgpuBufferUnmap((WGPUBuffer)buffer);
+	VOID_CAPTURE(VOID_CAP_BUFFER_WRITE_FLOATS, buffer, (const void *)data, (uint64_t)count * sizeof(float));
 }
 
 void void_gpu_mapped_write_float(void *mapped, uint32_t index, float value) {
@@ -141,7 +330,9 @@ void *void_gpu_create_shader(void *device, const char *wgsl_source) {
 
 	WGPUShaderModuleDescriptor desc = {0};
 	desc.nextInChain = (WGPUChainedStruct *)&wgsl;
-	return (void *)wgpuDeviceCreateShaderModule((WGPUDevice)device, &desc);
+	void *shader = (void *)wgpuDeviceCreateShaderModule((WGPUDevice)device, &desc);
+	VOID_CAPTURE(VOID_CAP_CREATE_SHADER, shader, device, wgsl_source);
+	return shader;
 }
 
 void *void_gpu_create_render_pipeline(
@@ -171,7 +362,9 @@ void *void_gpu_create_render_pipeline(
 	desc.multisample.mask = 0xFFFFFFFF;
 	desc.fragment = &frag;
 
-	return (void *)wgpuDeviceCreateRenderPipeline((WGPUDevice)device, &desc);
+	void *pipeline = (void *)wgpuDeviceCreateRenderPipeline((WGPUDevice)device, &desc);
+	VOID_CAPTURE(VOID_CAP_CREATE_RENDER_PIPELINE, pipeline, device, shader, vs_entry, fs_entry);
+	return pipeline;
 }
 
 void *void_gpu_create_render_pipeline_vb(
@@ -223,7 +416,19 @@ void *void_gpu_create_render_pipeline_vb(
 	desc.multisample.mask = 0xFFFFFFFF;
 	desc.fragment = &frag;
 
-	return (void *)wgpuDeviceCreateRenderPipeline((WGPUDevice)device, &desc);
+	void *pipeline = (void *)wgpuDeviceCreateRenderPipeline((WGPUDevice)device, &desc);
+	if (void_capture_active()) {
+		uint32_t total = 0;
+		for (uint32_t b = 0; b < buffer_count && b < 8; b++) total += attr_counts[b];
+		void_capture_record(VOID_CAP_CREATE_RENDER_PIPELINE_VB, pipeline, device, shader, vs_entry, fs_entry,
+			buffer_count,
+			(const void *)strides, (uint64_t)buffer_count * sizeof(uint64_t),
+			(const void *)attr_counts, (uint64_t)buffer_count * sizeof(uint32_t),
+			(const void *)formats, (uint64_t)total * sizeof(uint32_t),
+			(const void *)attr_offsets, (uint64_t)total * sizeof(uint64_t),
+			(const void *)locations, (uint64_t)total * sizeof(uint32_t));
+	}
+	return pipeline;
 }
 
 void *void_gpu_create_render_pipeline_1vb(
@@ -274,7 +479,10 @@ void *void_gpu_create_render_pipeline_1vb(
 	desc.multisample.mask = 0xFFFFFFFF;
 	desc.fragment = &frag;
 
-	return (void *)wgpuDeviceCreateRenderPipeline((WGPUDevice)device, &desc);
+	void *pipeline = (void *)wgpuDeviceCreateRenderPipeline((WGPUDevice)device, &desc);
+	VOID_CAPTURE(VOID_CAP_CREATE_RENDER_PIPELINE_1VB, pipeline, device, shader, vs_entry, fs_entry,
+		stride, attr_count, fmt0, off0, loc0, fmt1, off1, loc1);
+	return pipeline;
 }
 
 // --- Frame ---
@@ -287,11 +495,14 @@ void *void_gpu_get_current_texture_view(void *surface) {
 	}
 	WGPUTextureView view = wgpuTextureCreateView(st.texture, NULL);
 	wgpuTextureRelease(st.texture);
+	VOID_CAPTURE(VOID_CAP_GET_CURRENT_TEXTURE_VIEW, (void *)view, surface);
 	return (void *)view;
 }
 
 void *void_gpu_create_command_encoder(void *device) {
-	return (void *)wgpuDeviceCreateCommandEncoder((WGPUDevice)device, NULL);
+	void *encoder = (void *)wgpuDeviceCreateCommandEncoder((WGPUDevice)device, NULL);
+	VOID_CAPTURE(VOID_CAP_CREATE_COMMAND_ENCODER, encoder, device);
+	return encoder;
 }
 
 void *void_gpu_begin_render_pass(
@@ -310,42 +521,94 @@ void *void_gpu_begin_render_pass(
 	rp.colorAttachmentCount = 1;
 	rp.colorAttachments = &color;
 
-	return (void *)wgpuCommandEncoderBeginRenderPass(
+	void *pass = (void *)wgpuCommandEncoderBeginRenderPass(
 		(WGPUCommandEncoder)encoder, &rp);
+	VOID_CAPTURE(VOID_CAP_BEGIN_RENDER_PASS, pass, encoder, view, r, g, b, a);
+	return pass;
 }
 
 void void_gpu_render_pass_set_pipeline(void *pass, void *pipeline) {
 	wgpuRenderPassEncoderSetPipeline(
 		(WGPURenderPassEncoder)pass, (WGPURenderPipeline)pipeline);
+	VOID_CAPTURE(VOID_CAP_SET_PIPELINE, pass, pipeline);
 }
 
 void void_gpu_render_pass_set_vertex_buffer(void *pass, uint32_t slot, void *buffer, uint64_t offset, uint64_t size) {
 	uint64_t actual_size = (size == 0) ? WGPU_WHOLE_SIZE : size;
 	wgpuRenderPassEncoderSetVertexBuffer(
 		(WGPURenderPassEncoder)pass, slot, (WGPUBuffer)buffer, offset, actual_size);
+	VOID_CAPTURE(VOID_CAP_SET_VERTEX_BUFFER, pass, slot, buffer, offset, size);
 }
 
 void void_gpu_render_pass_draw(void *pass, uint32_t vertex_count) {
 	wgpuRenderPassEncoderDraw(
 		(WGPURenderPassEncoder)pass, vertex_count, 1, 0, 0);
+	VOID_CAPTURE(VOID_CAP_DRAW, pass, vertex_count);
 }
 
 void void_gpu_end_render_pass(void *pass) {
+	VOID_CAPTURE(VOID_CAP_END_RENDER_PASS, pass);
 	wgpuRenderPassEncoderEnd((WGPURenderPassEncoder)pass);
 	wgpuRenderPassEncoderRelease((WGPURenderPassEncoder)pass);
 }
 
 void *void_gpu_finish_encoder(void *encoder) {
-	return (void *)wgpuCommandEncoderFinish((WGPUCommandEncoder)encoder, NULL);
+	void *command = (void *)wgpuCommandEncoderFinish((WGPUCommandEncoder)encoder, NULL);
+	VOID_CAPTURE(VOID_CAP_FINISH_ENCODER, command, encoder);
+	return command;
 }
 
 void void_gpu_submit(void *queue, void *command) {
 	WGPUCommandBuffer cmd = (WGPUCommandBuffer)command;
 	wgpuQueueSubmit((WGPUQueue)queue, 1, &cmd);
+	VOID_CAPTURE(VOID_CAP_SUBMIT, queue, command);
 }
 
 void void_gpu_present(void *surface) {
 	wgpuSurfacePresent((WGPUSurface)surface);
+	VOID_CAPTURE(VOID_CAP_PRESENT, surface);
+}
+
+// --- Debug Groups & Markers ---
+
+void void_gpu_encoder_push_debug_group(void *encoder, const char *label) {
+	wgpuCommandEncoderPushDebugGroup((WGPUCommandEncoder)encoder, (WGPUStringView){ label, WGPU_STRLEN });
+	VOID_CAPTURE(VOID_CAP_ENCODER_PUSH_DEBUG_GROUP, encoder, label);
+}
+
+void void_gpu_encoder_pop_debug_group(void *encoder) {
+	wgpuCommandEncoderPopDebugGroup((WGPUCommandEncoder)encoder);
+	VOID_CAPTURE(VOID_CAP_ENCODER_POP_DEBUG_GROUP, encoder);
+}
+
+void void_gpu_encoder_insert_debug_marker(void *encoder, const char *label) {
+	wgpuCommandEncoderInsertDebugMarker((WGPUCommandEncoder)encoder, (WGPUStringView){ label, WGPU_STRLEN });
+	VOID_CAPTURE(VOID_CAP_ENCODER_INSERT_DEBUG_MARKER, encoder, label);
+}
+
+void void_gpu_render_pass_push_debug_group(void *pass, const char *label) {
+	wgpuRenderPassEncoderPushDebugGroup((WGPURenderPassEncoder)pass, (WGPUStringView){ label, WGPU_STRLEN });
+	VOID_CAPTURE(VOID_CAP_PASS_PUSH_DEBUG_GROUP, pass, label);
+}
+
+void void_gpu_render_pass_pop_debug_group(void *pass) {
+	wgpuRenderPassEncoderPopDebugGroup((WGPURenderPassEncoder)pass);
+	VOID_CAPTURE(VOID_CAP_PASS_POP_DEBUG_GROUP, pass);
+}
+
+void void_gpu_render_pass_insert_debug_marker(void *pass, const char *label) {
+	wgpuRenderPassEncoderInsertDebugMarker((WGPURenderPassEncoder)pass, (WGPUStringView){ label, WGPU_STRLEN });
+	VOID_CAPTURE(VOID_CAP_PASS_INSERT_DEBUG_MARKER, pass, label);
+}
+
+void void_gpu_compute_pass_push_debug_group(void *pass, const char *label) {
+	wgpuComputePassEncoderPushDebugGroup((WGPUComputePassEncoder)pass, (WGPUStringView){ label, WGPU_STRLEN });
+	VOID_CAPTURE(VOID_CAP_COMPUTE_PUSH_DEBUG_GROUP, pass, label);
+}
+
+void void_gpu_compute_pass_pop_debug_group(void *pass) {
+	wgpuComputePassEncoderPopDebugGroup((WGPUComputePassEncoder)pass);
+	VOID_CAPTURE(VOID_CAP_COMPUTE_POP_DEBUG_GROUP, pass);
 }
 
 // --- Bind Group & Pipeline Layout ---
@@ -366,7 +629,9 @@ void *void_gpu_create_bind_group_layout_1buf(
 	desc.entryCount = 1;
 	desc.entries = &entry;
 
-	return (void *)wgpuDeviceCreateBindGroupLayout((WGPUDevice)device, &desc);
+	void *layout = (void *)wgpuDeviceCreateBindGroupLayout((WGPUDevice)device, &desc);
+	VOID_CAPTURE(VOID_CAP_CREATE_BIND_GROUP_LAYOUT_1BUF, layout, device, binding, visibility, minBindingSize);
+	return layout;
 }
 
 void *void_gpu_create_bind_group_1buf(
@@ -384,7 +649,9 @@ void *void_gpu_create_bind_group_1buf(
 	desc.entryCount = 1;
 	desc.entries = &entry;
 
-	return (void *)wgpuDeviceCreateBindGroup((WGPUDevice)device, &desc);
+	void *group = (void *)wgpuDeviceCreateBindGroup((WGPUDevice)device, &desc);
+	VOID_CAPTURE(VOID_CAP_CREATE_BIND_GROUP_1BUF, group, device, layout, binding, buffer, offset, size);
+	return group;
 }
 
 void *void_gpu_create_pipeline_layout_1bg(void *device, void *bindGroupLayout) {
@@ -394,12 +661,15 @@ void *void_gpu_create_pipeline_layout_1bg(void *device, void *bindGroupLayout) {
 	desc.bindGroupLayoutCount = 1;
 	desc.bindGroupLayouts = &bgl;
 
-	return (void *)wgpuDeviceCreatePipelineLayout((WGPUDevice)device, &desc);
+	void *layout = (void *)wgpuDeviceCreatePipelineLayout((WGPUDevice)device, &desc);
+	VOID_CAPTURE(VOID_CAP_CREATE_PIPELINE_LAYOUT_1BG, layout, device, bindGroupLayout);
+	return layout;
 }
 
 void void_gpu_render_pass_set_bind_group(void *pass, uint32_t index, void *bindGroup) {
 	wgpuRenderPassEncoderSetBindGroup(
 		(WGPURenderPassEncoder)pass, index, (WGPUBindGroup)bindGroup, 0, NULL);
+	VOID_CAPTURE(VOID_CAP_SET_BIND_GROUP, pass, index, bindGroup);
 }
 
 // --- Index Buffer ---
@@ -411,6 +681,7 @@ void void_gpu_render_pass_set_index_buffer(
 	wgpuRenderPassEncoderSetIndexBuffer(
 		(WGPURenderPassEncoder)pass, (WGPUBuffer)buffer,
 		(WGPUIndexFormat)format, offset, actual_size);
+	VOID_CAPTURE(VOID_CAP_SET_INDEX_BUFFER, pass, buffer, format, offset, size);
 }
 
 void void_gpu_render_pass_draw_indexed(
@@ -420,6 +691,22 @@ void void_gpu_render_pass_draw_indexed(
 	wgpuRenderPassEncoderDrawIndexed(
 		(WGPURenderPassEncoder)pass, indexCount, instanceCount,
 		firstIndex, baseVertex, firstInstance);
+	VOID_CAPTURE(VOID_CAP_DRAW_INDEXED, pass, indexCount, instanceCount, firstIndex, baseVertex, firstInstance);
+}
+
+void void_gpu_render_pass_draw_instanced(
+	void *pass, uint32_t vertexCount, uint32_t instanceCount,
+	uint32_t firstVertex, uint32_t firstInstance
+) {
+	wgpuRenderPassEncoderDraw(
+		(WGPURenderPassEncoder)pass, vertexCount, instanceCount,
+		firstVertex, firstInstance);
+	VOID_CAPTURE(VOID_CAP_DRAW_INSTANCED, pass, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+
+void void_gpu_render_pass_draw_indirect(void *pass, void *buffer, uint64_t offset) {
+	wgpuRenderPassEncoderDrawIndirect((WGPURenderPassEncoder)pass, (WGPUBuffer)buffer, offset);
+	VOID_CAPTURE(VOID_CAP_DRAW_INDIRECT, pass, buffer, offset);
 }
 
 void void_gpu_mapped_write_u16(void *mapped, uint32_t index, uint16_t value) {
@@ -430,6 +717,18 @@ void void_gpu_mapped_write_u32(void *mapped, uint32_t index, uint32_t value) {
 	((uint32_t *)mapped)[index] = value;
 }
 
+// Records a created texture in the memory registry (src/gpu/memory)
+static void *track_texture(WGPUTexture texture, const WGPUTextureDescriptor *desc) {
+	if (!texture) return NULL;
+	uint32_t category = (desc->usage & WGPUTextureUsage_RenderAttachment)
+		? VOID_GPU_MEM_TARGET : VOID_GPU_MEM_TEXTURE;
+	uint64_t bytes = (desc->usage & WGPUTextureUsage_TransientAttachment) ? 0
+		: void_gpu_texture_bytes(desc->size.width, desc->size.height, desc->size.depthOrArrayLayers,
+			(uint32_t)desc->format, desc->mipLevelCount, desc->sampleCount);
+	void_gpu_memory_track(texture, category, bytes);
+	return (void *)texture;
+}
+
 // --- Depth Texture ---
 
 void *void_gpu_create_depth_texture(void *device, uint32_t width, uint32_t height) {
@@ -442,11 +741,15 @@ void *void_gpu_create_depth_texture(void *device, uint32_t width, uint32_t heigh
 	desc.dimension = WGPUTextureDimension_2D;
 	desc.format = WGPUTextureFormat_Depth24Plus;
 	desc.usage = WGPUTextureUsage_RenderAttachment;
-	return (void *)wgpuDeviceCreateTexture((WGPUDevice)device, &desc);
+	void *texture = track_texture(wgpuDeviceCreateTexture((WGPUDevice)device, &desc), &desc);
+	VOID_CAPTURE(VOID_CAP_CREATE_DEPTH_TEXTURE, texture, device, width, height);
+	return texture;
 }
 
 void *void_gpu_create_texture_view(void *texture) {
-	return (void *)wgpuTextureCreateView((WGPUTexture)texture, NULL);
+	void *view = (void *)wgpuTextureCreateView((WGPUTexture)texture, NULL);
+	VOID_CAPTURE(VOID_CAP_CREATE_TEXTURE_VIEW, view, texture);
+	return view;
 }
 
 void *void_gpu_begin_render_pass_depth(
@@ -473,8 +776,10 @@ void *void_gpu_begin_render_pass_depth(
 	rp.colorAttachments = &color;
 	rp.depthStencilAttachment = &depth;
 
-	return (void *)wgpuCommandEncoderBeginRenderPass(
+	void *pass = (void *)wgpuCommandEncoderBeginRenderPass(
 		(WGPUCommandEncoder)encoder, &rp);
+	VOID_CAPTURE(VOID_CAP_BEGIN_RENDER_PASS_DEPTH, pass, encoder, colorView, r, g, b, a, depthView);
+	return pass;
 }
 
 // --- Extended Pipeline ---
@@ -546,7 +851,10 @@ void *void_gpu_create_render_pipeline_ext(
 		desc.depthStencil = &depth_state;
 	}
 
-	return (void *)wgpuDeviceCreateRenderPipeline((WGPUDevice)device, &desc);
+	void *pipeline = (void *)wgpuDeviceCreateRenderPipeline((WGPUDevice)device, &desc);
+	VOID_CAPTURE(VOID_CAP_CREATE_RENDER_PIPELINE_EXT, pipeline, device, shader, vs_entry, fs_entry,
+		pipelineLayout, stride, attr_count, fmt0, off0, loc0, fmt1, off1, loc1, has_depth, cullMode);
+	return pipeline;
 }
 
 // --- Viewport & Scissor ---
@@ -556,6 +864,7 @@ void void_gpu_render_pass_set_viewport(void *pass, float x, float y,
 ) {
 	wgpuRenderPassEncoderSetViewport(
 		(WGPURenderPassEncoder)pass, x, y, width, height, minDepth, maxDepth);
+	VOID_CAPTURE(VOID_CAP_SET_VIEWPORT, pass, x, y, width, height, minDepth, maxDepth);
 }
 
 void void_gpu_render_pass_set_scissor_rect(void *pass,
@@ -563,6 +872,7 @@ void void_gpu_render_pass_set_scissor_rect(void *pass,
 ) {
 	wgpuRenderPassEncoderSetScissorRect(
 		(WGPURenderPassEncoder)pass, x, y, width, height);
+	VOID_CAPTURE(VOID_CAP_SET_SCISSOR_RECT, pass, x, y, width, height);
 }
 
 // --- General Texture ---
@@ -579,7 +889,78 @@ void *void_gpu_create_texture(void *device, uint32_t width, uint32_t height,
 	desc.dimension = WGPUTextureDimension_2D;
 	desc.format = (WGPUTextureFormat)format;
 	desc.usage = (WGPUTextureUsage)usage;
-	return (void *)wgpuDeviceCreateTexture((WGPUDevice)device, &desc);
+	void *texture = track_texture(wgpuDeviceCreateTexture((WGPUDevice)device, &desc), &desc);
+	VOID_CAPTURE(VOID_CAP_CREATE_TEXTURE, texture, device, width, height, format, usage, mipLevelCount);
+	return texture;
+}
+
+void *void_gpu_create_texture_ms(void *device, uint32_t width, uint32_t height,
+	uint32_t format, uint32_t usage, uint32_t sampleCount
+) {
+	WGPUTextureDescriptor desc = {0};
+	desc.size.width = width;
+	desc.size.height = height;
+	desc.size.depthOrArrayLayers = 1;
+	desc.mipLevelCount = 1;
+	desc.sampleCount = sampleCount ? sampleCount : 1;
+	desc.dimension = WGPUTextureDimension_2D;
+	desc.format = (WGPUTextureFormat)format;
+	desc.usage = (WGPUTextureUsage)usage;
+	void *texture = track_texture(wgpuDeviceCreateTexture((WGPUDevice)device, &desc), &desc);
+	VOID_CAPTURE(VOID_CAP_CREATE_TEXTURE_MS, texture, device, width, height, format, usage, sampleCount);
+	return texture;
+}
+
+void *void_gpu_create_texture_layers(void *device, uint32_t width, uint32_t height,
+	uint32_t layers, uint32_t format, uint32_t usage, uint32_t mipLevelCount
+) {
+	WGPUTextureDescriptor desc = {0};
+	desc.size.width = width;
+	desc.size.height = height;
+	desc.size.depthOrArrayLayers = layers ? layers : 1;
+	desc.mipLevelCount = mipLevelCount ? mipLevelCount : 1;
+	desc.sampleCount = 1;
+	desc.dimension = WGPUTextureDimension_2D;
+	desc.format = (WGPUTextureFormat)format;
+	desc.usage = (WGPUTextureUsage)usage;
+	void *texture = track_texture(wgpuDeviceCreateTexture((WGPUDevice)device, &desc), &desc);
+	VOID_CAPTURE(VOID_CAP_CREATE_TEXTURE_LAYERS, texture, device, width, height, layers, format, usage, mipLevelCount);
+	return texture;
+}
+
+void *void_gpu_create_texture_3d(void *device, uint32_t width, uint32_t height,
+	uint32_t depth, uint32_t format, uint32_t usage
+) {
+	WGPUTextureDescriptor desc = {0};
+	desc.size.width = width;
+	desc.size.height = height;
+	desc.size.depthOrArrayLayers = depth ? depth : 1;
+	desc.mipLevelCount = 1;
+	desc.sampleCount = 1;
+	desc.dimension = WGPUTextureDimension_3D;
+	desc.format = (WGPUTextureFormat)format;
+	desc.usage = (WGPUTextureUsage)usage;
+	void *texture = track_texture(wgpuDeviceCreateTexture((WGPUDevice)device, &desc), &desc);
+	VOID_CAPTURE(VOID_CAP_CREATE_TEXTURE_3D, texture, device, width, height, depth, format, usage);
+	return texture;
+}
+
+void *void_gpu_create_texture_view_range(void *texture, uint32_t dimension,
+	uint32_t baseMip, uint32_t mipCount, uint32_t baseLayer, uint32_t layerCount,
+	uint32_t aspect
+) {
+	WGPUTextureViewDescriptor desc = {0};
+	desc.format = WGPUTextureFormat_Undefined;
+	desc.dimension = (WGPUTextureViewDimension)dimension;
+	desc.baseMipLevel = baseMip;
+	desc.mipLevelCount = mipCount ? mipCount : WGPU_MIP_LEVEL_COUNT_UNDEFINED;
+	desc.baseArrayLayer = baseLayer;
+	desc.arrayLayerCount = layerCount ? layerCount : WGPU_ARRAY_LAYER_COUNT_UNDEFINED;
+	desc.aspect = aspect ? (WGPUTextureAspect)aspect : WGPUTextureAspect_All;
+	void *view = (void *)wgpuTextureCreateView((WGPUTexture)texture, &desc);
+	VOID_CAPTURE(VOID_CAP_CREATE_TEXTURE_VIEW_RANGE, view, texture, dimension,
+		baseMip, mipCount, baseLayer, layerCount, aspect);
+	return view;
 }
 
 void void_gpu_queue_write_texture(void *queue, void *texture,
@@ -598,6 +979,94 @@ void void_gpu_queue_write_texture(void *queue, void *texture,
 
 	wgpuQueueWriteTexture(
 		(WGPUQueue)queue, &dest, data, (size_t)dataSize, &layout, &size);
+	VOID_CAPTURE(VOID_CAP_QUEUE_WRITE_TEXTURE, queue, texture, data, dataSize, bytesPerRow, width, height);
+}
+
+void void_gpu_queue_write_texture_region(void *queue, void *texture,
+	uint32_t x, uint32_t y, const void *data, uint64_t dataSize,
+	uint32_t bytesPerRow, uint32_t width, uint32_t height
+) {
+	WGPUTexelCopyTextureInfo dest = {0};
+	dest.texture = (WGPUTexture)texture;
+	dest.mipLevel = 0;
+	dest.origin = (WGPUOrigin3D){ x, y, 0 };
+
+	WGPUTexelCopyBufferLayout layout = {0};
+	layout.bytesPerRow = bytesPerRow;
+	layout.rowsPerImage = height;
+
+	WGPUExtent3D size = { width, height, 1 };
+
+	wgpuQueueWriteTexture(
+		(WGPUQueue)queue, &dest, data, (size_t)dataSize, &layout, &size);
+	VOID_CAPTURE(VOID_CAP_QUEUE_WRITE_TEXTURE_REGION, queue, texture, x, y, data, dataSize,
+		bytesPerRow, width, height);
+}
+
+void void_gpu_queue_write_texture_mip(void *queue, void *texture, uint32_t mipLevel,
+	const void *data, uint64_t dataSize,
+	uint32_t bytesPerRow, uint32_t width, uint32_t height
+) {
+	WGPUTexelCopyTextureInfo dest = {0};
+	dest.texture = (WGPUTexture)texture;
+	dest.mipLevel = mipLevel;
+
+	WGPUTexelCopyBufferLayout layout = {0};
+	layout.bytesPerRow = bytesPerRow;
+	layout.rowsPerImage = height;
+
+	WGPUExtent3D size = { width, height, 1 };
+
+	wgpuQueueWriteTexture(
+		(WGPUQueue)queue, &dest, data, (size_t)dataSize, &layout, &size);
+	VOID_CAPTURE(VOID_CAP_QUEUE_WRITE_TEXTURE_MIP, queue, texture, mipLevel, data, dataSize,
+		bytesPerRow, width, height);
+}
+
+void void_gpu_queue_write_texture_level(void *queue, void *texture, uint32_t format,
+	uint32_t mipLevel, uint32_t layer, const void *data, uint64_t dataSize,
+	uint32_t width, uint32_t height
+) {
+	uint32_t block = void_gpu_format_block_size(format);
+	uint32_t blocks_x = (width + block - 1) / block;
+	uint32_t blocks_y = (height + block - 1) / block;
+
+	WGPUTexelCopyTextureInfo dest = {0};
+	dest.texture = (WGPUTexture)texture;
+	dest.mipLevel = mipLevel;
+	dest.origin.z = layer;
+
+	// Rows are rows of blocks; the extent is the physical (block-rounded) size
+	WGPUTexelCopyBufferLayout layout = {0};
+	layout.bytesPerRow = blocks_x * void_gpu_format_block_bytes(format);
+	layout.rowsPerImage = blocks_y;
+
+	WGPUExtent3D size = { blocks_x * block, blocks_y * block, 1 };
+
+	wgpuQueueWriteTexture(
+		(WGPUQueue)queue, &dest, data, (size_t)dataSize, &layout, &size);
+	VOID_CAPTURE(VOID_CAP_QUEUE_WRITE_TEXTURE_LEVEL, queue, texture, format, mipLevel, layer,
+		data, dataSize, width, height);
+}
+
+void void_gpu_queue_write_texture_3d(void *queue, void *texture,
+	const void *data, uint64_t dataSize,
+	uint32_t bytesPerRow, uint32_t width, uint32_t height, uint32_t depth
+) {
+	WGPUTexelCopyTextureInfo dest = {0};
+	dest.texture = (WGPUTexture)texture;
+	dest.mipLevel = 0;
+
+	WGPUTexelCopyBufferLayout layout = {0};
+	layout.bytesPerRow = bytesPerRow;
+	layout.rowsPerImage = height;
+
+	WGPUExtent3D size = { width, height, depth };
+
+	wgpuQueueWriteTexture(
+		(WGPUQueue)queue, &dest, data, (size_t)dataSize, &layout, &size);
+	VOID_CAPTURE(VOID_CAP_QUEUE_WRITE_TEXTURE_3D, queue, texture, data, dataSize,
+		bytesPerRow, width, height, depth);
 }
 
 // --- Sampler ---
@@ -613,13 +1082,15 @@ void *void_gpu_create_sampler(void *device,
 	desc.minFilter = (WGPUFilterMode)minFilter;
 	desc.mipmapFilter = WGPUMipmapFilterMode_Nearest;
 	desc.maxAnisotropy = 1;
-	return (void *)wgpuDeviceCreateSampler((WGPUDevice)device, &desc);
+	void *sampler = (void *)wgpuDeviceCreateSampler((WGPUDevice)device, &desc);
+	VOID_CAPTURE(VOID_CAP_CREATE_SAMPLER, sampler, device, addressMode, magFilter, minFilter);
+	return sampler;
 }
 
 // --- Texture/Sampler Bind Groups ---
 
-void *void_gpu_create_bind_group_layout_1tex_1samp(void *device,
-	uint32_t texBinding, uint32_t texVisibility,
+static void *create_layout_1tex_1samp(void *device,
+	uint32_t texBinding, uint32_t texVisibility, uint32_t viewDimension,
 	uint32_t sampBinding, uint32_t sampVisibility
 ) {
 	WGPUBindGroupLayoutEntry entries[2] = {0};
@@ -628,7 +1099,7 @@ void *void_gpu_create_bind_group_layout_1tex_1samp(void *device,
 	entries[0].binding = texBinding;
 	entries[0].visibility = (WGPUShaderStage)texVisibility;
 	entries[0].texture.sampleType = WGPUTextureSampleType_Float;
-	entries[0].texture.viewDimension = WGPUTextureViewDimension_2D;
+	entries[0].texture.viewDimension = (WGPUTextureViewDimension)viewDimension;
 
 	// Sampler entry
 	entries[1].binding = sampBinding;
@@ -642,6 +1113,28 @@ void *void_gpu_create_bind_group_layout_1tex_1samp(void *device,
 	return (void *)wgpuDeviceCreateBindGroupLayout((WGPUDevice)device, &desc);
 }
 
+void *void_gpu_create_bind_group_layout_1tex_1samp(void *device,
+	uint32_t texBinding, uint32_t texVisibility,
+	uint32_t sampBinding, uint32_t sampVisibility
+) {
+	void *layout = create_layout_1tex_1samp(device, texBinding, texVisibility,
+		WGPUTextureViewDimension_2D, sampBinding, sampVisibility);
+	VOID_CAPTURE(VOID_CAP_CREATE_BIND_GROUP_LAYOUT_TS, layout, device,
+		texBinding, texVisibility, sampBinding, sampVisibility);
+	return layout;
+}
+
+void *void_gpu_create_bind_group_layout_1tex_1samp_dim(void *device,
+	uint32_t texBinding, uint32_t texVisibility, uint32_t viewDimension,
+	uint32_t sampBinding, uint32_t sampVisibility
+) {
+	void *layout = create_layout_1tex_1samp(device, texBinding, texVisibility,
+		viewDimension, sampBinding, sampVisibility);
+	VOID_CAPTURE(VOID_CAP_CREATE_BIND_GROUP_LAYOUT_TS_DIM, layout, device,
+		texBinding, texVisibility, viewDimension, sampBinding, sampVisibility);
+	return layout;
+}
+
 void *void_gpu_create_bind_group_1tex_1samp(void *device, void *layout,
 	uint32_t texBinding, void *textureView,
 	uint32_t sampBinding, void *sampler
@@ -659,7 +1152,10 @@ void *void_gpu_create_bind_group_1tex_1samp(void *device, void *layout,
 	desc.entryCount = 2;
 	desc.entries = entries;
 
-	return (void *)wgpuDeviceCreateBindGroup((WGPUDevice)device, &desc);
+	void *group = (void *)wgpuDeviceCreateBindGroup((WGPUDevice)device, &desc);
+	VOID_CAPTURE(VOID_CAP_CREATE_BIND_GROUP_TS, group, device, layout,
+		texBinding, textureView, sampBinding, sampler);
+	return group;
 }
 
 void *void_gpu_create_pipeline_layout_2bg(void *device, void *bg0, void *bg1) {
@@ -671,7 +1167,9 @@ void *void_gpu_create_pipeline_layout_2bg(void *device, void *bg0, void *bg1) {
 	desc.bindGroupLayoutCount = 2;
 	desc.bindGroupLayouts = bgls;
 
-	return (void *)wgpuDeviceCreatePipelineLayout((WGPUDevice)device, &desc);
+	void *layout = (void *)wgpuDeviceCreatePipelineLayout((WGPUDevice)device, &desc);
+	VOID_CAPTURE(VOID_CAP_CREATE_PIPELINE_LAYOUT_2BG, layout, device, bg0, bg1);
+	return layout;
 }
 
 // --- Extended Pipeline 2 (3 attrs + blend) ---
@@ -766,7 +1264,248 @@ void *void_gpu_create_render_pipeline_ext2(
 		desc.depthStencil = &depth_state;
 	}
 
-	return (void *)wgpuDeviceCreateRenderPipeline((WGPUDevice)device, &desc);
+	void *pipeline = (void *)wgpuDeviceCreateRenderPipeline((WGPUDevice)device, &desc);
+	VOID_CAPTURE(VOID_CAP_CREATE_RENDER_PIPELINE_EXT2, pipeline, device, shader, vs_entry, fs_entry,
+		pipelineLayout, stride, attr_count, fmt0, off0, loc0, fmt1, off1, loc1, fmt2, off2, loc2,
+		has_depth, cullMode, has_blend, blendColorSrc, blendColorDst, blendColorOp,
+		blendAlphaSrc, blendAlphaDst, blendAlphaOp);
+	return pipeline;
+}
+
+// --- Described Pipeline ---
+
+// Everything a WGPURenderPipelineDescriptor points into
+typedef struct PipelineDescStorage {
+	WGPUVertexAttribute    attrs[VOID_GPU_MAX_VERTEX_ATTRS];
+	WGPUVertexBufferLayout vb;
+	WGPUBlendState         blend;
+	WGPUColorTargetState   color_target;
+	WGPUFragmentState      frag;
+	WGPUDepthStencilState  depth_state;
+	WGPURenderPipelineDescriptor desc;
+} PipelineDescStorage;
+
+static void build_pipeline_desc(PipelineDescStorage *st, const VoidRenderPipelineDesc *d) {
+	memset(st, 0, sizeof(*st));
+	WGPUShaderModule sm = (WGPUShaderModule)d->shader;
+
+	WGPUVertexAttribute *attrs = st->attrs;
+	uint32_t attr_count = d->attr_count < VOID_GPU_MAX_VERTEX_ATTRS
+		? d->attr_count : VOID_GPU_MAX_VERTEX_ATTRS;
+	for (uint32_t i = 0; i < attr_count; i++) {
+		attrs[i].format = (WGPUVertexFormat)d->attrs[i].format;
+		attrs[i].offset = d->attrs[i].offset;
+		attrs[i].shaderLocation = d->attrs[i].location;
+	}
+
+	WGPUVertexBufferLayout *vb = &st->vb;
+	vb->arrayStride = d->stride;
+	vb->stepMode = d->instanced ? WGPUVertexStepMode_Instance : WGPUVertexStepMode_Vertex;
+	vb->attributeCount = attr_count;
+	vb->attributes = attrs;
+
+	// Blend state
+	WGPUBlendState *blend = &st->blend;
+	if (d->has_blend) {
+		blend->color.srcFactor = (WGPUBlendFactor)d->blend_color_src;
+		blend->color.dstFactor = (WGPUBlendFactor)d->blend_color_dst;
+		blend->color.operation = (WGPUBlendOperation)d->blend_color_op;
+		blend->alpha.srcFactor = (WGPUBlendFactor)d->blend_alpha_src;
+		blend->alpha.dstFactor = (WGPUBlendFactor)d->blend_alpha_dst;
+		blend->alpha.operation = (WGPUBlendOperation)d->blend_alpha_op;
+	}
+
+	// Fragment
+	WGPUColorTargetState *color_target = &st->color_target;
+	color_target->format = d->color_format
+		? (WGPUTextureFormat)d->color_format : WGPUTextureFormat_BGRA8Unorm;
+	color_target->writeMask = WGPUColorWriteMask_All;
+	if (d->has_blend) {
+		color_target->blend = blend;
+	}
+
+	WGPUFragmentState *frag = &st->frag;
+	frag->module = sm;
+	frag->entryPoint = (WGPUStringView){ d->fs_entry, WGPU_STRLEN };
+	frag->targetCount = 1;
+	frag->targets = color_target;
+
+	// Depth stencil
+	WGPUDepthStencilState *depth_state = &st->depth_state;
+	if (d->depth_format) {
+		depth_state->format = (WGPUTextureFormat)d->depth_format;
+		depth_state->depthWriteEnabled = d->depth_write ? WGPUOptionalBool_True : WGPUOptionalBool_False;
+		depth_state->depthCompare = d->depth_compare
+			? (WGPUCompareFunction)d->depth_compare : WGPUCompareFunction_Less;
+		depth_state->depthBias = d->depth_bias;
+		depth_state->depthBiasSlopeScale = d->depth_bias_slope_scale;
+		depth_state->depthBiasClamp = d->depth_bias_clamp;
+	}
+
+	// Pipeline
+	WGPURenderPipelineDescriptor *desc = &st->desc;
+	desc->label = (WGPUStringView){ "pipeline_desc", WGPU_STRLEN };
+	if (d->layout) {
+		desc->layout = (WGPUPipelineLayout)d->layout;
+	}
+	desc->vertex.module = sm;
+	desc->vertex.entryPoint = (WGPUStringView){ d->vs_entry, WGPU_STRLEN };
+	if (attr_count > 0) {
+		desc->vertex.bufferCount = 1;
+		desc->vertex.buffers = vb;
+	}
+	desc->primitive.topology = WGPUPrimitiveTopology_TriangleList;
+	desc->primitive.frontFace = WGPUFrontFace_CCW;
+	desc->primitive.cullMode = d->cull_mode ? (WGPUCullMode)d->cull_mode : WGPUCullMode_None;
+	desc->multisample.count = d->sample_count ? d->sample_count : 1;
+	desc->multisample.mask = 0xFFFFFFFF;
+	desc->fragment = d->depth_only ? NULL : frag;
+	if (d->depth_format) {
+		desc->depthStencil = depth_state;
+	}
+}
+
+void *void_gpu_create_render_pipeline_desc(void *device, const VoidRenderPipelineDesc *d) {
+	PipelineDescStorage st;
+	build_pipeline_desc(&st, d);
+	void *pipeline = (void *)wgpuDeviceCreateRenderPipeline((WGPUDevice)device, &st.desc);
+	VOID_CAPTURE(VOID_CAP_CREATE_RENDER_PIPELINE_DESC, pipeline, device, d);
+	return pipeline;
+}
+
+void *void_gpu_create_render_pipeline_desc_async(void *device, const VoidRenderPipelineDesc *d) {
+	WGPUAdapter adapter = wgpuDeviceGetAdapter((WGPUDevice)device);
+	GpuRequest *r = request_new(REQUEST_PIPELINE, wgpuAdapterGetInstance(adapter), device);
+	wgpuAdapterRelease(adapter);
+	r->pipeline = *d;
+	PipelineDescStorage st;
+	build_pipeline_desc(&st, d);
+	WGPUCreateRenderPipelineAsyncCallbackInfo cb = {0};
+	cb.mode = WGPUCallbackMode_WaitAnyOnly;
+	cb.callback = on_pipeline_ready;
+	cb.userdata1 = r;
+	r->future = wgpuDeviceCreateRenderPipelineAsync((WGPUDevice)device, &st.desc, cb);
+	return r;
+}
+
+// --- Described Render Pass ---
+
+void *void_gpu_begin_render_pass_desc(void *encoder, const VoidRenderPassDesc *d) {
+	WGPURenderPassColorAttachment colors[VOID_GPU_MAX_COLOR_ATTACHMENTS] = {0};
+	uint32_t count = d->color_count;
+	if (count > VOID_GPU_MAX_COLOR_ATTACHMENTS) count = VOID_GPU_MAX_COLOR_ATTACHMENTS;
+	for (uint32_t i = 0; i < count; i++) {
+		const VoidColorAttachment *c = &d->colors[i];
+		colors[i].view = (WGPUTextureView)c->view;
+		colors[i].resolveTarget = (WGPUTextureView)c->resolve_target;
+		colors[i].loadOp = c->clear ? WGPULoadOp_Clear : WGPULoadOp_Load;
+		colors[i].storeOp = c->store ? WGPUStoreOp_Store : WGPUStoreOp_Discard;
+		colors[i].clearValue = (WGPUColor){ c->clear_r, c->clear_g, c->clear_b, c->clear_a };
+		colors[i].depthSlice = WGPU_DEPTH_SLICE_UNDEFINED;
+	}
+
+	// Read-only depth must leave load/store undefined
+	WGPURenderPassDepthStencilAttachment depth = {0};
+	depth.view = (WGPUTextureView)d->depth_view;
+	depth.depthReadOnly = d->depth_read_only ? 1 : 0;
+	if (!d->depth_read_only) {
+		depth.depthLoadOp = d->depth_clear ? WGPULoadOp_Clear : WGPULoadOp_Load;
+		depth.depthStoreOp = d->depth_store ? WGPUStoreOp_Store : WGPUStoreOp_Discard;
+	}
+	depth.depthClearValue = d->depth_clear_value;
+
+	WGPURenderPassDescriptor rp = {0};
+	rp.label = (WGPUStringView){ d->label, WGPU_STRLEN };
+	rp.colorAttachmentCount = count;
+	rp.colorAttachments = colors;
+	rp.depthStencilAttachment = d->depth_view ? &depth : NULL;
+
+	WGPUPassTimestampWrites timestamps = {0};
+	if (d->timestamp_set) {
+		timestamps.querySet = (WGPUQuerySet)d->timestamp_set;
+		timestamps.beginningOfPassWriteIndex = d->timestamp_begin;
+		timestamps.endOfPassWriteIndex = d->timestamp_end;
+		rp.timestampWrites = &timestamps;
+	}
+
+	void *pass = (void *)wgpuCommandEncoderBeginRenderPass(
+		(WGPUCommandEncoder)encoder, &rp);
+	VOID_CAPTURE(VOID_CAP_BEGIN_RENDER_PASS_DESC, pass, encoder, d);
+	return pass;
+}
+
+// --- Compute ---
+
+void *void_gpu_create_compute_pipeline(void *device, void *shader,
+	const char *entry, void *pipelineLayout
+) {
+	WGPUComputePipelineDescriptor desc = {0};
+	desc.layout = (WGPUPipelineLayout)pipelineLayout;
+	desc.compute.module = (WGPUShaderModule)shader;
+	desc.compute.entryPoint = (WGPUStringView){ entry, WGPU_STRLEN };
+	void *pipeline = (void *)wgpuDeviceCreateComputePipeline((WGPUDevice)device, &desc);
+	VOID_CAPTURE(VOID_CAP_CREATE_COMPUTE_PIPELINE, pipeline, device, shader, entry, pipelineLayout);
+	return pipeline;
+}
+
+void *void_gpu_begin_compute_pass(void *encoder) {
+	WGPUComputePassDescriptor desc = {0};
+	desc.label = (WGPUStringView){ NULL, WGPU_STRLEN };
+	void *pass = (void *)wgpuCommandEncoderBeginComputePass((WGPUCommandEncoder)encoder, &desc);
+	VOID_CAPTURE(VOID_CAP_BEGIN_COMPUTE_PASS, pass, encoder);
+	return pass;
+}
+
+void *void_gpu_begin_compute_pass_desc(void *encoder, const VoidComputePassDesc *d) {
+	WGPUComputePassDescriptor desc = {0};
+	desc.label = (WGPUStringView){ d->label, WGPU_STRLEN };
+	WGPUPassTimestampWrites timestamps = {0};
+	if (d->timestamp_set) {
+		timestamps.querySet = (WGPUQuerySet)d->timestamp_set;
+		timestamps.beginningOfPassWriteIndex = d->timestamp_begin;
+		timestamps.endOfPassWriteIndex = d->timestamp_end;
+		desc.timestampWrites = &timestamps;
+	}
+	void *pass = (void *)wgpuCommandEncoderBeginComputePass((WGPUCommandEncoder)encoder, &desc);
+	VOID_CAPTURE(VOID_CAP_BEGIN_COMPUTE_PASS_DESC, pass, encoder, d);
+	return pass;
+}
+
+void void_gpu_compute_pass_set_pipeline(void *pass, void *pipeline) {
+	wgpuComputePassEncoderSetPipeline(
+		(WGPUComputePassEncoder)pass, (WGPUComputePipeline)pipeline);
+	VOID_CAPTURE(VOID_CAP_COMPUTE_SET_PIPELINE, pass, pipeline);
+}
+
+void void_gpu_compute_pass_set_bind_group(void *pass, uint32_t index, void *bindGroup) {
+	wgpuComputePassEncoderSetBindGroup(
+		(WGPUComputePassEncoder)pass, index, (WGPUBindGroup)bindGroup, 0, NULL);
+	VOID_CAPTURE(VOID_CAP_COMPUTE_SET_BIND_GROUP, pass, index, bindGroup);
+}
+
+void void_gpu_compute_pass_set_bind_group_offset(void *pass, uint32_t index, void *bindGroup,
+	uint32_t dynamicOffset
+) {
+	wgpuComputePassEncoderSetBindGroup(
+		(WGPUComputePassEncoder)pass, index, (WGPUBindGroup)bindGroup, 1, &dynamicOffset);
+	VOID_CAPTURE(VOID_CAP_COMPUTE_SET_BIND_GROUP_OFFSET, pass, index, bindGroup, dynamicOffset);
+}
+
+void void_gpu_compute_pass_dispatch(void *pass, uint32_t x, uint32_t y, uint32_t z) {
+	wgpuComputePassEncoderDispatchWorkgroups((WGPUComputePassEncoder)pass, x, y, z);
+	VOID_CAPTURE(VOID_CAP_DISPATCH, pass, x, y, z);
+}
+
+void void_gpu_compute_pass_dispatch_indirect(void *pass, void *buffer, uint64_t offset) {
+	wgpuComputePassEncoderDispatchWorkgroupsIndirect(
+		(WGPUComputePassEncoder)pass, (WGPUBuffer)buffer, offset);
+	VOID_CAPTURE(VOID_CAP_DISPATCH_INDIRECT, pass, buffer, offset);
+}
+
+void void_gpu_end_compute_pass(void *pass) {
+	VOID_CAPTURE(VOID_CAP_END_COMPUTE_PASS, pass);
+	wgpuComputePassEncoderEnd((WGPUComputePassEncoder)pass);
+	wgpuComputePassEncoderRelease((WGPUComputePassEncoder)pass);
 }
 
 // --- Checkerboard Texture Generator ---
@@ -775,36 +1514,29 @@ void void_gen_checkerboard(void *dest, uint32_t size,
 	uint32_t r1, uint32_t g1, uint32_t b1,
 	uint32_t r2, uint32_t g2, uint32_t b2
 ) {
-	uint8_t *pixels = (uint8_t *)dest;
-	uint32_t cell = size / 8;  // 8x8 checkerboard
-	if (cell < 1) cell = 1;
-	for (uint32_t y = 0; y < size; y++) {
-		for (uint32_t x = 0; x < size; x++) {
-			int checker = ((x / cell) + (y / cell)) % 2;
-			uint32_t idx = (y * size + x) * 4;
-			pixels[idx + 0] = checker ? (uint8_t)r2 : (uint8_t)r1;
-			pixels[idx + 1] = checker ? (uint8_t)g2 : (uint8_t)g1;
-			pixels[idx + 2] = checker ? (uint8_t)b2 : (uint8_t)b1;
-			pixels[idx + 3] = 255;  // alpha
-		}
-	}
+	// 8x8 cells, opaque
+	uint32_t c1 = (r1 & 0xFF) | (g1 & 0xFF) << 8 | (b1 & 0xFF) << 16 | 0xFF000000u;
+	uint32_t c2 = (r2 & 0xFF) | (g2 & 0xFF) << 8 | (b2 & 0xFF) << 16 | 0xFF000000u;
+	void_pixels_checkerboard((uint8_t *)dest, size, size, size / 8, c1, c2);
 }
 
 // --- Release ---
 
+// Instance, adapter, device and queue belong to the replayer; not recorded
 void void_gpu_release_instance(void *p)        { if (p) wgpuInstanceRelease((WGPUInstance)p); }
-void void_gpu_release_surface(void *p)         { if (p) wgpuSurfaceRelease((WGPUSurface)p); }
+void void_gpu_release_surface(void *p)         { if (p) { VOID_CAPTURE(VOID_CAP_RELEASE_SURFACE, p); wgpuSurfaceRelease((WGPUSurface)p); } }
 void void_gpu_release_adapter(void *p)         { if (p) wgpuAdapterRelease((WGPUAdapter)p); }
 void void_gpu_release_device(void *p)          { if (p) wgpuDeviceRelease((WGPUDevice)p); }
 void void_gpu_release_queue(void *p)           { if (p) wgpuQueueRelease((WGPUQueue)p); }
-void void_gpu_release_shader(void *p)          { if (p) wgpuShaderModuleRelease((WGPUShaderModule)p); }
-void void_gpu_release_pipeline(void *p)        { if (p) wgpuRenderPipelineRelease((WGPURenderPipeline)p); }
-void void_gpu_release_command_encoder(void *p) { if (p) wgpuCommandEncoderRelease((WGPUCommandEncoder)p); }
-void void_gpu_release_command_buffer(void *p)  { if (p) wgpuCommandBufferRelease((WGPUCommandBuffer)p); }
-void void_gpu_release_texture_view(void *p)    { if (p) wgpuTextureViewRelease((WGPUTextureView)p); }
-void void_gpu_release_buffer(void *p)          { if (p) wgpuBufferRelease((WGPUBuffer)p); }
-void void_gpu_release_texture(void *p)         { if (p) wgpuTextureRelease((WGPUTexture)p); }
-void void_gpu_release_bind_group_layout(void *p) { if (p) wgpuBindGroupLayoutRelease((WGPUBindGroupLayout)p); }
-void void_gpu_release_bind_group(void *p)      { if (p) wgpuBindGroupRelease((WGPUBindGroup)p); }
-void void_gpu_release_pipeline_layout(void *p) { if (p) wgpuPipelineLayoutRelease((WGPUPipelineLayout)p); }
-void void_gpu_release_sampler(void *p)          { if (p) wgpuSamplerRelease((WGPUSampler)p); }
+void void_gpu_release_shader(void *p)          { if (p) { VOID_CAPTURE(VOID_CAP_RELEASE_SHADER, p); wgpuShaderModuleRelease((WGPUShaderModule)p); } }
+void void_gpu_release_pipeline(void *p)        { if (p) { VOID_CAPTURE(VOID_CAP_RELEASE_PIPELINE, p); wgpuRenderPipelineRelease((WGPURenderPipeline)p); } }
+void void_gpu_release_command_encoder(void *p) { if (p) { VOID_CAPTURE(VOID_CAP_RELEASE_COMMAND_ENCODER, p); wgpuCommandEncoderRelease((WGPUCommandEncoder)p); } }
+void void_gpu_release_command_buffer(void *p)  { if (p) { VOID_CAPTURE(VOID_CAP_RELEASE_COMMAND_BUFFER, p); wgpuCommandBufferRelease((WGPUCommandBuffer)p); } }
+void void_gpu_release_texture_view(void *p)    { if (p) { VOID_CAPTURE(VOID_CAP_RELEASE_TEXTURE_VIEW, p); wgpuTextureViewRelease((WGPUTextureView)p); } }
+void void_gpu_release_buffer(void *p)          { if (p) { VOID_CAPTURE(VOID_CAP_RELEASE_BUFFER, p); void_gpu_memory_untrack(p); wgpuBufferRelease((WGPUBuffer)p); } }
+void void_gpu_release_texture(void *p)         { if (p) { VOID_CAPTURE(VOID_CAP_RELEASE_TEXTURE, p); void_gpu_memory_untrack(p); wgpuTextureRelease((WGPUTexture)p); } }
+void void_gpu_release_bind_group_layout(void *p) { if (p) { VOID_CAPTURE(VOID_CAP_RELEASE_BIND_GROUP_LAYOUT, p); wgpuBindGroupLayoutRelease((WGPUBindGroupLayout)p); } }
+void void_gpu_release_bind_group(void *p)      { if (p) { VOID_CAPTURE(VOID_CAP_RELEASE_BIND_GROUP, p); wgpuBindGroupRelease((WGPUBindGroup)p); } }
+void void_gpu_release_compute_pipeline(void *p) { if (p) { VOID_CAPTURE(VOID_CAP_RELEASE_COMPUTE_PIPELINE, p); wgpuComputePipelineRelease((WGPUComputePipeline)p); } }
+void void_gpu_release_pipeline_layout(void *p) { if (p) { VOID_CAPTURE(VOID_CAP_RELEASE_PIPELINE_LAYOUT, p); wgpuPipelineLayoutRelease((WGPUPipelineLayout)p); } }
+void void_gpu_release_sampler(void *p)          { if (p) { VOID_CAPTURE(VOID_CAP_RELEASE_SAMPLER, p); wgpuSamplerRelease((WGPUSampler)p); } }
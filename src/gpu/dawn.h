@@ -10,8 +10,31 @@
 void *void_gpu_create_instance(void);
 void *void_gpu_create_surface(void *instance, void *window);
 void *void_gpu_request_adapter(void *instance, void *surface);
+// Headless CPU adapter (SwiftShader); for tools and benchmarks
+void *void_gpu_request_adapter_fallback(void *instance);
 void *void_gpu_request_device(void *adapter);
+// Futures: the _async calls return a request at once; poll() checks it
+// without blocking (1 = done), wait() blocks until it completes, frees it
+// and returns the result (NULL on failure). Every request must be waited.
+void *void_gpu_request_adapter_async(void *instance, void *surface);
+void *void_gpu_request_device_async(void *adapter);
+int   void_gpu_request_poll(void *request);
+void *void_gpu_request_wait(void *request);
 void *void_gpu_get_queue(void *device);
+// 1 when the device was created with TransientAttachments (memoryless
+// render targets on tiled GPUs; usage must be RenderAttachment | TransientAttachment).
+int void_gpu_device_has_transient_attachments(void *device);
+// 1 when the device was created with TimestampQuery (GPU pass timings).
+int void_gpu_device_has_timestamps(void *device);
+// Block-compressed texture families the device was created with
+#define VOID_GPU_COMPRESSION_BC   0x1
+#define VOID_GPU_COMPRESSION_ETC2 0x2   // ETC2 + EAC
+#define VOID_GPU_COMPRESSION_ASTC 0x4
+uint32_t void_gpu_device_texture_compression(void *device);
+// Run callbacks of finished asynchronous work (buffer readbacks); once per frame.
+void void_gpu_process_events(void *instance);
+// Blocks until everything submitted to `queue` has finished (not per frame)
+void void_gpu_queue_wait_idle(void *instance, void *queue);
 void void_gpu_configure_surface(void *surface, void *device, uint32_t width, uint32_t height);
 
 // Shader & Pipeline
@@ -49,6 +72,16 @@ void *void_gpu_finish_encoder(void *encoder);
 void void_gpu_submit(void *queue, void *command);
 void void_gpu_present(void *surface);
 
+// Debug Groups & Markers (shown by GPU capture tools such as Xcode and RenderDoc)
+void void_gpu_encoder_push_debug_group(void *encoder, const char *label);
+void void_gpu_encoder_pop_debug_group(void *encoder);
+void void_gpu_encoder_insert_debug_marker(void *encoder, const char *label);
+void void_gpu_render_pass_push_debug_group(void *pass, const char *label);
+void void_gpu_render_pass_pop_debug_group(void *pass);
+void void_gpu_render_pass_insert_debug_marker(void *pass, const char *label);
+void void_gpu_compute_pass_push_debug_group(void *pass, const char *label);
+void void_gpu_compute_pass_pop_debug_group(void *pass);
+
 // Bind Group & Pipeline Layout
 void *void_gpu_create_bind_group_layout_1buf(
     void *device, uint32_t binding, uint32_t visibility, uint64_t minBindingSize);
@@ -64,6 +97,11 @@ void void_gpu_render_pass_set_index_buffer(
 void void_gpu_render_pass_draw_indexed(
     void *pass, uint32_t indexCount, uint32_t instanceCount,
     uint32_t firstIndex, int32_t baseVertex, uint32_t firstInstance);
+void void_gpu_render_pass_draw_instanced(
+    void *pass, uint32_t vertexCount, uint32_t instanceCount,
+    uint32_t firstVertex, uint32_t firstInstance);
+// Args buffer (Indirect usage): vertexCount, instanceCount, firstVertex, firstInstance
+void void_gpu_render_pass_draw_indirect(void *pass, void *buffer, uint64_t offset);
 void void_gpu_mapped_write_u16(void *mapped, uint32_t index, uint16_t value);
 void void_gpu_mapped_write_u32(void *mapped, uint32_t index, uint32_t value);
 
@@ -100,6 +138,95 @@ void *void_gpu_create_render_pipeline_ext2(
     uint32_t blendColorSrc, uint32_t blendColorDst, uint32_t blendColorOp,
     uint32_t blendAlphaSrc, uint32_t blendAlphaDst, uint32_t blendAlphaOp);
 
+// Described Pipeline (flattened descriptor for C-side pipeline caches)
+#define VOID_GPU_MAX_VERTEX_ATTRS 8
+
+typedef struct VoidVertexAttr {
+    uint32_t format;
+    uint64_t offset;
+    uint32_t location;
+} VoidVertexAttr;
+
+typedef struct VoidRenderPipelineDesc {
+    void *shader;
+    const char *vs_entry;
+    const char *fs_entry;
+    void *layout;                      // NULL = auto layout
+    uint64_t stride;
+    uint32_t attr_count;
+    VoidVertexAttr attrs[VOID_GPU_MAX_VERTEX_ATTRS];
+    int instanced;                     // 1 = vertex buffer steps per instance
+    uint32_t color_format;             // 0 = BGRA8Unorm
+    int depth_only;                    // 1 = no fragment stage / color target
+    uint32_t cull_mode;                // 0 = none
+    uint32_t sample_count;             // 0 = 1 (no MSAA)
+    uint32_t depth_format;             // 0 = no depth attachment
+    int depth_write;
+    uint32_t depth_compare;            // 0 = less
+    int32_t depth_bias;                // constant, in depth units
+    float depth_bias_slope_scale;
+    float depth_bias_clamp;            // 0 = unclamped
+    int has_blend;
+    uint32_t blend_color_src, blend_color_dst, blend_color_op;
+    uint32_t blend_alpha_src, blend_alpha_dst, blend_alpha_op;
+} VoidRenderPipelineDesc;
+
+void *void_gpu_create_render_pipeline_desc(void *device, const VoidRenderPipelineDesc *d);
+// Compiles on the implementation's worker threads; a request for
+// void_gpu_request_wait. The shader, layout and entry-point strings must
+// stay alive until then.
+void *void_gpu_create_render_pipeline_desc_async(void *device, const VoidRenderPipelineDesc *d);
+
+// Described Render Pass (flattened descriptor for the render graph)
+#define VOID_GPU_MAX_COLOR_ATTACHMENTS 4
+
+typedef struct VoidColorAttachment {
+    void *view;
+    void *resolve_target;              // NULL = no resolve
+    int clear;                         // 1 = clear, 0 = load
+    int store;                         // 1 = store, 0 = discard
+    double clear_r, clear_g, clear_b, clear_a;
+} VoidColorAttachment;
+
+typedef struct VoidRenderPassDesc {
+    const char *label;                 // NULL = unlabeled
+    uint32_t color_count;
+    VoidColorAttachment colors[VOID_GPU_MAX_COLOR_ATTACHMENTS];
+    void *depth_view;                  // NULL = no depth attachment
+    int depth_clear;
+    int depth_store;
+    int depth_read_only;
+    float depth_clear_value;
+    void *timestamp_set;               // NULL = untimed (see src/gpu/timer)
+    uint32_t timestamp_begin;          // query indices written at pass begin/end
+    uint32_t timestamp_end;
+} VoidRenderPassDesc;
+
+void *void_gpu_begin_render_pass_desc(void *encoder, const VoidRenderPassDesc *d);
+
+// Compute
+void *void_gpu_create_compute_pipeline(void *device, void *shader,
+    const char *entry, void *pipelineLayout);
+void *void_gpu_begin_compute_pass(void *encoder);
+
+typedef struct VoidComputePassDesc {
+    const char *label;                 // NULL = unlabeled
+    void *timestamp_set;               // NULL = untimed (see src/gpu/timer)
+    uint32_t timestamp_begin;
+    uint32_t timestamp_end;
+} VoidComputePassDesc;
+
+void *void_gpu_begin_compute_pass_desc(void *encoder, const VoidComputePassDesc *d);
+void void_gpu_compute_pass_set_pipeline(void *pass, void *pipeline);
+void void_gpu_compute_pass_set_bind_group(void *pass, uint32_t index, void *bindGroup);
+// Bind group with one dynamic-offset buffer binding
+void void_gpu_compute_pass_set_bind_group_offset(void *pass, uint32_t index, void *bindGroup,
+    uint32_t dynamicOffset);
+void void_gpu_compute_pass_dispatch(void *pass, uint32_t x, uint32_t y, uint32_t z);
+// Args buffer (Indirect usage): workgroup counts x, y, z
+void void_gpu_compute_pass_dispatch_indirect(void *pass, void *buffer, uint64_t offset);
+void void_gpu_end_compute_pass(void *pass);
+
 // Viewport & Scissor
 void void_gpu_render_pass_set_viewport(void *pass, float x, float y,
     float width, float height, float minDepth, float maxDepth);
@@ -109,9 +236,40 @@ void void_gpu_render_pass_set_scissor_rect(void *pass,
 // General Texture
 void *void_gpu_create_texture(void *device, uint32_t width, uint32_t height,
     uint32_t format, uint32_t usage, uint32_t mipLevelCount);
+// Multisampled render target (sampleCount 1 or 4)
+void *void_gpu_create_texture_ms(void *device, uint32_t width, uint32_t height,
+    uint32_t format, uint32_t usage, uint32_t sampleCount);
+void *void_gpu_create_texture_layers(void *device, uint32_t width, uint32_t height,
+    uint32_t layers, uint32_t format, uint32_t usage, uint32_t mipLevelCount);
+// Single-mip volume texture (e.g. color grading LUTs); views default to 3D
+void *void_gpu_create_texture_3d(void *device, uint32_t width, uint32_t height,
+    uint32_t depth, uint32_t format, uint32_t usage);
+// View of a mip/layer range; dimension is a TextureViewDimension (0 = default),
+// aspect 0 = all, 3 = depth only.
+void *void_gpu_create_texture_view_range(void *texture, uint32_t dimension,
+    uint32_t baseMip, uint32_t mipCount, uint32_t baseLayer, uint32_t layerCount,
+    uint32_t aspect);
 void void_gpu_queue_write_texture(void *queue, void *texture,
     const void *data, uint64_t dataSize,
     uint32_t bytesPerRow, uint32_t width, uint32_t height);
+// Sub-rectangle at (x, y) of mip 0 (atlas uploads)
+void void_gpu_queue_write_texture_region(void *queue, void *texture,
+    uint32_t x, uint32_t y, const void *data, uint64_t dataSize,
+    uint32_t bytesPerRow, uint32_t width, uint32_t height);
+// Whole mip level `mipLevel` (width/height are that level's size)
+void void_gpu_queue_write_texture_mip(void *queue, void *texture, uint32_t mipLevel,
+    const void *data, uint64_t dataSize,
+    uint32_t bytesPerRow, uint32_t width, uint32_t height);
+// Whole mip level of one array layer, tightly packed in `format`'s blocks
+// (rows of 4x4 blocks for compressed formats). width/height are the level's
+// size in texels; the copy covers the level's block-rounded size.
+void void_gpu_queue_write_texture_level(void *queue, void *texture, uint32_t format,
+    uint32_t mipLevel, uint32_t layer, const void *data, uint64_t dataSize,
+    uint32_t width, uint32_t height);
+// Whole volume: rows bytesPerRow apart, slices height rows apart
+void void_gpu_queue_write_texture_3d(void *queue, void *texture,
+    const void *data, uint64_t dataSize,
+    uint32_t bytesPerRow, uint32_t width, uint32_t height, uint32_t depth);
 
 // Sampler
 void *void_gpu_create_sampler(void *device,
@@ -121,6 +279,11 @@ void *void_gpu_create_sampler(void *device,
 void *void_gpu_create_bind_group_layout_1tex_1samp(void *device,
     uint32_t texBinding, uint32_t texVisibility,
     uint32_t sampBinding, uint32_t sampVisibility);
+// Same, for a texture_2d_array / texture_cube / ... binding (viewDimension
+// is a TextureViewDimension; the one above is 2D)
+void *void_gpu_create_bind_group_layout_1tex_1samp_dim(void *device,
+    uint32_t texBinding, uint32_t texVisibility, uint32_t viewDimension,
+    uint32_t sampBinding, uint32_t sampVisibility);
 void *void_gpu_create_bind_group_1tex_1samp(void *device, void *layout,
     uint32_t texBinding, void *textureView,
     uint32_t sampBinding, void *sampler);
@@ -139,6 +302,7 @@ void void_gpu_release_device(void *p);
 void void_gpu_release_queue(void *p);
 void void_gpu_release_shader(void *p);
 void void_gpu_release_pipeline(void *p);
+void void_gpu_release_compute_pipeline(void *p);
 void void_gpu_release_command_encoder(void *p);
 void void_gpu_release_command_buffer(void *p);
 void void_gpu_release_texture_view(void *p);
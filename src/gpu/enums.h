@@ -0,0 +1,99 @@
+// Void GPU Enums — short names for the Dawn enum values C modules pass
+// through dawn.h and cache.h (which take plain integers)
+// Every name maps onto the WGPU* value from <dawn/webgpu.h>, so no module
+// keeps its own copy of a number. src/gpu/constants.ms mirrors the same
+// values for MetaScript code.
+
+#ifndef VOID_GPU_ENUMS_H
+#define VOID_GPU_ENUMS_H
+
+#include <dawn/webgpu.h>
+
+// --- Buffer usage ---
+#define BUFFER_USAGE_MAP_READ  WGPUBufferUsage_MapRead
+#define BUFFER_USAGE_COPY_SRC  WGPUBufferUsage_CopySrc
+#define BUFFER_USAGE_COPY_DST  WGPUBufferUsage_CopyDst
+#define BUFFER_USAGE_INDEX     WGPUBufferUsage_Index
+#define BUFFER_USAGE_VERTEX    WGPUBufferUsage_Vertex
+#define BUFFER_USAGE_UNIFORM   WGPUBufferUsage_Uniform
+#define BUFFER_USAGE_STORAGE   WGPUBufferUsage_Storage
+#define BUFFER_USAGE_INDIRECT  WGPUBufferUsage_Indirect
+
+// --- Texture usage ---
+#define TEXTURE_USAGE_COPY_DST             WGPUTextureUsage_CopyDst
+#define TEXTURE_USAGE_TEXTURE_BINDING      WGPUTextureUsage_TextureBinding
+#define TEXTURE_USAGE_STORAGE_BINDING      WGPUTextureUsage_StorageBinding
+#define TEXTURE_USAGE_RENDER_ATTACHMENT    WGPUTextureUsage_RenderAttachment
+#define TEXTURE_USAGE_TRANSIENT_ATTACHMENT WGPUTextureUsage_TransientAttachment
+
+// --- Texture formats ---
+#define FMT_R8_UNORM           WGPUTextureFormat_R8Unorm
+#define FMT_RGBA8_UNORM        WGPUTextureFormat_RGBA8Unorm
+#define FMT_RGBA8_UNORM_SRGB   WGPUTextureFormat_RGBA8UnormSrgb
+#define FMT_BGRA8_UNORM        WGPUTextureFormat_BGRA8Unorm
+#define FMT_RGBA16_FLOAT       WGPUTextureFormat_RGBA16Float
+#define FMT_DEPTH24_PLUS       WGPUTextureFormat_Depth24Plus
+#define FMT_DEPTH32_FLOAT      WGPUTextureFormat_Depth32Float
+#define FMT_BC1_RGBA_UNORM     WGPUTextureFormat_BC1RGBAUnorm
+#define FMT_BC1_RGBA_SRGB      WGPUTextureFormat_BC1RGBAUnormSrgb
+#define FMT_BC3_RGBA_UNORM     WGPUTextureFormat_BC3RGBAUnorm
+#define FMT_BC3_RGBA_SRGB      WGPUTextureFormat_BC3RGBAUnormSrgb
+#define FMT_BC4_R_UNORM        WGPUTextureFormat_BC4RUnorm
+#define FMT_BC5_RG_UNORM       WGPUTextureFormat_BC5RGUnorm
+#define FMT_BC7_RGBA_UNORM     WGPUTextureFormat_BC7RGBAUnorm
+#define FMT_BC7_RGBA_SRGB      WGPUTextureFormat_BC7RGBAUnormSrgb
+#define FMT_ETC2_RGB8_UNORM    WGPUTextureFormat_ETC2RGB8Unorm
+#define FMT_ETC2_RGB8_SRGB     WGPUTextureFormat_ETC2RGB8UnormSrgb
+#define FMT_ETC2_RGBA8_UNORM   WGPUTextureFormat_ETC2RGBA8Unorm
+#define FMT_ETC2_RGBA8_SRGB    WGPUTextureFormat_ETC2RGBA8UnormSrgb
+#define FMT_EAC_RG11_UNORM     WGPUTextureFormat_EACRG11Unorm
+#define FMT_ASTC_4X4_UNORM     WGPUTextureFormat_ASTC4x4Unorm
+#define FMT_ASTC_4X4_SRGB      WGPUTextureFormat_ASTC4x4UnormSrgb
+
+// --- Vertex and index formats ---
+#define VFMT_UNORM8X4          WGPUVertexFormat_Unorm8x4
+#define VFMT_FLOAT32           WGPUVertexFormat_Float32
+#define VFMT_FLOAT32X2         WGPUVertexFormat_Float32x2
+#define VFMT_FLOAT32X3         WGPUVertexFormat_Float32x3
+#define VFMT_FLOAT32X4         WGPUVertexFormat_Float32x4
+#define VFMT_UINT32            WGPUVertexFormat_Uint32
+#define VFMT_UINT32X2          WGPUVertexFormat_Uint32x2
+#define VFMT_UINT32X3          WGPUVertexFormat_Uint32x3
+#define VFMT_UINT32X4          WGPUVertexFormat_Uint32x4
+#define VFMT_SINT32            WGPUVertexFormat_Sint32
+#define INDEX_UINT32           WGPUIndexFormat_Uint32
+
+// --- Bind group layouts ---
+#define STAGE_VERTEX           WGPUShaderStage_Vertex
+#define STAGE_FRAGMENT         WGPUShaderStage_Fragment
+#define STAGE_COMPUTE          WGPUShaderStage_Compute
+#define BINDING_UNIFORM        WGPUBufferBindingType_Uniform
+#define BINDING_STORAGE        WGPUBufferBindingType_Storage
+#define BINDING_READ_ONLY_STORAGE WGPUBufferBindingType_ReadOnlyStorage
+#define SAMPLE_TYPE_FLOAT      WGPUTextureSampleType_Float
+#define SAMPLE_TYPE_DEPTH      WGPUTextureSampleType_Depth
+#define SAMPLER_FILTERING      WGPUSamplerBindingType_Filtering
+#define SAMPLER_COMPARISON     WGPUSamplerBindingType_Comparison
+#define STORAGE_WRITE_ONLY     WGPUStorageTextureAccess_WriteOnly
+
+// --- Views ---
+#define VIEW_2D                WGPUTextureViewDimension_2D
+#define VIEW_2D_ARRAY          WGPUTextureViewDimension_2DArray
+#define VIEW_3D                WGPUTextureViewDimension_3D
+#define ASPECT_DEPTH_ONLY      WGPUTextureAspect_DepthOnly
+
+// --- Samplers ---
+#define ADDRESS_CLAMP          WGPUAddressMode_ClampToEdge
+#define FILTER_LINEAR          WGPUFilterMode_Linear
+#define MIPMAP_NEAREST         WGPUMipmapFilterMode_Nearest
+#define COMPARE_LESS           WGPUCompareFunction_Less
+#define COMPARE_LESS_EQUAL     WGPUCompareFunction_LessEqual
+
+// --- Render state ---
+#define CULL_BACK              WGPUCullMode_Back
+#define BLEND_ONE              WGPUBlendFactor_One
+#define BLEND_SRC_ALPHA        WGPUBlendFactor_SrcAlpha
+#define BLEND_ONE_MINUS_SRC_ALPHA WGPUBlendFactor_OneMinusSrcAlpha
+#define BLEND_OP_ADD           WGPUBlendOperation_Add
+
+#endif
@@ -0,0 +1,170 @@
+// Void GPU Memory — allocation registry and VRAM budget
+
+#include "memory.h"
+#include "../core/hash.h"
+
+#include <stdlib.h>
+
+// --- Types ---
+
+typedef struct Allocation {
+	void    *handle;
+	uint64_t bytes;
+	uint32_t category;
+} Allocation;
+
+static Allocation *s_allocs = NULL;
+static uint32_t    s_count = 0;
+static uint32_t    s_cap = 0;
+static HashMap     s_index;          // hash_mix(handle) -> s_allocs slot
+
+static uint64_t s_budget = VOID_GPU_MEM_DEFAULT_BUDGET;
+static uint64_t s_used = 0;
+static uint64_t s_peak = 0;
+static uint64_t s_used_in[VOID_GPU_MEM_CATEGORY_COUNT];
+static uint32_t s_count_in[VOID_GPU_MEM_CATEGORY_COUNT];
+
+static uint64_t handle_key(void *handle) {
+	return hash_mix((uint64_t)(uintptr_t)handle);
+}
+
+// --- Registry ---
+
+void void_gpu_memory_track(void *handle, uint32_t category, uint64_t bytes) {
+	if (!handle) return;
+	if (category >= VOID_GPU_MEM_CATEGORY_COUNT) category = VOID_GPU_MEM_BUFFER;
+	// A handle Dawn reuses after a release that bypassed dawn.c
+	void_gpu_memory_untrack(handle);
+
+	if (s_count == s_cap) {
+		uint32_t cap = s_cap ? s_cap * 2 : 256;
+		Allocation *grown = realloc(s_allocs, cap * sizeof(Allocation));
+		if (!grown) return;
+		s_allocs = grown;
+		s_cap = cap;
+	}
+	s_allocs[s_count] = (Allocation){ handle, bytes, category };
+	map_put(&s_index, handle_key(handle), (int32_t)s_count);
+	s_count++;
+
+	s_used += bytes;
+	s_used_in[category] += bytes;
+	s_count_in[category]++;
+	if (s_used > s_peak) s_peak = s_used;
+}
+
+void void_gpu_memory_untrack(void *handle) {
+	if (!handle) return;
+	uint64_t key = handle_key(handle);
+	int32_t slot = map_get(&s_index, key);
+	if (slot < 0) return;
+
+	Allocation *a = &s_allocs[slot];
+	s_used -= a->bytes;
+	s_used_in[a->category] -= a->bytes;
+	s_count_in[a->category]--;
+	map_remove(&s_index, key);
+
+	// Swap-remove, re-pointing the moved entry
+	uint32_t last = --s_count;
+	if ((uint32_t)slot != last) {
+		s_allocs[slot] = s_allocs[last];
+		map_put(&s_index, handle_key(s_allocs[slot].handle), slot);
+	}
+}
+
+void void_gpu_memory_set_category(void *handle, uint32_t category) {
+	if (category >= VOID_GPU_MEM_CATEGORY_COUNT) return;
+	int32_t slot = map_get(&s_index, handle_key(handle));
+	if (slot < 0) return;
+	Allocation *a = &s_allocs[slot];
+	s_used_in[a->category] -= a->bytes;
+	s_count_in[a->category]--;
+	a->category = category;
+	s_used_in[category] += a->bytes;
+	s_count_in[category]++;
+}
+
+// --- Format sizes (Dawn WGPUTextureFormat values) ---
+
+uint32_t void_gpu_format_block_bytes(uint32_t format) {
+	switch (format) {
+	case 0x01: case 0x02: case 0x03: case 0x04:   // R8
+	case 0x26:                                    // Stencil8
+		return 1;
+	case 0x05: case 0x06: case 0x07:              // R16
+	case 0x08: case 0x09: case 0x0A: case 0x0B:   // RG8
+	case 0x27:                                    // Depth16Unorm
+		return 2;
+	case 0x1D: case 0x1E: case 0x1F:              // RG32
+	case 0x20: case 0x21: case 0x22:              // RGBA16
+	case 0x2B:                                    // Depth32FloatStencil8 (padded)
+		return 8;
+	case 0x23: case 0x24: case 0x25:              // RGBA32
+		return 16;
+	// Compressed: bytes per 4x4 block
+	case 0x2C: case 0x2D:                         // BC1
+	case 0x32: case 0x33:                         // BC4
+	case 0x3A: case 0x3B: case 0x3C: case 0x3D:   // ETC2 RGB8, RGB8A1
+	case 0x40: case 0x41:                         // EAC R11
+		return 8;
+	default:
+		if (format >= 0x2E && format <= 0x5F) return 16;  // BC2/3/5/6H/7, ETC2 RGBA8, EAC RG11, ASTC
+		return 4;                                 // RGBA8/BGRA8, RG16, R32, packed 32-bit, Depth24Plus, Depth32Float
+	}
+}
+
+uint32_t void_gpu_format_block_size(uint32_t format) {
+	// ASTC blocks beyond 4x4 are counted as 4x4 (an overestimate)
+	return format >= 0x2C && format <= 0x5F ? 4 : 1;
+}
+
+uint64_t void_gpu_texture_bytes(uint32_t width, uint32_t height, uint32_t layers,
+	uint32_t format, uint32_t mipLevelCount, uint32_t sampleCount
+) {
+	uint32_t block = void_gpu_format_block_size(format);
+	uint64_t block_bytes = void_gpu_format_block_bytes(format);
+	if (layers == 0) layers = 1;
+	if (mipLevelCount == 0) mipLevelCount = 1;
+	if (sampleCount == 0) sampleCount = 1;
+
+	uint64_t total = 0;
+	for (uint32_t m = 0; m < mipLevelCount; m++) {
+		uint32_t w = width >> m, h = height >> m;
+		if (w == 0) w = 1;
+		if (h == 0) h = 1;
+		uint64_t bw = (w + block - 1) / block, bh = (h + block - 1) / block;
+		total += bw * bh * block_bytes;
+	}
+	return total * layers * sampleCount;
+}
+
+// --- Budget ---
+
+void void_gpu_memory_set_budget(uint64_t bytes) {
+	s_budget = bytes;
+}
+
+uint64_t void_gpu_memory_budget(void) {
+	return s_budget;
+}
+
+uint64_t void_gpu_memory_used(void) {
+	return s_used;
+}
+
+uint64_t void_gpu_memory_used_in(uint32_t category) {
+	return category < VOID_GPU_MEM_CATEGORY_COUNT ? s_used_in[category] : 0;
+}
+
+uint32_t void_gpu_memory_count_in(uint32_t category) {
+	return category < VOID_GPU_MEM_CATEGORY_COUNT ? s_count_in[category] : 0;
+}
+
+uint64_t void_gpu_memory_peak(void) {
+	return s_peak;
+}
+
+int64_t void_gpu_memory_headroom(void) {
+	return (int64_t)s_budget - (int64_t)s_used;
+}
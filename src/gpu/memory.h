@@ -0,0 +1,49 @@
+// Void GPU Memory — allocation registry and VRAM budget
+// Every buffer and texture created through dawn.c is recorded with its
+// estimated size and a category; releasing it through dawn.c removes it.
+// Sizes are what the resource needs (mip chain, layers, samples), not what
+// the driver rounds them up to. Memoryless transient attachments count as
+// zero. The budget is advisory: nothing fails when it is exceeded, but
+// streaming (src/render/streaming) sizes itself to what the budget leaves.
+// Not thread-safe: create and release GPU resources on the render thread.
+
+#ifndef VOID_GPU_MEMORY_H
+#define VOID_GPU_MEMORY_H
+
+#include <stdint.h>
+
+// Categories
+#define VOID_GPU_MEM_BUFFER        0
+#define VOID_GPU_MEM_TEXTURE       1   // sampled textures
+#define VOID_GPU_MEM_TARGET        2   // render attachments
+#define VOID_GPU_MEM_STREAMING     3   // textures owned by the streamer
+#define VOID_GPU_MEM_CATEGORY_COUNT 4
+
+// Budget used until set (512 MiB)
+#define VOID_GPU_MEM_DEFAULT_BUDGET (512ull << 20)
+
+// --- Registry (called by dawn.c) ---
+void void_gpu_memory_track(void *handle, uint32_t category, uint64_t bytes);
+void void_gpu_memory_untrack(void *handle);
+// Moves a tracked resource to another category
+void void_gpu_memory_set_category(void *handle, uint32_t category);
+
+// Bytes per texel of a Dawn texture format, or per block for compressed
+// formats; block_size is the block width and height (1 when uncompressed).
+uint32_t void_gpu_format_block_bytes(uint32_t format);
+uint32_t void_gpu_format_block_size(uint32_t format);
+// Size of a texture with a full or partial mip chain
+uint64_t void_gpu_texture_bytes(uint32_t width, uint32_t height, uint32_t layers,
+    uint32_t format, uint32_t mipLevelCount, uint32_t sampleCount);
+
+// --- Budget ---
+void     void_gpu_memory_set_budget(uint64_t bytes);
+uint64_t void_gpu_memory_budget(void);
+uint64_t void_gpu_memory_used(void);
+uint64_t void_gpu_memory_used_in(uint32_t category);
+uint32_t void_gpu_memory_count_in(uint32_t category);
+uint64_t void_gpu_memory_peak(void);
+// Budget minus use; negative when over budget
+int64_t  void_gpu_memory_headroom(void);
+
+#endif
@@ -0,0 +1,264 @@
+// Void GPU Timer — per-pass GPU timings from timestamp queries
+
+#include "timer.h"
+#include "../core/trace.h"
+
+#include <dawn/webgpu.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- Types ---
+
+#define SLOT_IDLE     0    // free for recording
+#define SLOT_RESOLVED 1    // copy recorded, waiting for the submit
+#define SLOT_MAPPING  2    // map requested, GPU may still be busy
+#define SLOT_MAPPED   3    // results readable
+
+typedef struct Readback {
+	WGPUBuffer buffer;
+	int        state;
+	int        orphaned;     // timer destroyed while mapping; the callback frees it
+	uint64_t   frame;
+	uint32_t   scope_count;
+	char       names[VOID_GPU_TIMER_MAX_SCOPES][32];
+	uint64_t   submit_ns;    // CPU clock, for the trace timeline
+	uint64_t   complete_ns;
+} Readback;
+
+typedef struct GpuTimer {
+	int          supported;
+	WGPUQuerySet query_set;
+	WGPUBuffer   resolve_buffer;
+	Readback    *slots[VOID_GPU_TIMER_LATENCY];
+	uint64_t     frame;
+
+	// Frame being recorded
+	Readback    *current;    // NULL = this frame is not timed
+	uint32_t     scope_count;
+
+	// Latest completed frame
+	int          ready;
+	uint64_t     result_frame;
+	uint32_t     result_count;
+	char         result_names[VOID_GPU_TIMER_MAX_SCOPES][32];
+	float        result_ms[VOID_GPU_TIMER_MAX_SCOPES];
+	float        frame_ms;
+} GpuTimer;
+
+// Two timestamps per scope
+#define QUERY_COUNT  (VOID_GPU_TIMER_MAX_SCOPES * 2)
+#define BUFFER_SIZE  (QUERY_COUNT * sizeof(uint64_t))
+
+static void on_mapped(WGPUMapAsyncStatus status, WGPUStringView message, void *u1, void *u2) {
+	(void)message; (void)u2;
+	Readback *r = (Readback *)u1;
+	if (r->orphaned) {
+		if (status == WGPUMapAsyncStatus_Success) wgpuBufferUnmap(r->buffer);
+		wgpuBufferRelease(r->buffer);
+		free(r);
+		return;
+	}
+	// A failed map just drops that frame's timings
+	r->state = status == WGPUMapAsyncStatus_Success ? SLOT_MAPPED : SLOT_IDLE;
+	r->complete_ns = void_trace_now_ns();
+}
+
+// --- Lifecycle ---
+
+void *void_gpu_timer_create(void *device) {
+	GpuTimer *t = calloc(1, sizeof(GpuTimer));
+	t->supported = void_gpu_device_has_timestamps(device);
+	if (!t->supported) return t;
+
+	WGPUQuerySetDescriptor qd = {0};
+	qd.label = (WGPUStringView){ "void_gpu_timer", WGPU_STRLEN };
+	qd.type = WGPUQueryType_Timestamp;
+	qd.count = QUERY_COUNT;
+	t->query_set = wgpuDeviceCreateQuerySet((WGPUDevice)device, &qd);
+
+	WGPUBufferDescriptor bd = {0};
+	bd.size = BUFFER_SIZE;
+	bd.usage = WGPUBufferUsage_QueryResolve | WGPUBufferUsage_CopySrc;
+	t->resolve_buffer = wgpuDeviceCreateBuffer((WGPUDevice)device, &bd);
+
+	bd.usage = WGPUBufferUsage_MapRead | WGPUBufferUsage_CopyDst;
+	for (uint32_t i = 0; i < VOID_GPU_TIMER_LATENCY; i++) {
+		t->slots[i] = calloc(1, sizeof(Readback));
+		t->slots[i]->buffer = wgpuDeviceCreateBuffer((WGPUDevice)device, &bd);
+	}
+
+	if (!t->query_set || !t->resolve_buffer) {
+		fprintf(stderr, "void_gpu_timer: timestamp query setup failed, timing disabled\n");
+		t->supported = 0;
+	}
+	return t;
+}
+
+void void_gpu_timer_destroy(void *timer) {
+	GpuTimer *t = (GpuTimer *)timer;
+	if (!t) return;
+	for (uint32_t i = 0; i < VOID_GPU_TIMER_LATENCY; i++) {
+		Readback *r = t->slots[i];
+		if (!r) continue;
+		if (r->state == SLOT_MAPPING) {
+			r->orphaned = 1;
+			continue;
+		}
+		if (r->state == SLOT_MAPPED) wgpuBufferUnmap(r->buffer);
+		if (r->buffer) wgpuBufferRelease(r->buffer);
+		free(r);
+	}
+	if (t->resolve_buffer) wgpuBufferRelease(t->resolve_buffer);
+	if (t->query_set) {
+		wgpuQuerySetDestroy(t->query_set);
+		wgpuQuerySetRelease(t->query_set);
+	}
+	free(t);
+}
+
+int void_gpu_timer_supported(void *timer) {
+	return ((GpuTimer *)timer)->supported;
+}
+
+// --- Per frame ---
+
+static void read_results(GpuTimer *t, Readback *r) {
+	const uint64_t *ts = (const uint64_t *)wgpuBufferGetConstMappedRange(
+		r->buffer, 0, r->scope_count * 2 * sizeof(uint64_t));
+	if (!ts) return;
+
+	// Timestamps are nanoseconds; a pair can come back reversed or zero if
+	// the GPU reset its counter, so only well-ordered pairs count.
+	uint64_t first = UINT64_MAX, last = 0;
+	for (uint32_t i = 0; i < r->scope_count; i++) {
+		uint64_t b = ts[i * 2], e = ts[i * 2 + 1];
+		memcpy(t->result_names[i], r->names[i], sizeof(r->names[i]));
+		if (b == 0 || e < b) {
+			t->result_ms[i] = 0.0f;
+			continue;
+		}
+		t->result_ms[i] = (float)((double)(e - b) * 1e-6);
+		if (b < first) first = b;
+		if (e > last) last = e;
+	}
+	t->result_count = r->scope_count;
+	t->frame_ms = last > first ? (float)((double)(last - first) * 1e-6) : 0.0f;
+	void_trace_gpu_frame(r->submit_ns, r->complete_ns, r->scope_count, r->names[0], ts);
+	t->result_frame = r->frame;
+	t->ready = 1;
+}
+
+void void_gpu_timer_begin_frame(void *timer) {
+	GpuTimer *t = (GpuTimer *)timer;
+	t->current = NULL;
+	t->scope_count = 0;
+	if (!t->supported) return;
+
+	// Oldest first, so the newest finished frame ends up as the result
+	for (;;) {
+		Readback *oldest = NULL;
+		for (uint32_t i = 0; i < VOID_GPU_TIMER_LATENCY; i++) {
+			Readback *r = t->slots[i];
+			if (r->state == SLOT_MAPPED && (!oldest || r->frame < oldest->frame)) oldest = r;
+		}
+		if (!oldest) break;
+		if (oldest->frame > t->result_frame) read_results(t, oldest);
+		wgpuBufferUnmap(oldest->buffer);
+		oldest->state = SLOT_IDLE;
+	}
+
+	for (uint32_t i = 0; i < VOID_GPU_TIMER_LATENCY; i++) {
+		if (t->slots[i]->state == SLOT_IDLE) {
+			t->current = t->slots[i];
+			break;
+		}
+	}
+}
+
+uint32_t void_gpu_timer_scope(void *timer, const char *name) {
+	GpuTimer *t = (GpuTimer *)timer;
+	if (!t->current || t->scope_count >= VOID_GPU_TIMER_MAX_SCOPES) return VOID_GPU_TIMER_NONE;
+	char *dst = t->current->names[t->scope_count];
+	strncpy(dst, name ? name : "", 31);
+	dst[31] = '\0';
+	return t->scope_count++;
+}
+
+void void_gpu_timer_render_pass(void *timer, uint32_t scope, VoidRenderPassDesc *d) {
+	GpuTimer *t = (GpuTimer *)timer;
+	if (!t->current || scope >= t->scope_count) return;
+	d->timestamp_set = (void *)t->query_set;
+	d->timestamp_begin = scope * 2;
+	d->timestamp_end = scope * 2 + 1;
+}
+
+void void_gpu_timer_compute_pass(void *timer, uint32_t scope, VoidComputePassDesc *d) {
+	GpuTimer *t = (GpuTimer *)timer;
+	if (!t->current || scope >= t->scope_count) return;
+	d->timestamp_set = (void *)t->query_set;
+	d->timestamp_begin = scope * 2;
+	d->timestamp_end = scope * 2 + 1;
+}
+
+void void_gpu_timer_resolve(void *timer, void *encoder) {
+	GpuTimer *t = (GpuTimer *)timer;
+	Readback *r = t->current;
+	if (!r || t->scope_count == 0) return;
+	uint64_t size = (uint64_t)t->scope_count * 2 * sizeof(uint64_t);
+	wgpuCommandEncoderResolveQuerySet((WGPUCommandEncoder)encoder, t->query_set,
+		0, t->scope_count * 2, t->resolve_buffer, 0);
+	wgpuCommandEncoderCopyBufferToBuffer((WGPUCommandEncoder)encoder,
+		t->resolve_buffer, 0, r->buffer, 0, size);
+	r->scope_count = t->scope_count;
+	r->frame = ++t->frame;
+	r->state = SLOT_RESOLVED;
+}
+
+void void_gpu_timer_end_frame(void *timer) {
+	GpuTimer *t = (GpuTimer *)timer;
+	Readback *r = t->current;
+	t->current = NULL;
+	if (!r || r->state != SLOT_RESOLVED) return;
+
+	WGPUBufferMapCallbackInfo cb = {0};
+	cb.mode = WGPUCallbackMode_AllowProcessEvents;
+	cb.callback = on_mapped;
+	cb.userdata1 = r;
+	r->state = SLOT_MAPPING;
+	r->submit_ns = void_trace_now_ns();
+	wgpuBufferMapAsync(r->buffer, WGPUMapMode_Read, 0,
+		r->scope_count * 2 * sizeof(uint64_t), cb);
+}
+
+// --- Results ---
+
+int void_gpu_timer_ready(void *timer) {
+	return ((GpuTimer *)timer)->ready;
+}
+
+float void_gpu_timer_frame_ms(void *timer) {
+	return ((GpuTimer *)timer)->frame_ms;
+}
+
+uint32_t void_gpu_timer_result_count(void *timer) {
+	return ((GpuTimer *)timer)->result_count;
+}
+
+const char *void_gpu_timer_result_name(void *timer, uint32_t index) {
+	GpuTimer *t = (GpuTimer *)timer;
+	return index < t->result_count ? t->result_names[index] : "";
+}
+
+float void_gpu_timer_result_ms(void *timer, uint32_t index) {
+	GpuTimer *t = (GpuTimer *)timer;
+	return index < t->result_count ? t->result_ms[index] : 0.0f;
+}
+
+float void_gpu_timer_find_ms(void *timer, const char *name) {
+	GpuTimer *t = (GpuTimer *)timer;
+	for (uint32_t i = 0; i < t->result_count; i++) {
+		if (strcmp(t->result_names[i], name) == 0) return t->result_ms[i];
+	}
+	return -1.0f;
+}
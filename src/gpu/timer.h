@@ -0,0 +1,55 @@
+// Void GPU Timer — per-pass GPU timings from timestamp queries
+// Each timed render or compute pass writes a begin/end timestamp pair into a
+// query set. At the end of the frame the queries are resolved and copied into one of
+// VOID_GPU_TIMER_LATENCY readback buffers, which is mapped once the GPU is
+// done with it, so results arrive a few frames late without ever stalling.
+// A frame whose readback buffer is still in flight is simply not timed.
+// Without the TimestampQuery feature the timer is inert: scopes are
+// VOID_GPU_TIMER_NONE and no result ever becomes ready.
+//
+// Per frame: begin_frame → scope + render_pass/compute_pass per timed pass →
+// resolve (before finishing the encoder) → submit → end_frame.
+// Readback callbacks run from void_gpu_process_events. Not thread-safe.
+// While a trace capture runs (src/core/trace), each completed frame is also
+// placed on the trace's GPU track.
+
+#ifndef VOID_GPU_TIMER_H
+#define VOID_GPU_TIMER_H
+
+#include <stdint.h>
+
+#include "dawn.h"
+
+#define VOID_GPU_TIMER_MAX_SCOPES 16
+#define VOID_GPU_TIMER_LATENCY    3     // readback buffers in flight
+#define VOID_GPU_TIMER_NONE       0xFFFFFFFFu
+
+void *void_gpu_timer_create(void *device);
+void  void_gpu_timer_destroy(void *timer);
+int   void_gpu_timer_supported(void *timer);
+
+// --- Per frame ---
+// Collects finished readbacks and starts recording a new frame.
+void void_gpu_timer_begin_frame(void *timer);
+// Opens a named scope for one pass; VOID_GPU_TIMER_NONE when the frame is
+// not timed or the scopes are used up.
+uint32_t void_gpu_timer_scope(void *timer, const char *name);
+// Points the pass descriptor's timestamp writes at the scope (no-op for NONE).
+void void_gpu_timer_render_pass(void *timer, uint32_t scope, VoidRenderPassDesc *d);
+void void_gpu_timer_compute_pass(void *timer, uint32_t scope, VoidComputePassDesc *d);
+// Resolves this frame's queries into its readback buffer.
+void void_gpu_timer_resolve(void *timer, void *encoder);
+// After the submit that contains the resolve: starts the readback.
+void void_gpu_timer_end_frame(void *timer);
+
+// --- Results (latest completed frame) ---
+int      void_gpu_timer_ready(void *timer);
+// First pass begin to last pass end, in milliseconds
+float    void_gpu_timer_frame_ms(void *timer);
+uint32_t void_gpu_timer_result_count(void *timer);
+const char *void_gpu_timer_result_name(void *timer, uint32_t index);
+float    void_gpu_timer_result_ms(void *timer, uint32_t index);
+// Milliseconds of the scope called `name`, -1 if it was not timed
+float    void_gpu_timer_find_ms(void *timer, const char *name);
+
+#endif
@@ -19,12 +19,24 @@ void void_math_set_look_at(
 // Set the model matrix to rotation around Y axis
 void void_math_set_rotate_y(float angle);
 
+// Set the model matrix from 16 floats (column-major)
+void void_math_set_model(const void *m);
+
 // Compute MVP = projection * view * model → internal 64-byte buffer
 void void_math_multiply_mvp(void);
 
 // Get pointer to the 64-byte MVP result (16 floats, column-major)
 const void *void_math_get_mvp(void);
 
+// Get pointers to the current view / projection / model matrices
+const void *void_math_get_view(void);
+const void *void_math_get_projection(void);
+const void *void_math_get_model(void);
+
+// General helpers on caller-owned matrices (16 floats, column-major)
+void void_mat4_multiply(float *out, const float *a, const float *b);
+int  void_mat4_invert(float *out, const float *m);  // 0 if singular
+
 // Trig helpers (expose C math to MetaScript)
 float void_math_sinf(float x);
 float void_math_cosf(float x);
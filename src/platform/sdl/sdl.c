@@ -4,6 +4,9 @@
 
 #include <SDL3/SDL.h>
 
+#include <stdlib.h>
+#include <string.h>
+
 // --- Lifecycle ---
 
 int void_platform_init(void) {
@@ -22,12 +25,139 @@ void void_window_destroy(void *window) {
 	if (window) SDL_DestroyWindow((SDL_Window *)window);
 }
 
+// --- Input state ---
+
+#define KEY_WORDS (SDL_SCANCODE_COUNT / 64)
+
+static uint64_t s_keys_down[KEY_WORDS];
+static uint64_t s_keys_pressed[KEY_WORDS];
+static uint64_t s_keys_released[KEY_WORDS];
+static uint32_t s_buttons_down, s_buttons_pressed, s_buttons_released;
+static float s_mouse_x = 0, s_mouse_y = 0;
+static float s_wheel_x = 0, s_wheel_y = 0;
+
+static void track_key(int scancode, int down, int repeat) {
+	if (scancode < 0 || scancode >= SDL_SCANCODE_COUNT || repeat) return;
+	uint64_t bit = 1ull << (scancode & 63);
+	int w = scancode >> 6;
+	if (down) {
+		if (!(s_keys_down[w] & bit)) s_keys_pressed[w] |= bit;
+		s_keys_down[w] |= bit;
+	} else {
+		if (s_keys_down[w] & bit) s_keys_released[w] |= bit;
+		s_keys_down[w] &= ~bit;
+	}
+}
+
+static void track_button(int button, int down) {
+	if (button < 0 || button >= 32) return;
+	uint32_t bit = 1u << button;
+	if (down) {
+		if (!(s_buttons_down & bit)) s_buttons_pressed |= bit;
+		s_buttons_down |= bit;
+	} else {
+		if (s_buttons_down & bit) s_buttons_released |= bit;
+		s_buttons_down &= ~bit;
+	}
+}
+
+// Held keys never see their key_up once focus is gone
+static void release_all(void) {
+	for (int w = 0; w < KEY_WORDS; w++) {
+		s_keys_released[w] |= s_keys_down[w];
+		s_keys_down[w] = 0;
+	}
+	s_buttons_released |= s_buttons_down;
+	s_buttons_down = 0;
+}
+
+void void_input_new_frame(void) {
+	memset(s_keys_pressed, 0, sizeof(s_keys_pressed));
+	memset(s_keys_released, 0, sizeof(s_keys_released));
+	s_buttons_pressed = 0;
+	s_buttons_released = 0;
+	s_wheel_x = 0;
+	s_wheel_y = 0;
+}
+
+static int key_bit(const uint64_t *bits, int scancode) {
+	if (scancode < 0 || scancode >= SDL_SCANCODE_COUNT) return 0;
+	return (int)((bits[scancode >> 6] >> (scancode & 63)) & 1);
+}
+
+int void_key_down(int scancode) { return key_bit(s_keys_down, scancode); }
+int void_key_pressed(int scancode) { return key_bit(s_keys_pressed, scancode); }
+int void_key_released(int scancode) { return key_bit(s_keys_released, scancode); }
+int void_mouse_down(int button) { return button >= 0 && button < 32 ? (int)((s_buttons_down >> button) & 1) : 0; }
+int void_mouse_pressed(int button) { return button >= 0 && button < 32 ? (int)((s_buttons_pressed >> button) & 1) : 0; }
+int void_mouse_released(int button) { return button >= 0 && button < 32 ? (int)((s_buttons_released >> button) & 1) : 0; }
+float void_mouse_x(void) { return s_mouse_x; }
+float void_mouse_y(void) { return s_mouse_y; }
+float void_mouse_wheel_x(void) { return s_wheel_x; }
+float void_mouse_wheel_y(void) { return s_wheel_y; }
+
+// --- Event translation ---
+
+// Fill out from an SDL event and update the input state; returns the type
+// code (-1 = unhandled)
+static int translate_event(const SDL_Event *event, VoidEvent *out) {
+	memset(out, 0, sizeof(*out));
+	out->timestamp_ns = event->common.timestamp;
+	switch (event->type) {
+		case SDL_EVENT_QUIT:
+			out->type = 1;
+			break;
+		case SDL_EVENT_KEY_DOWN:
+		case SDL_EVENT_KEY_UP:
+			out->type = event->type == SDL_EVENT_KEY_DOWN ? 2 : 3;
+			out->code = (int32_t)event->key.scancode;
+			out->repeat = event->key.repeat ? 1 : 0;
+			track_key(out->code, out->type == 2, out->repeat);
+			break;
+		case SDL_EVENT_MOUSE_MOTION:
+			out->type = 4;
+			out->x = s_mouse_x = event->motion.x;
+			out->y = s_mouse_y = event->motion.y;
+			break;
+		case SDL_EVENT_MOUSE_BUTTON_DOWN:
+		case SDL_EVENT_MOUSE_BUTTON_UP:
+			out->type = event->type == SDL_EVENT_MOUSE_BUTTON_DOWN ? 5 : 6;
+			out->code = (int32_t)event->button.button;
+			out->x = s_mouse_x = event->button.x;
+			out->y = s_mouse_y = event->button.y;
+			track_button(out->code, out->type == 5);
+			break;
+		case SDL_EVENT_MOUSE_WHEEL:
+			out->type = 7;
+			out->x = event->wheel.x;
+			out->y = event->wheel.y;
+			s_wheel_x += out->x;
+			s_wheel_y += out->y;
+			break;
+		case SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED:
+			out->type = 8;
+			out->width = event->window.data1;
+			out->height = event->window.data2;
+			break;
+		case SDL_EVENT_WINDOW_FOCUS_LOST:
+			release_all();
+			out->type = -1;
+			break;
+		default:
+			out->type = -1;
+			break;
+	}
+	return out->type;
+}
+
 // --- Legacy event polling ---
 
+// Drains the queue through translate_event so input state stays current
 int void_poll_events(void) {
 	SDL_Event event;
+	VoidEvent e;
 	while (SDL_PollEvent(&event)) {
-		if (event.type == SDL_EVENT_QUIT) return 1;
+		if (translate_event(&event, &e) == 1) return 1;
 	}
 	return 0;
 }
@@ -42,40 +172,27 @@ static int s_win_w = 0, s_win_h = 0;
 int void_poll_event(void) {
 	SDL_Event event;
 	if (!SDL_PollEvent(&event)) return 0;
-	switch (event.type) {
-		case SDL_EVENT_QUIT:
-			return 1;
-		case SDL_EVENT_KEY_DOWN:
-			s_key = (int)event.key.scancode;
-			return 2;
-		case SDL_EVENT_KEY_UP:
-			s_key = (int)event.key.scancode;
-			return 3;
-		case SDL_EVENT_MOUSE_MOTION:
-			s_mx = event.motion.x;
-			s_my = event.motion.y;
-			return 4;
-		case SDL_EVENT_MOUSE_BUTTON_DOWN:
-			s_button = (int)event.button.button;
-			s_mx = event.button.x;
-			s_my = event.button.y;
-			return 5;
-		case SDL_EVENT_MOUSE_BUTTON_UP:
-			s_button = (int)event.button.button;
-			s_mx = event.button.x;
-			s_my = event.button.y;
-			return 6;
-		case SDL_EVENT_MOUSE_WHEEL:
-			s_mx = event.wheel.x;
-			s_my = event.wheel.y;
-			return 7;
-		case SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED:
-			s_win_w = event.window.data1;
-			s_win_h = event.window.data2;
-			return 8;
-		default:
-			return -1;
+	VoidEvent e;
+	int type = translate_event(&event, &e);
+	switch (type) {
+		case 2: case 3:
+			s_key = e.code;
+			break;
+		case 5: case 6:
+			s_button = e.code;
+			s_mx = e.x;
+			s_my = e.y;
+			break;
+		case 4: case 7:
+			s_mx = e.x;
+			s_my = e.y;
+			break;
+		case 8:
+			s_win_w = e.width;
+			s_win_h = e.height;
+			break;
 	}
+	return type;
 }
 
 int void_event_key(void) { return s_key; }
@@ -85,6 +202,59 @@ int void_event_button(void) { return s_button; }
 int void_event_width(void) { return s_win_w; }
 int void_event_height(void) { return s_win_h; }
 
+// --- Batched events ---
+
+int void_poll_event_batch(VoidEvent *events, int capacity) {
+	int count = 0;
+	SDL_Event event;
+	// Check capacity first: an event polled without room would be lost
+	while (count < capacity && SDL_PollEvent(&event)) {
+		if (translate_event(&event, &events[count]) > 0) count++;
+	}
+	return count;
+}
+
+typedef struct EventBuffer {
+	VoidEvent *events;
+	int capacity;
+	int count;
+} EventBuffer;
+
+void *void_event_buffer_create(int capacity) {
+	EventBuffer *b = calloc(1, sizeof(EventBuffer));
+	b->capacity = capacity > 0 ? capacity : 64;
+	b->events = calloc((size_t)b->capacity, sizeof(VoidEvent));
+	return b;
+}
+
+void void_event_buffer_destroy(void *buffer) {
+	EventBuffer *b = (EventBuffer *)buffer;
+	if (!b) return;
+	free(b->events);
+	free(b);
+}
+
+int void_event_buffer_poll(void *buffer) {
+	EventBuffer *b = (EventBuffer *)buffer;
+	b->count = void_poll_event_batch(b->events, b->capacity);
+	return b->count;
+}
+
+static const VoidEvent *buffer_event(void *buffer, int index) {
+	static const VoidEvent none = {0};
+	EventBuffer *b = (EventBuffer *)buffer;
+	return index >= 0 && index < b->count ? &b->events[index] : &none;
+}
+
+int void_event_buffer_type(void *buffer, int index) { return buffer_event(buffer, index)->type; }
+int void_event_buffer_code(void *buffer, int index) { return buffer_event(buffer, index)->code; }
+int void_event_buffer_repeat(void *buffer, int index) { return buffer_event(buffer, index)->repeat; }
+float void_event_buffer_x(void *buffer, int index) { return buffer_event(buffer, index)->x; }
+float void_event_buffer_y(void *buffer, int index) { return buffer_event(buffer, index)->y; }
+int void_event_buffer_width(void *buffer, int index) { return buffer_event(buffer, index)->width; }
+int void_event_buffer_height(void *buffer, int index) { return buffer_event(buffer, index)->height; }
+uint64_t void_event_buffer_timestamp(void *buffer, int index) { return buffer_event(buffer, index)->timestamp_ns; }
+
 // --- Timing ---
 
 uint64_t void_get_ticks_ns(void) {
@@ -30,6 +30,54 @@ int void_event_button(void);
 int void_event_width(void);
 int void_event_height(void);
 
+// --- Batched events ---
+// One event with its payload. code: scancode (key events) or button (mouse
+// buttons); x/y: position (mouse move/buttons) or scroll (wheel);
+// width/height: new pixel size (resize). timestamp_ns is on the
+// void_get_ticks_ns clock.
+typedef struct VoidEvent {
+    uint64_t timestamp_ns;
+    int32_t type;           // type code as above (never 0 or -1)
+    int32_t code;
+    int32_t repeat;         // key_down generated by key repeat
+    int32_t width, height;
+    float x, y;
+} VoidEvent;
+
+// Drain pending events into events, up to capacity (the rest stay queued
+// for the next call); returns the count. Unhandled events are dropped.
+int void_poll_event_batch(VoidEvent *events, int capacity);
+
+// Owned event array for callers that cannot lay out VoidEvent (.ms side)
+void *void_event_buffer_create(int capacity);
+void void_event_buffer_destroy(void *buffer);
+int void_event_buffer_poll(void *buffer);   // void_poll_event_batch into it
+int void_event_buffer_type(void *buffer, int index);
+int void_event_buffer_code(void *buffer, int index);
+int void_event_buffer_repeat(void *buffer, int index);
+float void_event_buffer_x(void *buffer, int index);
+float void_event_buffer_y(void *buffer, int index);
+int void_event_buffer_width(void *buffer, int index);
+int void_event_buffer_height(void *buffer, int index);
+uint64_t void_event_buffer_timestamp(void *buffer, int index);
+
+// --- Input state ---
+// Key (scancode) and mouse button bitmaps, kept by every poller above.
+// Pressed/released edges accumulate until void_input_new_frame, called once
+// per frame before polling, so a tap inside one frame reports both edges.
+// Losing window focus releases everything held.
+void void_input_new_frame(void);
+int void_key_down(int scancode);
+int void_key_pressed(int scancode);
+int void_key_released(int scancode);
+int void_mouse_down(int button);
+int void_mouse_pressed(int button);
+int void_mouse_released(int button);
+float void_mouse_x(void);
+float void_mouse_y(void);
+float void_mouse_wheel_x(void);     // this frame
+float void_mouse_wheel_y(void);
+
 // --- Timing ---
 uint64_t void_get_ticks_ns(void);
 
@@ -0,0 +1,608 @@
+// Void Render — Batched 2D sprites with runtime atlases
+
+#include "draw2d.h"
+#include "../gpu/dawn.h"
+#include "../gpu/enums.h"
+#include "../gpu/cache.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Extruded border around every packed image
+#define PAD 1
+
+// --- Atlas ---
+
+typedef struct SkylineNode {
+	uint32_t x, y, width;
+} SkylineNode;
+
+typedef struct AtlasPage {
+	void        *texture;
+	void        *view;
+	void        *group;      // cached (texture + sampler)
+	SkylineNode *nodes;      // skyline, left to right
+	uint32_t     node_count;
+	uint32_t     node_capacity;
+	uint64_t     used_area;
+} AtlasPage;
+
+typedef struct AtlasSprite {
+	uint32_t page;
+	uint32_t width, height;
+	float    u0, v0, u1, v1;
+} AtlasSprite;
+
+typedef struct Atlas {
+	void        *device;
+	uint32_t     page_size;
+	AtlasPage    pages[VOID_DRAW2D_MAX_PAGES];
+	uint32_t     page_count;
+	AtlasSprite *sprites;
+	uint32_t     sprite_count;
+	uint32_t     sprite_capacity;
+	uint32_t     white;
+	void        *layout;     // cached, bind group 1 of the batch
+	void        *sampler;    // cached
+} Atlas;
+
+static AtlasPage *add_page(Atlas *a) {
+	if (a->page_count >= VOID_DRAW2D_MAX_PAGES) return NULL;
+	AtlasPage *p = &a->pages[a->page_count++];
+	memset(p, 0, sizeof(*p));
+	p->texture = void_gpu_create_texture(a->device, a->page_size, a->page_size, FMT_RGBA8_UNORM,
+		TEXTURE_USAGE_TEXTURE_BINDING | TEXTURE_USAGE_COPY_DST, 1);
+	p->view = void_gpu_create_texture_view(p->texture);
+	void *g = void_gpu_group_begin(a->layout);
+	void_gpu_group_texture(g, 0, p->view);
+	void_gpu_group_sampler(g, 1, a->sampler);
+	p->group = void_gpu_group_finish(a->device, g);
+	p->node_capacity = 16;
+	p->nodes = malloc(p->node_capacity * sizeof(SkylineNode));
+	p->nodes[0] = (SkylineNode){ 0, 0, a->page_size };
+	p->node_count = 1;
+	return p;
+}
+
+// Lowest y a w x h rectangle can sit at on node i, or -1 if it does not fit
+static int64_t skyline_fit(const AtlasPage *p, uint32_t size, uint32_t i, uint32_t w, uint32_t h) {
+	if (p->nodes[i].x + w > size) return -1;
+	uint32_t y = 0;
+	int64_t left = w;
+	for (uint32_t j = i; left > 0; j++) {
+		if (j >= p->node_count) return -1;
+		if (p->nodes[j].y > y) y = p->nodes[j].y;
+		if (y + h > size) return -1;
+		left -= p->nodes[j].width;
+	}
+	return y;
+}
+
+static void skyline_insert(AtlasPage *p, uint32_t i, uint32_t x, uint32_t y, uint32_t w) {
+	if (p->node_count + 1 > p->node_capacity) {
+		p->node_capacity *= 2;
+		p->nodes = realloc(p->nodes, p->node_capacity * sizeof(SkylineNode));
+	}
+	memmove(&p->nodes[i + 1], &p->nodes[i], (p->node_count - i) * sizeof(SkylineNode));
+	p->nodes[i] = (SkylineNode){ x, y, w };
+	p->node_count++;
+
+	// Trim the nodes the new one now covers
+	while (i + 1 < p->node_count) {
+		SkylineNode *cur = &p->nodes[i], *next = &p->nodes[i + 1];
+		uint32_t end = cur->x + cur->width;
+		if (next->x >= end) break;
+		uint32_t shrink = end - next->x;
+		if (next->width <= shrink) {
+			memmove(next, next + 1, (p->node_count - i - 2) * sizeof(SkylineNode));
+			p->node_count--;
+		} else {
+			next->x += shrink;
+			next->width -= shrink;
+			break;
+		}
+	}
+	// Merge neighbours at the same height
+	for (uint32_t j = 0; j + 1 < p->node_count;) {
+		if (p->nodes[j].y == p->nodes[j + 1].y) {
+			p->nodes[j].width += p->nodes[j + 1].width;
+			memmove(&p->nodes[j + 1], &p->nodes[j + 2], (p->node_count - j - 2) * sizeof(SkylineNode));
+			p->node_count--;
+		} else {
+			j++;
+		}
+	}
+}
+
+// Bottom-left rule: lowest top edge, then the narrowest node
+static int skyline_pack(AtlasPage *p, uint32_t size, uint32_t w, uint32_t h, uint32_t *out_x, uint32_t *out_y) {
+	int64_t best_top = -1;
+	uint32_t best_width = 0, best = 0, best_y = 0;
+	for (uint32_t i = 0; i < p->node_count; i++) {
+		int64_t y = skyline_fit(p, size, i, w, h);
+		if (y < 0) continue;
+		int64_t top = y + h;
+		if (best_top < 0 || top < best_top || (top == best_top && p->nodes[i].width < best_width)) {
+			best_top = top;
+			best_width = p->nodes[i].width;
+			best = i;
+			best_y = (uint32_t)y;
+		}
+	}
+	if (best_top < 0) return 0;
+	*out_x = p->nodes[best].x;
+	*out_y = best_y;
+	skyline_insert(p, best, *out_x, best_y + h, w);
+	p->used_area += (uint64_t)w * h;
+	return 1;
+}
+
+void *void_atlas_create(void *device, uint32_t page_size) {
+	Atlas *a = calloc(1, sizeof(Atlas));
+	a->device = device;
+	a->page_size = page_size ? page_size : 1024;
+	a->sampler = void_gpu_cached_sampler(device, ADDRESS_CLAMP, ADDRESS_CLAMP, ADDRESS_CLAMP,
+		FILTER_LINEAR, FILTER_LINEAR, MIPMAP_NEAREST, 0, 1);
+	void *b = void_gpu_layout_begin();
+	void_gpu_layout_texture(b, 0, STAGE_FRAGMENT, SAMPLE_TYPE_FLOAT, VIEW_2D, 0);
+	void_gpu_layout_sampler(b, 1, STAGE_FRAGMENT, SAMPLER_FILTERING);
+	a->layout = void_gpu_layout_finish(device, b);
+
+	static const uint8_t white[4] = { 255, 255, 255, 255 };
+	void *queue = void_gpu_get_queue(device);
+	a->white = void_atlas_add(a, queue, white, 1, 1);
+	void_gpu_release_queue(queue);
+	return a;
+}
+
+void void_atlas_destroy(void *atlas) {
+	Atlas *a = (Atlas *)atlas;
+	if (!a) return;
+	for (uint32_t i = 0; i < a->page_count; i++) {
+		AtlasPage *p = &a->pages[i];
+		void_gpu_cache_release(p->group);
+		void_gpu_release_texture_view(p->view);
+		void_gpu_release_texture(p->texture);
+		free(p->nodes);
+	}
+	void_gpu_cache_release(a->layout);
+	void_gpu_cache_release(a->sampler);
+	free(a->sprites);
+	free(a);
+}
+
+uint32_t void_atlas_add(void *atlas, void *queue, const void *rgba, uint32_t width, uint32_t height) {
+	Atlas *a = (Atlas *)atlas;
+	uint32_t pw = width + PAD * 2, ph = height + PAD * 2;
+	if (width == 0 || height == 0 || pw > a->page_size || ph > a->page_size) {
+		fprintf(stderr, "void_atlas: %ux%u image does not fit a %u page\n", width, height, a->page_size);
+		return VOID_DRAW2D_NONE;
+	}
+
+	// First page with room, else a new one
+	uint32_t page = 0, x = 0, y = 0;
+	int placed = 0;
+	for (; page < a->page_count && !placed; page++) {
+		placed = skyline_pack(&a->pages[page], a->page_size, pw, ph, &x, &y);
+	}
+	if (placed) {
+		page--;
+	} else {
+		AtlasPage *p = add_page(a);
+		if (!p || !skyline_pack(p, a->page_size, pw, ph, &x, &y)) {
+			fprintf(stderr, "void_atlas: all %u pages are full\n", VOID_DRAW2D_MAX_PAGES);
+			return VOID_DRAW2D_NONE;
+		}
+		page = a->page_count - 1;
+	}
+
+	// Copy with the edge pixels repeated into the border
+	uint32_t *padded = malloc((size_t)pw * ph * 4);
+	const uint32_t *src = (const uint32_t *)rgba;
+	for (uint32_t py = 0; py < ph; py++) {
+		uint32_t sy = py < PAD ? 0 : (py - PAD >= height ? height - 1 : py - PAD);
+		for (uint32_t px = 0; px < pw; px++) {
+			uint32_t sx = px < PAD ? 0 : (px - PAD >= width ? width - 1 : px - PAD);
+			memcpy(&padded[py * pw + px], &src[sy * width + sx], 4);
+		}
+	}
+	void_gpu_queue_write_texture_region(queue, a->pages[page].texture, x, y,
+		padded, (uint64_t)pw * ph * 4, pw * 4, pw, ph);
+	free(padded);
+
+	if (a->sprite_count >= a->sprite_capacity) {
+		a->sprite_capacity = a->sprite_capacity ? a->sprite_capacity * 2 : 64;
+		a->sprites = realloc(a->sprites, a->sprite_capacity * sizeof(AtlasSprite));
+	}
+	float inv = 1.0f / (float)a->page_size;
+	AtlasSprite *s = &a->sprites[a->sprite_count];
+	s->page = page;
+	s->width = width;
+	s->height = height;
+	s->u0 = (float)(x + PAD) * inv;
+	s->v0 = (float)(y + PAD) * inv;
+	s->u1 = (float)(x + PAD + width) * inv;
+	s->v1 = (float)(y + PAD + height) * inv;
+	return a->sprite_count++;
+}
+
+uint32_t void_atlas_white(void *atlas) {
+	return ((Atlas *)atlas)->white;
+}
+
+uint32_t void_atlas_sprite_width(void *atlas, uint32_t sprite) {
+	Atlas *a = (Atlas *)atlas;
+	return sprite < a->sprite_count ? a->sprites[sprite].width : 0;
+}
+
+uint32_t void_atlas_sprite_height(void *atlas, uint32_t sprite) {
+	Atlas *a = (Atlas *)atlas;
+	return sprite < a->sprite_count ? a->sprites[sprite].height : 0;
+}
+
+uint32_t void_atlas_page_count(void *atlas) {
+	return ((Atlas *)atlas)->page_count;
+}
+
+float void_atlas_occupancy(void *atlas) {
+	Atlas *a = (Atlas *)atlas;
+	if (a->page_count == 0) return 0.0f;
+	uint64_t used = 0;
+	for (uint32_t i = 0; i < a->page_count; i++) used += a->pages[i].used_area;
+	return (float)((double)used / ((double)a->page_size * a->page_size * a->page_count));
+}
+
+// --- Batch ---
+
+typedef struct Vertex2D {
+	float    pos[2];
+	float    uv[2];
+	uint32_t color;      // RGBA8, red in the low byte
+} Vertex2D;
+
+typedef struct View2D {
+	float size[2];
+	float pad[2];
+} View2D;
+
+// Consecutive quads sharing a page and scissor: one draw
+typedef struct Run {
+	uint32_t page;
+	uint32_t first;
+	uint32_t count;
+	uint32_t scissor[4];     // width 0 = whole target
+} Run;
+
+static const char *s_batch_wgsl =
+"struct View2D {\n"
+"  size: vec2f,\n"
+"  pad: vec2f,\n"
+"};\n"
+"@group(0) @binding(0) var<uniform> view2d: View2D;\n"
+"@group(1) @binding(0) var atlas_tex: texture_2d<f32>;\n"
+"@group(1) @binding(1) var atlas_samp: sampler;\n"
+"\n"
+"struct VIn {\n"
+"  @location(0) pos: vec2f,\n"
+"  @location(1) uv: vec2f,\n"
+"  @location(2) color: vec4f,\n"
+"};\n"
+"struct VOut {\n"
+"  @builtin(position) pos: vec4f,\n"
+"  @location(0) uv: vec2f,\n"
+"  @location(1) color: vec4f,\n"
+"};\n"
+"\n"
+"@vertex fn vs_main(in: VIn) -> VOut {\n"
+"  var out: VOut;\n"
+"  out.pos = vec4f(in.pos / view2d.size * vec2f(2.0, -2.0) + vec2f(-1.0, 1.0), 0.0, 1.0);\n"
+"  out.uv = in.uv;\n"
+"  out.color = in.color;\n"
+"  return out;\n"
+"}\n"
+"\n"
+"@fragment fn fs_main(in: VOut) -> @location(0) vec4f {\n"
+"  return textureSample(atlas_tex, atlas_samp, in.uv) * in.color;\n"
+"}\n";
+
+typedef struct Batch {
+	void     *device;
+	Atlas    *atlas;
+	uint32_t  max_quads;
+
+	// Frame
+	Vertex2D *vertices;      // max_quads x 4
+	uint32_t  quad_count;
+	uint32_t  flushed;       // quads already uploaded this frame
+	Run      *runs;
+	uint32_t  run_count;
+	uint32_t  run_capacity;
+	uint32_t  first_run;     // first run not yet drawn
+	uint32_t  scissor[4];
+	int       clip_all;      // scissor clamped to nothing
+	uint32_t  width, height;
+	int       view_dirty;
+	View2D    view;
+	uint32_t  draws;
+	uint32_t  dropped;
+
+	void *vertex_buffer;
+	void *index_buffer;
+	void *uniform_buffer;
+	void *view_layout;       // cached
+	void *view_group;        // cached
+	void *pipeline_layout;   // cached
+	void *shader;
+	void *pipeline;
+} Batch;
+
+void *void_batch2d_create(void *device, void *atlas, uint32_t color_format,
+	uint32_t samples, uint32_t max_sprites
+) {
+	Batch *b = calloc(1, sizeof(Batch));
+	b->device = device;
+	b->atlas = (Atlas *)atlas;
+	b->max_quads = max_sprites ? max_sprites : 1;
+	b->vertices = malloc((size_t)b->max_quads * 4 * sizeof(Vertex2D));
+	b->run_capacity = 16;
+	b->runs = malloc(b->run_capacity * sizeof(Run));
+
+	b->vertex_buffer = void_gpu_create_buffer(device, (uint64_t)b->max_quads * 4 * sizeof(Vertex2D),
+		BUFFER_USAGE_VERTEX | BUFFER_USAGE_COPY_DST, 0);
+	b->uniform_buffer = void_gpu_create_buffer(device, sizeof(View2D),
+		BUFFER_USAGE_UNIFORM | BUFFER_USAGE_COPY_DST, 0);
+
+	// Static quad indices
+	uint64_t index_bytes = (uint64_t)b->max_quads * 6 * sizeof(uint32_t);
+	b->index_buffer = void_gpu_create_buffer(device, index_bytes,
+		BUFFER_USAGE_INDEX | BUFFER_USAGE_COPY_DST, 0);
+	uint32_t *indices = malloc(index_bytes);
+	for (uint32_t q = 0; q < b->max_quads; q++) {
+		uint32_t v = q * 4;
+		uint32_t *i = indices + q * 6;
+		i[0] = v; i[1] = v + 1; i[2] = v + 2;
+		i[3] = v; i[4] = v + 2; i[5] = v + 3;
+	}
+	void *queue = void_gpu_get_queue(device);
+	void_gpu_queue_write_buffer(queue, b->index_buffer, 0, indices, index_bytes);
+	void_gpu_release_queue(queue);
+	free(indices);
+
+	void *lb = void_gpu_layout_begin();
+	void_gpu_layout_buffer(lb, 0, STAGE_VERTEX, BINDING_UNIFORM, sizeof(View2D), 0);
+	b->view_layout = void_gpu_layout_finish(device, lb);
+	b->pipeline_layout = void_gpu_cached_pipeline_layout_2(device, b->view_layout, b->atlas->layout);
+	void *g = void_gpu_group_begin(b->view_layout);
+	void_gpu_group_buffer(g, 0, b->uniform_buffer, 0, 0);
+	b->view_group = void_gpu_group_finish(device, g);
+
+	b->shader = void_gpu_create_shader(device, s_batch_wgsl);
+	VoidRenderPipelineDesc d = {0};
+	d.shader = b->shader;
+	d.vs_entry = "vs_main";
+	d.fs_entry = "fs_main";
+	d.layout = b->pipeline_layout;
+	d.stride = sizeof(Vertex2D);
+	d.attr_count = 3;
+	d.attrs[0] = (VoidVertexAttr){ VFMT_FLOAT32X2, 0, 0 };
+	d.attrs[1] = (VoidVertexAttr){ VFMT_FLOAT32X2, 8, 1 };
+	d.attrs[2] = (VoidVertexAttr){ VFMT_UNORM8X4, 16, 2 };
+	d.color_format = color_format;
+	d.sample_count = samples;
+	d.has_blend = 1;
+	d.blend_color_src = BLEND_SRC_ALPHA;
+	d.blend_color_dst = BLEND_ONE_MINUS_SRC_ALPHA;
+	d.blend_color_op = BLEND_OP_ADD;
+	d.blend_alpha_src = BLEND_ONE;
+	d.blend_alpha_dst = BLEND_ONE_MINUS_SRC_ALPHA;
+	d.blend_alpha_op = BLEND_OP_ADD;
+	b->pipeline = void_gpu_create_render_pipeline_desc(device, &d);
+	return b;
+}
+
+void void_batch2d_destroy(void *batch) {
+	Batch *b = (Batch *)batch;
+	if (!b) return;
+	void_gpu_release_pipeline(b->pipeline);
+	void_gpu_release_shader(b->shader);
+	void_gpu_cache_release(b->view_group);
+	void_gpu_cache_release(b->pipeline_layout);
+	void_gpu_cache_release(b->view_layout);
+	void_gpu_release_buffer(b->uniform_buffer);
+	void_gpu_release_buffer(b->index_buffer);
+	void_gpu_release_buffer(b->vertex_buffer);
+	free(b->runs);
+	free(b->vertices);
+	free(b);
+}
+
+void void_batch2d_begin(void *batch, uint32_t width, uint32_t height) {
+	Batch *b = (Batch *)batch;
+	b->quad_count = 0;
+	b->flushed = 0;
+	b->run_count = 0;
+	b->first_run = 0;
+	b->draws = 0;
+	b->dropped = 0;
+	memset(b->scissor, 0, sizeof(b->scissor));
+	b->clip_all = 0;
+	if (width != b->width || height != b->height) {
+		b->width = width;
+		b->height = height;
+		b->view.size[0] = (float)(width ? width : 1);
+		b->view.size[1] = (float)(height ? height : 1);
+		b->view_dirty = 1;
+	}
+}
+
+void void_batch2d_scissor(void *batch, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+	Batch *b = (Batch *)batch;
+	if (width == 0 || height == 0) {
+		memset(b->scissor, 0, sizeof(b->scissor));
+		b->clip_all = 0;
+		return;
+	}
+	// Clamped to the target (WebGPU rejects scissors outside the attachment)
+	if (x > b->width) x = b->width;
+	if (y > b->height) y = b->height;
+	if (width > b->width - x) width = b->width - x;
+	if (height > b->height - y) height = b->height - y;
+	b->scissor[0] = x;
+	b->scissor[1] = y;
+	b->scissor[2] = width;
+	b->scissor[3] = height;
+	// Clipped away entirely: skip the sprites rather than turning clipping off
+	b->clip_all = width == 0 || height == 0;
+}
+
+// Next quad's 4 vertices (NULL when clipped or the frame is full), extending or
+// starting a run
+static Vertex2D *push_quad(Batch *b, uint32_t page) {
+	if (b->clip_all) return NULL;
+	if (b->quad_count >= b->max_quads) {
+		if (b->dropped++ == 0) {
+			fprintf(stderr, "void_batch2d: more than %u sprites this frame, dropping\n", b->max_quads);
+		}
+		return NULL;
+	}
+	Run *last = b->run_count > b->first_run ? &b->runs[b->run_count - 1] : NULL;
+	if (!last || last->page != page || memcmp(last->scissor, b->scissor, sizeof(b->scissor)) != 0) {
+		if (b->run_count >= b->run_capacity) {
+			b->run_capacity *= 2;
+			b->runs = realloc(b->runs, b->run_capacity * sizeof(Run));
+		}
+		last = &b->runs[b->run_count++];
+		last->page = page;
+		last->first = b->quad_count;
+		last->count = 0;
+		memcpy(last->scissor, b->scissor, sizeof(b->scissor));
+	}
+	last->count++;
+	return &b->vertices[(size_t)b->quad_count++ * 4];
+}
+
+static inline uint32_t pack_color(uint32_t rgba) {
+	// 0xRRGGBBAA -> bytes r, g, b, a in memory (Unorm8x4)
+	return (rgba >> 24) | ((rgba >> 8) & 0xFF00u) | ((rgba << 8) & 0xFF0000u) | (rgba << 24);
+}
+
+static void write_quad(Vertex2D *v, const float *xs, const float *ys,
+	float u0, float v0, float u1, float v1, uint32_t color
+) {
+	uint32_t c = pack_color(color);
+	const float us[4] = { u0, u1, u1, u0 };
+	const float vs[4] = { v0, v0, v1, v1 };
+	for (int i = 0; i < 4; i++) {
+		v[i].pos[0] = xs[i];
+		v[i].pos[1] = ys[i];
+		v[i].uv[0] = us[i];
+		v[i].uv[1] = vs[i];
+		v[i].color = c;
+	}
+}
+
+void void_batch2d_sprite_part(void *batch, uint32_t sprite,
+	float u0, float v0, float u1, float v1,
+	float x, float y, float width, float height, uint32_t color
+) {
+	Batch *b = (Batch *)batch;
+	if (sprite >= b->atlas->sprite_count) return;
+	const AtlasSprite *s = &b->atlas->sprites[sprite];
+	Vertex2D *v = push_quad(b, s->page);
+	if (!v) return;
+	float du = s->u1 - s->u0, dv = s->v1 - s->v0;
+	const float xs[4] = { x, x + width, x + width, x };
+	const float ys[4] = { y, y, y + height, y + height };
+	write_quad(v, xs, ys, s->u0 + u0 * du, s->v0 + v0 * dv, s->u0 + u1 * du, s->v0 + v1 * dv, color);
+}
+
+void void_batch2d_sprite(void *batch, uint32_t sprite,
+	float x, float y, float width, float height, uint32_t color
+) {
+	void_batch2d_sprite_part(batch, sprite, 0.0f, 0.0f, 1.0f, 1.0f, x, y, width, height, color);
+}
+
+void void_batch2d_sprite_ex(void *batch, uint32_t sprite,
+	float x, float y, float width, float height,
+	float origin_x, float origin_y, float rotation, uint32_t color
+) {
+	Batch *b = (Batch *)batch;
+	if (sprite >= b->atlas->sprite_count) return;
+	const AtlasSprite *s = &b->atlas->sprites[sprite];
+	Vertex2D *v = push_quad(b, s->page);
+	if (!v) return;
+	// Corners relative to the origin, rotated, then placed at (x, y)
+	float c = cosf(rotation), sn = sinf(rotation);
+	float left = -origin_x * width, top = -origin_y * height;
+	const float lx[4] = { left, left + width, left + width, left };
+	const float ly[4] = { top, top, top + height, top + height };
+	float xs[4], ys[4];
+	for (int i = 0; i < 4; i++) {
+		xs[i] = x + lx[i] * c - ly[i] * sn;
+		ys[i] = y + lx[i] * sn + ly[i] * c;
+	}
+	write_quad(v, xs, ys, s->u0, s->v0, s->u1, s->v1, color);
+}
+
+void void_batch2d_rect(void *batch, float x, float y, float width, float height, uint32_t color) {
+	Batch *b = (Batch *)batch;
+	void_batch2d_sprite(batch, b->atlas->white, x, y, width, height, color);
+}
+
+void void_batch2d_flush(void *batch, void *queue, void *render_pass) {
+	Batch *b = (Batch *)batch;
+	if (b->first_run >= b->run_count) return;
+
+	if (b->view_dirty) {
+		void_gpu_queue_write_buffer(queue, b->uniform_buffer, 0, &b->view, sizeof(b->view));
+		b->view_dirty = 0;
+	}
+	// Appended after earlier flushes, so their passes keep their vertices
+	uint32_t count = b->quad_count - b->flushed;
+	void_gpu_queue_write_buffer(queue, b->vertex_buffer,
+		(uint64_t)b->flushed * 4 * sizeof(Vertex2D),
+		&b->vertices[(size_t)b->flushed * 4], (uint64_t)count * 4 * sizeof(Vertex2D));
+	b->flushed = b->quad_count;
+
+	void_gpu_render_pass_set_pipeline(render_pass, b->pipeline);
+	void_gpu_render_pass_set_bind_group(render_pass, 0, b->view_group);
+	void_gpu_render_pass_set_vertex_buffer(render_pass, 0, b->vertex_buffer, 0,
+		(uint64_t)b->max_quads * 4 * sizeof(Vertex2D));
+	void_gpu_render_pass_set_index_buffer(render_pass, b->index_buffer, INDEX_UINT32, 0, 0);
+
+	uint32_t page = VOID_DRAW2D_NONE;
+	int clipped = 0;
+	for (uint32_t r = b->first_run; r < b->run_count; r++) {
+		const Run *run = &b->runs[r];
+		if (run->page != page) {
+			void_gpu_render_pass_set_bind_group(render_pass, 1, b->atlas->pages[run->page].group);
+			page = run->page;
+		}
+		if (run->scissor[2]) {
+			void_gpu_render_pass_set_scissor_rect(render_pass,
+				run->scissor[0], run->scissor[1], run->scissor[2], run->scissor[3]);
+			clipped = 1;
+		} else if (clipped) {
+			void_gpu_render_pass_set_scissor_rect(render_pass, 0, 0, b->width, b->height);
+			clipped = 0;
+		}
+		void_gpu_render_pass_draw_indexed(render_pass, run->count * 6, 1, run->first * 6, 0, 0);
+		b->draws++;
+	}
+	if (clipped) void_gpu_render_pass_set_scissor_rect(render_pass, 0, 0, b->width, b->height);
+	b->first_run = b->run_count;
+}
+
+uint32_t void_batch2d_sprite_count(void *batch) {
+	return ((Batch *)batch)->quad_count;
+}
+
+uint32_t void_batch2d_draw_count(void *batch) {
+	return ((Batch *)batch)->draws;
+}
+
+uint32_t void_batch2d_dropped(void *batch) {
+	return ((Batch *)batch)->dropped;
+}
@@ -0,0 +1,64 @@
+// Void Render — Batched 2D sprites with runtime atlases
+// Atlas: RGBA8 images are packed into shared pages (skyline bottom-left
+// packer, edges extruded by one pixel so bilinear filtering never bleeds)
+// and referenced by sprite id. Page 0 always holds a white pixel for solid
+// rectangles.
+// Batch: sprites are written as quads into one CPU array; flush() uploads
+// the new ones into a vertex buffer reused every frame (each flush appends
+// after the previous one) and draws them with one indexed draw per run of
+// sprites sharing an atlas page and scissor rectangle.
+//
+// Per frame: begin(target size) → sprite/rect/scissor calls → flush() in a
+// render pass (any number of times) → next begin.
+// Coordinates are pixels, origin top-left. Colors are 0xRRGGBBAA.
+
+#ifndef VOID_RENDER_DRAW2D_H
+#define VOID_RENDER_DRAW2D_H
+
+#include <stdint.h>
+
+#define VOID_DRAW2D_MAX_PAGES 8
+#define VOID_DRAW2D_NONE      0xFFFFFFFFu
+
+// --- Atlas ---
+void *void_atlas_create(void *device, uint32_t page_size);
+void  void_atlas_destroy(void *atlas);
+// Pack a width x height RGBA8 image (tightly packed rows); returns its
+// sprite id, or VOID_DRAW2D_NONE when it cannot fit in any page.
+uint32_t void_atlas_add(void *atlas, void *queue, const void *rgba, uint32_t width, uint32_t height);
+uint32_t void_atlas_white(void *atlas);
+uint32_t void_atlas_sprite_width(void *atlas, uint32_t sprite);
+uint32_t void_atlas_sprite_height(void *atlas, uint32_t sprite);
+uint32_t void_atlas_page_count(void *atlas);
+// Packed area / page area over all pages
+float    void_atlas_occupancy(void *atlas);
+
+// --- Batch ---
+// color_format / samples: the pass flush() records into. max_sprites per frame.
+void *void_batch2d_create(void *device, void *atlas, uint32_t color_format,
+    uint32_t samples, uint32_t max_sprites);
+void  void_batch2d_destroy(void *batch);
+
+void void_batch2d_begin(void *batch, uint32_t width, uint32_t height);
+// Clip following sprites to a rectangle; width or height 0 turns clipping off
+void void_batch2d_scissor(void *batch, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+void void_batch2d_sprite(void *batch, uint32_t sprite,
+    float x, float y, float width, float height, uint32_t color);
+// Rotated (radians) around origin (0..1 of the quad, 0.5 = center)
+void void_batch2d_sprite_ex(void *batch, uint32_t sprite,
+    float x, float y, float width, float height,
+    float origin_x, float origin_y, float rotation, uint32_t color);
+// Part of a sprite: u0..u1, v0..v1 in 0..1 of the sprite (tiles, glyphs)
+void void_batch2d_sprite_part(void *batch, uint32_t sprite,
+    float u0, float v0, float u1, float v1,
+    float x, float y, float width, float height, uint32_t color);
+void void_batch2d_rect(void *batch, float x, float y, float width, float height, uint32_t color);
+// Upload and draw everything added since the last flush
+void void_batch2d_flush(void *batch, void *queue, void *render_pass);
+
+// Stats of the current frame
+uint32_t void_batch2d_sprite_count(void *batch);
+uint32_t void_batch2d_draw_count(void *batch);
+uint32_t void_batch2d_dropped(void *batch);   // sprites over max_sprites
+
+#endif
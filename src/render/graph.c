@@ -0,0 +1,689 @@
+// Void Render — Frame render graph with pooled transient attachments
+
+#include "graph.h"
+#include "../gpu/dawn.h"
+#include "../gpu/enums.h"
+#include "../gpu/timer.h"
+#include "../gpu/memory.h"
+#include "../core/trace.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Pass dependencies are bit sets
+_Static_assert(VOID_GRAPH_MAX_PASSES <= 64, "VOID_GRAPH_MAX_PASSES");
+
+// --- Types ---
+
+typedef struct Resource {
+	char     name[32];
+	int      imported;
+	void    *view;           // imported view, or pool view after compile
+	uint32_t width;
+	uint32_t height;
+	uint32_t format;
+	uint32_t usage;
+	uint32_t samples;
+	int      memoryless;     // only cleared, rendered and discarded
+	uint32_t first;          // first/last live-order index that touches it
+	uint32_t last;
+} Resource;
+
+typedef struct Attachment {
+	uint32_t resource;
+	uint32_t resolve;        // VOID_GRAPH_NONE = no resolve
+	int      clear;
+	int      store;
+	double   clear_value[4];
+} Attachment;
+
+typedef struct Pass {
+	char       name[32];
+	uint32_t   color_count;
+	Attachment colors[VOID_GPU_MAX_COLOR_ATTACHMENTS];
+	Attachment depth;        // resource = VOID_GRAPH_NONE if absent
+	int        depth_read_only;
+	uint32_t   read_count;
+	uint32_t   reads[VOID_GRAPH_MAX_READS];
+	uint32_t   write_count;  // storage writes (compute passes)
+	uint32_t   writes[VOID_GRAPH_MAX_WRITES];
+	uint64_t   after;        // explicit predecessors (bit per pass index)
+	int        side_effect;
+	int        compute;      // compute pass: no attachments, never culled
+	int        live;
+	uint32_t   viewport_w;   // 0 = whole attachment
+	uint32_t   viewport_h;
+} Pass;
+
+typedef struct PoolTexture {
+	void    *texture;
+	void    *view;
+	uint32_t width;
+	uint32_t height;
+	uint32_t format;
+	uint32_t usage;
+	uint32_t samples;
+	uint64_t last_frame;     // last frame it was bound
+	uint32_t busy_until;     // live-order index of its current owner's last use
+} PoolTexture;
+
+typedef struct RenderGraph {
+	uint32_t width;
+	uint32_t height;
+	uint64_t frame;
+
+	Resource resources[VOID_GRAPH_MAX_RESOURCES];
+	uint32_t resource_count;
+	Pass     passes[VOID_GRAPH_MAX_PASSES];
+	uint32_t pass_count;
+
+	uint32_t sorted[VOID_GRAPH_MAX_PASSES]; // every pass, dependency order
+	uint32_t order[VOID_GRAPH_MAX_PASSES];  // live passes, execution order
+	uint32_t live_count;
+	uint32_t memoryless_count;
+
+	PoolTexture *pool;
+	uint32_t     pool_count;
+	uint32_t     pool_cap;
+
+	void    *encoder;
+	void    *current;        // open render or compute pass encoder
+	int      current_compute;
+	uint32_t cursor;
+	void    *timer;          // src/gpu/timer, NULL = passes untimed
+} RenderGraph;
+
+static void copy_name(char *dst, const char *src) {
+	if (!src) src = "";
+	strncpy(dst, src, 31);
+	dst[31] = '\0';
+}
+
+// --- Lifecycle ---
+
+void *void_graph_create(void) {
+	RenderGraph *g = calloc(1, sizeof(RenderGraph));
+	return g;
+}
+
+static void pool_release(PoolTexture *t) {
+	void_gpu_release_texture_view(t->view);
+	void_gpu_release_texture(t->texture);
+}
+
+void void_graph_destroy(void *graph) {
+	RenderGraph *g = (RenderGraph *)graph;
+	if (!g) return;
+	for (uint32_t i = 0; i < g->pool_count; i++) pool_release(&g->pool[i]);
+	free(g->pool);
+	free(g);
+}
+
+void void_graph_begin(void *graph, uint32_t width, uint32_t height) {
+	RenderGraph *g = (RenderGraph *)graph;
+	g->width = width;
+	g->height = height;
+	g->frame++;
+	g->resource_count = 0;
+	g->pass_count = 0;
+	g->live_count = 0;
+	g->encoder = NULL;
+	g->current = NULL;
+	g->current_compute = 0;
+	g->cursor = 0;
+}
+
+// --- Resources ---
+
+static Resource *new_resource(RenderGraph *g, const char *name, uint32_t *id) {
+	if (g->resource_count >= VOID_GRAPH_MAX_RESOURCES) {
+		fprintf(stderr, "void_graph: too many resources (%s)\n", name ? name : "");
+		*id = VOID_GRAPH_NONE;
+		return NULL;
+	}
+	*id = g->resource_count++;
+	Resource *r = &g->resources[*id];
+	memset(r, 0, sizeof(*r));
+	copy_name(r->name, name);
+	r->first = VOID_GRAPH_NONE;
+	r->last = VOID_GRAPH_NONE;
+	return r;
+}
+
+uint32_t void_graph_import(void *graph, void *view) {
+	uint32_t id;
+	Resource *r = new_resource((RenderGraph *)graph, "imported", &id);
+	if (!r) return id;
+	r->imported = 1;
+	r->view = view;
+	return id;
+}
+
+uint32_t void_graph_texture_ms(void *graph, const char *name,
+	uint32_t width, uint32_t height, uint32_t format, uint32_t usage, uint32_t samples
+) {
+	RenderGraph *g = (RenderGraph *)graph;
+	uint32_t id;
+	Resource *r = new_resource(g, name, &id);
+	if (!r) return id;
+	r->width = width ? width : g->width;
+	r->height = height ? height : g->height;
+	r->format = format;
+	r->usage = usage | TEXTURE_USAGE_RENDER_ATTACHMENT | TEXTURE_USAGE_TEXTURE_BINDING;
+	r->samples = samples ? samples : 1;
+	return id;
+}
+
+uint32_t void_graph_texture(void *graph, const char *name,
+	uint32_t width, uint32_t height, uint32_t format, uint32_t usage
+) {
+	return void_graph_texture_ms(graph, name, width, height, format, usage, 1);
+}
+
+// --- Passes ---
+
+static Pass *get_pass(RenderGraph *g, uint32_t pass) {
+	return pass < g->pass_count ? &g->passes[pass] : NULL;
+}
+
+static int valid_resource(RenderGraph *g, uint32_t resource) {
+	return resource < g->resource_count;
+}
+
+uint32_t void_graph_add_pass(void *graph, const char *name) {
+	RenderGraph *g = (RenderGraph *)graph;
+	if (g->pass_count >= VOID_GRAPH_MAX_PASSES) {
+		fprintf(stderr, "void_graph: too many passes (%s)\n", name ? name : "");
+		return VOID_GRAPH_NONE;
+	}
+	uint32_t id = g->pass_count++;
+	Pass *p = &g->passes[id];
+	memset(p, 0, sizeof(*p));
+	copy_name(p->name, name);
+	p->depth.resource = VOID_GRAPH_NONE;
+	return id;
+}
+
+uint32_t void_graph_add_compute_pass(void *graph, const char *name) {
+	RenderGraph *g = (RenderGraph *)graph;
+	uint32_t id = void_graph_add_pass(g, name);
+	if (id == VOID_GRAPH_NONE) return id;
+	g->passes[id].compute = 1;
+	g->passes[id].side_effect = 1;  // writes buffers the graph does not track
+	return id;
+}
+
+void void_graph_pass_color(void *graph, uint32_t pass, uint32_t resource,
+	int clear, double r, double g_, double b, double a
+) {
+	RenderGraph *g = (RenderGraph *)graph;
+	Pass *p = get_pass(g, pass);
+	if (!p || p->compute || !valid_resource(g, resource) || p->color_count >= VOID_GPU_MAX_COLOR_ATTACHMENTS) return;
+	Attachment *att = &p->colors[p->color_count++];
+	att->resource = resource;
+	att->resolve = VOID_GRAPH_NONE;
+	att->clear = clear;
+	att->clear_value[0] = r;
+	att->clear_value[1] = g_;
+	att->clear_value[2] = b;
+	att->clear_value[3] = a;
+}
+
+void void_graph_pass_resolve(void *graph, uint32_t pass, uint32_t resource, uint32_t target) {
+	RenderGraph *g = (RenderGraph *)graph;
+	Pass *p = get_pass(g, pass);
+	if (!p || !valid_resource(g, target)) return;
+	for (uint32_t c = 0; c < p->color_count; c++) {
+		if (p->colors[c].resource == resource) {
+			p->colors[c].resolve = target;
+			return;
+		}
+	}
+	fprintf(stderr, "void_graph: pass %s resolves %s, which it does not render to\n",
+		p->name, valid_resource(g, resource) ? g->resources[resource].name : "?");
+}
+
+void void_graph_pass_depth(void *graph, uint32_t pass, uint32_t resource,
+	int clear, float clear_value
+) {
+	RenderGraph *g = (RenderGraph *)graph;
+	Pass *p = get_pass(g, pass);
+	if (!p || p->compute || !valid_resource(g, resource)) return;
+	p->depth.resource = resource;
+	p->depth.clear = clear;
+	p->depth.clear_value[0] = clear_value;
+	p->depth_read_only = 0;
+}
+
+void void_graph_pass_depth_read(void *graph, uint32_t pass, uint32_t resource) {
+	RenderGraph *g = (RenderGraph *)graph;
+	Pass *p = get_pass(g, pass);
+	if (!p || p->compute || !valid_resource(g, resource)) return;
+	p->depth.resource = resource;
+	p->depth.clear = 0;
+	p->depth_read_only = 1;
+}
+
+void void_graph_pass_read(void *graph, uint32_t pass, uint32_t resource) {
+	RenderGraph *g = (RenderGraph *)graph;
+	Pass *p = get_pass(g, pass);
+	if (!p || !valid_resource(g, resource) || p->read_count >= VOID_GRAPH_MAX_READS) return;
+	p->reads[p->read_count++] = resource;
+}
+
+void void_graph_pass_write(void *graph, uint32_t pass, uint32_t resource) {
+	RenderGraph *g = (RenderGraph *)graph;
+	Pass *p = get_pass(g, pass);
+	if (!p || !p->compute || !valid_resource(g, resource) || p->write_count >= VOID_GRAPH_MAX_WRITES) return;
+	p->writes[p->write_count++] = resource;
+}
+
+void void_graph_pass_after(void *graph, uint32_t pass, uint32_t before) {
+	RenderGraph *g = (RenderGraph *)graph;
+	Pass *p = get_pass(g, pass);
+	if (!p || !get_pass(g, before) || before == pass) return;
+	p->after |= 1ull << before;
+}
+
+void void_graph_pass_side_effect(void *graph, uint32_t pass) {
+	Pass *p = get_pass((RenderGraph *)graph, pass);
+	if (p) p->side_effect = 1;
+}
+
+void void_graph_pass_viewport(void *graph, uint32_t pass, uint32_t width, uint32_t height) {
+	Pass *p = get_pass((RenderGraph *)graph, pass);
+	if (!p) return;
+	p->viewport_w = width;
+	p->viewport_h = height;
+}
+
+void void_graph_set_timer(void *graph, void *timer) {
+	((RenderGraph *)graph)->timer = timer;
+}
+
+// --- Compile ---
+
+static int pass_writes(const Pass *p, uint32_t resource) {
+	for (uint32_t c = 0; c < p->color_count; c++) {
+		if (p->colors[c].resource == resource || p->colors[c].resolve == resource) return 1;
+	}
+	if (p->depth.resource == resource && !p->depth_read_only) return 1;
+	for (uint32_t w = 0; w < p->write_count; w++) {
+		if (p->writes[w] == resource) return 1;
+	}
+	return 0;
+}
+
+static int pass_reads(const Pass *p, uint32_t resource) {
+	for (uint32_t r = 0; r < p->read_count; r++) {
+		if (p->reads[r] == resource) return 1;
+	}
+	return p->depth.resource == resource && p->depth_read_only;
+}
+
+// Order every pass by its declared reads and writes: a resource's writers
+// run in declaration order and its readers after all of them. Among passes
+// that are ready at the same time the earliest declared runs first, so a
+// graph declared in a valid order keeps it. Passes caught in a cycle are
+// reported and appended in declaration order.
+static void sort_passes(RenderGraph *g) {
+	uint64_t deps[VOID_GRAPH_MAX_PASSES];
+	for (uint32_t i = 0; i < g->pass_count; i++) deps[i] = g->passes[i].after;
+
+	for (uint32_t rid = 0; rid < g->resource_count; rid++) {
+		uint64_t writers = 0;
+		for (uint32_t i = 0; i < g->pass_count; i++) {
+			const Pass *p = &g->passes[i];
+			if (pass_writes(p, rid)) {
+				deps[i] |= writers;
+				writers |= 1ull << i;
+			}
+		}
+		if (!writers) continue;
+		for (uint32_t i = 0; i < g->pass_count; i++) {
+			const Pass *p = &g->passes[i];
+			if (!pass_writes(p, rid) && pass_reads(p, rid)) deps[i] |= writers;
+		}
+	}
+
+	uint64_t done = 0;
+	uint32_t count = 0;
+	while (count < g->pass_count) {
+		uint32_t next = VOID_GRAPH_NONE;
+		for (uint32_t i = 0; i < g->pass_count && next == VOID_GRAPH_NONE; i++) {
+			if (!(done & (1ull << i)) && !(deps[i] & ~done)) next = i;
+		}
+		if (next == VOID_GRAPH_NONE) break;
+		done |= 1ull << next;
+		g->sorted[count++] = next;
+	}
+	if (count == g->pass_count) return;
+
+	fprintf(stderr, "void_graph: dependency cycle between passes:");
+	for (uint32_t i = 0; i < g->pass_count; i++) {
+		if (done & (1ull << i)) continue;
+		fprintf(stderr, " %s", g->passes[i].name);
+		g->sorted[count++] = i;
+	}
+	fprintf(stderr, "\n");
+}
+
+// Walk passes backwards (in sorted order) tracking which resources a later
+// live pass still needs. A pass lives if it produces something needed (or is a root); its
+// attachments store only if their content is needed afterwards.
+static void cull(RenderGraph *g) {
+	uint8_t needed[VOID_GRAPH_MAX_RESOURCES] = {0};
+
+	for (uint32_t k = g->pass_count; k-- > 0;) {
+		Pass *p = &g->passes[g->sorted[k]];
+		int live = p->side_effect;
+		for (uint32_t c = 0; c < p->color_count; c++) {
+			const Resource *r = &g->resources[p->colors[c].resource];
+			if (r->imported || needed[p->colors[c].resource]) live = 1;
+			uint32_t t = p->colors[c].resolve;
+			if (t != VOID_GRAPH_NONE && (g->resources[t].imported || needed[t])) live = 1;
+		}
+		if (p->depth.resource != VOID_GRAPH_NONE && !p->depth_read_only) {
+			const Resource *r = &g->resources[p->depth.resource];
+			if (r->imported || needed[p->depth.resource]) live = 1;
+		}
+		for (uint32_t w = 0; w < p->write_count; w++) {
+			if (g->resources[p->writes[w]].imported || needed[p->writes[w]]) live = 1;
+		}
+		p->live = live;
+		if (!live) continue;
+
+		for (uint32_t w = 0; w < p->write_count; w++) needed[p->writes[w]] = 0;
+
+		for (uint32_t c = 0; c < p->color_count; c++) {
+			Attachment *a = &p->colors[c];
+			a->store = g->resources[a->resource].imported || needed[a->resource];
+			needed[a->resource] = a->clear ? 0 : 1;
+			if (a->resolve != VOID_GRAPH_NONE) needed[a->resolve] = 0;  // fully overwritten
+		}
+		if (p->depth.resource != VOID_GRAPH_NONE) {
+			Attachment *a = &p->depth;
+			if (p->depth_read_only) {
+				needed[a->resource] = 1;
+			} else {
+				a->store = g->resources[a->resource].imported || needed[a->resource];
+				needed[a->resource] = a->clear ? 0 : 1;
+			}
+		}
+		for (uint32_t r = 0; r < p->read_count; r++) needed[p->reads[r]] = 1;
+	}
+}
+
+static void touch(Resource *r, uint32_t index) {
+	if (r->first == VOID_GRAPH_NONE) r->first = index;
+	r->last = index;
+}
+
+// Forward walk: execution order, lifetimes, and clear-instead-of-load for
+// first writes of transient content.
+static void schedule(RenderGraph *g) {
+	uint8_t written[VOID_GRAPH_MAX_RESOURCES] = {0};
+	for (uint32_t r = 0; r < g->resource_count; r++) written[r] = (uint8_t)g->resources[r].imported;
+
+	g->live_count = 0;
+	for (uint32_t k = 0; k < g->pass_count; k++) {
+		uint32_t i = g->sorted[k];
+		Pass *p = &g->passes[i];
+		if (!p->live) continue;
+		uint32_t index = g->live_count++;
+		g->order[index] = i;
+
+		for (uint32_t r = 0; r < p->read_count; r++) {
+			if (!written[p->reads[r]]) {
+				fprintf(stderr, "void_graph: pass %s reads %s, which no live pass writes\n",
+					p->name, g->resources[p->reads[r]].name);
+			}
+			touch(&g->resources[p->reads[r]], index);
+		}
+		for (uint32_t w = 0; w < p->write_count; w++) {
+			written[p->writes[w]] = 1;
+			touch(&g->resources[p->writes[w]], index);
+		}
+		for (uint32_t c = 0; c < p->color_count; c++) {
+			Attachment *a = &p->colors[c];
+			if (!a->clear && !written[a->resource]) {
+				a->clear = 1;
+				memset(a->clear_value, 0, sizeof(a->clear_value));
+			}
+			written[a->resource] = 1;
+			touch(&g->resources[a->resource], index);
+			if (a->resolve != VOID_GRAPH_NONE) {
+				written[a->resolve] = 1;
+				touch(&g->resources[a->resolve], index);
+			}
+		}
+		if (p->depth.resource != VOID_GRAPH_NONE) {
+			Attachment *a = &p->depth;
+			if (!p->depth_read_only && !a->clear && !written[a->resource]) {
+				a->clear = 1;
+				a->clear_value[0] = 1.0;
+			}
+			written[a->resource] = 1;
+			touch(&g->resources[a->resource], index);
+		}
+	}
+}
+
+// A transient that every live use clears and discards never needs backing
+// memory: tiled GPUs keep it in tile memory for the length of the pass.
+static void mark_memoryless(RenderGraph *g, int supported) {
+	uint8_t ok[VOID_GRAPH_MAX_RESOURCES];
+	memset(ok, supported ? 1 : 0, sizeof(ok));
+
+	for (uint32_t index = 0; index < g->live_count; index++) {
+		const Pass *p = &g->passes[g->order[index]];
+		for (uint32_t r = 0; r < p->read_count; r++) ok[p->reads[r]] = 0;
+		for (uint32_t w = 0; w < p->write_count; w++) ok[p->writes[w]] = 0;
+		for (uint32_t c = 0; c < p->color_count; c++) {
+			const Attachment *a = &p->colors[c];
+			if (!a->clear || a->store) ok[a->resource] = 0;
+			if (a->resolve != VOID_GRAPH_NONE) ok[a->resolve] = 0;
+		}
+		if (p->depth.resource != VOID_GRAPH_NONE) {
+			if (p->depth_read_only || !p->depth.clear || p->depth.store) ok[p->depth.resource] = 0;
+		}
+	}
+
+	g->memoryless_count = 0;
+	for (uint32_t rid = 0; rid < g->resource_count; rid++) {
+		Resource *r = &g->resources[rid];
+		r->memoryless = !r->imported && r->first != VOID_GRAPH_NONE && ok[rid];
+		if (r->memoryless) g->memoryless_count++;
+	}
+}
+
+// Bind each live transient to a pool texture whose current owner's lifetime
+// has ended, creating textures only when nothing compatible is free.
+static void allocate(RenderGraph *g, void *device) {
+	for (uint32_t t = 0; t < g->pool_count; t++) g->pool[t].busy_until = VOID_GRAPH_NONE;
+
+	for (uint32_t index = 0; index < g->live_count; index++) {
+		for (uint32_t rid = 0; rid < g->resource_count; rid++) {
+			Resource *r = &g->resources[rid];
+			if (r->imported || r->first != index) continue;
+
+			// Memoryless textures allow no other usage
+			uint32_t usage = r->memoryless
+				? TEXTURE_USAGE_RENDER_ATTACHMENT | TEXTURE_USAGE_TRANSIENT_ATTACHMENT : r->usage;
+
+			PoolTexture *slot = NULL;
+			for (uint32_t t = 0; t < g->pool_count; t++) {
+				PoolTexture *pt = &g->pool[t];
+				int free_now = pt->busy_until == VOID_GRAPH_NONE || pt->busy_until < index;
+				if (free_now && pt->width == r->width && pt->height == r->height &&
+					pt->format == r->format && pt->usage == usage && pt->samples == r->samples) {
+					slot = pt;
+					break;
+				}
+			}
+			if (!slot) {
+				if (g->pool_count == g->pool_cap) {
+					g->pool_cap = g->pool_cap ? g->pool_cap * 2 : 8;
+					g->pool = realloc(g->pool, g->pool_cap * sizeof(PoolTexture));
+				}
+				slot = &g->pool[g->pool_count++];
+				slot->texture = void_gpu_create_texture_ms(device, r->width, r->height, r->format, usage, r->samples);
+				slot->view = void_gpu_create_texture_view(slot->texture);
+				slot->width = r->width;
+				slot->height = r->height;
+				slot->format = r->format;
+				slot->usage = usage;
+				slot->samples = r->samples;
+			}
+			slot->busy_until = r->last;
+			slot->last_frame = g->frame;
+			r->view = slot->view;
+		}
+	}
+
+	// Age out textures no frame has used recently (old sizes after a resize)
+	uint32_t t = 0;
+	while (t < g->pool_count) {
+		if (g->frame - g->pool[t].last_frame > VOID_GRAPH_KEEP_FRAMES) {
+			pool_release(&g->pool[t]);
+			g->pool[t] = g->pool[--g->pool_count];
+		} else {
+			t++;
+		}
+	}
+}
+
+void void_graph_compile(void *graph, void *device) {
+	RenderGraph *g = (RenderGraph *)graph;
+	for (uint32_t r = 0; r < g->resource_count; r++) {
+		Resource *res = &g->resources[r];
+		res->first = VOID_GRAPH_NONE;
+		res->last = VOID_GRAPH_NONE;
+		if (!res->imported) res->view = NULL;
+	}
+	sort_passes(g);
+	cull(g);
+	schedule(g);
+	mark_memoryless(g, void_gpu_device_has_transient_attachments(device));
+	allocate(g, device);
+}
+
+void *void_graph_view(void *graph, uint32_t resource) {
+	RenderGraph *g = (RenderGraph *)graph;
+	return valid_resource(g, resource) ? g->resources[resource].view : NULL;
+}
+
+int void_graph_pass_live(void *graph, uint32_t pass) {
+	Pass *p = get_pass((RenderGraph *)graph, pass);
+	return p ? p->live : 0;
+}
+
+// --- Execute ---
+
+void void_graph_execute(void *graph, void *encoder) {
+	RenderGraph *g = (RenderGraph *)graph;
+	g->encoder = encoder;
+	g->current = NULL;
+	g->current_compute = 0;
+	g->cursor = 0;
+}
+
+uint32_t void_graph_next(void *graph) {
+	RenderGraph *g = (RenderGraph *)graph;
+	if (g->current) {
+		if (g->current_compute) void_gpu_end_compute_pass(g->current);
+		else void_gpu_end_render_pass(g->current);
+		void_gpu_encoder_pop_debug_group(g->encoder);
+		void_trace_end();
+		g->current = NULL;
+	}
+	if (g->cursor >= g->live_count) return VOID_GRAPH_NONE;
+
+	uint32_t id = g->order[g->cursor++];
+	const Pass *p = &g->passes[id];
+
+	// CPU recording zone and GPU debug group, both closed by the next call
+	void_trace_begin(p->name);
+	void_gpu_encoder_push_debug_group(g->encoder, p->name);
+
+	g->current_compute = p->compute;
+	if (p->compute) {
+		VoidComputePassDesc cd;
+		memset(&cd, 0, sizeof(cd));
+		cd.label = p->name;
+		if (g->timer) {
+			void_gpu_timer_compute_pass(g->timer, void_gpu_timer_scope(g->timer, p->name), &cd);
+		}
+		g->current = void_gpu_begin_compute_pass_desc(g->encoder, &cd);
+		return id;
+	}
+
+	VoidRenderPassDesc d;
+	memset(&d, 0, sizeof(d));
+	d.label = p->name;
+	d.color_count = p->color_count;
+	for (uint32_t c = 0; c < p->color_count; c++) {
+		const Attachment *a = &p->colors[c];
+		d.colors[c].view = g->resources[a->resource].view;
+		if (a->resolve != VOID_GRAPH_NONE) d.colors[c].resolve_target = g->resources[a->resolve].view;
+		d.colors[c].clear = a->clear;
+		d.colors[c].store = a->store;
+		d.colors[c].clear_r = a->clear_value[0];
+		d.colors[c].clear_g = a->clear_value[1];
+		d.colors[c].clear_b = a->clear_value[2];
+		d.colors[c].clear_a = a->clear_value[3];
+	}
+	if (p->depth.resource != VOID_GRAPH_NONE) {
+		d.depth_view = g->resources[p->depth.resource].view;
+		d.depth_clear = p->depth.clear;
+		d.depth_store = p->depth.store;
+		d.depth_read_only = p->depth_read_only;
+		d.depth_clear_value = (float)p->depth.clear_value[0];
+	}
+	if (g->timer) {
+		void_gpu_timer_render_pass(g->timer, void_gpu_timer_scope(g->timer, p->name), &d);
+	}
+
+	g->current = void_gpu_begin_render_pass_desc(g->encoder, &d);
+	if (p->viewport_w && p->viewport_h) {
+		void_gpu_render_pass_set_viewport(g->current, 0.0f, 0.0f,
+			(float)p->viewport_w, (float)p->viewport_h, 0.0f, 1.0f);
+		void_gpu_render_pass_set_scissor_rect(g->current, 0, 0, p->viewport_w, p->viewport_h);
+	}
+	return id;
+}
+
+void *void_graph_encoder(void *graph) {
+	return ((RenderGraph *)graph)->current;
+}
+
+// --- Statistics ---
+
+uint32_t void_graph_live_pass_count(void *graph) {
+	return ((RenderGraph *)graph)->live_count;
+}
+
+uint32_t void_graph_culled_pass_count(void *graph) {
+	RenderGraph *g = (RenderGraph *)graph;
+	return g->pass_count - g->live_count;
+}
+
+uint32_t void_graph_pool_texture_count(void *graph) {
+	return ((RenderGraph *)graph)->pool_count;
+}
+
+uint64_t void_graph_pool_bytes(void *graph) {
+	RenderGraph *g = (RenderGraph *)graph;
+	uint64_t bytes = 0;
+	for (uint32_t t = 0; t < g->pool_count; t++) {
+		const PoolTexture *pt = &g->pool[t];
+		if (pt->usage & TEXTURE_USAGE_TRANSIENT_ATTACHMENT) continue;
+		bytes += void_gpu_texture_bytes(pt->width, pt->height, 1, pt->format, 1, pt->samples);
+	}
+	return bytes;
+}
+
+uint32_t void_graph_memoryless_count(void *graph) {
+	return ((RenderGraph *)graph)->memoryless_count;
+}
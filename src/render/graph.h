@@ -0,0 +1,111 @@
+// Void Render — Frame render graph with pooled transient attachments
+// Each frame: declare resources and passes (with the attachments they write
+// and the textures they sample), compile, then walk the live passes.
+//   - Passes are sorted by the resources they declare: the passes writing a
+//     resource run in declaration order, and the passes reading it run after
+//     all of them. Independent passes keep declaration order. Buffers are
+//     not tracked, so order passes that share one with void_graph_pass_after.
+//     A cycle is reported and its passes run in declaration order.
+//   - Passes whose output nobody reads are culled (unless they write an
+//     imported texture or are marked as having side effects).
+//   - Transient textures come from a pool. Two transients with the same
+//     size/format/usage and non-overlapping lifetimes share one texture.
+//     Pool textures not used for VOID_GRAPH_KEEP_FRAMES frames are released,
+//     so a resize simply ages the old sizes out.
+//   - Load/store ops are derived from use: content that no later pass reads
+//     is discarded, and a first write that would load undefined content
+//     clears instead.
+//   - Multisampled transients resolve into a single-sample resource in the
+//     pass that renders them. A transient that is only ever cleared,
+//     rendered and discarded (typically the MSAA color and depth) uses
+//     memoryless TransientAttachment textures when the device supports them.
+//   - Compute passes have no attachments; they sample graph textures
+//     (declared with read), may write graph textures as storage (declared
+//     with write) and write buffers the graph does not track, so they are
+//     never culled.
+//   - With a GPU timer set (src/gpu/timer), every live pass is timed under
+//     its name.
+// Handles are opaque pointers; resources and passes are frame-local indices.
+
+#ifndef VOID_RENDER_GRAPH_H
+#define VOID_RENDER_GRAPH_H
+
+#include <stdint.h>
+
+#define VOID_GRAPH_MAX_PASSES     64
+#define VOID_GRAPH_MAX_RESOURCES  64
+#define VOID_GRAPH_MAX_READS      8
+#define VOID_GRAPH_MAX_WRITES     4
+#define VOID_GRAPH_KEEP_FRAMES    2
+#define VOID_GRAPH_NONE           0xFFFFFFFFu
+
+void *void_graph_create(void);
+void  void_graph_destroy(void *graph);  // releases every pooled texture
+
+// Start a new frame; width/height is the size used by 0-sized transients.
+void void_graph_begin(void *graph, uint32_t width, uint32_t height);
+
+// --- Resources ---
+// External texture view (e.g. the swapchain). Writes to it are always kept.
+uint32_t void_graph_import(void *graph, void *view);
+// Transient texture; width/height 0 = frame size. usage is extra
+// GPUTextureUsage bits on top of RenderAttachment | TextureBinding.
+uint32_t void_graph_texture(void *graph, const char *name,
+    uint32_t width, uint32_t height, uint32_t format, uint32_t usage);
+// Multisampled transient (samples = 1 or 4).
+uint32_t void_graph_texture_ms(void *graph, const char *name,
+    uint32_t width, uint32_t height, uint32_t format, uint32_t usage, uint32_t samples);
+
+// --- Passes ---
+uint32_t void_graph_add_pass(void *graph, const char *name);
+// Compute pass; void_graph_encoder returns its compute pass encoder.
+uint32_t void_graph_add_compute_pass(void *graph, const char *name);
+// Color attachment write. clear = 0 loads (and so reads) the previous content.
+void void_graph_pass_color(void *graph, uint32_t pass, uint32_t resource,
+    int clear, double r, double g, double b, double a);
+// Resolve the pass's multisampled color attachment `resource` into `target`
+// (single-sample, same format). The target is fully overwritten.
+void void_graph_pass_resolve(void *graph, uint32_t pass, uint32_t resource, uint32_t target);
+void void_graph_pass_depth(void *graph, uint32_t pass, uint32_t resource,
+    int clear, float clear_value);
+// Depth attachment used for testing only (no writes).
+void void_graph_pass_depth_read(void *graph, uint32_t pass, uint32_t resource);
+// Texture sampled by the pass.
+void void_graph_pass_read(void *graph, uint32_t pass, uint32_t resource);
+// Storage texture written by a compute pass (create it with the
+// StorageBinding usage). Counts as overwriting the previous content.
+void void_graph_pass_write(void *graph, uint32_t pass, uint32_t resource);
+// Run `pass` after `before` (dependencies the graph cannot see, e.g. a
+// buffer one pass writes and the other reads).
+void void_graph_pass_after(void *graph, uint32_t pass, uint32_t before);
+// Never cull this pass.
+void void_graph_pass_side_effect(void *graph, uint32_t pass);
+// Render into the top-left width x height of the attachments (viewport and
+// scissor), e.g. a scaled scene inside a full-size target. 0 = whole target.
+void void_graph_pass_viewport(void *graph, uint32_t pass, uint32_t width, uint32_t height);
+
+// Time every live pass with a src/gpu/timer (NULL = off). Kept across frames.
+void void_graph_set_timer(void *graph, void *timer);
+
+// --- Compile & execute ---
+// Sorts and culls passes, computes lifetimes and load/store ops, binds pool
+// textures.
+void void_graph_compile(void *graph, void *device);
+// View of a resource (valid after compile, NULL if the resource was culled).
+void *void_graph_view(void *graph, uint32_t resource);
+int void_graph_pass_live(void *graph, uint32_t pass);
+
+// Iterate the live passes: each call ends the previous pass, begins the next
+// render (or compute) pass on `encoder` and returns its index, or VOID_GRAPH_NONE.
+void void_graph_execute(void *graph, void *encoder);
+uint32_t void_graph_next(void *graph);
+void *void_graph_encoder(void *graph);  // current render / compute pass encoder
+
+// Statistics (last compile)
+uint32_t void_graph_live_pass_count(void *graph);
+uint32_t void_graph_culled_pass_count(void *graph);
+uint32_t void_graph_pool_texture_count(void *graph);
+uint64_t void_graph_pool_bytes(void *graph);       // excludes memoryless textures
+uint32_t void_graph_memoryless_count(void *graph); // transients bound to memoryless textures
+
+#endif
@@ -0,0 +1,417 @@
+// Void Render — Clustered forward lighting
+
+#include "lighting.h"
+#include "../gpu/dawn.h"
+#include "../gpu/enums.h"
+#include "../gpu/cache.h"
+#include "../math/mat4.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CLUSTER_COUNT (VOID_LIGHT_GRID_X * VOID_LIGHT_GRID_Y * VOID_LIGHT_GRID_Z)
+#define WORKGROUP_SIZE 64
+
+#define STR_(x) #x
+#define STR(x) STR_(x)
+
+// --- GPU layouts (must match the WGSL structs below) ---
+
+typedef struct GpuLight {
+	float pos_range[4];   // world position, range
+	float color[4];       // rgb * intensity, type (0 point, 1 spot)
+	float dir_cos[4];     // spot direction, cos(outer)
+	float spot[4];        // cos(inner), padding
+} GpuLight;
+
+typedef struct ClusterUniforms {
+	float    view[16];
+	float    inv_proj[16];
+	float    inv_view_proj[16];
+	float    screen[4];   // width, height, near, far
+	float    slice[4];    // z scale, z bias, tile width, tile height
+	uint32_t grid[4];     // x, y, z, light count
+	float    ambient[4];
+	float    sun_dir[4];  // direction the light travels
+	float    sun_color[4];
+} ClusterUniforms;
+
+// --- WGSL ---
+
+#define WGSL_COMMON \
+"const LIGHT_GRID = vec3u(" STR(VOID_LIGHT_GRID_X) "u, " STR(VOID_LIGHT_GRID_Y) "u, " STR(VOID_LIGHT_GRID_Z) "u);\n" \
+"const LIGHTS_PER_CLUSTER = " STR(VOID_LIGHT_MAX_PER_CLUSTER) "u;\n" \
+"struct Light {\n" \
+"  pos_range: vec4f,\n" \
+"  color: vec4f,\n" \
+"  dir_cos: vec4f,\n" \
+"  spot: vec4f,\n" \
+"};\n" \
+"struct ClusterUniforms {\n" \
+"  view: mat4x4f,\n" \
+"  inv_proj: mat4x4f,\n" \
+"  inv_view_proj: mat4x4f,\n" \
+"  screen: vec4f,\n" \
+"  slice: vec4f,\n" \
+"  grid: vec4u,\n" \
+"  ambient: vec4f,\n" \
+"  sun_dir: vec4f,\n" \
+"  sun_color: vec4f,\n" \
+"};\n"
+
+static const char *s_fragment_wgsl =
+WGSL_COMMON
+"@group(" STR(VOID_LIGHT_GROUP) ") @binding(0) var<uniform> cluster_u: ClusterUniforms;\n"
+"@group(" STR(VOID_LIGHT_GROUP) ") @binding(1) var<storage, read> cluster_lights: array<Light>;\n"
+"@group(" STR(VOID_LIGHT_GROUP) ") @binding(2) var<storage, read> cluster_counts: array<u32>;\n"
+"@group(" STR(VOID_LIGHT_GROUP) ") @binding(3) var<storage, read> cluster_indices: array<u32>;\n"
+"// Sun shadowing; fragments linked before this one may lower it\n"
+"var<private> light_sun_visibility: f32 = 1.0;\n"
+"\n"
+"fn clustered_light(frag_coord: vec4f, albedo: vec3f) -> vec3f {\n"
+"  // World position from the fragment's window coordinates and depth\n"
+"  let ndc = vec4f(frag_coord.x / cluster_u.screen.x * 2.0 - 1.0,\n"
+"                  1.0 - frag_coord.y / cluster_u.screen.y * 2.0, frag_coord.z, 1.0);\n"
+"  let wp = cluster_u.inv_view_proj * ndc;\n"
+"  let wpos = wp.xyz / wp.w;\n"
+"  // Flat normal from screen-space derivatives (uniform control flow)\n"
+"  let n = normalize(cross(dpdy(wpos), dpdx(wpos)));\n"
+"\n"
+"  let view_z = -(cluster_u.view * vec4f(wpos, 1.0)).z;\n"
+"  let slice_z = u32(clamp(log(max(view_z, 1e-4)) * cluster_u.slice.x + cluster_u.slice.y,\n"
+"                        0.0, f32(LIGHT_GRID.z - 1u)));\n"
+"  let tile = min(vec2u(frag_coord.xy / cluster_u.slice.zw), LIGHT_GRID.xy - 1u);\n"
+"  let cluster = tile.x + tile.y * LIGHT_GRID.x + slice_z * LIGHT_GRID.x * LIGHT_GRID.y;\n"
+"\n"
+"  var result = cluster_u.ambient.rgb * albedo;\n"
+"  result += albedo * cluster_u.sun_color.rgb * max(dot(n, -cluster_u.sun_dir.xyz), 0.0)\n"
+"            * light_sun_visibility;\n"
+"  let count = cluster_counts[cluster];\n"
+"  for (var i = 0u; i < count; i++) {\n"
+"    let light = cluster_lights[cluster_indices[cluster * LIGHTS_PER_CLUSTER + i]];\n"
+"    let to_light = light.pos_range.xyz - wpos;\n"
+"    let dist = length(to_light);\n"
+"    let l = to_light / max(dist, 1e-4);\n"
+"    let ratio = dist / light.pos_range.w;\n"
+"    let fade = clamp(1.0 - ratio * ratio * ratio * ratio, 0.0, 1.0);\n"
+"    var atten = fade * fade / (dist * dist + 1.0);\n"
+"    if (light.color.w > 0.5) {\n"
+"      let cos_angle = dot(-l, light.dir_cos.xyz);\n"
+"      atten *= smoothstep(light.dir_cos.w, light.spot.x, cos_angle);\n"
+"    }\n"
+"    result += albedo * light.color.rgb * max(dot(n, l), 0.0) * atten;\n"
+"  }\n"
+"  return result;\n"
+"}\n";
+
+static const char *s_compute_wgsl =
+WGSL_COMMON
+"@group(0) @binding(0) var<uniform> cu: ClusterUniforms;\n"
+"@group(0) @binding(1) var<storage, read> lights: array<Light>;\n"
+"@group(0) @binding(2) var<storage, read_write> counts: array<u32>;\n"
+"@group(0) @binding(3) var<storage, read_write> indices: array<u32>;\n"
+"\n"
+"// View-space bounding spheres of the current batch of lights\n"
+"var<workgroup> batch: array<vec4f, " STR(WORKGROUP_SIZE) ">;\n"
+"\n"
+"fn slice_depth(z: u32) -> f32 {\n"
+"  return cu.screen.z * pow(cu.screen.w / cu.screen.z, f32(z) / f32(LIGHT_GRID.z));\n"
+"}\n"
+"\n"
+"// Point on the near plane under a window position, in view space\n"
+"fn near_point(p: vec2f) -> vec3f {\n"
+"  let ndc = vec4f(p.x / cu.screen.x * 2.0 - 1.0, 1.0 - p.y / cu.screen.y * 2.0, 0.0, 1.0);\n"
+"  let v = cu.inv_proj * ndc;\n"
+"  return v.xyz / v.w;\n"
+"}\n"
+"\n"
+"@compute @workgroup_size(" STR(WORKGROUP_SIZE) ")\n"
+"fn bin(@builtin(global_invocation_id) gid: vec3u, @builtin(local_invocation_index) lid: u32) {\n"
+"  let cluster = gid.x;\n"
+"  let in_grid = cluster < LIGHT_GRID.x * LIGHT_GRID.y * LIGHT_GRID.z;\n"
+"  let cx = cluster % LIGHT_GRID.x;\n"
+"  let cy = (cluster / LIGHT_GRID.x) % LIGHT_GRID.y;\n"
+"  let cz = cluster / (LIGHT_GRID.x * LIGHT_GRID.y);\n"
+"\n"
+"  // Froxel AABB: tile corners projected onto the slice's near/far planes\n"
+"  let a = near_point(vec2f(f32(cx), f32(cy)) * cu.slice.zw);\n"
+"  let b = near_point(vec2f(f32(cx + 1u), f32(cy + 1u)) * cu.slice.zw);\n"
+"  let z0 = -slice_depth(cz);\n"
+"  let z1 = -slice_depth(cz + 1u);\n"
+"  let a0 = a * (z0 / a.z);\n"
+"  let a1 = a * (z1 / a.z);\n"
+"  let b0 = b * (z0 / b.z);\n"
+"  let b1 = b * (z1 / b.z);\n"
+"  let bmin = min(min(a0, a1), min(b0, b1));\n"
+"  let bmax = max(max(a0, a1), max(b0, b1));\n"
+"\n"
+"  var count = 0u;\n"
+"  let light_count = cu.grid.w;\n"
+"  for (var base = 0u; base < light_count; base += " STR(WORKGROUP_SIZE) "u) {\n"
+"    if (base + lid < light_count) {\n"
+"      let light = lights[base + lid];\n"
+"      let center = (cu.view * vec4f(light.pos_range.xyz, 1.0)).xyz;\n"
+"      batch[lid] = vec4f(center, light.pos_range.w);\n"
+"    }\n"
+"    workgroupBarrier();\n"
+"    if (in_grid) {\n"
+"      let n = min(" STR(WORKGROUP_SIZE) "u, light_count - base);\n"
+"      for (var j = 0u; j < n; j++) {\n"
+"        let s = batch[j];\n"
+"        let d = max(bmin - s.xyz, vec3f(0.0)) + max(s.xyz - bmax, vec3f(0.0));\n"
+"        if (dot(d, d) <= s.w * s.w && count < LIGHTS_PER_CLUSTER) {\n"
+"          indices[cluster * LIGHTS_PER_CLUSTER + count] = base + j;\n"
+"          count++;\n"
+"        }\n"
+"      }\n"
+"    }\n"
+"    workgroupBarrier();\n"
+"  }\n"
+"  if (in_grid) {\n"
+"    counts[cluster] = count;\n"
+"  }\n"
+"}\n";
+
+// --- Lighting ---
+
+typedef struct Lighting {
+	GpuLight lights[VOID_LIGHT_MAX];
+	uint32_t count;
+	float    ambient[3];
+	float    sun_dir[3];
+	float    sun_color[3];
+
+	void *uniform_buffer;
+	void *light_buffer;
+	void *count_buffer;
+	void *index_buffer;
+
+	void *shader;
+	void *pipeline;
+	void *compute_layout;     // cached
+	void *compute_group;      // cached
+	void *compute_pipeline_layout;  // cached
+	void *fragment_layout;    // cached
+	void *fragment_group;     // cached
+} Lighting;
+
+void *void_lighting_create(void *device) {
+	Lighting *l = calloc(1, sizeof(Lighting));
+	l->ambient[0] = l->ambient[1] = l->ambient[2] = 0.05f;
+
+	l->uniform_buffer = void_gpu_create_buffer(device, sizeof(ClusterUniforms),
+		BUFFER_USAGE_UNIFORM | BUFFER_USAGE_COPY_DST, 0);
+	l->light_buffer = void_gpu_create_buffer(device, sizeof(GpuLight) * VOID_LIGHT_MAX,
+		BUFFER_USAGE_STORAGE | BUFFER_USAGE_COPY_DST, 0);
+	l->count_buffer = void_gpu_create_buffer(device, sizeof(uint32_t) * CLUSTER_COUNT,
+		BUFFER_USAGE_STORAGE, 0);
+	l->index_buffer = void_gpu_create_buffer(device,
+		sizeof(uint32_t) * CLUSTER_COUNT * VOID_LIGHT_MAX_PER_CLUSTER,
+		BUFFER_USAGE_STORAGE, 0);
+
+	// Binning pipeline
+	void *b = void_gpu_layout_begin();
+	void_gpu_layout_buffer(b, 0, STAGE_COMPUTE, BINDING_UNIFORM, sizeof(ClusterUniforms), 0);
+	void_gpu_layout_buffer(b, 1, STAGE_COMPUTE, BINDING_READ_ONLY_STORAGE, 0, 0);
+	void_gpu_layout_buffer(b, 2, STAGE_COMPUTE, BINDING_STORAGE, 0, 0);
+	void_gpu_layout_buffer(b, 3, STAGE_COMPUTE, BINDING_STORAGE, 0, 0);
+	l->compute_layout = void_gpu_layout_finish(device, b);
+
+	void *g = void_gpu_group_begin(l->compute_layout);
+	void_gpu_group_buffer(g, 0, l->uniform_buffer, 0, 0);
+	void_gpu_group_buffer(g, 1, l->light_buffer, 0, 0);
+	void_gpu_group_buffer(g, 2, l->count_buffer, 0, 0);
+	void_gpu_group_buffer(g, 3, l->index_buffer, 0, 0);
+	l->compute_group = void_gpu_group_finish(device, g);
+
+	l->compute_pipeline_layout = void_gpu_cached_pipeline_layout_1(device, l->compute_layout);
+	l->shader = void_gpu_create_shader(device, s_compute_wgsl);
+	l->pipeline = void_gpu_create_compute_pipeline(device, l->shader, "bin", l->compute_pipeline_layout);
+
+	// Shading bind group
+	b = void_gpu_layout_begin();
+	void_gpu_layout_buffer(b, 0, STAGE_FRAGMENT, BINDING_UNIFORM, sizeof(ClusterUniforms), 0);
+	void_gpu_layout_buffer(b, 1, STAGE_FRAGMENT, BINDING_READ_ONLY_STORAGE, 0, 0);
+	void_gpu_layout_buffer(b, 2, STAGE_FRAGMENT, BINDING_READ_ONLY_STORAGE, 0, 0);
+	void_gpu_layout_buffer(b, 3, STAGE_FRAGMENT, BINDING_READ_ONLY_STORAGE, 0, 0);
+	l->fragment_layout = void_gpu_layout_finish(device, b);
+
+	g = void_gpu_group_begin(l->fragment_layout);
+	void_gpu_group_buffer(g, 0, l->uniform_buffer, 0, 0);
+	void_gpu_group_buffer(g, 1, l->light_buffer, 0, 0);
+	void_gpu_group_buffer(g, 2, l->count_buffer, 0, 0);
+	void_gpu_group_buffer(g, 3, l->index_buffer, 0, 0);
+	l->fragment_group = void_gpu_group_finish(device, g);
+
+	return l;
+}
+
+void void_lighting_destroy(void *lighting) {
+	Lighting *l = (Lighting *)lighting;
+	if (!l) return;
+	void_gpu_cache_release(l->fragment_group);
+	void_gpu_cache_release(l->fragment_layout);
+	void_gpu_cache_release(l->compute_group);
+	void_gpu_cache_release(l->compute_pipeline_layout);
+	void_gpu_cache_release(l->compute_layout);
+	void_gpu_release_compute_pipeline(l->pipeline);
+	void_gpu_release_shader(l->shader);
+	void_gpu_release_buffer(l->index_buffer);
+	void_gpu_release_buffer(l->count_buffer);
+	void_gpu_release_buffer(l->light_buffer);
+	void_gpu_release_buffer(l->uniform_buffer);
+	free(l);
+}
+
+// --- Lights ---
+
+void void_lighting_clear(void *lighting) {
+	((Lighting *)lighting)->count = 0;
+}
+
+uint32_t void_lighting_add_point(void *lighting,
+	float x, float y, float z, float range,
+	float r, float g, float b, float intensity
+) {
+	return void_lighting_add_spot(lighting, x, y, z, range,
+		0.0f, 0.0f, -1.0f, -1.0f, -1.0f, r, g, b, intensity);
+}
+
+uint32_t void_lighting_add_spot(void *lighting,
+	float x, float y, float z, float range,
+	float dirX, float dirY, float dirZ,
+	float innerAngle, float outerAngle,
+	float r, float g, float b, float intensity
+) {
+	Lighting *l = (Lighting *)lighting;
+	if (l->count >= VOID_LIGHT_MAX) return UINT32_MAX;
+	uint32_t index = l->count++;
+	GpuLight *light = &l->lights[index];
+	memset(light, 0, sizeof(*light));
+	light->pos_range[0] = x;
+	light->pos_range[1] = y;
+	light->pos_range[2] = z;
+	light->pos_range[3] = range > 0.0f ? range : 1.0f;
+	light->color[0] = r * intensity;
+	light->color[1] = g * intensity;
+	light->color[2] = b * intensity;
+
+	// Negative angles mark a point light
+	if (outerAngle >= 0.0f) {
+		float len = sqrtf(dirX * dirX + dirY * dirY + dirZ * dirZ);
+		if (len < 1e-6f) len = 1.0f;
+		light->color[3] = 1.0f;
+		light->dir_cos[0] = dirX / len;
+		light->dir_cos[1] = dirY / len;
+		light->dir_cos[2] = dirZ / len;
+		light->dir_cos[3] = cosf(outerAngle);
+		light->spot[0] = cosf(innerAngle < outerAngle ? innerAngle : outerAngle);
+	}
+	return index;
+}
+
+void void_lighting_set_position(void *lighting, uint32_t index, float x, float y, float z) {
+	Lighting *l = (Lighting *)lighting;
+	if (index >= l->count) return;
+	l->lights[index].pos_range[0] = x;
+	l->lights[index].pos_range[1] = y;
+	l->lights[index].pos_range[2] = z;
+}
+
+void void_lighting_set_sun(void *lighting,
+	float dirX, float dirY, float dirZ,
+	float r, float g, float b, float intensity
+) {
+	Lighting *l = (Lighting *)lighting;
+	float len = sqrtf(dirX * dirX + dirY * dirY + dirZ * dirZ);
+	if (len < 1e-6f) {
+		intensity = 0.0f;
+		len = 1.0f;
+	}
+	l->sun_dir[0] = dirX / len;
+	l->sun_dir[1] = dirY / len;
+	l->sun_dir[2] = dirZ / len;
+	l->sun_color[0] = r * intensity;
+	l->sun_color[1] = g * intensity;
+	l->sun_color[2] = b * intensity;
+}
+
+void void_lighting_set_ambient(void *lighting, float r, float g, float b) {
+	Lighting *l = (Lighting *)lighting;
+	l->ambient[0] = r;
+	l->ambient[1] = g;
+	l->ambient[2] = b;
+}
+
+uint32_t void_lighting_count(void *lighting) {
+	return ((Lighting *)lighting)->count;
+}
+
+// --- Frame ---
+
+void void_lighting_update(void *lighting, void *queue,
+	uint32_t width, uint32_t height, float nearZ, float farZ
+) {
+	Lighting *l = (Lighting *)lighting;
+	const float *view = (const float *)void_math_get_view();
+	const float *proj = (const float *)void_math_get_projection();
+
+	ClusterUniforms u;
+	memset(&u, 0, sizeof(u));
+	memcpy(u.view, view, sizeof(u.view));
+	void_mat4_invert(u.inv_proj, proj);
+	float view_proj[16];
+	void_mat4_multiply(view_proj, proj, view);
+	void_mat4_invert(u.inv_view_proj, view_proj);
+
+	float w = width ? (float)width : 1.0f;
+	float h = height ? (float)height : 1.0f;
+	u.screen[0] = w;
+	u.screen[1] = h;
+	u.screen[2] = nearZ;
+	u.screen[3] = farZ;
+
+	// slice = log(z) * scale + bias  ==  Z * log(z / near) / log(far / near)
+	float log_ratio = logf(farZ / nearZ);
+	u.slice[0] = (float)VOID_LIGHT_GRID_Z / log_ratio;
+	u.slice[1] = -(float)VOID_LIGHT_GRID_Z * logf(nearZ) / log_ratio;
+	u.slice[2] = w / (float)VOID_LIGHT_GRID_X;
+	u.slice[3] = h / (float)VOID_LIGHT_GRID_Y;
+
+	u.grid[0] = VOID_LIGHT_GRID_X;
+	u.grid[1] = VOID_LIGHT_GRID_Y;
+	u.grid[2] = VOID_LIGHT_GRID_Z;
+	u.grid[3] = l->count;
+	u.ambient[0] = l->ambient[0];
+	u.ambient[1] = l->ambient[1];
+	u.ambient[2] = l->ambient[2];
+	memcpy(u.sun_dir, l->sun_dir, sizeof(l->sun_dir));
+	memcpy(u.sun_color, l->sun_color, sizeof(l->sun_color));
+
+	void_gpu_queue_write_buffer(queue, l->uniform_buffer, 0, &u, sizeof(u));
+	if (l->count) {
+		void_gpu_queue_write_buffer(queue, l->light_buffer, 0, l->lights, sizeof(GpuLight) * l->count);
+	}
+}
+
+void void_lighting_bin(void *lighting, void *encoder) {
+	Lighting *l = (Lighting *)lighting;
+	void *pass = void_gpu_begin_compute_pass(encoder);
+	void_gpu_compute_pass_set_pipeline(pass, l->pipeline);
+	void_gpu_compute_pass_set_bind_group(pass, 0, l->compute_group);
+	void_gpu_compute_pass_dispatch(pass, (CLUSTER_COUNT + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE, 1, 1);
+	void_gpu_end_compute_pass(pass);
+}
+
+void *void_lighting_bind_group_layout(void *lighting) {
+	return ((Lighting *)lighting)->fragment_layout;
+}
+
+void *void_lighting_bind_group(void *lighting) {
+	return ((Lighting *)lighting)->fragment_group;
+}
+
+const char *void_lighting_wgsl(void) {
+	return s_fragment_wgsl;
+}
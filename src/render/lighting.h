@@ -0,0 +1,66 @@
+// Void Render — Clustered forward lighting
+// The view frustum is split into a VOID_LIGHT_GRID_X × Y × Z froxel grid
+// (screen tiles × exponential depth slices, using the same near/far as the
+// depth buffer). A compute pass bins every point/spot light into the froxels
+// its range touches; the lighting fragment then shades each pixel with only
+// the lights of its froxel. Cost scales with lights per froxel, not per scene.
+//
+// Bind group (fragment shaders, group VOID_LIGHT_GROUP):
+//   0 uniform            cluster uniforms (matrices, grid, ambient)
+//   1 storage, read      lights
+//   2 storage, read      per-cluster light counts
+//   3 storage, read      per-cluster light indices (fixed slots)
+
+#ifndef VOID_RENDER_LIGHTING_H
+#define VOID_RENDER_LIGHTING_H
+
+#include <stdint.h>
+
+#define VOID_LIGHT_GRID_X        16
+#define VOID_LIGHT_GRID_Y        9
+#define VOID_LIGHT_GRID_Z        24
+#define VOID_LIGHT_MAX           1024
+#define VOID_LIGHT_MAX_PER_CLUSTER 64
+#define VOID_LIGHT_GROUP         2
+
+void *void_lighting_create(void *device);
+void  void_lighting_destroy(void *lighting);
+
+// --- Lights (world space) ---
+void void_lighting_clear(void *lighting);
+// Return the light index, or UINT32_MAX when full.
+uint32_t void_lighting_add_point(void *lighting,
+    float x, float y, float z, float range,
+    float r, float g, float b, float intensity);
+// Angles are cone half-angles in radians.
+uint32_t void_lighting_add_spot(void *lighting,
+    float x, float y, float z, float range,
+    float dirX, float dirY, float dirZ,
+    float innerAngle, float outerAngle,
+    float r, float g, float b, float intensity);
+void void_lighting_set_position(void *lighting, uint32_t index, float x, float y, float z);
+void void_lighting_set_ambient(void *lighting, float r, float g, float b);
+// Directional light (direction it travels); intensity 0 disables it.
+// Shading multiplies it by `light_sun_visibility` (see src/render/shadows).
+void void_lighting_set_sun(void *lighting,
+    float dirX, float dirY, float dirZ,
+    float r, float g, float b, float intensity);
+uint32_t void_lighting_count(void *lighting);
+
+// Upload lights + cluster uniforms for this frame. Uses the current view and
+// projection from src/math/mat4; near/far must match the projection.
+void void_lighting_update(void *lighting, void *queue,
+    uint32_t width, uint32_t height, float nearZ, float farZ);
+
+// Record the binning compute pass (before the passes that shade with it).
+void void_lighting_bin(void *lighting, void *encoder);
+
+// Layout / bind group for VOID_LIGHT_GROUP (owned by the lighting object).
+void *void_lighting_bind_group_layout(void *lighting);
+void *void_lighting_bind_group(void *lighting);
+
+// WGSL declarations for the lighting fragment (structs, bindings and
+// `fn clustered_light(frag_coord: vec4f, albedo: vec3f) -> vec3f`).
+const char *void_lighting_wgsl(void);
+
+#endif
@@ -0,0 +1,622 @@
+// Void Render — Materials built from composable WGSL fragments
+
+#include "material.h"
+#include "../gpu/dawn.h"
+#include "../gpu/enums.h"
+#include "../core/hash.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- String builder ---
+
+typedef struct StrBuf {
+	char  *data;
+	size_t len;
+	size_t cap;
+} StrBuf;
+
+static void sb_append(StrBuf *b, const char *s) {
+	size_t n = strlen(s);
+	if (b->len + n + 1 > b->cap) {
+		size_t cap = b->cap ? b->cap : 1024;
+		while (b->len + n + 1 > cap) cap *= 2;
+		b->data = realloc(b->data, cap);
+		b->cap = cap;
+	}
+	memcpy(b->data + b->len, s, n + 1);
+	b->len += n;
+}
+
+static void sb_appendf_loc(StrBuf *b, const char *prefix, uint32_t loc, const char *name, const char *type) {
+	char line[256];
+	snprintf(line, sizeof(line), "  %s@location(%u) %s: %s,\n", prefix, loc, name, type);
+	sb_append(b, line);
+}
+
+// --- Fragments ---
+
+#define MAX_FRAGMENTS 256
+
+typedef struct Fragment {
+	char    *name;
+	char    *decls;
+	char    *attributes;
+	char    *varyings;
+	char    *vertex;
+	char    *fragment;
+	uint64_t hash;
+} Fragment;
+
+static Fragment s_fragments[MAX_FRAGMENTS];
+static uint32_t s_fragment_count = 0;
+
+static char *dup_or_empty(const char *s) {
+	if (!s) s = "";
+	size_t n = strlen(s) + 1;
+	char *d = malloc(n);
+	memcpy(d, s, n);
+	return d;
+}
+
+uint32_t void_material_fragment(const char *name,
+	const char *decls, const char *attributes, const char *varyings,
+	const char *vertex, const char *fragment
+) {
+	uint64_t h = FNV_OFFSET;
+	h = fnv_str(h, name ? name : "");
+	h = fnv_str(h, decls ? decls : "");
+	h = fnv_str(h, attributes ? attributes : "");
+	h = fnv_str(h, varyings ? varyings : "");
+	h = fnv_str(h, vertex ? vertex : "");
+	h = fnv_str(h, fragment ? fragment : "");
+
+	for (uint32_t i = 0; i < s_fragment_count; i++) {
+		if (s_fragments[i].hash == h) return i;
+	}
+	if (s_fragment_count >= MAX_FRAGMENTS) {
+		fprintf(stderr, "void_material: fragment table full (%s)\n", name);
+		return VOID_MATERIAL_NONE;
+	}
+	Fragment *f = &s_fragments[s_fragment_count];
+	f->name = dup_or_empty(name);
+	f->decls = dup_or_empty(decls);
+	f->attributes = dup_or_empty(attributes);
+	f->varyings = dup_or_empty(varyings);
+	f->vertex = dup_or_empty(vertex);
+	f->fragment = dup_or_empty(fragment);
+	f->hash = h;
+	return s_fragment_count++;
+}
+
+// --- "name: type" line parsing ---
+
+typedef struct Field {
+	char name[48];
+	char type[32];
+} Field;
+
+static void trim_copy(char *dst, size_t cap, const char *begin, const char *end) {
+	while (begin < end && (*begin == ' ' || *begin == '\t')) begin++;
+	while (end > begin && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == ',' || end[-1] == ';' || end[-1] == '\r')) end--;
+	size_t n = (size_t)(end - begin);
+	if (n >= cap) n = cap - 1;
+	memcpy(dst, begin, n);
+	dst[n] = 0;
+}
+
+// Append fields from `text` not already present (first declaration wins)
+static uint32_t parse_fields(const char *text, Field *out, uint32_t count, uint32_t max) {
+	const char *line = text;
+	while (*line) {
+		const char *eol = strchr(line, '\n');
+		if (!eol) eol = line + strlen(line);
+		const char *colon = memchr(line, ':', (size_t)(eol - line));
+		if (colon && count < max) {
+			Field f;
+			trim_copy(f.name, sizeof(f.name), line, colon);
+			trim_copy(f.type, sizeof(f.type), colon + 1, eol);
+			int dup = 0;
+			for (uint32_t i = 0; i < count; i++) {
+				if (strcmp(out[i].name, f.name) == 0) dup = 1;
+			}
+			if (!dup && f.name[0]) out[count++] = f;
+		}
+		line = *eol ? eol + 1 : eol;
+	}
+	return count;
+}
+
+static int vertex_format(const char *type, uint32_t *format, uint32_t *size) {
+	static const struct { const char *type; uint32_t format; uint32_t size; } k[] = {
+		{ "f32",       VFMT_FLOAT32,   4 }, { "vec2f", VFMT_FLOAT32X2, 8 },
+		{ "vec3f",     VFMT_FLOAT32X3, 12 }, { "vec4f", VFMT_FLOAT32X4, 16 },
+		{ "vec2<f32>", VFMT_FLOAT32X2, 8 }, { "vec3<f32>", VFMT_FLOAT32X3, 12 },
+		{ "vec4<f32>", VFMT_FLOAT32X4, 16 },
+		{ "u32",       VFMT_UINT32,    4 }, { "vec2u", VFMT_UINT32X2, 8 },
+		{ "vec3u",     VFMT_UINT32X3, 12 }, { "vec4u", VFMT_UINT32X4, 16 },
+		{ "i32",       VFMT_SINT32,    4 },
+	};
+	for (size_t i = 0; i < sizeof(k) / sizeof(k[0]); i++) {
+		if (strcmp(type, k[i].type) == 0) {
+			*format = k[i].format;
+			*size = k[i].size;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+// --- Variant cache (fragment list -> linked shader module) ---
+
+typedef struct Variant {
+	uint64_t hash;
+	char    *source;
+	void    *shader;
+	uint32_t refs;
+	uint64_t stride;
+	uint32_t attr_count;
+	VoidVertexAttr attrs[VOID_GPU_MAX_VERTEX_ATTRS];
+} Variant;
+
+static Variant *s_variants = NULL;
+static uint32_t s_variant_count = 0;
+static uint32_t s_variant_cap = 0;
+static uint32_t s_variant_live = 0;
+static HashMap  s_variant_map;
+
+static uint64_t variant_hash(const uint32_t *fragments, uint32_t count) {
+	uint64_t h = FNV_OFFSET;
+	for (uint32_t i = 0; i < count; i++) h = fnv_u64(h, s_fragments[fragments[i]].hash);
+	return h;
+}
+
+static void link_variant(Variant *v, const uint32_t *fragments, uint32_t count) {
+	Field attrs[VOID_GPU_MAX_VERTEX_ATTRS];
+	Field varyings[16];
+	uint32_t attr_count = 0, varying_count = 0;
+	for (uint32_t i = 0; i < count; i++) {
+		const Fragment *f = &s_fragments[fragments[i]];
+		attr_count = parse_fields(f->attributes, attrs, attr_count, VOID_GPU_MAX_VERTEX_ATTRS);
+		varying_count = parse_fields(f->varyings, varyings, varying_count, 16);
+	}
+
+	StrBuf b = {0};
+	sb_append(&b, "// linked:");
+	for (uint32_t i = 0; i < count; i++) {
+		sb_append(&b, " ");
+		sb_append(&b, s_fragments[fragments[i]].name);
+	}
+	sb_append(&b, "\n");
+
+	for (uint32_t i = 0; i < count; i++) {
+		const Fragment *f = &s_fragments[fragments[i]];
+		if (f->decls[0]) {
+			sb_append(&b, f->decls);
+			sb_append(&b, "\n");
+		}
+	}
+
+	// Vertex input struct + buffer layout (tightly packed, link order)
+	v->stride = 0;
+	v->attr_count = 0;
+	sb_append(&b, "struct VIn {\n");
+	for (uint32_t i = 0; i < attr_count; i++) {
+		uint32_t format = 0, size = 0;
+		if (!vertex_format(attrs[i].type, &format, &size)) {
+			fprintf(stderr, "void_material: unsupported attribute type %s\n", attrs[i].type);
+			continue;
+		}
+		sb_appendf_loc(&b, "", v->attr_count, attrs[i].name, attrs[i].type);
+		v->attrs[v->attr_count].format = format;
+		v->attrs[v->attr_count].offset = v->stride;
+		v->attrs[v->attr_count].location = v->attr_count;
+		v->attr_count++;
+		v->stride += size;
+	}
+	if (v->attr_count == 0) sb_append(&b, "  @builtin(vertex_index) vertex_index: u32,\n");
+	sb_append(&b, "  @builtin(instance_index) instance_index: u32,\n");
+	sb_append(&b, "};\n\n");
+
+	sb_append(&b, "struct VOut {\n  @builtin(position) pos: vec4f,\n");
+	for (uint32_t i = 0; i < varying_count; i++) {
+		// Integer varyings must not be interpolated
+		const char *t = varyings[i].type;
+		size_t n = strlen(t);
+		int integer = strstr(t, "u32") || strstr(t, "i32")
+			|| (n > 0 && (t[n - 1] == 'u' || t[n - 1] == 'i'));
+		sb_appendf_loc(&b, integer ? "@interpolate(flat) " : "", i, varyings[i].name, t);
+	}
+	sb_append(&b, "};\n\n");
+
+	sb_append(&b, "@vertex fn vs(in: VIn) -> VOut {\n  var out: VOut;\n");
+	for (uint32_t i = 0; i < count; i++) {
+		const Fragment *f = &s_fragments[fragments[i]];
+		if (f->vertex[0]) {
+			sb_append(&b, "  { // ");
+			sb_append(&b, f->name);
+			sb_append(&b, "\n");
+			sb_append(&b, f->vertex);
+			sb_append(&b, "\n  }\n");
+		}
+	}
+	sb_append(&b, "  return out;\n}\n\n");
+
+	sb_append(&b, "@fragment fn fs(in: VOut) -> @location(0) vec4f {\n  var color = vec4f(1.0);\n");
+	for (uint32_t i = 0; i < count; i++) {
+		const Fragment *f = &s_fragments[fragments[i]];
+		if (f->fragment[0]) {
+			sb_append(&b, "  { // ");
+			sb_append(&b, f->name);
+			sb_append(&b, "\n");
+			sb_append(&b, f->fragment);
+			sb_append(&b, "\n  }\n");
+		}
+	}
+	sb_append(&b, "  return color;\n}\n");
+
+	v->source = b.data;
+}
+
+static int32_t variant_acquire(const uint32_t *fragments, uint32_t count) {
+	uint64_t h = variant_hash(fragments, count);
+	int32_t idx = map_get(&s_variant_map, h);
+	if (idx < 0) {
+		if (s_variant_count == s_variant_cap) {
+			s_variant_cap = s_variant_cap ? s_variant_cap * 2 : 32;
+			s_variants = realloc(s_variants, s_variant_cap * sizeof(Variant));
+		}
+		idx = (int32_t)s_variant_count++;
+		Variant *v = &s_variants[idx];
+		memset(v, 0, sizeof(*v));
+		v->hash = h;
+		link_variant(v, fragments, count);
+		map_put(&s_variant_map, h, idx);
+		s_variant_live++;
+	}
+	s_variants[idx].refs++;
+	return idx;
+}
+
+static void variant_release(int32_t idx) {
+	if (idx < 0 || (uint32_t)idx >= s_variant_count) return;
+	Variant *v = &s_variants[idx];
+	if (v->refs == 0 || --v->refs > 0) return;
+	map_remove(&s_variant_map, v->hash);
+	void_gpu_release_shader(v->shader);
+	free(v->source);
+	memset(v, 0, sizeof(*v));  // slot stays allocated; indices are stable
+	s_variant_live--;
+}
+
+// --- Pipeline cache (variant + render state + layout -> pipeline) ---
+
+typedef struct PassState {
+	uint32_t cull_mode;
+	uint32_t depth_compare;
+	uint32_t blend_mode;
+	uint32_t color_format;
+	uint32_t depth_format;
+	uint32_t sample_count;
+	int      depth_write;
+	int32_t  depth_bias;
+	float    depth_bias_slope;
+	float    depth_bias_clamp;
+} PassState;
+
+typedef struct CachedPipeline {
+	uint64_t key;
+	void    *pipeline;
+	void    *request;         // async compile in flight (pipeline NULL until resolved)
+	uint32_t refs;
+} CachedPipeline;
+
+static CachedPipeline *s_pipelines = NULL;
+static uint32_t s_pipeline_count = 0;
+static uint32_t s_pipeline_cap = 0;
+static uint32_t s_pipeline_live = 0;
+static HashMap  s_pipeline_map;
+
+static uint64_t pipeline_key(const Variant *v, const PassState *st, void *layout) {
+	uint64_t h = fnv_u64(FNV_OFFSET, v->hash);
+	h = fnv_u64(h, st->cull_mode);
+	h = fnv_u64(h, st->depth_compare);
+	h = fnv_u64(h, st->blend_mode);
+	h = fnv_u64(h, st->color_format);
+	h = fnv_u64(h, st->depth_format);
+	h = fnv_u64(h, st->sample_count);
+	h = fnv_u64(h, (uint64_t)st->depth_write);
+	h = fnv_bytes(h, &st->depth_bias, sizeof(st->depth_bias));
+	h = fnv_bytes(h, &st->depth_bias_slope, sizeof(st->depth_bias_slope));
+	h = fnv_bytes(h, &st->depth_bias_clamp, sizeof(st->depth_bias_clamp));
+	h = fnv_u64(h, (uint64_t)(uintptr_t)layout);
+	return h;
+}
+
+static void fill_blend(VoidRenderPipelineDesc *d, uint32_t mode) {
+	if (mode == VOID_BLEND_OPAQUE) return;
+	d->has_blend = 1;
+	d->blend_color_op = BLEND_OP_ADD;
+	d->blend_alpha_op = BLEND_OP_ADD;
+	switch (mode) {
+		case VOID_BLEND_ADDITIVE:
+			d->blend_color_src = BLEND_SRC_ALPHA; d->blend_color_dst = BLEND_ONE;
+			d->blend_alpha_src = BLEND_ONE;       d->blend_alpha_dst = BLEND_ONE;
+			break;
+		case VOID_BLEND_PREMULTIPLIED:
+			d->blend_color_src = BLEND_ONE; d->blend_color_dst = BLEND_ONE_MINUS_SRC_ALPHA;
+			d->blend_alpha_src = BLEND_ONE; d->blend_alpha_dst = BLEND_ONE_MINUS_SRC_ALPHA;
+			break;
+		default:
+			d->blend_color_src = BLEND_SRC_ALPHA; d->blend_color_dst = BLEND_ONE_MINUS_SRC_ALPHA;
+			d->blend_alpha_src = BLEND_ONE;       d->blend_alpha_dst = BLEND_ONE_MINUS_SRC_ALPHA;
+			break;
+	}
+}
+
+static int32_t pipeline_acquire(void *device, Variant *v, const PassState *st, void *layout, int async) {
+	uint64_t key = pipeline_key(v, st, layout);
+	int32_t idx = map_get(&s_pipeline_map, key);
+	if (idx < 0) {
+		VoidRenderPipelineDesc d = {0};
+		d.shader = v->shader;
+		d.vs_entry = "vs";
+		d.fs_entry = "fs";
+		d.layout = layout;
+		d.stride = v->stride;
+		d.attr_count = v->attr_count;
+		memcpy(d.attrs, v->attrs, sizeof(d.attrs));
+		d.color_format = st->color_format;
+		d.depth_only = st->color_format == 0;
+		d.cull_mode = st->cull_mode;
+		d.sample_count = st->sample_count;
+		d.depth_format = st->depth_format;
+		d.depth_write = st->depth_write;
+		d.depth_compare = st->depth_compare;
+		d.depth_bias = st->depth_bias;
+		d.depth_bias_slope_scale = st->depth_bias_slope;
+		d.depth_bias_clamp = st->depth_bias_clamp;
+		fill_blend(&d, st->blend_mode);
+
+		void *pipeline = NULL, *request = NULL;
+		if (async) request = void_gpu_create_render_pipeline_desc_async(device, &d);
+		else pipeline = void_gpu_create_render_pipeline_desc(device, &d);
+		if (!pipeline && !request) return -1;
+
+		if (s_pipeline_count == s_pipeline_cap) {
+			s_pipeline_cap = s_pipeline_cap ? s_pipeline_cap * 2 : 32;
+			s_pipelines = realloc(s_pipelines, s_pipeline_cap * sizeof(CachedPipeline));
+		}
+		idx = (int32_t)s_pipeline_count++;
+		s_pipelines[idx].key = key;
+		s_pipelines[idx].pipeline = pipeline;
+		s_pipelines[idx].request = request;
+		s_pipelines[idx].refs = 0;
+		map_put(&s_pipeline_map, key, idx);
+		s_pipeline_live++;
+	}
+	s_pipelines[idx].refs++;
+	return idx;
+}
+
+// Waits for an async compile still in flight
+static void *pipeline_resolve(int32_t idx) {
+	CachedPipeline *p = &s_pipelines[idx];
+	if (p->request) {
+		p->pipeline = void_gpu_request_wait(p->request);
+		p->request = NULL;
+	}
+	return p->pipeline;
+}
+
+static void pipeline_release(int32_t idx) {
+	if (idx < 0 || (uint32_t)idx >= s_pipeline_count) return;
+	CachedPipeline *p = &s_pipelines[idx];
+	if (p->refs == 0 || --p->refs > 0) return;
+	map_remove(&s_pipeline_map, p->key);
+	void_gpu_release_pipeline(pipeline_resolve(idx));
+	memset(p, 0, sizeof(*p));
+	s_pipeline_live--;
+}
+
+// --- Materials ---
+
+typedef struct MaterialPass {
+	uint32_t  queue_pass;
+	uint32_t  fragments[VOID_MATERIAL_MAX_FRAGMENTS];
+	uint32_t  fragment_count;
+	PassState state;
+	int32_t   variant;        // -1 = not linked yet
+	int32_t   pipeline;       // -1 = not built yet
+	void     *pipeline_layout;
+} MaterialPass;
+
+typedef struct Material {
+	MaterialPass passes[VOID_MATERIAL_MAX_PASSES];
+	uint32_t     pass_count;
+} Material;
+
+// NULL for VOID_MATERIAL_NONE (add_pass on a full material) and other bad indices
+static MaterialPass *get_pass(void *material, uint32_t pass) {
+	Material *m = (Material *)material;
+	if (!m || pass == VOID_MATERIAL_NONE || pass >= m->pass_count) return NULL;
+	return &m->passes[pass];
+}
+
+// Any change to fragments or state invalidates the cached variant/pipeline
+static void invalidate(MaterialPass *p, int relink) {
+	pipeline_release(p->pipeline);
+	p->pipeline = -1;
+	p->pipeline_layout = NULL;
+	if (relink) {
+		variant_release(p->variant);
+		p->variant = -1;
+	}
+}
+
+void *void_material_create(void) {
+	return calloc(1, sizeof(Material));
+}
+
+void void_material_destroy(void *material) {
+	Material *m = (Material *)material;
+	if (!m) return;
+	for (uint32_t i = 0; i < m->pass_count; i++) invalidate(&m->passes[i], 1);
+	free(m);
+}
+
+uint32_t void_material_add_pass(void *material, uint32_t queue_pass) {
+	Material *m = (Material *)material;
+	if (m->pass_count >= VOID_MATERIAL_MAX_PASSES) {
+		fprintf(stderr, "void_material: material has %d passes already\n", VOID_MATERIAL_MAX_PASSES);
+		return VOID_MATERIAL_NONE;
+	}
+	MaterialPass *p = &m->passes[m->pass_count];
+	memset(p, 0, sizeof(*p));
+	p->queue_pass = queue_pass;
+	p->state.cull_mode = CULL_BACK;
+	p->state.depth_write = 1;
+	p->state.depth_compare = COMPARE_LESS;
+	p->state.blend_mode = VOID_BLEND_OPAQUE;
+	p->state.color_format = FMT_BGRA8_UNORM;
+	p->state.depth_format = FMT_DEPTH24_PLUS;
+	p->state.sample_count = 1;
+	p->variant = -1;
+	p->pipeline = -1;
+	return m->pass_count++;
+}
+
+void void_material_pass_add_fragment(void *material, uint32_t pass, uint32_t fragment) {
+	MaterialPass *p = get_pass(material, pass);
+	if (!p || fragment == VOID_MATERIAL_NONE || fragment >= s_fragment_count) return;
+	if (p->fragment_count >= VOID_MATERIAL_MAX_FRAGMENTS) {
+		fprintf(stderr, "void_material: pass has %d fragments already\n", VOID_MATERIAL_MAX_FRAGMENTS);
+		return;
+	}
+	for (uint32_t i = 0; i < p->fragment_count; i++) {
+		if (p->fragments[i] == fragment) return;
+	}
+	p->fragments[p->fragment_count++] = fragment;
+	invalidate(p, 1);
+}
+
+void void_material_pass_set_cull(void *material, uint32_t pass, uint32_t cull_mode) {
+	MaterialPass *p = get_pass(material, pass);
+	if (!p || p->state.cull_mode == cull_mode) return;
+	p->state.cull_mode = cull_mode;
+	invalidate(p, 0);
+}
+
+void void_material_pass_set_depth(void *material, uint32_t pass, int depth_write, uint32_t depth_compare) {
+	MaterialPass *p = get_pass(material, pass);
+	if (!p) return;
+	p->state.depth_write = depth_write ? 1 : 0;
+	p->state.depth_compare = depth_compare;
+	invalidate(p, 0);
+}
+
+void void_material_pass_set_blend(void *material, uint32_t pass, uint32_t blend_mode) {
+	MaterialPass *p = get_pass(material, pass);
+	if (!p || p->state.blend_mode == blend_mode) return;
+	p->state.blend_mode = blend_mode;
+	invalidate(p, 0);
+}
+
+void void_material_pass_set_formats(void *material, uint32_t pass, uint32_t color_format, uint32_t depth_format) {
+	MaterialPass *p = get_pass(material, pass);
+	if (!p) return;
+	p->state.color_format = color_format;
+	p->state.depth_format = depth_format;
+	invalidate(p, 0);
+}
+
+void void_material_pass_set_depth_bias(void *material, uint32_t pass, int32_t constant, float slope_scale, float clamp) {
+	MaterialPass *p = get_pass(material, pass);
+	if (!p) return;
+	p->state.depth_bias = constant;
+	p->state.depth_bias_slope = slope_scale;
+	p->state.depth_bias_clamp = clamp;
+	invalidate(p, 0);
+}
+
+void void_material_pass_set_sample_count(void *material, uint32_t pass, uint32_t sample_count) {
+	MaterialPass *p = get_pass(material, pass);
+	if (!p) return;
+	if (sample_count == 0) sample_count = 1;
+	if (p->state.sample_count == sample_count) return;
+	p->state.sample_count = sample_count;
+	invalidate(p, 0);
+}
+
+uint32_t void_material_pass_count(void *material) {
+	return ((Material *)material)->pass_count;
+}
+
+uint32_t void_material_pass_queue_pass(void *material, uint32_t pass) {
+	MaterialPass *p = get_pass(material, pass);
+	return p ? p->queue_pass : 0;
+}
+
+int void_material_pass_translucent(void *material, uint32_t pass) {
+	MaterialPass *p = get_pass(material, pass);
+	return p && p->state.blend_mode != VOID_BLEND_OPAQUE;
+}
+
+static Variant *linked_variant(MaterialPass *p) {
+	if (p->variant < 0) p->variant = variant_acquire(p->fragments, p->fragment_count);
+	return &s_variants[p->variant];
+}
+
+void *void_material_pass_shader(void *device, void *material, uint32_t pass) {
+	MaterialPass *p = get_pass(material, pass);
+	if (!p) return NULL;
+	Variant *v = linked_variant(p);
+	if (!v->shader) v->shader = void_gpu_create_shader(device, v->source);
+	return v->shader;
+}
+
+static int pass_acquire(void *device, void *material, uint32_t pass, void *layout, int async) {
+	MaterialPass *p = get_pass(material, pass);
+	if (!p) return 0;
+	if (p->pipeline >= 0 && p->pipeline_layout == layout) return 1;
+	invalidate(p, 0);
+	if (!void_material_pass_shader(device, material, pass)) return 0;
+	p->pipeline = pipeline_acquire(device, &s_variants[p->variant], &p->state, layout, async);
+	p->pipeline_layout = layout;
+	return p->pipeline >= 0;
+}
+
+void *void_material_pass_pipeline(void *device, void *material, uint32_t pass, void *layout) {
+	if (!pass_acquire(device, material, pass, layout, 0)) return NULL;
+	return pipeline_resolve(get_pass(material, pass)->pipeline);
+}
+
+int void_material_pass_prepare(void *device, void *material, uint32_t pass, void *layout) {
+	return pass_acquire(device, material, pass, layout, 1);
+}
+
+const char *void_material_pass_source(void *material, uint32_t pass) {
+	MaterialPass *p = get_pass(material, pass);
+	if (!p) return NULL;
+	return linked_variant(p)->source;
+}
+
+uint32_t void_material_variant_count(void)  { return s_variant_live; }
+uint32_t void_material_pipeline_count(void) { return s_pipeline_live; }
+
+void void_material_cache_clear(void) {
+	for (uint32_t i = 0; i < s_pipeline_count; i++) void_gpu_release_pipeline(pipeline_resolve((int32_t)i));
+	for (uint32_t i = 0; i < s_variant_count; i++) {
+		void_gpu_release_shader(s_variants[i].shader);
+		free(s_variants[i].source);
+	}
+	free(s_pipelines);
+	free(s_variants);
+	s_pipelines = NULL;
+	s_variants = NULL;
+	s_pipeline_count = s_pipeline_cap = s_pipeline_live = 0;
+	s_variant_count = s_variant_cap = s_variant_live = 0;
+	map_clear(&s_pipeline_map);
+	map_clear(&s_variant_map);
+}
@@ -0,0 +1,81 @@
+// Void Render — Materials built from composable WGSL fragments
+// A material has passes; each pass has render state plus an ordered list of
+// WGSL fragments. Fragments are linked into one shader module per unique
+// fragment list (the "variant"), compiled once and shared by every material
+// that uses the same list. Pipelines are cached by variant + render state.
+// All handles are opaque pointers.
+
+#ifndef VOID_RENDER_MATERIAL_H
+#define VOID_RENDER_MATERIAL_H
+
+#include <stdint.h>
+
+#define VOID_MATERIAL_MAX_PASSES    4
+#define VOID_MATERIAL_MAX_FRAGMENTS 16
+#define VOID_MATERIAL_NONE          0xFFFFFFFFu  // no fragment / no pass (table full)
+
+// Blend modes
+#define VOID_BLEND_OPAQUE        0
+#define VOID_BLEND_ALPHA         1
+#define VOID_BLEND_ADDITIVE      2
+#define VOID_BLEND_PREMULTIPLIED 3
+
+// --- Fragments ---
+// Each section is plain WGSL (any may be empty):
+//   decls      top-level declarations (bindings, structs, helper fns)
+//   attributes vertex inputs, one "name: type" per line
+//   varyings   vertex -> fragment values, one "name: type" per line
+//   vertex     statements inside vs(); read `in.<attr>` (and
+//              `in.instance_index`), write `out.<varying>`
+//   fragment   statements inside fs(); read `in.<varying>`, update `color`
+// Locations and the vertex buffer layout are assigned in link order.
+// Registering identical content twice returns the same id. VOID_MATERIAL_NONE
+// when the fragment table is full.
+uint32_t void_material_fragment(const char *name,
+    const char *decls, const char *attributes, const char *varyings,
+    const char *vertex, const char *fragment);
+
+// --- Materials ---
+void *void_material_create(void);
+void  void_material_destroy(void *material);
+
+// Add a pass rendered in render-queue pass `queue_pass`. Returns its index,
+// or VOID_MATERIAL_NONE when the material already has MAX_PASSES passes.
+uint32_t void_material_add_pass(void *material, uint32_t queue_pass);
+void void_material_pass_add_fragment(void *material, uint32_t pass, uint32_t fragment);
+void void_material_pass_set_cull(void *material, uint32_t pass, uint32_t cull_mode);
+void void_material_pass_set_depth(void *material, uint32_t pass, int depth_write, uint32_t depth_compare);
+void void_material_pass_set_blend(void *material, uint32_t pass, uint32_t blend_mode);
+// color_format 0 = depth-only pass (no fragment stage, e.g. shadow casters).
+void void_material_pass_set_formats(void *material, uint32_t pass, uint32_t color_format, uint32_t depth_format);
+// Rasterizer depth bias (shadow casters): constant + slope_scale * max slope,
+// clamped to `clamp` when non-zero.
+// MSAA sample count of the pass's attachments (1 or 4).
+void void_material_pass_set_sample_count(void *material, uint32_t pass, uint32_t sample_count);
+void void_material_pass_set_depth_bias(void *material, uint32_t pass, int32_t constant, float slope_scale, float clamp);
+
+uint32_t void_material_pass_count(void *material);
+uint32_t void_material_pass_queue_pass(void *material, uint32_t pass);
+int void_material_pass_translucent(void *material, uint32_t pass);
+
+// Linked shader module for a pass (owned by the variant cache).
+void *void_material_pass_shader(void *device, void *material, uint32_t pass);
+
+// Pipeline for a pass against `layout` (owned by the pipeline cache).
+void *void_material_pass_pipeline(void *device, void *material, uint32_t pass, void *layout);
+// Starts compiling that pipeline asynchronously and returns at once (1 = ok);
+// the first void_material_pass_pipeline call waits for it. Lets startup
+// overlap pipeline compiles with each other and with asset loading.
+int void_material_pass_prepare(void *device, void *material, uint32_t pass, void *layout);
+
+// Linked WGSL for a pass (owned by the variant cache; for debugging).
+const char *void_material_pass_source(void *material, uint32_t pass);
+
+// Cache statistics
+uint32_t void_material_variant_count(void);
+uint32_t void_material_pipeline_count(void);
+
+// Release every cached variant and pipeline (call before device release).
+void void_material_cache_clear(void);
+
+#endif
@@ -0,0 +1,620 @@
+// Void Render — Meshes with simplified LOD chains
+
+#include "mesh.h"
+#include "../gpu/dawn.h"
+#include "../gpu/enums.h"
+#include "../math/mat4.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MESH_MAGIC          "VMSH"
+#define MESH_VERSION        1
+#define MAX_PASSES          16      // collapse passes per level
+#define BOUNDARY_WEIGHT     10.0f   // keeps open borders from shrinking inwards
+#define MIN_SHRINK          0.95f   // a level must drop at least 5% of the triangles
+
+typedef struct MeshLod {
+	uint32_t first;
+	uint32_t count;
+	float error;
+} MeshLod;
+
+typedef struct Mesh {
+	float *vertices;
+	uint32_t vertex_count;
+	uint32_t stride;
+	uint32_t position_offset;
+	uint32_t *indices;          // every level back to back
+	uint32_t index_count;
+	MeshLod lods[VOID_MESH_MAX_LODS];
+	uint32_t lod_count;
+	float center[3];
+	float radius;
+	float impostor_px;
+	void *vertex_buffer;
+	void *index_buffer;
+} Mesh;
+
+static float s_pixels_per_unit = 1.0f;
+
+static const float *position(const Mesh *m, uint32_t v) {
+	return m->vertices + (size_t)v * m->stride + m->position_offset;
+}
+
+static void compute_bounds(Mesh *m) {
+	float lo[3] = { INFINITY, INFINITY, INFINITY };
+	float hi[3] = { -INFINITY, -INFINITY, -INFINITY };
+	for (uint32_t v = 0; v < m->vertex_count; v++) {
+		const float *p = position(m, v);
+		for (int i = 0; i < 3; i++) {
+			if (p[i] < lo[i]) lo[i] = p[i];
+			if (p[i] > hi[i]) hi[i] = p[i];
+		}
+	}
+	float r2 = 0.0f;
+	for (int i = 0; i < 3; i++) m->center[i] = m->vertex_count ? (lo[i] + hi[i]) * 0.5f : 0.0f;
+	for (uint32_t v = 0; v < m->vertex_count; v++) {
+		const float *p = position(m, v);
+		float dx = p[0] - m->center[0], dy = p[1] - m->center[1], dz = p[2] - m->center[2];
+		float d2 = dx * dx + dy * dy + dz * dz;
+		if (d2 > r2) r2 = d2;
+	}
+	m->radius = sqrtf(r2);
+}
+
+void *void_mesh_create(const float *vertices, uint32_t vertex_count, uint32_t stride,
+	uint32_t position_offset, const uint32_t *indices, uint32_t index_count
+) {
+	if (vertex_count == 0 || position_offset + 3 > stride || index_count % 3 != 0) {
+		fprintf(stderr, "void_mesh: invalid vertex layout\n");
+		return NULL;
+	}
+	for (uint32_t i = 0; i < index_count; i++) {
+		if (indices[i] >= vertex_count) {
+			fprintf(stderr, "void_mesh: index %u out of range\n", indices[i]);
+			return NULL;
+		}
+	}
+
+	Mesh *m = calloc(1, sizeof(Mesh));
+	size_t vertex_bytes = (size_t)vertex_count * stride * sizeof(float);
+	m->vertices = malloc(vertex_bytes);
+	memcpy(m->vertices, vertices, vertex_bytes);
+	m->vertex_count = vertex_count;
+	m->stride = stride;
+	m->position_offset = position_offset;
+	m->indices = malloc((index_count ? index_count : 1) * sizeof(uint32_t));
+	memcpy(m->indices, indices, index_count * sizeof(uint32_t));
+	m->index_count = index_count;
+	m->lods[0].count = index_count;
+	m->lod_count = 1;
+	compute_bounds(m);
+	return m;
+}
+
+void void_mesh_destroy(void *mesh) {
+	Mesh *m = (Mesh *)mesh;
+	if (!m) return;
+	if (m->vertex_buffer) void_gpu_release_buffer(m->vertex_buffer);
+	if (m->index_buffer) void_gpu_release_buffer(m->index_buffer);
+	free(m->vertices);
+	free(m->indices);
+	free(m);
+}
+
+// --- Simplification (quadric error metrics) ---
+//
+// Vertices sharing a position are welded into one representative ("rep"),
+// so the simplifier sees the connected surface; a weld group whose members
+// differ in other attributes (a UV or normal seam) is locked. Each level
+// runs passes of half-edge collapses onto existing reps, cheapest first,
+// touching each neighbourhood at most once per pass, and rejects collapses
+// that flip a triangle. Output corners keep their original vertex unless
+// their rep moved, in which case they use the target rep.
+
+typedef struct Quadric {
+	double a[10];   // symmetric 4x4: xx xy xz xw yy yz yw zz zw ww
+	double w;       // summed weight (area), normalises the cost to distance^2
+} Quadric;
+
+typedef struct SortVertex {
+	float p[3];
+	uint32_t v;
+} SortVertex;
+
+typedef struct Edge {
+	uint64_t key;       // min rep << 32 | max rep
+	uint32_t tri;
+} Edge;
+
+typedef struct Collapse {
+	float cost;
+	uint32_t from;
+	uint32_t to;
+} Collapse;
+
+static int cmp_sort_vertex(const void *a, const void *b) {
+	const SortVertex *x = a, *y = b;
+	for (int i = 0; i < 3; i++) {
+		if (x->p[i] < y->p[i]) return -1;
+		if (x->p[i] > y->p[i]) return 1;
+	}
+	return x->v < y->v ? -1 : x->v > y->v;
+}
+
+static int cmp_edge(const void *a, const void *b) {
+	const Edge *x = a, *y = b;
+	return x->key < y->key ? -1 : x->key > y->key;
+}
+
+static int cmp_collapse(const void *a, const void *b) {
+	const Collapse *x = a, *y = b;
+	return x->cost < y->cost ? -1 : x->cost > y->cost;
+}
+
+static void quadric_add_plane(Quadric *q, double nx, double ny, double nz, double d, double w) {
+	q->a[0] += w * nx * nx; q->a[1] += w * nx * ny; q->a[2] += w * nx * nz; q->a[3] += w * nx * d;
+	q->a[4] += w * ny * ny; q->a[5] += w * ny * nz; q->a[6] += w * ny * d;
+	q->a[7] += w * nz * nz; q->a[8] += w * nz * d;
+	q->a[9] += w * d * d;
+	q->w += w;
+}
+
+static void quadric_add(Quadric *q, const Quadric *o) {
+	for (int i = 0; i < 10; i++) q->a[i] += o->a[i];
+	q->w += o->w;
+}
+
+static double quadric_error(const Quadric *q, const float *p) {
+	double x = p[0], y = p[1], z = p[2];
+	double e = q->a[0] * x * x + 2 * q->a[1] * x * y + 2 * q->a[2] * x * z + 2 * q->a[3] * x
+		+ q->a[4] * y * y + 2 * q->a[5] * y * z + 2 * q->a[6] * y
+		+ q->a[7] * z * z + 2 * q->a[8] * z
+		+ q->a[9];
+	return e > 0.0 && q->w > 0.0 ? e / q->w : 0.0;
+}
+
+static void cross3(float *out, const float *a, const float *b, const float *c) {
+	float e1[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+	float e2[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+	out[0] = e1[1] * e2[2] - e1[2] * e2[1];
+	out[1] = e1[2] * e2[0] - e1[0] * e2[2];
+	out[2] = e1[0] * e2[1] - e1[1] * e2[0];
+}
+
+// remap[v] = rep of v; locked[rep] = 1 on attribute seams
+static void weld(const Mesh *m, uint32_t *remap, uint8_t *locked) {
+	SortVertex *sorted = malloc(m->vertex_count * sizeof(SortVertex));
+	for (uint32_t v = 0; v < m->vertex_count; v++) {
+		memcpy(sorted[v].p, position(m, v), sizeof(sorted[v].p));
+		sorted[v].v = v;
+	}
+	qsort(sorted, m->vertex_count, sizeof(SortVertex), cmp_sort_vertex);
+
+	size_t vertex_bytes = (size_t)m->stride * sizeof(float);
+	memset(locked, 0, m->vertex_count);
+	for (uint32_t i = 0; i < m->vertex_count; ) {
+		uint32_t rep = sorted[i].v;
+		uint32_t j = i;
+		for (; j < m->vertex_count && memcmp(sorted[j].p, sorted[i].p, sizeof(sorted[i].p)) == 0; j++) {
+			remap[sorted[j].v] = rep;
+			if (memcmp(m->vertices + (size_t)sorted[j].v * m->stride,
+				m->vertices + (size_t)rep * m->stride, vertex_bytes) != 0) {
+				locked[rep] = 1;
+			}
+		}
+		i = j;
+	}
+	free(sorted);
+}
+
+// Simplifies `tris` (rep corners, updated in place) towards target_tris.
+// Returns the largest accepted collapse cost (distance^2).
+static double simplify_level(const Mesh *m, uint32_t *tris, uint32_t tri_count,
+	uint32_t target_tris, const uint8_t *locked, double max_cost
+) {
+	uint32_t n = m->vertex_count;
+	Quadric *quadrics = malloc(n * sizeof(Quadric));
+	Edge *edges = malloc((size_t)tri_count * 3 * sizeof(Edge));
+	Collapse *collapses = malloc((size_t)tri_count * 3 * sizeof(Collapse));
+	uint32_t *adj_offset = malloc((n + 1) * sizeof(uint32_t));
+	uint32_t *adj = malloc((size_t)tri_count * 3 * sizeof(uint32_t));
+	uint8_t *touched = malloc(n);
+	double level_cost = 0.0;
+	uint32_t live = 0;
+	for (uint32_t t = 0; t < tri_count; t++) {
+		uint32_t *c = tris + t * 3;
+		if (c[0] != c[1] && c[1] != c[2] && c[0] != c[2]) live++;
+	}
+
+	// Quadrics: area-weighted face planes plus perpendicular planes along
+	// open borders, accumulated again as collapses merge reps
+	memset(quadrics, 0, n * sizeof(Quadric));
+	for (uint32_t t = 0; t < tri_count; t++) {
+		uint32_t *c = tris + t * 3;
+		if (c[0] == c[1] || c[1] == c[2] || c[0] == c[2]) continue;
+		float nrm[3];
+		const float *p0 = position(m, c[0]);
+		cross3(nrm, p0, position(m, c[1]), position(m, c[2]));
+		double len = sqrt((double)nrm[0] * nrm[0] + (double)nrm[1] * nrm[1] + (double)nrm[2] * nrm[2]);
+		if (len <= 0.0) continue;
+		double nx = nrm[0] / len, ny = nrm[1] / len, nz = nrm[2] / len;
+		double d = -(nx * p0[0] + ny * p0[1] + nz * p0[2]);
+		for (int k = 0; k < 3; k++) quadric_add_plane(&quadrics[c[k]], nx, ny, nz, d, len * 0.5);
+	}
+
+	for (uint32_t pass = 0; pass < MAX_PASSES && live > target_tris; pass++) {
+		// Unique edges of the live triangles; an edge used once is a border
+		uint32_t edge_count = 0;
+		for (uint32_t t = 0; t < tri_count; t++) {
+			uint32_t *c = tris + t * 3;
+			if (c[0] == c[1] || c[1] == c[2] || c[0] == c[2]) continue;
+			for (int k = 0; k < 3; k++) {
+				uint32_t a = c[k], b = c[(k + 1) % 3];
+				uint64_t lo = a < b ? a : b, hi = a < b ? b : a;
+				edges[edge_count].key = lo << 32 | hi;
+				edges[edge_count].tri = t;
+				edge_count++;
+			}
+		}
+		qsort(edges, edge_count, sizeof(Edge), cmp_edge);
+
+		uint32_t collapse_count = 0;
+		for (uint32_t i = 0; i < edge_count; ) {
+			uint32_t j = i + 1;
+			while (j < edge_count && edges[j].key == edges[i].key) j++;
+			uint32_t a = (uint32_t)(edges[i].key >> 32), b = (uint32_t)edges[i].key;
+			if (pass == 0 && j - i == 1) {
+				const uint32_t *c = tris + edges[i].tri * 3;
+				float nrm[3];
+				cross3(nrm, position(m, c[0]), position(m, c[1]), position(m, c[2]));
+				const float *pa = position(m, a), *pb = position(m, b);
+				float e[3] = { pb[0] - pa[0], pb[1] - pa[1], pb[2] - pa[2] };
+				double px = (double)e[1] * nrm[2] - (double)e[2] * nrm[1];
+				double py = (double)e[2] * nrm[0] - (double)e[0] * nrm[2];
+				double pz = (double)e[0] * nrm[1] - (double)e[1] * nrm[0];
+				double len = sqrt(px * px + py * py + pz * pz);
+				if (len > 0.0) {
+					px /= len; py /= len; pz /= len;
+					double d = -(px * pa[0] + py * pa[1] + pz * pa[2]);
+					double w = BOUNDARY_WEIGHT * ((double)e[0] * e[0] + (double)e[1] * e[1] + (double)e[2] * e[2]);
+					quadric_add_plane(&quadrics[a], px, py, pz, d, w);
+					quadric_add_plane(&quadrics[b], px, py, pz, d, w);
+				}
+			}
+			i = j;
+			if (locked[a] && locked[b]) continue;
+			Quadric q = quadrics[a];
+			quadric_add(&q, &quadrics[b]);
+			double to_b = locked[a] ? INFINITY : quadric_error(&q, position(m, b));
+			double to_a = locked[b] ? INFINITY : quadric_error(&q, position(m, a));
+			Collapse *col = &collapses[collapse_count++];
+			col->from = to_b <= to_a ? a : b;
+			col->to = to_b <= to_a ? b : a;
+			col->cost = (float)(to_b <= to_a ? to_b : to_a);
+		}
+		qsort(collapses, collapse_count, sizeof(Collapse), cmp_collapse);
+
+		// Rep -> live triangles (CSR)
+		memset(adj_offset, 0, (n + 1) * sizeof(uint32_t));
+		for (uint32_t t = 0; t < tri_count; t++) {
+			uint32_t *c = tris + t * 3;
+			if (c[0] == c[1] || c[1] == c[2] || c[0] == c[2]) continue;
+			for (int k = 0; k < 3; k++) adj_offset[c[k] + 1]++;
+		}
+		for (uint32_t v = 0; v < n; v++) adj_offset[v + 1] += adj_offset[v];
+		for (uint32_t t = 0; t < tri_count; t++) {
+			uint32_t *c = tris + t * 3;
+			if (c[0] == c[1] || c[1] == c[2] || c[0] == c[2]) continue;
+			for (int k = 0; k < 3; k++) adj[adj_offset[c[k]]++] = t;
+		}
+		for (uint32_t v = n; v > 0; v--) adj_offset[v] = adj_offset[v - 1];
+		adj_offset[0] = 0;
+
+		memset(touched, 0, n);
+		uint32_t applied = 0;
+		for (uint32_t i = 0; i < collapse_count && live > target_tris; i++) {
+			Collapse *col = &collapses[i];
+			if (col->cost > max_cost) break;
+			if (touched[col->from] || touched[col->to]) continue;
+
+			// Reject collapses that flip or squash a surviving triangle
+			const float *pt = position(m, col->to);
+			uint32_t removed = 0;
+			int flips = 0;
+			for (uint32_t k = adj_offset[col->from]; k < adj_offset[col->from + 1] && !flips; k++) {
+				const uint32_t *c = tris + adj[k] * 3;
+				if (c[0] == col->to || c[1] == col->to || c[2] == col->to) {
+					removed++;
+					continue;
+				}
+				const float *p[3], *q[3];
+				for (int e = 0; e < 3; e++) {
+					p[e] = position(m, c[e]);
+					q[e] = c[e] == col->from ? pt : p[e];
+				}
+				float n0[3], n1[3];
+				cross3(n0, p[0], p[1], p[2]);
+				cross3(n1, q[0], q[1], q[2]);
+				flips = n0[0] * n1[0] + n0[1] * n1[1] + n0[2] * n1[2] <= 0.0f;
+			}
+			if (flips || removed == 0) continue;
+
+			for (uint32_t k = adj_offset[col->from]; k < adj_offset[col->from + 1]; k++) {
+				uint32_t *c = tris + adj[k] * 3;
+				for (int e = 0; e < 3; e++) {
+					if (c[e] == col->from) c[e] = col->to;
+					touched[c[e]] = 1;
+				}
+			}
+			touched[col->from] = 1;
+			quadric_add(&quadrics[col->to], &quadrics[col->from]);
+			if (col->cost > level_cost) level_cost = col->cost;
+			live -= removed;
+			applied++;
+		}
+		if (applied == 0) break;
+	}
+
+	free(touched);
+	free(adj);
+	free(adj_offset);
+	free(collapses);
+	free(edges);
+	free(quadrics);
+	return level_cost;
+}
+
+uint32_t void_mesh_build_lods(void *mesh, uint32_t max_lods, float ratio, float max_error) {
+	Mesh *m = (Mesh *)mesh;
+	if (m->vertex_buffer) {
+		fprintf(stderr, "void_mesh: build_lods after upload\n");
+		return m->lod_count;
+	}
+	if (max_lods > VOID_MESH_MAX_LODS) max_lods = VOID_MESH_MAX_LODS;
+	if (ratio <= 0.0f || ratio >= 1.0f) ratio = 0.5f;
+	double max_cost = max_error > 0.0f ? (double)max_error * max_error : INFINITY;
+	m->lod_count = 1;
+	m->index_count = m->lods[0].count;
+
+	uint32_t *remap = malloc(m->vertex_count * sizeof(uint32_t));
+	uint8_t *locked = malloc(m->vertex_count);
+	weld(m, remap, locked);
+
+	uint32_t *tris = malloc((m->lods[0].count ? m->lods[0].count : 1) * sizeof(uint32_t));
+	float error = 0.0f;
+	while (m->lod_count < max_lods) {
+		const MeshLod *prev = &m->lods[m->lod_count - 1];
+		const uint32_t *src = m->indices + prev->first;
+		uint32_t tri_count = prev->count / 3;
+		if (tri_count == 0) break;
+		for (uint32_t i = 0; i < prev->count; i++) tris[i] = remap[src[i]];
+
+		uint32_t target = (uint32_t)(tri_count * ratio);
+		double cost = simplify_level(m, tris, tri_count, target, locked, max_cost);
+
+		uint32_t live = 0;
+		for (uint32_t t = 0; t < tri_count; t++) {
+			const uint32_t *c = tris + t * 3;
+			if (c[0] != c[1] && c[1] != c[2] && c[0] != c[2]) live++;
+		}
+		if (live == 0 || live > tri_count * MIN_SHRINK) break;
+
+		m->indices = realloc(m->indices, (m->index_count + live * 3) * sizeof(uint32_t));
+		src = m->indices + prev->first;
+		uint32_t *dst = m->indices + m->index_count;
+		for (uint32_t t = 0; t < tri_count; t++) {
+			const uint32_t *c = tris + t * 3;
+			if (c[0] == c[1] || c[1] == c[2] || c[0] == c[2]) continue;
+			for (int k = 0; k < 3; k++) {
+				uint32_t original = src[t * 3 + k];
+				*dst++ = c[k] == remap[original] ? original : c[k];
+			}
+		}
+
+		// Quadrics restart per level, so errors add up along the chain
+		error += (float)sqrt(cost);
+		MeshLod *lod = &m->lods[m->lod_count++];
+		lod->first = m->index_count;
+		lod->count = live * 3;
+		lod->error = error;
+		m->index_count += live * 3;
+	}
+
+	free(tris);
+	free(locked);
+	free(remap);
+	return m->lod_count;
+}
+
+// --- Mesh file ---
+
+typedef struct MeshFileHeader {
+	char magic[4];
+	uint32_t version;
+	uint32_t vertex_count;
+	uint32_t stride;
+	uint32_t position_offset;
+	uint32_t index_count;
+	uint32_t lod_count;
+	float center[3];
+	float radius;
+} MeshFileHeader;
+
+int void_mesh_save(void *mesh, const char *path) {
+	Mesh *m = (Mesh *)mesh;
+	FILE *f = fopen(path, "wb");
+	if (!f) {
+		fprintf(stderr, "void_mesh: cannot write %s\n", path);
+		return 0;
+	}
+	MeshFileHeader h = {0};
+	memcpy(h.magic, MESH_MAGIC, 4);
+	h.version = MESH_VERSION;
+	h.vertex_count = m->vertex_count;
+	h.stride = m->stride;
+	h.position_offset = m->position_offset;
+	h.index_count = m->index_count;
+	h.lod_count = m->lod_count;
+	memcpy(h.center, m->center, sizeof(h.center));
+	h.radius = m->radius;
+	int ok = fwrite(&h, sizeof(h), 1, f) == 1
+		&& fwrite(m->lods, sizeof(MeshLod), m->lod_count, f) == m->lod_count
+		&& fwrite(m->vertices, (size_t)m->stride * sizeof(float), m->vertex_count, f) == m->vertex_count
+		&& fwrite(m->indices, sizeof(uint32_t), m->index_count, f) == m->index_count;
+	if (fclose(f) != 0) ok = 0;
+	if (!ok) fprintf(stderr, "void_mesh: failed writing %s\n", path);
+	return ok;
+}
+
+void *void_mesh_load(const char *path) {
+	FILE *f = fopen(path, "rb");
+	if (!f) {
+		fprintf(stderr, "void_mesh: cannot open %s\n", path);
+		return NULL;
+	}
+	MeshFileHeader h;
+	if (fread(&h, sizeof(h), 1, f) != 1 || memcmp(h.magic, MESH_MAGIC, 4) != 0 ||
+		h.version != MESH_VERSION || h.lod_count == 0 || h.lod_count > VOID_MESH_MAX_LODS ||
+		h.vertex_count == 0 || h.position_offset + 3 > h.stride) {
+		fprintf(stderr, "void_mesh: %s is not a mesh file\n", path);
+		fclose(f);
+		return NULL;
+	}
+
+	Mesh *m = calloc(1, sizeof(Mesh));
+	m->vertex_count = h.vertex_count;
+	m->stride = h.stride;
+	m->position_offset = h.position_offset;
+	m->index_count = h.index_count;
+	m->lod_count = h.lod_count;
+	memcpy(m->center, h.center, sizeof(m->center));
+	m->radius = h.radius;
+	m->vertices = malloc((size_t)h.vertex_count * h.stride * sizeof(float));
+	m->indices = malloc((h.index_count ? h.index_count : 1) * sizeof(uint32_t));
+	int ok = fread(m->lods, sizeof(MeshLod), h.lod_count, f) == h.lod_count
+		&& fread(m->vertices, (size_t)h.stride * sizeof(float), h.vertex_count, f) == h.vertex_count
+		&& fread(m->indices, sizeof(uint32_t), h.index_count, f) == h.index_count;
+	fclose(f);
+	for (uint32_t l = 0; ok && l < m->lod_count; l++) {
+		ok = (uint64_t)m->lods[l].first + m->lods[l].count <= m->index_count;
+	}
+	for (uint32_t i = 0; ok && i < m->index_count; i++) ok = m->indices[i] < m->vertex_count;
+	if (!ok) {
+		fprintf(stderr, "void_mesh: %s is truncated or corrupt\n", path);
+		void_mesh_destroy(m);
+		return NULL;
+	}
+	return m;
+}
+
+// --- GPU buffers ---
+
+void void_mesh_upload(void *mesh, void *device) {
+	Mesh *m = (Mesh *)mesh;
+	if (m->vertex_buffer) return;
+	uint64_t vertex_bytes = (uint64_t)m->vertex_count * m->stride * sizeof(float);
+	uint64_t index_bytes = (uint64_t)m->index_count * sizeof(uint32_t);
+	m->vertex_buffer = void_gpu_create_buffer(device, vertex_bytes,
+		BUFFER_USAGE_VERTEX | BUFFER_USAGE_COPY_DST, 0);
+	m->index_buffer = void_gpu_create_buffer(device, index_bytes ? index_bytes : 4,
+		BUFFER_USAGE_INDEX | BUFFER_USAGE_COPY_DST, 0);
+
+	void *queue = void_gpu_get_queue(device);
+	void_gpu_queue_write_buffer(queue, m->vertex_buffer, 0, m->vertices, vertex_bytes);
+	if (index_bytes) void_gpu_queue_write_buffer(queue, m->index_buffer, 0, m->indices, index_bytes);
+	void_gpu_release_queue(queue);
+}
+
+void *void_mesh_vertex_buffer(void *mesh) { return ((Mesh *)mesh)->vertex_buffer; }
+void *void_mesh_index_buffer(void *mesh) { return ((Mesh *)mesh)->index_buffer; }
+uint32_t void_mesh_vertex_count(void *mesh) { return ((Mesh *)mesh)->vertex_count; }
+uint32_t void_mesh_lod_count(void *mesh) { return ((Mesh *)mesh)->lod_count; }
+float void_mesh_radius(void *mesh) { return ((Mesh *)mesh)->radius; }
+const float *void_mesh_center(void *mesh) { return ((Mesh *)mesh)->center; }
+
+uint32_t void_mesh_lod_first(void *mesh, uint32_t lod) {
+	Mesh *m = (Mesh *)mesh;
+	return lod < m->lod_count ? m->lods[lod].first : 0;
+}
+
+uint32_t void_mesh_lod_index_count(void *mesh, uint32_t lod) {
+	Mesh *m = (Mesh *)mesh;
+	return lod < m->lod_count ? m->lods[lod].count : 0;
+}
+
+float void_mesh_lod_error(void *mesh, uint32_t lod) {
+	Mesh *m = (Mesh *)mesh;
+	return lod < m->lod_count ? m->lods[lod].error : 0.0f;
+}
+
+// --- Selection ---
+
+void void_mesh_set_viewport(float height) {
+	// projection[5] = 1 / tan(fovY / 2): NDC units per view unit at distance 1
+	const float *proj = (const float *)void_math_get_projection();
+	s_pixels_per_unit = proj[5] * height * 0.5f;
+}
+
+float void_mesh_screen_size(void *mesh, float distance) {
+	Mesh *m = (Mesh *)mesh;
+	if (distance < 1e-4f) distance = 1e-4f;
+	return 2.0f * m->radius * s_pixels_per_unit / distance;
+}
+
+void void_mesh_set_impostor_size(void *mesh, float pixels) {
+	((Mesh *)mesh)->impostor_px = pixels > 0.0f ? pixels : 0.0f;
+}
+
+uint32_t void_mesh_select_lod(void *mesh, uint32_t current, float distance, float threshold_px) {
+	Mesh *m = (Mesh *)mesh;
+	if (distance < 1e-4f) distance = 1e-4f;
+	float scale = s_pixels_per_unit / distance;
+
+	if (m->impostor_px > 0.0f) {
+		float size = 2.0f * m->radius * scale;
+		float enter = m->impostor_px * (1.0f - VOID_MESH_LOD_HYSTERESIS);
+		if (current == VOID_MESH_LOD_IMPOSTOR ? size < m->impostor_px : size < enter) {
+			return VOID_MESH_LOD_IMPOSTOR;
+		}
+	}
+	if (current >= m->lod_count) current = m->lod_count - 1;
+
+	// Errors grow along the chain: find the coarsest level within the
+	// threshold, and within the tighter coarsening threshold
+	float coarsen_px = threshold_px * (1.0f - VOID_MESH_LOD_HYSTERESIS);
+	uint32_t fit = 0, coarse = 0;
+	for (uint32_t l = 1; l < m->lod_count; l++) {
+		float px = m->lods[l].error * scale;
+		if (px <= threshold_px) fit = l;
+		if (px <= coarsen_px) coarse = l;
+	}
+	if (fit < current) return fit;
+	if (coarse > current) return coarse;
+	return current;
+}
+
+void void_mesh_impostor_quad(void *mesh, const float *position, float *out) {
+	Mesh *m = (Mesh *)mesh;
+	// Camera right and up in world space: the view matrix's first two rows
+	const float *view = (const float *)void_math_get_view();
+	float right[3] = { view[0], view[4], view[8] };
+	float up[3] = { view[1], view[5], view[9] };
+	float c[3] = {
+		position[0] + m->center[0], position[1] + m->center[1], position[2] + m->center[2]
+	};
+	static const float corners[4][4] = {
+		{ -1.0f, -1.0f, 0.0f, 1.0f }, { 1.0f, -1.0f, 1.0f, 1.0f },
+		{ -1.0f, 1.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f, 0.0f },
+	};
+	for (int i = 0; i < 4; i++) {
+		float sx = corners[i][0] * m->radius, sy = corners[i][1] * m->radius;
+		float *o = out + i * 5;
+		for (int k = 0; k < 3; k++) o[k] = c[k] + right[k] * sx + up[k] * sy;
+		o[3] = corners[i][2];
+		o[4] = corners[i][3];
+	}
+}
@@ -0,0 +1,77 @@
+// Void Render — Meshes with simplified LOD chains
+// A mesh keeps one interleaved vertex buffer and one index buffer holding
+// every LOD's triangle list back to back: level 0 is the source mesh, each
+// further level a quadric-error-metric (QEM) simplification of the previous
+// one that reuses the same vertices, so levels differ only in their index
+// range. Each level stores its geometric error (object units). LODs are
+// built at load with void_mesh_build_lods, or offline and stored in a mesh
+// file (void_mesh_save / void_mesh_load).
+//
+// Selection projects a level's error to pixels with the projection set by
+// void_math_set_perspective (call void_mesh_set_viewport after it) and
+// picks the coarsest level under the pixel threshold. Coarsening needs a
+// VOID_MESH_LOD_HYSTERESIS margin, so an object near a switch distance
+// does not pop back and forth. Below the mesh's impostor size the
+// selection returns VOID_MESH_LOD_IMPOSTOR: draw a camera-facing billboard
+// (void_mesh_impostor_quad) with a texture the caller baked of the mesh.
+
+#ifndef VOID_RENDER_MESH_H
+#define VOID_RENDER_MESH_H
+
+#include <stdint.h>
+
+#define VOID_MESH_MAX_LODS          8
+#define VOID_MESH_LOD_HYSTERESIS    0.25f    // coarsen only below 75% of the threshold
+#define VOID_MESH_LOD_IMPOSTOR      0xFFFFFFFFu
+
+// vertices: vertex_count x stride floats; the position is 3 floats at
+// position_offset. Both arrays are copied.
+void *void_mesh_create(const float *vertices, uint32_t vertex_count, uint32_t stride,
+    uint32_t position_offset, const uint32_t *indices, uint32_t index_count);
+void  void_mesh_destroy(void *mesh);
+
+// Appends levels until max_lods, each aiming at `ratio` of the previous
+// level's triangles (0 = 0.5). Stops early when a level would exceed
+// max_error (object units, 0 = no limit) or stops shrinking. Vertices on UV
+// or normal seams are kept, so seams never tear. Replaces existing LODs
+// above level 0 and must run before upload. Returns the level count.
+uint32_t void_mesh_build_lods(void *mesh, uint32_t max_lods, float ratio, float max_error);
+
+// Mesh file ("VMSH": vertices, indices, LOD table, bounds). 1 on success.
+int   void_mesh_save(void *mesh, const char *path);
+void *void_mesh_load(const char *path);   // NULL on failure
+
+// Creates the vertex (Vertex | CopyDst) and index (Index | CopyDst) buffers
+void void_mesh_upload(void *mesh, void *device);
+void *void_mesh_vertex_buffer(void *mesh);
+void *void_mesh_index_buffer(void *mesh);   // uint32 indices
+
+uint32_t void_mesh_vertex_count(void *mesh);
+uint32_t void_mesh_lod_count(void *mesh);
+uint32_t void_mesh_lod_first(void *mesh, uint32_t lod);         // first index
+uint32_t void_mesh_lod_index_count(void *mesh, uint32_t lod);
+float    void_mesh_lod_error(void *mesh, uint32_t lod);
+float    void_mesh_radius(void *mesh);                            // bounding sphere
+const float *void_mesh_center(void *mesh);                        // 3 floats
+
+// --- Selection ---
+
+// Pixels per object unit at distance 1 for the current projection (from
+// void_math_set_perspective) and a viewport `height` pixels tall
+void  void_mesh_set_viewport(float height);
+// Projected bounding-sphere diameter, in pixels
+float void_mesh_screen_size(void *mesh, float distance);
+// Level to draw at `distance` (view space) given the level drawn last frame
+// (`current`, 0 the first time). threshold_px: allowed projected error.
+uint32_t void_mesh_select_lod(void *mesh, uint32_t current, float distance, float threshold_px);
+
+// Below `pixels` of screen size selection returns VOID_MESH_LOD_IMPOSTOR
+// (0 = never). Leaving it needs the same hysteresis margin.
+void void_mesh_set_impostor_size(void *mesh, float pixels);
+
+// Camera-facing quad covering the bounding sphere of a mesh placed at
+// `position` (world), for the current view matrix: 4 corners x (pos.xyz,
+// uv.xy) = 20 floats, triangle-strip order.
+void void_mesh_impostor_quad(void *mesh, const float *position, float *out);
+
+#endif
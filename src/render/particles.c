@@ -0,0 +1,758 @@
+// Void Render — GPU particles
+
+#include "particles.h"
+#include "../gpu/dawn.h"
+#include "../gpu/enums.h"
+#include "../gpu/cache.h"
+#include "../math/mat4.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WORKGROUP_SIZE 64
+
+// Sort steps live at 256-byte offsets (uniform offset alignment)
+#define STEP_STRIDE 256
+
+// Indirect argument buffer layout, in u32s (see finalize/prepare below)
+#define ARGS_SIMULATE 0        // dispatch x, y, z
+#define ARGS_SORT     4        // dispatch x, y, z
+#define ARGS_DRAW     8        // vertexCount, instanceCount, firstVertex, firstInstance
+#define ARGS_COUNT    12
+
+// --- GPU layouts (must match the WGSL structs below) ---
+
+typedef struct GpuParticle {
+	float pos[3];
+	float age;
+	float vel[3];
+	float life;
+} GpuParticle;
+
+typedef struct SimUniforms {
+	float    view_proj[16];
+	float    inv_view_proj[16];
+	float    camera[4];      // eye, dt
+	float    emitter[4];     // position, radius
+	float    direction[4];   // direction, cos(spread)
+	float    speed_life[4];  // speed min/max, lifetime min/max
+	float    forces[4];      // gravity, drag
+	float    collision[4];   // enabled, restitution, thickness, friction
+	float    screen[4];      // depth area width, height
+	uint32_t counts[4];      // emit count, capacity, current alive list, seed
+} SimUniforms;
+
+typedef struct DrawUniforms {
+	float view_proj[16];
+	float right[4];
+	float up[4];
+	float color_start[4];
+	float color_end[4];
+	float size[4];           // start, end
+} DrawUniforms;
+
+// --- WGSL ---
+
+#define WGSL_PARTICLE \
+"struct Particle {\n" \
+"  pos: vec3f,\n" \
+"  age: f32,\n" \
+"  vel: vec3f,\n" \
+"  life: f32,\n" \
+"};\n"
+
+// Preceded by the scene_depth declaration (depth texture type varies)
+static const char *s_sim_wgsl =
+WGSL_PARTICLE
+"struct SimUniforms {\n"
+"  view_proj: mat4x4f,\n"
+"  inv_view_proj: mat4x4f,\n"
+"  camera: vec4f,\n"
+"  emitter: vec4f,\n"
+"  direction: vec4f,\n"
+"  speed_life: vec4f,\n"
+"  forces: vec4f,\n"
+"  collision: vec4f,\n"
+"  screen: vec4f,\n"
+"  counts: vec4u,\n"
+"};\n"
+"struct SortStep {\n"
+"  k: u32,\n"
+"  j: u32,\n"
+"  pad0: u32,\n"
+"  pad1: u32,\n"
+"};\n"
+"@group(0) @binding(0) var<uniform> sim: SimUniforms;\n"
+"@group(0) @binding(1) var<storage, read_write> particles: array<Particle>;\n"
+"@group(0) @binding(2) var<storage, read_write> dead: array<u32>;\n"
+"// Two alive lists of `capacity` entries, swapped every frame\n"
+"@group(0) @binding(3) var<storage, read_write> alive: array<u32>;\n"
+"// (sort key, particle index)\n"
+"@group(0) @binding(4) var<storage, read_write> keys: array<vec2u>;\n"
+"// dead count, alive count of list 0 and 1, sort size\n"
+"@group(0) @binding(5) var<storage, read_write> counters: array<atomic<u32>, 4>;\n"
+"@group(1) @binding(0) var<storage, read_write> args: array<u32, 12>;\n"
+"@group(1) @binding(1) var<uniform> sort_step: SortStep;\n"
+"\n"
+"fn pcg(v: u32) -> u32 {\n"
+"  let state = v * 747796405u + 2891336453u;\n"
+"  let word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;\n"
+"  return (word >> 22u) ^ word;\n"
+"}\n"
+"\n"
+"fn rand01(seed: ptr<function, u32>) -> f32 {\n"
+"  *seed = pcg(*seed);\n"
+"  return f32(*seed >> 8u) * (1.0 / 16777216.0);\n"
+"}\n"
+"\n"
+"@compute @workgroup_size(64) fn emit(@builtin(global_invocation_id) gid: vec3u) {\n"
+"  if (gid.x >= sim.counts.x) {\n"
+"    return;\n"
+"  }\n"
+"  let capacity = sim.counts.y;\n"
+"  // Pop a free index; losers of the race for the last ones put the count back\n"
+"  let free_count = atomicSub(&counters[0], 1u);\n"
+"  if (free_count == 0u || free_count > capacity) {\n"
+"    atomicAdd(&counters[0], 1u);\n"
+"    return;\n"
+"  }\n"
+"  let idx = dead[free_count - 1u];\n"
+"\n"
+"  var seed = pcg(gid.x ^ pcg(sim.counts.w));\n"
+"  let axis = sim.direction.xyz;\n"
+"  let cos_t = mix(1.0, sim.direction.w, rand01(&seed));\n"
+"  let sin_t = sqrt(max(1.0 - cos_t * cos_t, 0.0));\n"
+"  let phi = rand01(&seed) * 6.2831853;\n"
+"  let helper = select(vec3f(1.0, 0.0, 0.0), vec3f(0.0, 1.0, 0.0), abs(axis.x) > 0.9);\n"
+"  let t1 = normalize(cross(axis, helper));\n"
+"  let t2 = cross(axis, t1);\n"
+"  let dir = axis * cos_t + (t1 * cos(phi) + t2 * sin(phi)) * sin_t;\n"
+"\n"
+"  let z = rand01(&seed) * 2.0 - 1.0;\n"
+"  let a = rand01(&seed) * 6.2831853;\n"
+"  let r = pow(rand01(&seed), 1.0 / 3.0) * sim.emitter.w;\n"
+"  let s = sqrt(1.0 - z * z);\n"
+"\n"
+"  var p: Particle;\n"
+"  p.pos = sim.emitter.xyz + vec3f(s * cos(a), s * sin(a), z) * r;\n"
+"  p.age = 0.0;\n"
+"  p.vel = dir * mix(sim.speed_life.x, sim.speed_life.y, rand01(&seed));\n"
+"  p.life = max(mix(sim.speed_life.z, sim.speed_life.w, rand01(&seed)), 0.001);\n"
+"  particles[idx] = p;\n"
+"\n"
+"  let cur = sim.counts.z;\n"
+"  let slot = atomicAdd(&counters[1u + cur], 1u);\n"
+"  alive[cur * capacity + slot] = idx;\n"
+"}\n"
+"\n"
+"@compute @workgroup_size(1) fn prepare() {\n"
+"  let cur = sim.counts.z;\n"
+"  atomicStore(&counters[2u - cur], 0u);\n"
+"  let count = atomicLoad(&counters[1u + cur]);\n"
+"  args[0] = (count + 63u) / 64u;\n"
+"  args[1] = 1u;\n"
+"  args[2] = 1u;\n"
+"}\n"
+"\n"
+"fn depth_world(c: vec2i, d: f32) -> vec3f {\n"
+"  let uv = (vec2f(c) + 0.5) / sim.screen.xy;\n"
+"  let w = sim.inv_view_proj * vec4f(uv.x * 2.0 - 1.0, 1.0 - uv.y * 2.0, d, 1.0);\n"
+"  return w.xyz / w.w;\n"
+"}\n"
+"\n"
+"fn collide(p: ptr<function, Particle>) {\n"
+"  let clip = sim.view_proj * vec4f((*p).pos, 1.0);\n"
+"  if (clip.w <= 0.0) {\n"
+"    return;\n"
+"  }\n"
+"  let ndc = clip.xyz / clip.w;\n"
+"  let c = vec2i((vec2f(ndc.x, -ndc.y) * 0.5 + 0.5) * sim.screen.xy);\n"
+"  if (any(c < vec2i(0)) || any(c >= vec2i(sim.screen.xy) - 1)) {\n"
+"    return;\n"
+"  }\n"
+"  // In front of the visible surface, or nothing there\n"
+"  let d = textureLoad(scene_depth, c, 0);\n"
+"  if (d >= 1.0 || ndc.z <= d) {\n"
+"    return;\n"
+"  }\n"
+"\n"
+"  let surface = depth_world(c, d);\n"
+"  let dx = depth_world(c + vec2i(1, 0), textureLoad(scene_depth, c + vec2i(1, 0), 0)) - surface;\n"
+"  let dy = depth_world(c + vec2i(0, 1), textureLoad(scene_depth, c + vec2i(0, 1), 0)) - surface;\n"
+"  var n = cross(dy, dx);\n"
+"  let len = length(n);\n"
+"  if (len < 1e-8) {\n"
+"    return;\n"
+"  }\n"
+"  n = n / len;\n"
+"  if (dot(n, sim.camera.xyz - surface) < 0.0) {\n"
+"    n = -n;\n"
+"  }\n"
+"\n"
+"  // Far behind the surface: hidden by it, not touching it\n"
+"  let behind = dot(surface - (*p).pos, n);\n"
+"  if (behind > sim.collision.z) {\n"
+"    return;\n"
+"  }\n"
+"  (*p).pos += n * (max(behind, 0.0) + 0.001);\n"
+"  let vn = dot((*p).vel, n);\n"
+"  if (vn < 0.0) {\n"
+"    let tangent = (*p).vel - n * vn;\n"
+"    (*p).vel = tangent * (1.0 - sim.collision.w) - n * vn * sim.collision.y;\n"
+"  }\n"
+"}\n"
+"\n"
+"@compute @workgroup_size(64) fn simulate(@builtin(global_invocation_id) gid: vec3u) {\n"
+"  let cur = sim.counts.z;\n"
+"  let nxt = 1u - cur;\n"
+"  let capacity = sim.counts.y;\n"
+"  if (gid.x >= atomicLoad(&counters[1u + cur])) {\n"
+"    return;\n"
+"  }\n"
+"  let idx = alive[cur * capacity + gid.x];\n"
+"  var p = particles[idx];\n"
+"  let dt = sim.camera.w;\n"
+"  p.age += dt;\n"
+"  if (p.age >= p.life) {\n"
+"    let free_slot = atomicAdd(&counters[0], 1u);\n"
+"    dead[free_slot] = idx;\n"
+"    return;\n"
+"  }\n"
+"\n"
+"  p.vel = (p.vel + sim.forces.xyz * dt) * max(1.0 - sim.forces.w * dt, 0.0);\n"
+"  p.pos += p.vel * dt;\n"
+"  if (sim.collision.x > 0.0) {\n"
+"    collide(&p);\n"
+"  }\n"
+"  particles[idx] = p;\n"
+"\n"
+"  // Compact survivors into the other list, keyed far-to-near: a positive\n"
+"  // float's bits order like the float, so invert them\n"
+"  let slot = atomicAdd(&counters[1u + nxt], 1u);\n"
+"  alive[nxt * capacity + slot] = idx;\n"
+"  let dist = max(distance(p.pos, sim.camera.xyz), 1e-6);\n"
+"  keys[slot] = vec2u(~bitcast<u32>(dist), idx);\n"
+"}\n"
+"\n"
+"@compute @workgroup_size(1) fn finalize() {\n"
+"  let count = atomicLoad(&counters[2u - sim.counts.z]);\n"
+"  var sort_size = 2u;\n"
+"  while (sort_size < count) {\n"
+"    sort_size = sort_size << 1u;\n"
+"  }\n"
+"  atomicStore(&counters[3], sort_size);\n"
+"  args[4] = (sort_size + 63u) / 64u;\n"
+"  args[5] = 1u;\n"
+"  args[6] = 1u;\n"
+"  args[8] = 6u;\n"
+"  args[9] = count;\n"
+"  args[10] = 0u;\n"
+"  args[11] = 0u;\n"
+"}\n"
+"\n"
+"// Keys past the survivors sort last\n"
+"@compute @workgroup_size(64) fn sort_pad(@builtin(global_invocation_id) gid: vec3u) {\n"
+"  let count = atomicLoad(&counters[2u - sim.counts.z]);\n"
+"  if (gid.x < count || gid.x >= atomicLoad(&counters[3])) {\n"
+"    return;\n"
+"  }\n"
+"  keys[gid.x] = vec2u(0xFFFFFFFFu, 0u);\n"
+"}\n"
+"\n"
+"// One bitonic compare-exchange step. Steps for blocks larger than this\n"
+"// frame's sort size have nothing left to do.\n"
+"@compute @workgroup_size(64) fn sort_merge(@builtin(global_invocation_id) gid: vec3u) {\n"
+"  let n = atomicLoad(&counters[3]);\n"
+"  let i = gid.x;\n"
+"  if (sort_step.k > n || i >= n) {\n"
+"    return;\n"
+"  }\n"
+"  let l = i ^ sort_step.j;\n"
+"  if (l <= i) {\n"
+"    return;\n"
+"  }\n"
+"  let a = keys[i];\n"
+"  let b = keys[l];\n"
+"  let ascending = (i & sort_step.k) == 0u;\n"
+"  if (select(a.x < b.x, a.x > b.x, ascending)) {\n"
+"    keys[i] = b;\n"
+"    keys[l] = a;\n"
+"  }\n"
+"}\n";
+
+static const char *s_draw_wgsl =
+WGSL_PARTICLE
+"struct DrawUniforms {\n"
+"  view_proj: mat4x4f,\n"
+"  right: vec4f,\n"
+"  up: vec4f,\n"
+"  color_start: vec4f,\n"
+"  color_end: vec4f,\n"
+"  size: vec4f,\n"
+"};\n"
+"@group(0) @binding(0) var<uniform> draw_u: DrawUniforms;\n"
+"@group(0) @binding(1) var<storage, read> particles: array<Particle>;\n"
+"@group(0) @binding(2) var<storage, read> keys: array<vec2u>;\n"
+"\n"
+"struct VsOut {\n"
+"  @builtin(position) pos: vec4f,\n"
+"  @location(0) uv: vec2f,\n"
+"  @location(1) color: vec4f,\n"
+"};\n"
+"\n"
+"@vertex fn vs_main(@builtin(vertex_index) vi: u32, @builtin(instance_index) ii: u32) -> VsOut {\n"
+"  var corners = array<vec2f, 6>(\n"
+"    vec2f(0.0, 0.0), vec2f(1.0, 0.0), vec2f(1.0, 1.0),\n"
+"    vec2f(0.0, 0.0), vec2f(1.0, 1.0), vec2f(0.0, 1.0));\n"
+"  let corner = corners[vi];\n"
+"  let p = particles[keys[ii].y];\n"
+"  let t = clamp(p.age / p.life, 0.0, 1.0);\n"
+"  let size = mix(draw_u.size.x, draw_u.size.y, t);\n"
+"  let offset = (draw_u.right.xyz * (corner.x - 0.5) + draw_u.up.xyz * (corner.y - 0.5)) * size;\n"
+"  var out: VsOut;\n"
+"  out.pos = draw_u.view_proj * vec4f(p.pos + offset, 1.0);\n"
+"  out.uv = corner * 2.0 - 1.0;\n"
+"  out.color = mix(draw_u.color_start, draw_u.color_end, t);\n"
+"  return out;\n"
+"}\n"
+"\n"
+"@fragment fn fs_main(in: VsOut) -> @location(0) vec4f {\n"
+"  let falloff = clamp(1.0 - dot(in.uv, in.uv), 0.0, 1.0);\n"
+"  return vec4f(in.color.rgb, in.color.a * falloff);\n"
+"}\n";
+
+// --- Particles ---
+
+typedef struct Particles {
+	void    *device;
+	uint32_t capacity;
+	uint32_t sort_capacity;  // power of two >= capacity
+	uint32_t step_count;
+	uint32_t current;        // alive list simulated next
+	uint32_t depth_samples;
+
+	// Emitter & simulation settings (uploaded per simulate)
+	SimUniforms  sim;
+	DrawUniforms draw;
+	float    rate;
+	float    rate_accum;
+	uint32_t burst;
+	uint32_t seed;
+	uint64_t emitted;
+
+	void *particle_buffer;
+	void *dead_buffer;
+	void *alive_buffer;
+	void *key_buffer;
+	void *counter_buffer;
+	void *args_buffer;
+	void *sim_uniform_buffer;
+	void *step_buffer;
+	void *draw_uniform_buffer;
+	void *dummy_depth;       // bound when there is no depth texture
+	void *dummy_depth_view;
+
+	void *sim_layout;        // cached
+	void *args_layout;       // cached
+	void *step_layout;       // cached
+	void *sim_pipeline_layout;   // cached
+	void *args_pipeline_layout;  // cached
+	void *step_pipeline_layout;  // cached
+	void *args_group;        // cached
+	void *step_group;        // cached
+	void *sim_group;         // cached, for group_depth
+	void *group_depth;
+
+	void *sim_shader;
+	void *emit_pipeline;
+	void *prepare_pipeline;
+	void *simulate_pipeline;
+	void *finalize_pipeline;
+	void *pad_pipeline;
+	void *merge_pipeline;
+
+	void *draw_layout;       // cached
+	void *draw_pipeline_layout;  // cached
+	void *draw_group;        // cached
+	void *draw_shader;
+	void *draw_pipeline;
+} Particles;
+
+static void *storage_buffer(void *device, uint64_t size, uint32_t extra_usage) {
+	return void_gpu_create_buffer(device, size,
+		BUFFER_USAGE_STORAGE | BUFFER_USAGE_COPY_DST | extra_usage, 0);
+}
+
+static void create_buffers(Particles *p, void *device) {
+	uint64_t cap = p->capacity;
+	p->particle_buffer = storage_buffer(device, cap * sizeof(GpuParticle), 0);
+	p->dead_buffer = storage_buffer(device, cap * sizeof(uint32_t), 0);
+	p->alive_buffer = storage_buffer(device, cap * 2 * sizeof(uint32_t), 0);
+	p->key_buffer = storage_buffer(device, (uint64_t)p->sort_capacity * 2 * sizeof(uint32_t), 0);
+	p->counter_buffer = storage_buffer(device, 4 * sizeof(uint32_t), 0);
+	p->args_buffer = storage_buffer(device, ARGS_COUNT * sizeof(uint32_t), BUFFER_USAGE_INDIRECT);
+	p->sim_uniform_buffer = void_gpu_create_buffer(device, sizeof(SimUniforms),
+		BUFFER_USAGE_UNIFORM | BUFFER_USAGE_COPY_DST, 0);
+	p->draw_uniform_buffer = void_gpu_create_buffer(device, sizeof(DrawUniforms),
+		BUFFER_USAGE_UNIFORM | BUFFER_USAGE_COPY_DST, 0);
+
+	// One (k, j) pair per bitonic step, selected by dynamic offset
+	p->step_buffer = void_gpu_create_buffer(device, (uint64_t)p->step_count * STEP_STRIDE,
+		BUFFER_USAGE_UNIFORM | BUFFER_USAGE_COPY_DST, 0);
+	void *queue = void_gpu_get_queue(device);
+	uint8_t *steps = calloc(p->step_count, STEP_STRIDE);
+	uint32_t s = 0;
+	for (uint32_t k = 2; k <= p->sort_capacity; k <<= 1) {
+		for (uint32_t j = k >> 1; j > 0; j >>= 1) {
+			uint32_t *step = (uint32_t *)(steps + (size_t)s++ * STEP_STRIDE);
+			step[0] = k;
+			step[1] = j;
+		}
+	}
+	void_gpu_queue_write_buffer(queue, p->step_buffer, 0, steps, (uint64_t)p->step_count * STEP_STRIDE);
+	free(steps);
+
+	// Every particle starts on the dead list
+	uint32_t *dead = malloc(cap * sizeof(uint32_t));
+	for (uint32_t i = 0; i < p->capacity; i++) dead[i] = i;
+	void_gpu_queue_write_buffer(queue, p->dead_buffer, 0, dead, cap * sizeof(uint32_t));
+	free(dead);
+
+	uint32_t counters[4] = { p->capacity, 0, 0, 2 };
+	void_gpu_queue_write_buffer(queue, p->counter_buffer, 0, counters, sizeof(counters));
+	uint32_t args[ARGS_COUNT] = { 0, 1, 1, 0, 0, 1, 1, 0, 6, 0, 0, 0 };
+	void_gpu_queue_write_buffer(queue, p->args_buffer, 0, args, sizeof(args));
+	void_gpu_release_queue(queue);
+}
+
+static void create_compute(Particles *p, void *device) {
+	void *b = void_gpu_layout_begin();
+	void_gpu_layout_buffer(b, 0, STAGE_COMPUTE, BINDING_UNIFORM, sizeof(SimUniforms), 0);
+	for (uint32_t i = 1; i <= 5; i++) void_gpu_layout_buffer(b, i, STAGE_COMPUTE, BINDING_STORAGE, 0, 0);
+	void_gpu_layout_texture(b, 6, STAGE_COMPUTE, SAMPLE_TYPE_DEPTH, VIEW_2D, p->depth_samples > 1);
+	p->sim_layout = void_gpu_layout_finish(device, b);
+
+	b = void_gpu_layout_begin();
+	void_gpu_layout_buffer(b, 0, STAGE_COMPUTE, BINDING_STORAGE, 0, 0);
+	p->args_layout = void_gpu_layout_finish(device, b);
+
+	b = void_gpu_layout_begin();
+	void_gpu_layout_buffer(b, 1, STAGE_COMPUTE, BINDING_UNIFORM, 16, 1);
+	p->step_layout = void_gpu_layout_finish(device, b);
+
+	p->sim_pipeline_layout = void_gpu_cached_pipeline_layout_1(device, p->sim_layout);
+	p->args_pipeline_layout = void_gpu_cached_pipeline_layout_2(device, p->sim_layout, p->args_layout);
+	p->step_pipeline_layout = void_gpu_cached_pipeline_layout_2(device, p->sim_layout, p->step_layout);
+
+	void *g = void_gpu_group_begin(p->args_layout);
+	void_gpu_group_buffer(g, 0, p->args_buffer, 0, 0);
+	p->args_group = void_gpu_group_finish(device, g);
+	g = void_gpu_group_begin(p->step_layout);
+	void_gpu_group_buffer(g, 1, p->step_buffer, 0, 16);
+	p->step_group = void_gpu_group_finish(device, g);
+
+	const char *depth_decl = p->depth_samples > 1
+		? "@group(0) @binding(6) var scene_depth: texture_depth_multisampled_2d;\n"
+		: "@group(0) @binding(6) var scene_depth: texture_depth_2d;\n";
+	size_t len = strlen(depth_decl) + strlen(s_sim_wgsl) + 1;
+	char *source = malloc(len);
+	strcpy(source, depth_decl);
+	strcat(source, s_sim_wgsl);
+	p->sim_shader = void_gpu_create_shader(device, source);
+	free(source);
+
+	p->emit_pipeline = void_gpu_create_compute_pipeline(device, p->sim_shader, "emit", p->sim_pipeline_layout);
+	p->prepare_pipeline = void_gpu_create_compute_pipeline(device, p->sim_shader, "prepare", p->args_pipeline_layout);
+	p->simulate_pipeline = void_gpu_create_compute_pipeline(device, p->sim_shader, "simulate", p->sim_pipeline_layout);
+	p->finalize_pipeline = void_gpu_create_compute_pipeline(device, p->sim_shader, "finalize", p->args_pipeline_layout);
+	p->pad_pipeline = void_gpu_create_compute_pipeline(device, p->sim_shader, "sort_pad", p->sim_pipeline_layout);
+	p->merge_pipeline = void_gpu_create_compute_pipeline(device, p->sim_shader, "sort_merge", p->step_pipeline_layout);
+
+	if (p->depth_samples == 0) {
+		p->dummy_depth = void_gpu_create_texture(device, 1, 1, FMT_DEPTH32_FLOAT,
+			TEXTURE_USAGE_TEXTURE_BINDING, 1);
+		p->dummy_depth_view = void_gpu_create_texture_view(p->dummy_depth);
+	}
+}
+
+static void create_draw(Particles *p, void *device,
+	uint32_t color_format, uint32_t depth_format, uint32_t samples
+) {
+	void *b = void_gpu_layout_begin();
+	void_gpu_layout_buffer(b, 0, STAGE_VERTEX, BINDING_UNIFORM, sizeof(DrawUniforms), 0);
+	void_gpu_layout_buffer(b, 1, STAGE_VERTEX, BINDING_READ_ONLY_STORAGE, 0, 0);
+	void_gpu_layout_buffer(b, 2, STAGE_VERTEX, BINDING_READ_ONLY_STORAGE, 0, 0);
+	p->draw_layout = void_gpu_layout_finish(device, b);
+	p->draw_pipeline_layout = void_gpu_cached_pipeline_layout_1(device, p->draw_layout);
+
+	void *g = void_gpu_group_begin(p->draw_layout);
+	void_gpu_group_buffer(g, 0, p->draw_uniform_buffer, 0, 0);
+	void_gpu_group_buffer(g, 1, p->particle_buffer, 0, 0);
+	void_gpu_group_buffer(g, 2, p->key_buffer, 0, 0);
+	p->draw_group = void_gpu_group_finish(device, g);
+
+	// Alpha blended over the scene, depth tested but not written
+	p->draw_shader = void_gpu_create_shader(device, s_draw_wgsl);
+	VoidRenderPipelineDesc d = {0};
+	d.shader = p->draw_shader;
+	d.vs_entry = "vs_main";
+	d.fs_entry = "fs_main";
+	d.layout = p->draw_pipeline_layout;
+	d.color_format = color_format;
+	d.sample_count = samples;
+	d.depth_format = depth_format;
+	d.depth_write = 0;
+	d.has_blend = 1;
+	d.blend_color_src = BLEND_SRC_ALPHA;
+	d.blend_color_dst = BLEND_ONE_MINUS_SRC_ALPHA;
+	d.blend_color_op = BLEND_OP_ADD;
+	d.blend_alpha_src = BLEND_ONE;
+	d.blend_alpha_dst = BLEND_ONE_MINUS_SRC_ALPHA;
+	d.blend_alpha_op = BLEND_OP_ADD;
+	p->draw_pipeline = void_gpu_create_render_pipeline_desc(device, &d);
+}
+
+void *void_particles_create(void *device, uint32_t capacity,
+	uint32_t color_format, uint32_t depth_format, uint32_t samples,
+	uint32_t depth_samples
+) {
+	Particles *p = calloc(1, sizeof(Particles));
+	p->device = device;
+	p->capacity = capacity ? capacity : 1;
+	p->sort_capacity = 2;
+	while (p->sort_capacity < p->capacity) p->sort_capacity <<= 1;
+	for (uint32_t k = 2; k <= p->sort_capacity; k <<= 1) {
+		for (uint32_t j = k >> 1; j > 0; j >>= 1) p->step_count++;
+	}
+	p->depth_samples = depth_samples;
+	p->seed = 0x9E3779B9u;
+
+	void_particles_set_emitter(p, 0.0f, 0.0f, 0.0f, 0.1f);
+	void_particles_set_direction(p, 0.0f, 1.0f, 0.0f, 0.3f);
+	void_particles_set_speed(p, 1.0f, 2.0f);
+	void_particles_set_lifetime(p, 1.0f, 2.0f);
+	void_particles_set_forces(p, 0.0f, -9.81f, 0.0f, 0.1f);
+	void_particles_set_collision(p, 0.4f, 0.2f, 0.25f);
+	void_particles_set_color(p, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f);
+	void_particles_set_size(p, 0.05f, 0.02f);
+
+	create_buffers(p, device);
+	create_compute(p, device);
+	create_draw(p, device, color_format, depth_format, samples);
+	return p;
+}
+
+void void_particles_destroy(void *particles) {
+	Particles *p = (Particles *)particles;
+	if (!p) return;
+	void_gpu_release_pipeline(p->draw_pipeline);
+	void_gpu_release_shader(p->draw_shader);
+	void_gpu_cache_release(p->draw_group);
+	void_gpu_cache_release(p->draw_pipeline_layout);
+	void_gpu_cache_release(p->draw_layout);
+
+	void_gpu_release_compute_pipeline(p->merge_pipeline);
+	void_gpu_release_compute_pipeline(p->pad_pipeline);
+	void_gpu_release_compute_pipeline(p->finalize_pipeline);
+	void_gpu_release_compute_pipeline(p->simulate_pipeline);
+	void_gpu_release_compute_pipeline(p->prepare_pipeline);
+	void_gpu_release_compute_pipeline(p->emit_pipeline);
+	void_gpu_release_shader(p->sim_shader);
+	if (p->sim_group) void_gpu_cache_release(p->sim_group);
+	void_gpu_cache_release(p->step_group);
+	void_gpu_cache_release(p->args_group);
+	void_gpu_cache_release(p->step_pipeline_layout);
+	void_gpu_cache_release(p->args_pipeline_layout);
+	void_gpu_cache_release(p->sim_pipeline_layout);
+	void_gpu_cache_release(p->step_layout);
+	void_gpu_cache_release(p->args_layout);
+	void_gpu_cache_release(p->sim_layout);
+	if (p->dummy_depth) {
+		void_gpu_release_texture_view(p->dummy_depth_view);
+		void_gpu_release_texture(p->dummy_depth);
+	}
+
+	void_gpu_release_buffer(p->draw_uniform_buffer);
+	void_gpu_release_buffer(p->step_buffer);
+	void_gpu_release_buffer(p->sim_uniform_buffer);
+	void_gpu_release_buffer(p->args_buffer);
+	void_gpu_release_buffer(p->counter_buffer);
+	void_gpu_release_buffer(p->key_buffer);
+	void_gpu_release_buffer(p->alive_buffer);
+	void_gpu_release_buffer(p->dead_buffer);
+	void_gpu_release_buffer(p->particle_buffer);
+	free(p);
+}
+
+// --- Emitter ---
+
+static void set4(float *dst, float x, float y, float z, float w) {
+	dst[0] = x; dst[1] = y; dst[2] = z; dst[3] = w;
+}
+
+void void_particles_set_emitter(void *particles, float x, float y, float z, float radius) {
+	set4(((Particles *)particles)->sim.emitter, x, y, z, radius);
+}
+
+void void_particles_set_direction(void *particles, float dirX, float dirY, float dirZ, float spread) {
+	float len = sqrtf(dirX * dirX + dirY * dirY + dirZ * dirZ);
+	if (len < 1e-6f) { dirX = 0.0f; dirY = 1.0f; dirZ = 0.0f; len = 1.0f; }
+	set4(((Particles *)particles)->sim.direction, dirX / len, dirY / len, dirZ / len, cosf(spread));
+}
+
+void void_particles_set_speed(void *particles, float min_speed, float max_speed) {
+	float *v = ((Particles *)particles)->sim.speed_life;
+	v[0] = min_speed;
+	v[1] = max_speed;
+}
+
+void void_particles_set_lifetime(void *particles, float min_seconds, float max_seconds) {
+	float *v = ((Particles *)particles)->sim.speed_life;
+	v[2] = min_seconds;
+	v[3] = max_seconds;
+}
+
+void void_particles_set_rate(void *particles, float per_second) {
+	((Particles *)particles)->rate = per_second > 0.0f ? per_second : 0.0f;
+}
+
+void void_particles_burst(void *particles, uint32_t count) {
+	((Particles *)particles)->burst += count;
+}
+
+// --- Simulation ---
+
+void void_particles_set_forces(void *particles, float gx, float gy, float gz, float drag) {
+	set4(((Particles *)particles)->sim.forces, gx, gy, gz, drag);
+}
+
+void void_particles_set_collision(void *particles, float restitution, float friction, float thickness) {
+	Particles *p = (Particles *)particles;
+	set4(p->sim.collision, p->depth_samples ? 1.0f : 0.0f, restitution, thickness, friction);
+}
+
+// --- Look ---
+
+void void_particles_set_color(void *particles,
+	float r0, float g0, float b0, float a0,
+	float r1, float g1, float b1, float a1
+) {
+	Particles *p = (Particles *)particles;
+	set4(p->draw.color_start, r0, g0, b0, a0);
+	set4(p->draw.color_end, r1, g1, b1, a1);
+}
+
+void void_particles_set_size(void *particles, float start_size, float end_size) {
+	set4(((Particles *)particles)->draw.size, start_size, end_size, 0.0f, 0.0f);
+}
+
+// --- Per frame ---
+
+static void sim_group_for(Particles *p, void *depth_view) {
+	if (!depth_view) depth_view = p->dummy_depth_view;
+	if (depth_view == p->group_depth && p->sim_group) return;
+	if (p->sim_group) void_gpu_cache_release(p->sim_group);
+	void *g = void_gpu_group_begin(p->sim_layout);
+	void_gpu_group_buffer(g, 0, p->sim_uniform_buffer, 0, 0);
+	void_gpu_group_buffer(g, 1, p->particle_buffer, 0, 0);
+	void_gpu_group_buffer(g, 2, p->dead_buffer, 0, 0);
+	void_gpu_group_buffer(g, 3, p->alive_buffer, 0, 0);
+	void_gpu_group_buffer(g, 4, p->key_buffer, 0, 0);
+	void_gpu_group_buffer(g, 5, p->counter_buffer, 0, 0);
+	void_gpu_group_texture(g, 6, depth_view);
+	p->sim_group = void_gpu_group_finish(p->device, g);
+	p->group_depth = depth_view;
+}
+
+void void_particles_simulate(void *particles, void *queue, void *compute_pass,
+	float dt, void *depth_view, uint32_t width, uint32_t height
+) {
+	Particles *p = (Particles *)particles;
+	if (p->depth_samples && !depth_view) {
+		fprintf(stderr, "void_particles: simulate without a depth texture, collisions skipped\n");
+		return;
+	}
+
+	// Spawn count: the rate's whole particles so far plus bursts
+	p->rate_accum += p->rate * dt;
+	uint32_t emit = (uint32_t)p->rate_accum;
+	p->rate_accum -= (float)emit;
+	emit += p->burst;
+	p->burst = 0;
+	if (emit > p->capacity) emit = p->capacity;
+	p->emitted += emit;
+
+	// Camera (same as the depth buffer)
+	float inv_view[16];
+	const float *view = (const float *)void_math_get_view();
+	void_mat4_multiply(p->sim.view_proj, (const float *)void_math_get_projection(), view);
+	void_mat4_invert(p->sim.inv_view_proj, p->sim.view_proj);
+	void_mat4_invert(inv_view, view);
+	set4(p->sim.camera, inv_view[12], inv_view[13], inv_view[14], dt);
+	set4(p->sim.screen, (float)width, (float)height, 0.0f, 0.0f);
+	p->seed = p->seed * 1664525u + 1013904223u;
+	p->sim.counts[0] = emit;
+	p->sim.counts[1] = p->capacity;
+	p->sim.counts[2] = p->current;
+	p->sim.counts[3] = p->seed;
+	void_gpu_queue_write_buffer(queue, p->sim_uniform_buffer, 0, &p->sim, sizeof(p->sim));
+
+	sim_group_for(p, depth_view);
+	void *pass = compute_pass;
+	void_gpu_compute_pass_set_bind_group(pass, 0, p->sim_group);
+
+	if (emit > 0) {
+		void_gpu_compute_pass_set_pipeline(pass, p->emit_pipeline);
+		void_gpu_compute_pass_dispatch(pass, (emit + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE, 1, 1);
+	}
+
+	// Dispatches that read the argument buffer must not also have it bound
+	// for writing, so group 1 alternates between the args and the sort steps.
+	void_gpu_compute_pass_set_bind_group(pass, 1, p->args_group);
+	void_gpu_compute_pass_set_pipeline(pass, p->prepare_pipeline);
+	void_gpu_compute_pass_dispatch(pass, 1, 1, 1);
+
+	void_gpu_compute_pass_set_bind_group_offset(pass, 1, p->step_group, 0);
+	void_gpu_compute_pass_set_pipeline(pass, p->simulate_pipeline);
+	void_gpu_compute_pass_dispatch_indirect(pass, p->args_buffer, ARGS_SIMULATE * sizeof(uint32_t));
+
+	void_gpu_compute_pass_set_bind_group(pass, 1, p->args_group);
+	void_gpu_compute_pass_set_pipeline(pass, p->finalize_pipeline);
+	void_gpu_compute_pass_dispatch(pass, 1, 1, 1);
+
+	void_gpu_compute_pass_set_bind_group_offset(pass, 1, p->step_group, 0);
+	void_gpu_compute_pass_set_pipeline(pass, p->pad_pipeline);
+	void_gpu_compute_pass_dispatch_indirect(pass, p->args_buffer, ARGS_SORT * sizeof(uint32_t));
+
+	void_gpu_compute_pass_set_pipeline(pass, p->merge_pipeline);
+	for (uint32_t s = 0; s < p->step_count; s++) {
+		void_gpu_compute_pass_set_bind_group_offset(pass, 1, p->step_group, s * STEP_STRIDE);
+		void_gpu_compute_pass_dispatch_indirect(pass, p->args_buffer, ARGS_SORT * sizeof(uint32_t));
+	}
+
+	p->current ^= 1;
+}
+
+void void_particles_draw(void *particles, void *queue, void *render_pass) {
+	Particles *p = (Particles *)particles;
+	const float *view = (const float *)void_math_get_view();
+	void_mat4_multiply(p->draw.view_proj, (const float *)void_math_get_projection(), view);
+	// Camera right / up are the first two rows of the view rotation
+	set4(p->draw.right, view[0], view[4], view[8], 0.0f);
+	set4(p->draw.up, view[1], view[5], view[9], 0.0f);
+	void_gpu_queue_write_buffer(queue, p->draw_uniform_buffer, 0, &p->draw, sizeof(p->draw));
+
+	void_gpu_render_pass_set_pipeline(render_pass, p->draw_pipeline);
+	void_gpu_render_pass_set_bind_group(render_pass, 0, p->draw_group);
+	void_gpu_render_pass_draw_indirect(render_pass, p->args_buffer, ARGS_DRAW * sizeof(uint32_t));
+}
+
+uint32_t void_particles_capacity(void *particles) {
+	return ((Particles *)particles)->capacity;
+}
+
+uint64_t void_particles_emitted(void *particles) {
+	return ((Particles *)particles)->emitted;
+}
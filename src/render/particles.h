@@ -0,0 +1,74 @@
+// Void Render — GPU particles
+// Emission, simulation, compaction, sorting and draw arguments all run in
+// compute shaders on storage buffers; the CPU only uploads emitter settings
+// and how many particles to spawn this frame.
+//
+// Per simulate():
+//   emit      pop free indices from the dead list, initialise, append to the
+//             current alive list
+//   prepare   size the simulate dispatch from the alive count (indirect)
+//   simulate  age, forces, depth-buffer collisions; survivors are compacted
+//             into the other alive list with a back-to-front sort key,
+//             the dead go back on the dead list
+//   finalize  instance count for the indirect draw, sort size
+//   sort      bitonic sort of the keys over the next power of two of the
+//             survivor count (indirect dispatches, idle steps exit early)
+// draw() renders camera-facing quads with one indirect instanced draw,
+// alpha blended, depth tested without writes.
+//
+// Collisions read the scene depth buffer of the frame (render it first):
+// a particle that moved behind the visible surface, within `thickness` of
+// it, is pushed back out along the normal reconstructed from the depth
+// buffer and bounces.
+
+#ifndef VOID_RENDER_PARTICLES_H
+#define VOID_RENDER_PARTICLES_H
+
+#include <stdint.h>
+
+// capacity = maximum live particles. The draw pipeline is built for
+// color_format / depth_format / samples (the pass it is drawn in).
+// depth_samples: sample count of the depth texture given to simulate()
+// (0 = no collisions).
+void *void_particles_create(void *device, uint32_t capacity,
+    uint32_t color_format, uint32_t depth_format, uint32_t samples,
+    uint32_t depth_samples);
+void  void_particles_destroy(void *particles);
+
+// --- Emitter ---
+void void_particles_set_emitter(void *particles, float x, float y, float z, float radius);
+// Launch direction and cone half-angle (radians)
+void void_particles_set_direction(void *particles, float dirX, float dirY, float dirZ, float spread);
+void void_particles_set_speed(void *particles, float min_speed, float max_speed);
+void void_particles_set_lifetime(void *particles, float min_seconds, float max_seconds);
+// Continuous emission in particles per second
+void void_particles_set_rate(void *particles, float per_second);
+// Spawn count extra particles on the next simulate
+void void_particles_burst(void *particles, uint32_t count);
+
+// --- Simulation ---
+void void_particles_set_forces(void *particles, float gx, float gy, float gz, float drag);
+// restitution: bounce (0..1); friction: tangential loss per bounce (0..1);
+// thickness: world distance behind a surface still treated as contact
+void void_particles_set_collision(void *particles, float restitution, float friction, float thickness);
+
+// --- Look ---
+void void_particles_set_color(void *particles,
+    float r0, float g0, float b0, float a0,
+    float r1, float g1, float b1, float a1);
+void void_particles_set_size(void *particles, float start_size, float end_size);
+
+// --- Per frame ---
+// Records into an open compute pass. Camera from src/math/mat4 (set it
+// first). depth_view (may be NULL) holds the scene depth rendered this frame
+// in its top-left width x height area.
+void void_particles_simulate(void *particles, void *queue, void *compute_pass,
+    float dt, void *depth_view, uint32_t width, uint32_t height);
+// Records into an open render pass matching the create() formats.
+void void_particles_draw(void *particles, void *queue, void *render_pass);
+
+uint32_t void_particles_capacity(void *particles);
+// Spawn requests so far (the live count stays on the GPU)
+uint64_t void_particles_emitted(void *particles);
+
+#endif
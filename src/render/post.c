@@ -0,0 +1,806 @@
+// Void Render — Compute post-processing: bloom, tonemapping, grading, FXAA
+
+#include "post.h"
+#include "../gpu/dawn.h"
+#include "../gpu/enums.h"
+#include "../gpu/cache.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// post.h spells these out for MetaScript callers
+_Static_assert(VOID_POST_HDR_FORMAT == FMT_RGBA16_FLOAT, "VOID_POST_HDR_FORMAT");
+_Static_assert(VOID_POST_OUT_FORMAT == FMT_RGBA8_UNORM, "VOID_POST_OUT_FORMAT");
+
+#define LEVELS        VOID_POST_BLOOM_LEVELS
+#define DOWN_PER_PASS 4         // pyramid levels one downsample dispatch writes
+#define SINKS         (DOWN_PER_PASS - 1)
+
+// One uniform block per dispatch, selected by dynamic offset
+#define BLOCK_STRIDE    256
+#define BLOCK_COMPOSITE 0
+#define BLOCK_DOWN      1       // 2 blocks
+#define BLOCK_UP        3       // LEVELS - 2 blocks
+#define BLOCK_COUNT     (BLOCK_UP + LEVELS - 2)
+
+// --- GPU layout (must match the WGSL structs below) ---
+
+typedef struct DownUniforms {
+	float src_texel[2];    // 1 / source texture size
+	float src_max[2];      // center of the last source texel inside the area
+	float dst_texel[2];    // 1 / first written level's texture size
+	float threshold;
+	float knee;
+	uint32_t sizes[8];     // area of each written level (x, y pairs)
+	uint32_t levels;       // levels this dispatch writes (1..4)
+	uint32_t prefilter;    // bright-pass the source (first dispatch)
+	uint32_t pad[2];
+} DownUniforms;
+
+typedef struct UpUniforms {
+	float src_texel[2];    // level above (lower resolution)
+	float src_max[2];
+	float dst_texel[2];
+	uint32_t size[2];      // area of the written level
+} UpUniforms;
+
+typedef struct CompositeUniforms {
+	uint32_t size[2];      // render area
+	uint32_t flags;        // VOID_POST_* effect bits
+	uint32_t pad;
+	float bloom_texel[2];  // pyramid level 0
+	float bloom_max[2];
+	float up_texel[2];     // accumulated level 1
+	float up_max[2];
+	float exposure;
+	float bloom_intensity; // already divided by the level count
+	float lut_scale;       // (n - 1) / n
+	float lut_offset;      // 0.5 / n
+} CompositeUniforms;
+
+// --- WGSL ---
+
+static const char *s_post_wgsl =
+"fn luma(c: vec3f) -> f32 {\n"
+"  return dot(c, vec3f(0.299, 0.587, 0.114));\n"
+"}\n"
+"\n"
+"// 3x3 tent (1 2 1) over a lower-resolution level, one bilinear fetch per tap\n"
+"fn tent9(t: texture_2d<f32>, s: sampler, uv: vec2f, texel: vec2f, uv_max: vec2f) -> vec3f {\n"
+"  var sum = vec3f(0.0);\n"
+"  for (var y = -1; y <= 1; y++) {\n"
+"    for (var x = -1; x <= 1; x++) {\n"
+"      let w = f32((2 - abs(x)) * (2 - abs(y)));\n"
+"      let p = clamp(uv + vec2f(f32(x), f32(y)) * texel, texel * 0.5, uv_max);\n"
+"      sum += w * textureSampleLevel(t, s, p, 0.0).rgb;\n"
+"    }\n"
+"  }\n"
+"  return sum / 16.0;\n"
+"}\n"
+"\n"
+"// --- Bloom downsample: up to 4 levels per dispatch ---\n"
+"\n"
+"struct Down {\n"
+"  src_texel: vec2f,\n"
+"  src_max: vec2f,\n"
+"  dst_texel: vec2f,\n"
+"  threshold: f32,\n"
+"  knee: f32,\n"
+"  sizes: array<vec4u, 2>,\n"
+"  levels: u32,\n"
+"  prefilter: u32,\n"
+"  pad: vec2u,\n"
+"};\n"
+"@group(0) @binding(0) var<uniform> dn: Down;\n"
+"@group(0) @binding(1) var dn_src: texture_2d<f32>;\n"
+"@group(0) @binding(2) var dn_samp: sampler;\n"
+"@group(0) @binding(3) var dn_dst0: texture_storage_2d<rgba16float, write>;\n"
+"@group(0) @binding(4) var dn_dst1: texture_storage_2d<rgba16float, write>;\n"
+"@group(0) @binding(5) var dn_dst2: texture_storage_2d<rgba16float, write>;\n"
+"@group(0) @binding(6) var dn_dst3: texture_storage_2d<rgba16float, write>;\n"
+"\n"
+"var<workgroup> dn_tile: array<vec3f, 64>;\n"
+"\n"
+"fn dn_fetch(uv: vec2f) -> vec3f {\n"
+"  return textureSampleLevel(dn_src, dn_samp, clamp(uv, dn.src_texel * 0.5, dn.src_max), 0.0).rgb;\n"
+"}\n"
+"\n"
+"// Soft-knee bright pass, weighted by 1 / (1 + luma) so a single very\n"
+"// bright texel cannot flicker the whole bloom (Karis average)\n"
+"fn dn_bright(c: vec3f) -> vec4f {\n"
+"  let bright = max(c.r, max(c.g, c.b));\n"
+"  var soft = clamp(bright - dn.threshold + dn.knee, 0.0, 2.0 * dn.knee);\n"
+"  soft = soft * soft / (4.0 * dn.knee + 1e-4);\n"
+"  let contrib = max(soft, bright - dn.threshold) / max(bright, 1e-4);\n"
+"  let w = 1.0 / (1.0 + luma(c));\n"
+"  return vec4f(c * contrib * w, w);\n"
+"}\n"
+"\n"
+"fn dn_size(k: u32) -> vec2u {\n"
+"  let v = dn.sizes[k >> 1u];\n"
+"  return select(v.xy, v.zw, (k & 1u) == 1u);\n"
+"}\n"
+"\n"
+"fn dn_store(k: u32, p: vec2u, v: vec3f) {\n"
+"  if (k >= dn.levels || any(p >= dn_size(k))) {\n"
+"    return;\n"
+"  }\n"
+"  let c = vec4f(v, 1.0);\n"
+"  switch k {\n"
+"    case 0u: { textureStore(dn_dst0, p, c); }\n"
+"    case 1u: { textureStore(dn_dst1, p, c); }\n"
+"    case 2u: { textureStore(dn_dst2, p, c); }\n"
+"    default: { textureStore(dn_dst3, p, c); }\n"
+"  }\n"
+"}\n"
+"\n"
+"@compute @workgroup_size(8, 8) fn downsample(\n"
+"  @builtin(global_invocation_id) gid: vec3u,\n"
+"  @builtin(local_invocation_id) lid: vec3u,\n"
+"  @builtin(workgroup_id) wid: vec3u\n"
+") {\n"
+"  // First level: 4 bilinear taps cover the 4x4 source texels around the\n"
+"  // destination texel\n"
+"  let uv = (vec2f(gid.xy) + 0.5) * dn.dst_texel;\n"
+"  let o = dn.src_texel;\n"
+"  let a = dn_fetch(uv + vec2f(-o.x, -o.y));\n"
+"  let b = dn_fetch(uv + vec2f(o.x, -o.y));\n"
+"  let c = dn_fetch(uv + vec2f(-o.x, o.y));\n"
+"  let d = dn_fetch(uv + vec2f(o.x, o.y));\n"
+"  var v = (a + b + c + d) * 0.25;\n"
+"  if (dn.prefilter != 0u) {\n"
+"    let s = dn_bright(a) + dn_bright(b) + dn_bright(c) + dn_bright(d);\n"
+"    v = s.rgb / s.w;\n"
+"  }\n"
+"  dn_store(0u, gid.xy, v);\n"
+"  dn_tile[lid.y * 8u + lid.x] = v;\n"
+"  workgroupBarrier();\n"
+"\n"
+"  // The rest in workgroup memory: 8x8 -> 4x4 -> 2x2 -> 1x1\n"
+"  var n = 4u;\n"
+"  for (var k = 1u; k < 4u; k++) {\n"
+"    let live = lid.x < n && lid.y < n;\n"
+"    var r = vec3f(0.0);\n"
+"    if (live) {\n"
+"      let s = lid.xy * 2u;\n"
+"      r = (dn_tile[s.y * 8u + s.x] + dn_tile[s.y * 8u + s.x + 1u] +\n"
+"           dn_tile[(s.y + 1u) * 8u + s.x] + dn_tile[(s.y + 1u) * 8u + s.x + 1u]) * 0.25;\n"
+"    }\n"
+"    workgroupBarrier();\n"
+"    if (live) {\n"
+"      dn_tile[lid.y * 8u + lid.x] = r;\n"
+"      dn_store(k, wid.xy * n + lid.xy, r);\n"
+"    }\n"
+"    workgroupBarrier();\n"
+"    n = n >> 1u;\n"
+"  }\n"
+"}\n"
+"\n"
+"// --- Bloom upsample: level k = down k + tent(level k + 1) ---\n"
+"\n"
+"struct Up {\n"
+"  src_texel: vec2f,\n"
+"  src_max: vec2f,\n"
+"  dst_texel: vec2f,\n"
+"  size: vec2u,\n"
+"};\n"
+"@group(0) @binding(0) var<uniform> upu: Up;\n"
+"@group(0) @binding(1) var up_base: texture_2d<f32>;\n"
+"@group(0) @binding(2) var up_src: texture_2d<f32>;\n"
+"@group(0) @binding(3) var up_samp: sampler;\n"
+"@group(0) @binding(4) var up_dst: texture_storage_2d<rgba16float, write>;\n"
+"\n"
+"@compute @workgroup_size(8, 8) fn upsample(@builtin(global_invocation_id) gid: vec3u) {\n"
+"  if (any(gid.xy >= upu.size)) {\n"
+"    return;\n"
+"  }\n"
+"  let uv = (vec2f(gid.xy) + 0.5) * upu.dst_texel;\n"
+"  let v = textureLoad(up_base, gid.xy, 0).rgb + tent9(up_src, up_samp, uv, upu.src_texel, upu.src_max);\n"
+"  textureStore(up_dst, gid.xy, vec4f(v, 1.0));\n"
+"}\n"
+"\n"
+"// --- Composite: bloom, exposure, tonemap, LUT, FXAA ---\n"
+"\n"
+"struct Composite {\n"
+"  size: vec2u,\n"
+"  flags: u32,\n"
+"  pad: u32,\n"
+"  bloom_texel: vec2f,\n"
+"  bloom_max: vec2f,\n"
+"  up_texel: vec2f,\n"
+"  up_max: vec2f,\n"
+"  exposure: f32,\n"
+"  bloom_intensity: f32,\n"
+"  lut_scale: f32,\n"
+"  lut_offset: f32,\n"
+"};\n"
+"@group(0) @binding(0) var<uniform> cp: Composite;\n"
+"@group(0) @binding(1) var cp_hdr: texture_2d<f32>;\n"
+"@group(0) @binding(2) var cp_out: texture_storage_2d<rgba8unorm, write>;\n"
+"@group(0) @binding(3) var cp_bloom0: texture_2d<f32>;\n"
+"@group(0) @binding(4) var cp_bloom1: texture_2d<f32>;\n"
+"@group(0) @binding(5) var cp_lut: texture_3d<f32>;\n"
+"@group(0) @binding(6) var cp_samp: sampler;\n"
+"\n"
+"const POST_BLOOM = 1u;\n"
+"const POST_TONEMAP = 2u;\n"
+"const POST_GRADE = 4u;\n"
+"\n"
+"// ACES filmic fit (Narkowicz)\n"
+"fn aces(x: vec3f) -> vec3f {\n"
+"  return clamp((x * (2.51 * x + 0.03)) / (x * (2.43 * x + 0.59) + 0.14), vec3f(0.0), vec3f(1.0));\n"
+"}\n"
+"\n"
+"// Final LDR color of a render-area pixel (clamped to the area)\n"
+"fn cp_color(pixel: vec2i) -> vec3f {\n"
+"  let p = clamp(pixel, vec2i(0), vec2i(cp.size) - 1);\n"
+"  var c = textureLoad(cp_hdr, p, 0).rgb;\n"
+"  if ((cp.flags & POST_BLOOM) != 0u) {\n"
+"    let uv = (vec2f(p) + 0.5) * 0.5 * cp.bloom_texel;\n"
+"    let b0 = textureSampleLevel(cp_bloom0, cp_samp, clamp(uv, cp.bloom_texel * 0.5, cp.bloom_max), 0.0).rgb;\n"
+"    c += (b0 + tent9(cp_bloom1, cp_samp, uv, cp.up_texel, cp.up_max)) * cp.bloom_intensity;\n"
+"  }\n"
+"  if ((cp.flags & POST_TONEMAP) != 0u) {\n"
+"    c = aces(c * cp.exposure);\n"
+"  } else {\n"
+"    c = clamp(c, vec3f(0.0), vec3f(1.0));\n"
+"  }\n"
+"  if ((cp.flags & POST_GRADE) != 0u) {\n"
+"    c = textureSampleLevel(cp_lut, cp_samp, c * cp.lut_scale + cp.lut_offset, 0.0).rgb;\n"
+"  }\n"
+"  return c;\n"
+"}\n"
+"\n"
+"@compute @workgroup_size(16, 16) fn composite(@builtin(global_invocation_id) gid: vec3u) {\n"
+"  if (any(gid.xy >= cp.size)) {\n"
+"    return;\n"
+"  }\n"
+"  textureStore(cp_out, gid.xy, vec4f(cp_color(vec2i(gid.xy)), 1.0));\n"
+"}\n"
+"\n"
+"// FXAA on the graded colors. The tile (16x16 + apron) is graded once into\n"
+"// workgroup memory; the edge search reaches at most FX_SPAN / 2 texels,\n"
+"// plus one for the bilinear read, which is the apron.\n"
+"const FX_APRON = 3;\n"
+"const FX_SIDE = 22;\n"
+"const FX_COUNT = 484u;\n"
+"const FX_SPAN = 4.0;\n"
+"const FX_REDUCE_MUL = 0.125;\n"
+"const FX_REDUCE_MIN = 0.0078125;\n"
+"const FX_EDGE_MIN = 0.0312;\n"
+"const FX_EDGE = 0.125;\n"
+"\n"
+"var<workgroup> fx_tile: array<vec4f, 484>;   // graded rgb + luma\n"
+"\n"
+"fn fx_at(x: i32, y: i32) -> vec4f {\n"
+"  return fx_tile[clamp(y, 0, FX_SIDE - 1) * FX_SIDE + clamp(x, 0, FX_SIDE - 1)];\n"
+"}\n"
+"\n"
+"// Bilinear read between tile texel centers\n"
+"fn fx_sample(pos: vec2f) -> vec3f {\n"
+"  let p = clamp(pos, vec2f(0.0), vec2f(f32(FX_SIDE - 1)));\n"
+"  let i = vec2i(floor(p));\n"
+"  let f = p - floor(p);\n"
+"  let top = mix(fx_at(i.x, i.y).rgb, fx_at(i.x + 1, i.y).rgb, f.x);\n"
+"  let bottom = mix(fx_at(i.x, i.y + 1).rgb, fx_at(i.x + 1, i.y + 1).rgb, f.x);\n"
+"  return mix(top, bottom, f.y);\n"
+"}\n"
+"\n"
+"@compute @workgroup_size(16, 16) fn composite_fxaa(\n"
+"  @builtin(workgroup_id) wid: vec3u,\n"
+"  @builtin(local_invocation_id) lid: vec3u,\n"
+"  @builtin(local_invocation_index) li: u32\n"
+") {\n"
+"  let origin = vec2i(wid.xy * 16u) - FX_APRON;\n"
+"  for (var i = li; i < FX_COUNT; i += 256u) {\n"
+"    let c = cp_color(origin + vec2i(i32(i % u32(FX_SIDE)), i32(i / u32(FX_SIDE))));\n"
+"    fx_tile[i] = vec4f(c, luma(c));\n"
+"  }\n"
+"  workgroupBarrier();\n"
+"\n"
+"  let p = wid.xy * 16u + lid.xy;\n"
+"  if (any(p >= cp.size)) {\n"
+"    return;\n"
+"  }\n"
+"  let q = vec2i(lid.xy) + FX_APRON;\n"
+"  let m = fx_at(q.x, q.y);\n"
+"  let nw = fx_at(q.x - 1, q.y - 1).a;\n"
+"  let ne = fx_at(q.x + 1, q.y - 1).a;\n"
+"  let sw = fx_at(q.x - 1, q.y + 1).a;\n"
+"  let se = fx_at(q.x + 1, q.y + 1).a;\n"
+"  let lmin = min(m.a, min(min(nw, ne), min(sw, se)));\n"
+"  let lmax = max(m.a, max(max(nw, ne), max(sw, se)));\n"
+"  if (lmax - lmin < max(FX_EDGE_MIN, lmax * FX_EDGE)) {\n"
+"    textureStore(cp_out, p, vec4f(m.rgb, 1.0));\n"
+"    return;\n"
+"  }\n"
+"\n"
+"  // Blur along the edge, falling back to the shorter span when the longer\n"
+"  // one picks up colors from outside the local range\n"
+"  var dir = vec2f(-((nw + ne) - (sw + se)), (nw + sw) - (ne + se));\n"
+"  let reduce = max((nw + ne + sw + se) * 0.25 * FX_REDUCE_MUL, FX_REDUCE_MIN);\n"
+"  let rcp_min = 1.0 / (min(abs(dir.x), abs(dir.y)) + reduce);\n"
+"  dir = clamp(dir * rcp_min, vec2f(-FX_SPAN), vec2f(FX_SPAN));\n"
+"  let pos = vec2f(q);\n"
+"  let a = 0.5 * (fx_sample(pos + dir * (1.0 / 3.0 - 0.5)) + fx_sample(pos + dir * (2.0 / 3.0 - 0.5)));\n"
+"  let b = a * 0.5 + 0.25 * (fx_sample(pos - dir * 0.5) + fx_sample(pos + dir * 0.5));\n"
+"  let lb = luma(b);\n"
+"  textureStore(cp_out, p, vec4f(select(b, a, lb < lmin || lb > lmax), 1.0));\n"
+"}\n";
+
+// --- Post ---
+
+typedef struct Post {
+	void *device;
+	uint32_t effects;
+	float threshold;
+	float knee;
+	float intensity;
+	float exposure;
+
+	void *shader;
+	void *uniform_buffer;    // BLOCK_COUNT blocks
+	void *sampler;           // cached
+	void *down_layout;       // cached
+	void *up_layout;         // cached
+	void *composite_layout;  // cached
+	void *down_pipeline_layout;
+	void *up_pipeline_layout;
+	void *composite_pipeline_layout;
+	void *down_pipeline;
+	void *up_pipeline;
+	void *composite_pipeline;
+	void *fxaa_pipeline;
+
+	// 1x1 RGBA16F layers: storage slots a downsample does not use, and
+	// the bloom inputs of the composite while bloom is off
+	void *sink;
+	void *sink_views[SINKS];
+
+	// Bloom pyramid for source_w x source_h (0 = not allocated)
+	uint32_t source_w, source_h;
+	uint32_t levels;
+	uint32_t level_w[LEVELS], level_h[LEVELS];
+	void *down;              // level 0..levels-1
+	void *up;                // level 1..levels-1 (level 0 lives in the composite)
+	void *down_views[LEVELS];
+	void *up_views[LEVELS];  // index = level, [0] unused
+	void *down_groups[2];    // cached; [0] reads the HDR source
+	void *down_group_hdr;    // view down_groups[0] was built for
+	void *up_groups[LEVELS]; // cached, index = level written
+
+	// Composite group (cached), rebuilt when any of its views changes
+	void *group;
+	void *group_hdr, *group_out, *group_bloom, *group_lut;
+
+	void *lut;
+	void *lut_view;
+	uint32_t lut_size;
+
+	uint32_t dispatches;
+} Post;
+
+static float clampf(float v, float lo, float hi) {
+	return v < lo ? lo : (v > hi ? hi : v);
+}
+
+static void *level_view(void *texture, uint32_t mip) {
+	return void_gpu_create_texture_view_range(texture, VIEW_2D, mip, 1, 0, 1, 0);
+}
+
+static void create_layouts(Post *p, void *device) {
+	void *b = void_gpu_layout_begin();
+	void_gpu_layout_buffer(b, 0, STAGE_COMPUTE, BINDING_UNIFORM, sizeof(DownUniforms), 1);
+	void_gpu_layout_texture(b, 1, STAGE_COMPUTE, SAMPLE_TYPE_FLOAT, VIEW_2D, 0);
+	void_gpu_layout_sampler(b, 2, STAGE_COMPUTE, SAMPLER_FILTERING);
+	for (uint32_t i = 0; i < DOWN_PER_PASS; i++) {
+		void_gpu_layout_storage_texture(b, 3 + i, STAGE_COMPUTE, STORAGE_WRITE_ONLY,
+			VOID_POST_HDR_FORMAT, VIEW_2D);
+	}
+	p->down_layout = void_gpu_layout_finish(device, b);
+
+	b = void_gpu_layout_begin();
+	void_gpu_layout_buffer(b, 0, STAGE_COMPUTE, BINDING_UNIFORM, sizeof(UpUniforms), 1);
+	void_gpu_layout_texture(b, 1, STAGE_COMPUTE, SAMPLE_TYPE_FLOAT, VIEW_2D, 0);
+	void_gpu_layout_texture(b, 2, STAGE_COMPUTE, SAMPLE_TYPE_FLOAT, VIEW_2D, 0);
+	void_gpu_layout_sampler(b, 3, STAGE_COMPUTE, SAMPLER_FILTERING);
+	void_gpu_layout_storage_texture(b, 4, STAGE_COMPUTE, STORAGE_WRITE_ONLY,
+		VOID_POST_HDR_FORMAT, VIEW_2D);
+	p->up_layout = void_gpu_layout_finish(device, b);
+
+	b = void_gpu_layout_begin();
+	void_gpu_layout_buffer(b, 0, STAGE_COMPUTE, BINDING_UNIFORM, sizeof(CompositeUniforms), 0);
+	void_gpu_layout_texture(b, 1, STAGE_COMPUTE, SAMPLE_TYPE_FLOAT, VIEW_2D, 0);
+	void_gpu_layout_storage_texture(b, 2, STAGE_COMPUTE, STORAGE_WRITE_ONLY,
+		VOID_POST_OUT_FORMAT, VIEW_2D);
+	void_gpu_layout_texture(b, 3, STAGE_COMPUTE, SAMPLE_TYPE_FLOAT, VIEW_2D, 0);
+	void_gpu_layout_texture(b, 4, STAGE_COMPUTE, SAMPLE_TYPE_FLOAT, VIEW_2D, 0);
+	void_gpu_layout_texture(b, 5, STAGE_COMPUTE, SAMPLE_TYPE_FLOAT, VIEW_3D, 0);
+	void_gpu_layout_sampler(b, 6, STAGE_COMPUTE, SAMPLER_FILTERING);
+	p->composite_layout = void_gpu_layout_finish(device, b);
+
+	p->down_pipeline_layout = void_gpu_cached_pipeline_layout_1(device, p->down_layout);
+	p->up_pipeline_layout = void_gpu_cached_pipeline_layout_1(device, p->up_layout);
+	p->composite_pipeline_layout = void_gpu_cached_pipeline_layout_1(device, p->composite_layout);
+}
+
+void *void_post_create(void *device) {
+	Post *p = calloc(1, sizeof(Post));
+	p->device = device;
+	p->effects = VOID_POST_ALL;
+	p->threshold = 1.0f;
+	p->knee = 0.5f;
+	p->intensity = 0.8f;
+	p->exposure = 1.0f;
+
+	p->uniform_buffer = void_gpu_create_buffer(device, (uint64_t)BLOCK_COUNT * BLOCK_STRIDE,
+		BUFFER_USAGE_UNIFORM | BUFFER_USAGE_COPY_DST, 0);
+	p->sampler = void_gpu_cached_sampler(device, ADDRESS_CLAMP, ADDRESS_CLAMP, ADDRESS_CLAMP,
+		FILTER_LINEAR, FILTER_LINEAR, MIPMAP_NEAREST, 0, 1);
+	create_layouts(p, device);
+
+	p->shader = void_gpu_create_shader(device, s_post_wgsl);
+	p->down_pipeline = void_gpu_create_compute_pipeline(device, p->shader, "downsample", p->down_pipeline_layout);
+	p->up_pipeline = void_gpu_create_compute_pipeline(device, p->shader, "upsample", p->up_pipeline_layout);
+	p->composite_pipeline = void_gpu_create_compute_pipeline(device, p->shader, "composite", p->composite_pipeline_layout);
+	p->fxaa_pipeline = void_gpu_create_compute_pipeline(device, p->shader, "composite_fxaa", p->composite_pipeline_layout);
+
+	p->sink = void_gpu_create_texture_layers(device, 1, 1, SINKS, VOID_POST_HDR_FORMAT,
+		TEXTURE_USAGE_TEXTURE_BINDING | TEXTURE_USAGE_STORAGE_BINDING, 1);
+	for (uint32_t i = 0; i < SINKS; i++) {
+		p->sink_views[i] = void_gpu_create_texture_view_range(p->sink, VIEW_2D, 0, 1, i, 1, 0);
+	}
+
+	void_post_set_lut(p, NULL, VOID_POST_LUT_SIZE);
+	return p;
+}
+
+static void release_group(void **group) {
+	if (*group) void_gpu_cache_release(*group);
+	*group = NULL;
+}
+
+static void pyramid_release(Post *p) {
+	for (uint32_t i = 0; i < 2; i++) release_group(&p->down_groups[i]);
+	for (uint32_t l = 0; l < LEVELS; l++) {
+		release_group(&p->up_groups[l]);
+		if (p->down_views[l]) void_gpu_release_texture_view(p->down_views[l]);
+		if (p->up_views[l]) void_gpu_release_texture_view(p->up_views[l]);
+		p->down_views[l] = NULL;
+		p->up_views[l] = NULL;
+	}
+	if (p->down) void_gpu_release_texture(p->down);
+	if (p->up) void_gpu_release_texture(p->up);
+	p->down = NULL;
+	p->up = NULL;
+	p->down_group_hdr = NULL;
+	release_group(&p->group);
+	p->levels = 0;
+	p->source_w = 0;
+	p->source_h = 0;
+}
+
+void void_post_destroy(void *post) {
+	Post *p = (Post *)post;
+	if (!p) return;
+	pyramid_release(p);
+	release_group(&p->group);
+	if (p->lut_view) void_gpu_release_texture_view(p->lut_view);
+	if (p->lut) void_gpu_release_texture(p->lut);
+	for (uint32_t i = 0; i < SINKS; i++) void_gpu_release_texture_view(p->sink_views[i]);
+	void_gpu_release_texture(p->sink);
+	void_gpu_release_compute_pipeline(p->down_pipeline);
+	void_gpu_release_compute_pipeline(p->up_pipeline);
+	void_gpu_release_compute_pipeline(p->composite_pipeline);
+	void_gpu_release_compute_pipeline(p->fxaa_pipeline);
+	void_gpu_release_shader(p->shader);
+	void_gpu_cache_release(p->down_pipeline_layout);
+	void_gpu_cache_release(p->up_pipeline_layout);
+	void_gpu_cache_release(p->composite_pipeline_layout);
+	void_gpu_cache_release(p->down_layout);
+	void_gpu_cache_release(p->up_layout);
+	void_gpu_cache_release(p->composite_layout);
+	void_gpu_cache_release(p->sampler);
+	void_gpu_release_buffer(p->uniform_buffer);
+	free(p);
+}
+
+// --- Settings ---
+
+void void_post_set_effects(void *post, uint32_t effects) {
+	((Post *)post)->effects = effects & VOID_POST_ALL;
+}
+
+uint32_t void_post_effects(void *post) {
+	return ((Post *)post)->effects;
+}
+
+void void_post_set_bloom(void *post, float threshold, float knee, float intensity) {
+	Post *p = (Post *)post;
+	p->threshold = threshold > 0.0f ? threshold : 0.0f;
+	p->knee = clampf(knee, 0.0f, p->threshold > 0.0f ? p->threshold : 0.0f);
+	p->intensity = intensity > 0.0f ? intensity : 0.0f;
+}
+
+void void_post_set_exposure(void *post, float exposure) {
+	((Post *)post)->exposure = exposure > 0.0f ? exposure : 0.0f;
+}
+
+int void_post_set_lut(void *post, const void *rgba8, uint32_t size) {
+	Post *p = (Post *)post;
+	if (size < 2 || size > 256) {
+		fprintf(stderr, "void_post: LUT size %u out of range (2..256)\n", size);
+		return 0;
+	}
+	if (size != p->lut_size) {
+		if (p->lut_view) void_gpu_release_texture_view(p->lut_view);
+		if (p->lut) void_gpu_release_texture(p->lut);
+		p->lut = void_gpu_create_texture_3d(p->device, size, size, size, FMT_RGBA8_UNORM,
+			TEXTURE_USAGE_TEXTURE_BINDING | TEXTURE_USAGE_COPY_DST);
+		p->lut_view = void_gpu_create_texture_view(p->lut);
+		p->lut_size = size;
+	}
+
+	uint64_t bytes = (uint64_t)size * size * size * 4;
+	uint8_t *identity = NULL;
+	if (!rgba8) {
+		identity = malloc((size_t)bytes);
+		uint8_t *t = identity;
+		for (uint32_t b = 0; b < size; b++) {
+			for (uint32_t g = 0; g < size; g++) {
+				for (uint32_t r = 0; r < size; r++) {
+					t[0] = (uint8_t)((r * 255 + (size - 1) / 2) / (size - 1));
+					t[1] = (uint8_t)((g * 255 + (size - 1) / 2) / (size - 1));
+					t[2] = (uint8_t)((b * 255 + (size - 1) / 2) / (size - 1));
+					t[3] = 255;
+					t += 4;
+				}
+			}
+		}
+		rgba8 = identity;
+	}
+	void *queue = void_gpu_get_queue(p->device);
+	void_gpu_queue_write_texture_3d(queue, p->lut, rgba8, bytes, size * 4, size, size, size);
+	void_gpu_release_queue(queue);
+	free(identity);
+	return 1;
+}
+
+void void_post_set_grade(void *post, float contrast, float saturation, float r, float g, float b) {
+	uint32_t n = VOID_POST_LUT_SIZE;
+	uint8_t *lut = malloc((size_t)n * n * n * 4);
+	uint8_t *t = lut;
+	float gain[3] = { r, g, b };
+	for (uint32_t z = 0; z < n; z++) {
+		for (uint32_t y = 0; y < n; y++) {
+			for (uint32_t x = 0; x < n; x++) {
+				float c[3] = {
+					(float)x / (float)(n - 1), (float)y / (float)(n - 1), (float)z / (float)(n - 1)
+				};
+				float l = 0.0f;
+				for (int i = 0; i < 3; i++) {
+					c[i] = (c[i] - 0.5f) * contrast + 0.5f;
+				}
+				l = c[0] * 0.299f + c[1] * 0.587f + c[2] * 0.114f;
+				for (int i = 0; i < 3; i++) {
+					float v = (l + (c[i] - l) * saturation) * gain[i];
+					t[i] = (uint8_t)(clampf(v, 0.0f, 1.0f) * 255.0f + 0.5f);
+				}
+				t[3] = 255;
+				t += 4;
+			}
+		}
+	}
+	void_post_set_lut(post, lut, n);
+	free(lut);
+}
+
+// --- Pyramid ---
+
+static uint32_t mip_size(uint32_t size, uint32_t level) {
+	uint32_t v = size >> level;
+	return v ? v : 1;
+}
+
+static void group_down(Post *p, uint32_t slot, void *src, uint32_t first) {
+	void *g = void_gpu_group_begin(p->down_layout);
+	void_gpu_group_buffer(g, 0, p->uniform_buffer, 0, sizeof(DownUniforms));
+	void_gpu_group_texture(g, 1, src);
+	void_gpu_group_sampler(g, 2, p->sampler);
+	for (uint32_t i = 0, sink = 0; i < DOWN_PER_PASS; i++) {
+		uint32_t level = first + i;
+		void *dst = level < p->levels ? p->down_views[level] : p->sink_views[sink++];
+		void_gpu_group_texture(g, 3 + i, dst);
+	}
+	release_group(&p->down_groups[slot]);
+	p->down_groups[slot] = void_gpu_group_finish(p->device, g);
+}
+
+// Textures, views and the groups that do not depend on the frame's views
+static int pyramid_prepare(Post *p, uint32_t source_w, uint32_t source_h) {
+	if (p->down && p->source_w == source_w && p->source_h == source_h) return p->levels > 0;
+	pyramid_release(p);
+
+	uint32_t w = source_w / 2, h = source_h / 2;
+	if (w < 2 || h < 2) return 0;
+	uint32_t levels = 2;
+	while (levels < LEVELS && mip_size(w, levels) > 1 && mip_size(h, levels) > 1) levels++;
+
+	uint32_t usage = TEXTURE_USAGE_TEXTURE_BINDING | TEXTURE_USAGE_STORAGE_BINDING;
+	p->down = void_gpu_create_texture(p->device, w, h, VOID_POST_HDR_FORMAT, usage, levels);
+	p->up = void_gpu_create_texture(p->device, mip_size(w, 1), mip_size(h, 1),
+		VOID_POST_HDR_FORMAT, usage, levels - 1);
+	if (!p->down || !p->up) {
+		pyramid_release(p);
+		return 0;
+	}
+	p->source_w = source_w;
+	p->source_h = source_h;
+	p->levels = levels;
+	for (uint32_t l = 0; l < levels; l++) {
+		p->level_w[l] = mip_size(w, l);
+		p->level_h[l] = mip_size(h, l);
+		p->down_views[l] = level_view(p->down, l);
+		if (l > 0) p->up_views[l] = level_view(p->up, l - 1);
+	}
+
+	if (levels > DOWN_PER_PASS) group_down(p, 1, p->down_views[DOWN_PER_PASS - 1], DOWN_PER_PASS);
+	for (uint32_t l = 1; l + 1 < levels; l++) {
+		void *g = void_gpu_group_begin(p->up_layout);
+		void_gpu_group_buffer(g, 0, p->uniform_buffer, 0, sizeof(UpUniforms));
+		void_gpu_group_texture(g, 1, p->down_views[l]);
+		void_gpu_group_texture(g, 2, l + 2 == levels ? p->down_views[l + 1] : p->up_views[l + 1]);
+		void_gpu_group_sampler(g, 3, p->sampler);
+		void_gpu_group_texture(g, 4, p->up_views[l]);
+		p->up_groups[l] = void_gpu_group_finish(p->device, g);
+	}
+	return 1;
+}
+
+// --- Per frame ---
+
+static uint32_t groups_for(uint32_t size, uint32_t per_group) {
+	return (size + per_group - 1) / per_group;
+}
+
+void void_post_run(void *post, void *queue, void *compute_pass,
+	void *hdr_view, uint32_t source_w, uint32_t source_h,
+	void *out_view, uint32_t width, uint32_t height
+) {
+	Post *p = (Post *)post;
+	p->dispatches = 0;
+	if (!hdr_view || !out_view || !source_w || !source_h) return;
+	if (width == 0 || width > source_w) width = source_w;
+	if (height == 0 || height > source_h) height = source_h;
+
+	uint32_t effects = p->effects;
+	if ((effects & VOID_POST_BLOOM) && (p->intensity <= 0.0f || !pyramid_prepare(p, source_w, source_h))) {
+		effects &= ~(uint32_t)VOID_POST_BLOOM;
+	}
+	int bloom = (effects & VOID_POST_BLOOM) != 0;
+
+	// Areas of the pyramid that cover the render area
+	uint32_t area_w[LEVELS] = {0}, area_h[LEVELS] = {0};
+	uint32_t levels = bloom ? p->levels : 0;
+	for (uint32_t l = 0; l < levels; l++) {
+		uint32_t aw = l == 0 ? (width + 1) / 2 : (area_w[l - 1] + 1) / 2;
+		uint32_t ah = l == 0 ? (height + 1) / 2 : (area_h[l - 1] + 1) / 2;
+		area_w[l] = aw < p->level_w[l] ? (aw ? aw : 1) : p->level_w[l];
+		area_h[l] = ah < p->level_h[l] ? (ah ? ah : 1) : p->level_h[l];
+	}
+
+	uint8_t blocks[BLOCK_COUNT * BLOCK_STRIDE];
+	memset(blocks, 0, sizeof(blocks));
+
+	CompositeUniforms *cu = (CompositeUniforms *)(blocks + BLOCK_COMPOSITE * BLOCK_STRIDE);
+	cu->size[0] = width;
+	cu->size[1] = height;
+	cu->flags = effects;
+	cu->exposure = p->exposure;
+	cu->lut_scale = (float)(p->lut_size - 1) / (float)p->lut_size;
+	cu->lut_offset = 0.5f / (float)p->lut_size;
+	if (bloom) {
+		cu->bloom_texel[0] = 1.0f / (float)p->level_w[0];
+		cu->bloom_texel[1] = 1.0f / (float)p->level_h[0];
+		cu->bloom_max[0] = ((float)area_w[0] - 0.5f) / (float)p->level_w[0];
+		cu->bloom_max[1] = ((float)area_h[0] - 0.5f) / (float)p->level_h[0];
+		cu->up_texel[0] = 1.0f / (float)p->level_w[1];
+		cu->up_texel[1] = 1.0f / (float)p->level_h[1];
+		cu->up_max[0] = ((float)area_w[1] - 0.5f) / (float)p->level_w[1];
+		cu->up_max[1] = ((float)area_h[1] - 0.5f) / (float)p->level_h[1];
+		cu->bloom_intensity = p->intensity / (float)levels;
+	}
+
+	for (uint32_t pass = 0; bloom && pass * DOWN_PER_PASS < levels; pass++) {
+		DownUniforms *du = (DownUniforms *)(blocks + (BLOCK_DOWN + pass) * BLOCK_STRIDE);
+		uint32_t first = pass * DOWN_PER_PASS;
+		float src_w = pass == 0 ? (float)source_w : (float)p->level_w[first - 1];
+		float src_h = pass == 0 ? (float)source_h : (float)p->level_h[first - 1];
+		float src_aw = pass == 0 ? (float)width : (float)area_w[first - 1];
+		float src_ah = pass == 0 ? (float)height : (float)area_h[first - 1];
+		du->src_texel[0] = 1.0f / src_w;
+		du->src_texel[1] = 1.0f / src_h;
+		du->src_max[0] = (src_aw - 0.5f) / src_w;
+		du->src_max[1] = (src_ah - 0.5f) / src_h;
+		du->dst_texel[0] = 1.0f / (float)p->level_w[first];
+		du->dst_texel[1] = 1.0f / (float)p->level_h[first];
+		du->threshold = p->threshold;
+		du->knee = p->knee;
+		du->levels = levels - first < DOWN_PER_PASS ? levels - first : DOWN_PER_PASS;
+		du->prefilter = pass == 0;
+		for (uint32_t i = 0; i < du->levels; i++) {
+			du->sizes[i * 2] = area_w[first + i];
+			du->sizes[i * 2 + 1] = area_h[first + i];
+		}
+	}
+	for (uint32_t l = 1; bloom && l + 1 < levels; l++) {
+		UpUniforms *uu = (UpUniforms *)(blocks + (BLOCK_UP + l - 1) * BLOCK_STRIDE);
+		uu->src_texel[0] = 1.0f / (float)p->level_w[l + 1];
+		uu->src_texel[1] = 1.0f / (float)p->level_h[l + 1];
+		uu->src_max[0] = ((float)area_w[l + 1] - 0.5f) / (float)p->level_w[l + 1];
+		uu->src_max[1] = ((float)area_h[l + 1] - 0.5f) / (float)p->level_h[l + 1];
+		uu->dst_texel[0] = 1.0f / (float)p->level_w[l];
+		uu->dst_texel[1] = 1.0f / (float)p->level_h[l];
+		uu->size[0] = area_w[l];
+		uu->size[1] = area_h[l];
+	}
+	void_gpu_queue_write_buffer(queue, p->uniform_buffer, 0, blocks, sizeof(blocks));
+
+	void *pass = compute_pass;
+	if (bloom) {
+		if (hdr_view != p->down_group_hdr || !p->down_groups[0]) {
+			group_down(p, 0, hdr_view, 0);
+			p->down_group_hdr = hdr_view;
+		}
+		void_gpu_compute_pass_set_pipeline(pass, p->down_pipeline);
+		for (uint32_t i = 0; i * DOWN_PER_PASS < levels; i++) {
+			uint32_t first = i * DOWN_PER_PASS;
+			void_gpu_compute_pass_set_bind_group_offset(pass, 0, p->down_groups[i],
+				(BLOCK_DOWN + i) * BLOCK_STRIDE);
+			void_gpu_compute_pass_dispatch(pass,
+				groups_for(area_w[first], 8), groups_for(area_h[first], 8), 1);
+			p->dispatches++;
+		}
+
+		// Smallest first; level 0 is added in the composite
+		void_gpu_compute_pass_set_pipeline(pass, p->up_pipeline);
+		for (uint32_t l = levels - 1; l-- > 1;) {
+			void_gpu_compute_pass_set_bind_group_offset(pass, 0, p->up_groups[l],
+				(BLOCK_UP + l - 1) * BLOCK_STRIDE);
+			void_gpu_compute_pass_dispatch(pass, groups_for(area_w[l], 8), groups_for(area_h[l], 8), 1);
+			p->dispatches++;
+		}
+	}
+
+	void *bloom0 = bloom ? p->down_views[0] : p->sink_views[0];
+	if (!p->group || hdr_view != p->group_hdr || out_view != p->group_out ||
+		bloom0 != p->group_bloom || p->lut_view != p->group_lut
+	) {
+		void *bloom1 = !bloom ? p->sink_views[1]
+			: p->levels == 2 ? p->down_views[1] : p->up_views[1];
+		void *g = void_gpu_group_begin(p->composite_layout);
+		void_gpu_group_buffer(g, 0, p->uniform_buffer, BLOCK_COMPOSITE * BLOCK_STRIDE, sizeof(CompositeUniforms));
+		void_gpu_group_texture(g, 1, hdr_view);
+		void_gpu_group_texture(g, 2, out_view);
+		void_gpu_group_texture(g, 3, bloom0);
+		void_gpu_group_texture(g, 4, bloom1);
+		void_gpu_group_texture(g, 5, p->lut_view);
+		void_gpu_group_sampler(g, 6, p->sampler);
+		release_group(&p->group);
+		p->group = void_gpu_group_finish(p->device, g);
+		p->group_hdr = hdr_view;
+		p->group_out = out_view;
+		p->group_bloom = bloom0;
+		p->group_lut = p->lut_view;
+	}
+	void_gpu_compute_pass_set_pipeline(pass, (effects & VOID_POST_FXAA) ? p->fxaa_pipeline : p->composite_pipeline);
+	void_gpu_compute_pass_set_bind_group(pass, 0, p->group);
+	void_gpu_compute_pass_dispatch(pass, groups_for(width, 16), groups_for(height, 16), 1);
+	p->dispatches++;
+}
+
+uint32_t void_post_dispatch_count(void *post) {
+	return ((Post *)post)->dispatches;
+}
@@ -0,0 +1,66 @@
+// Void Render — Compute post-processing: bloom, tonemapping, grading, FXAA
+// The scene renders into an HDR (RGBA16F) target; run() turns its render
+// area into LDR (RGBA8) in a few compute dispatches, at the render
+// resolution (before any upscale):
+//   downsample  bright-pass + 4 pyramid levels per dispatch: each
+//               workgroup reduces its 8x8 half-res tile down to 1x1 in
+//               workgroup memory (two dispatches cover 6 levels)
+//   upsample    tent-filtered accumulation back up the pyramid, one small
+//               dispatch per level (the largest, level 0, is folded into
+//               the composite)
+//   composite   bloom + exposure + ACES tonemap + 3D LUT grade + FXAA in
+//               one pass. A 16x16 tile plus a 3-texel apron is graded into
+//               workgroup memory once, and FXAA reads its neighbours from
+//               there, so full-resolution pixels are read once and written
+//               once.
+// With bloom off only the composite runs. Each effect is a runtime toggle.
+//
+// The bloom pyramid is sized for the source texture (half its size), not
+// the render area, so dynamic resolution changes never reallocate it.
+
+#ifndef VOID_RENDER_POST_H
+#define VOID_RENDER_POST_H
+
+#include <stdint.h>
+
+// Effect bits
+#define VOID_POST_BLOOM   0x1
+#define VOID_POST_TONEMAP 0x2   // off: HDR is clamped to [0, 1]
+#define VOID_POST_GRADE   0x4   // 3D LUT
+#define VOID_POST_FXAA    0x8
+#define VOID_POST_ALL     0xF
+
+#define VOID_POST_BLOOM_LEVELS 6    // half resolution down to 1/64
+#define VOID_POST_LUT_SIZE     32   // default LUT edge
+#define VOID_POST_HDR_FORMAT   0x22 // RGBA16Float: scene target
+#define VOID_POST_OUT_FORMAT   0x12 // RGBA8Unorm: run() output (storage)
+
+void *void_post_create(void *device);
+void  void_post_destroy(void *post);
+
+// --- Settings ---
+void     void_post_set_effects(void *post, uint32_t effects);
+uint32_t void_post_effects(void *post);
+// Soft threshold: bloom starts at threshold - knee and is full above
+// threshold + knee; intensity scales the summed pyramid.
+void void_post_set_bloom(void *post, float threshold, float knee, float intensity);
+void void_post_set_exposure(void *post, float exposure);
+// Grading LUT: size^3 RGBA8 texels, red fastest, then green, then blue.
+// NULL = identity. Returns 1 on success.
+int  void_post_set_lut(void *post, const void *rgba8, uint32_t size);
+// Bakes a simple grade into the LUT: contrast around mid grey, saturation
+// (0 = grey), then per-channel gain
+void void_post_set_grade(void *post, float contrast, float saturation, float r, float g, float b);
+
+// --- Per frame ---
+// Post-processes the top-left width x height of hdr_view (an RGBA16F
+// texture of source_w x source_h, TextureBinding usage) into the same area
+// of out_view (RGBA8Unorm, StorageBinding usage), recording into an open
+// compute pass.
+void void_post_run(void *post, void *queue, void *compute_pass,
+    void *hdr_view, uint32_t source_w, uint32_t source_h,
+    void *out_view, uint32_t width, uint32_t height);
+// Dispatches recorded by the last run
+uint32_t void_post_dispatch_count(void *post);
+
+#endif
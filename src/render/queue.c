@@ -0,0 +1,411 @@
+// Void Render — Sort-key render queue
+
+#include "queue.h"
+#include "../core/jobs.h"
+#include "../gpu/dawn.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// --- Handle interning (handle -> small stable id per key field) ---
+
+#define INTERN_SLOTS 8192  // power of two, > 2x the widest id space
+
+typedef struct InternTable {
+	const void *keys[INTERN_SLOTS];
+	uint16_t    ids[INTERN_SLOTS];
+	uint32_t    count;
+	uint32_t    limit;  // ids available in the key field (id 0 = NULL)
+} InternTable;
+
+static uint32_t hash_ptr(const void *p) {
+	uint64_t x = (uint64_t)(uintptr_t)p;
+	x ^= x >> 33;
+	x *= 0xff51afd7ed558ccdULL;
+	x ^= x >> 33;
+	return (uint32_t)x;
+}
+
+static uint32_t intern(InternTable *t, const void *p) {
+	if (!p) return 0;
+	uint32_t h = hash_ptr(p);
+	uint32_t slot = h & (INTERN_SLOTS - 1);
+	for (;;) {
+		if (t->keys[slot] == p) return t->ids[slot];
+		if (t->keys[slot] == NULL) break;
+		slot = (slot + 1) & (INTERN_SLOTS - 1);
+	}
+	// Out of ids: fall back to a hashed id (grouping only, never correctness)
+	if (t->count + 1 >= t->limit) return 1 + h % (t->limit - 1);
+	t->keys[slot] = p;
+	t->ids[slot] = (uint16_t)(++t->count);
+	return t->count;
+}
+
+// --- Queue ---
+
+typedef struct RenderQueue {
+	VoidDrawItem  *items;
+	uint64_t      *keys;
+	uint32_t      *order;
+	uint64_t      *tmp_keys;
+	uint32_t      *tmp_order;
+	uint32_t       count;
+	uint32_t       capacity;
+	int            sorted;
+	float          near_z;
+	float          depth_scale;
+	InternTable    pipelines;
+	InternTable    materials;
+	InternTable    bindings;
+	InternTable    meshes;
+	VoidQueueStats stats;
+} RenderQueue;
+
+// Grows in size_t and clamps to UINT32_MAX items, so indices stay below the
+// UINT32_MAX error value; fails when needed is past that or the byte size
+// would overflow
+static int queue_reserve(RenderQueue *q, size_t needed) {
+	if (needed <= q->capacity) return 1;
+	if (needed > UINT32_MAX || needed > SIZE_MAX / sizeof(VoidDrawItem)) return 0;
+	size_t cap = q->capacity ? q->capacity : 256;
+	while (cap < needed) cap = cap > UINT32_MAX / 2 ? UINT32_MAX : cap * 2;
+	if (cap > SIZE_MAX / sizeof(VoidDrawItem)) cap = needed;
+	VoidDrawItem *items = realloc(q->items, cap * sizeof(VoidDrawItem));
+	if (items) q->items = items;
+	uint64_t *keys = realloc(q->keys, cap * sizeof(uint64_t));
+	if (keys) q->keys = keys;
+	uint32_t *order = realloc(q->order, cap * sizeof(uint32_t));
+	if (order) q->order = order;
+	uint64_t *tmp_keys = realloc(q->tmp_keys, cap * sizeof(uint64_t));
+	if (tmp_keys) q->tmp_keys = tmp_keys;
+	uint32_t *tmp_order = realloc(q->tmp_order, cap * sizeof(uint32_t));
+	if (tmp_order) q->tmp_order = tmp_order;
+	if (!items || !keys || !order || !tmp_keys || !tmp_order) return 0;
+	q->capacity = (uint32_t)cap;
+	return 1;
+}
+
+void *void_queue_create(uint32_t initial_capacity) {
+	RenderQueue *q = calloc(1, sizeof(RenderQueue));
+	if (!q) return NULL;
+	q->pipelines.limit = 1u << VOID_QUEUE_PIPELINE_BITS;
+	q->materials.limit = 1u << VOID_QUEUE_MATERIAL_BITS;
+	q->bindings.limit  = 1u << VOID_QUEUE_BINDING_BITS;
+	q->meshes.limit    = 1u << VOID_QUEUE_MESH_BITS;
+	void_queue_set_depth_range(q, 0.1f, 100.0f);
+	if (!queue_reserve(q, initial_capacity ? initial_capacity : 256)) {
+		void_queue_destroy(q);
+		return NULL;
+	}
+	return q;
+}
+
+void void_queue_destroy(void *queue) {
+	RenderQueue *q = (RenderQueue *)queue;
+	if (!q) return;
+	free(q->items);
+	free(q->keys);
+	free(q->order);
+	free(q->tmp_keys);
+	free(q->tmp_order);
+	free(q);
+}
+
+void void_queue_set_depth_range(void *queue, float near_z, float far_z) {
+	RenderQueue *q = (RenderQueue *)queue;
+	q->near_z = near_z;
+	q->depth_scale = far_z > near_z ? 1.0f / (far_z - near_z) : 0.0f;
+}
+
+void void_queue_begin(void *queue) {
+	RenderQueue *q = (RenderQueue *)queue;
+	q->count = 0;
+	q->sorted = 0;
+	memset(&q->stats, 0, sizeof(q->stats));
+}
+
+// --- Key packing ---
+
+static uint64_t quantize_depth(const RenderQueue *q, float depth) {
+	float t = (depth - q->near_z) * q->depth_scale;
+	if (!(t > 0.0f)) t = 0.0f;  // also catches NaN
+	if (t > 1.0f) t = 1.0f;
+	return (uint64_t)(t * (float)((1u << VOID_QUEUE_DEPTH_BITS) - 1));
+}
+
+static uint64_t make_key(RenderQueue *q, uint32_t pass, int translucent, float depth,
+	const VoidDrawItem *item
+) {
+	uint64_t pipe = intern(&q->pipelines, item->pipeline);
+	uint64_t mat  = intern(&q->materials, item->bind_groups[1]);
+	uint64_t bind = intern(&q->bindings, item->bind_groups[0]);
+	uint64_t mesh = intern(&q->meshes, item->vertex_buffer);
+	uint64_t d    = quantize_depth(q, depth);
+
+	uint64_t state = pipe;
+	state = (state << VOID_QUEUE_MATERIAL_BITS) | mat;
+	state = (state << VOID_QUEUE_BINDING_BITS) | bind;
+	state = (state << VOID_QUEUE_MESH_BITS) | mesh;
+
+	uint64_t key = (uint64_t)(pass & ((1u << VOID_QUEUE_PASS_BITS) - 1));
+	key = (key << 1) | (translucent ? 1u : 0u);
+	if (translucent) {
+		uint64_t back_to_front = ((1u << VOID_QUEUE_DEPTH_BITS) - 1) - d;
+		key = (key << VOID_QUEUE_DEPTH_BITS) | back_to_front;
+		key = (key << (64 - VOID_QUEUE_PASS_BITS - 1 - VOID_QUEUE_DEPTH_BITS)) | state;
+	} else {
+		key = (key << (64 - VOID_QUEUE_PASS_BITS - 1 - VOID_QUEUE_DEPTH_BITS)) | state;
+		key = (key << VOID_QUEUE_DEPTH_BITS) | d;
+	}
+	return key;
+}
+
+uint32_t void_queue_push_item(void *queue, uint32_t pass, int translucent, float depth,
+	const VoidDrawItem *item
+) {
+	RenderQueue *q = (RenderQueue *)queue;
+	if (!queue_reserve(q, (size_t)q->count + 1)) return UINT32_MAX;
+	uint32_t i = q->count++;
+	q->items[i] = *item;
+	if (q->items[i].instance_count == 0) q->items[i].instance_count = 1;
+	q->keys[i] = make_key(q, pass, translucent, depth, item);
+	q->order[i] = i;
+	q->sorted = 0;
+	return i;
+}
+
+uint32_t void_queue_push(void *queue, uint32_t pass, int translucent, float depth,
+	void *pipeline, void *bind_group0, void *bind_group1,
+	void *vertex_buffer, void *index_buffer, uint32_t index_format,
+	uint32_t count, uint32_t instance_count
+) {
+	VoidDrawItem item = {0};
+	item.pipeline = pipeline;
+	item.bind_groups[0] = bind_group0;
+	item.bind_groups[1] = bind_group1;
+	item.vertex_buffer = vertex_buffer;
+	item.index_buffer = index_buffer;
+	item.index_format = index_format;
+	item.count = count;
+	item.instance_count = instance_count;
+	return void_queue_push_item(queue, pass, translucent, depth, &item);
+}
+
+void void_queue_set_bind_group(void *queue, uint32_t item, uint32_t index, void *bind_group) {
+	RenderQueue *q = (RenderQueue *)queue;
+	if (item >= q->count || index >= VOID_QUEUE_MAX_BIND_GROUPS) return;
+	q->items[item].bind_groups[index] = bind_group;
+}
+
+void void_queue_set_base_vertex(void *queue, uint32_t item, uint32_t base_vertex) {
+	RenderQueue *q = (RenderQueue *)queue;
+	if (item >= q->count) return;
+	VoidDrawItem *it = &q->items[item];
+	if (it->index_buffer) it->base_vertex = (int32_t)base_vertex;
+	else it->first = base_vertex;
+}
+
+void void_queue_set_first_index(void *queue, uint32_t item, uint32_t first_index) {
+	RenderQueue *q = (RenderQueue *)queue;
+	if (item >= q->count) return;
+	VoidDrawItem *it = &q->items[item];
+	if (it->index_buffer) it->first = first_index;
+}
+
+void void_queue_set_first_instance(void *queue, uint32_t item, uint32_t first_instance) {
+	RenderQueue *q = (RenderQueue *)queue;
+	if (item >= q->count) return;
+	q->items[item].first_instance = first_instance;
+}
+
+// --- Radix sort (LSD, 8-bit digits, parallel histogram + stable scatter) ---
+
+#define RADIX_MAX_CHUNKS   32
+#define RADIX_PARALLEL_MIN 8192   // below this the job overhead dominates
+
+typedef struct RadixPass {
+	const uint64_t *src_keys;
+	const uint32_t *src_values;
+	uint64_t       *dst_keys;
+	uint32_t       *dst_values;
+	uint32_t        count;
+	uint32_t        chunk;
+	uint32_t        shift;
+	uint32_t        hist[RADIX_MAX_CHUNKS][256];
+} RadixPass;
+
+static void radix_histogram(void *ctx, uint32_t begin, uint32_t end, uint32_t worker) {
+	(void)worker;
+	RadixPass *p = (RadixPass *)ctx;
+	for (uint32_t c = begin; c < end; c++) {
+		uint32_t *h = p->hist[c];
+		memset(h, 0, 256 * sizeof(uint32_t));
+		uint32_t lo = c * p->chunk;
+		uint32_t hi = lo + p->chunk < p->count ? lo + p->chunk : p->count;
+		for (uint32_t i = lo; i < hi; i++) {
+			h[(p->src_keys[i] >> p->shift) & 0xFF]++;
+		}
+	}
+}
+
+static void radix_scatter(void *ctx, uint32_t begin, uint32_t end, uint32_t worker) {
+	(void)worker;
+	RadixPass *p = (RadixPass *)ctx;
+	for (uint32_t c = begin; c < end; c++) {
+		uint32_t *offs = p->hist[c];  // prefix offsets after the scan
+		uint32_t lo = c * p->chunk;
+		uint32_t hi = lo + p->chunk < p->count ? lo + p->chunk : p->count;
+		for (uint32_t i = lo; i < hi; i++) {
+			uint64_t k = p->src_keys[i];
+			uint32_t dst = offs[(k >> p->shift) & 0xFF]++;
+			p->dst_keys[dst] = k;
+			p->dst_values[dst] = p->src_values[i];
+		}
+	}
+}
+
+void void_radix_sort_u64(uint64_t *keys, uint32_t *values,
+	uint64_t *tmp_keys, uint32_t *tmp_values, uint32_t count
+) {
+	if (count < 2) return;
+
+	RadixPass p;
+	uint32_t chunks = 1;
+	if (count >= RADIX_PARALLEL_MIN) {
+		chunks = void_jobs_thread_count() * 2;
+		if (chunks > RADIX_MAX_CHUNKS) chunks = RADIX_MAX_CHUNKS;
+	}
+	p.count = count;
+	p.chunk = (count + chunks - 1) / chunks;
+	chunks = (count + p.chunk - 1) / p.chunk;
+
+	uint64_t *src_k = keys, *dst_k = tmp_keys;
+	uint32_t *src_v = values, *dst_v = tmp_values;
+
+	for (uint32_t shift = 0; shift < 64; shift += 8) {
+		p.src_keys = src_k;
+		p.src_values = src_v;
+		p.dst_keys = dst_k;
+		p.dst_values = dst_v;
+		p.shift = shift;
+		void_jobs_parallel_for(chunks, 1, radix_histogram, &p);
+
+		// Skip digits where every key lands in one bucket (common for the
+		// high pass/pipeline bits and for quantized depth).
+		uint32_t total[256] = {0};
+		int skip = 0;
+		for (uint32_t d = 0; d < 256 && !skip; d++) {
+			for (uint32_t c = 0; c < chunks; c++) total[d] += p.hist[c][d];
+			if (total[d] == count) skip = 1;
+		}
+		if (skip) continue;
+
+		// Exclusive scan: digit-major, chunk-minor keeps the sort stable.
+		uint32_t sum = 0;
+		for (uint32_t d = 0; d < 256; d++) {
+			for (uint32_t c = 0; c < chunks; c++) {
+				uint32_t n = p.hist[c][d];
+				p.hist[c][d] = sum;
+				sum += n;
+			}
+		}
+		void_jobs_parallel_for(chunks, 1, radix_scatter, &p);
+
+		uint64_t *tk = src_k; src_k = dst_k; dst_k = tk;
+		uint32_t *tv = src_v; src_v = dst_v; dst_v = tv;
+	}
+
+	if (src_k != keys) {
+		memcpy(keys, src_k, count * sizeof(uint64_t));
+		memcpy(values, src_v, count * sizeof(uint32_t));
+	}
+}
+
+void void_queue_sort(void *queue) {
+	RenderQueue *q = (RenderQueue *)queue;
+	if (q->sorted) return;
+	void_radix_sort_u64(q->keys, q->order, q->tmp_keys, q->tmp_order, q->count);
+	q->sorted = 1;
+}
+
+// --- Submission ---
+
+static uint32_t lower_bound_pass(const RenderQueue *q, uint32_t pass) {
+	uint64_t target = (uint64_t)pass << (64 - VOID_QUEUE_PASS_BITS);
+	uint32_t lo = 0, hi = q->count;
+	while (lo < hi) {
+		uint32_t mid = lo + (hi - lo) / 2;
+		if (q->keys[mid] < target) lo = mid + 1; else hi = mid;
+	}
+	return lo;
+}
+
+void void_queue_submit(void *queue, void *render_pass, uint32_t pass) {
+	RenderQueue *q = (RenderQueue *)queue;
+	void_queue_sort(q);
+
+	void *cur_pipeline = NULL;
+	void *cur_groups[VOID_QUEUE_MAX_BIND_GROUPS] = {0};
+	void *cur_vb = NULL;
+	void *cur_ib = NULL;
+	uint32_t cur_ib_format = 0;
+	VoidQueueStats *s = &q->stats;
+
+	for (uint32_t i = lower_bound_pass(q, pass); i < q->count; i++) {
+		if ((q->keys[i] >> (64 - VOID_QUEUE_PASS_BITS)) != pass) break;
+		const VoidDrawItem *it = &q->items[q->order[i]];
+
+		if (it->pipeline != cur_pipeline) {
+			void_gpu_render_pass_set_pipeline(render_pass, it->pipeline);
+			cur_pipeline = it->pipeline;
+			s->pipeline_switches++;
+		} else {
+			s->redundant_skipped++;
+		}
+
+		for (uint32_t g = 0; g < VOID_QUEUE_MAX_BIND_GROUPS; g++) {
+			void *bg = it->bind_groups[g];
+			if (!bg) continue;
+			if (bg != cur_groups[g]) {
+				void_gpu_render_pass_set_bind_group(render_pass, g, bg);
+				cur_groups[g] = bg;
+				s->bind_group_switches++;
+			} else {
+				s->redundant_skipped++;
+			}
+		}
+
+		if (it->vertex_buffer && it->vertex_buffer != cur_vb) {
+			void_gpu_render_pass_set_vertex_buffer(render_pass, 0, it->vertex_buffer, 0, 0);
+			cur_vb = it->vertex_buffer;
+			s->buffer_switches++;
+		}
+
+		if (it->index_buffer) {
+			if (it->index_buffer != cur_ib || it->index_format != cur_ib_format) {
+				void_gpu_render_pass_set_index_buffer(render_pass, it->index_buffer, it->index_format, 0, 0);
+				cur_ib = it->index_buffer;
+				cur_ib_format = it->index_format;
+				s->buffer_switches++;
+			}
+			void_gpu_render_pass_draw_indexed(render_pass, it->count, it->instance_count,
+				it->first, it->base_vertex, it->first_instance);
+		} else {
+			void_gpu_render_pass_draw_instanced(render_pass, it->count, it->instance_count,
+				it->first, it->first_instance);
+		}
+		s->draws++;
+	}
+}
+
+// --- Stats ---
+
+const VoidQueueStats *void_queue_stats(void *queue) {
+	return &((RenderQueue *)queue)->stats;
+}
+
+uint32_t void_queue_stat_draws(void *queue)               { return ((RenderQueue *)queue)->stats.draws; }
+uint32_t void_queue_stat_pipeline_switches(void *queue)   { return ((RenderQueue *)queue)->stats.pipeline_switches; }
+uint32_t void_queue_stat_bind_group_switches(void *queue) { return ((RenderQueue *)queue)->stats.bind_group_switches; }
+uint32_t void_queue_stat_redundant_skipped(void *queue)   { return ((RenderQueue *)queue)->stats.redundant_skipped; }
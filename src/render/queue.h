@@ -0,0 +1,102 @@
+// Void Render — Sort-key render queue
+// Draws are recorded with a packed 64-bit key, radix-sorted, then replayed
+// into a render pass with redundant pipeline / bind group changes dropped.
+// All handles are opaque pointers.
+
+#ifndef VOID_RENDER_QUEUE_H
+#define VOID_RENDER_QUEUE_H
+
+#include <stdint.h>
+
+// Key layout (MSB first):
+//   opaque:      pass(4) | 0 | pipeline(10) | material(12) | bind group(11) | mesh(10) | depth(16)
+//   translucent: pass(4) | 1 | ~depth(16) | pipeline(10) | material(12) | bind group(11) | mesh(10)
+// Opaque draws group by state and go front-to-back inside a state bucket;
+// translucent draws go back-to-front and only group state on depth ties.
+// "material" is bind group 1, "bind group" is bind group 0, "mesh" is the
+// vertex buffer. Ids are interned from handles; collisions only affect
+// grouping, never correctness (state is compared by handle at submit).
+#define VOID_QUEUE_PASS_BITS     4
+#define VOID_QUEUE_PIPELINE_BITS 10
+#define VOID_QUEUE_MATERIAL_BITS 12
+#define VOID_QUEUE_BINDING_BITS  11
+#define VOID_QUEUE_MESH_BITS     10
+#define VOID_QUEUE_DEPTH_BITS    16
+
+#define VOID_QUEUE_MAX_BIND_GROUPS 4
+
+typedef struct VoidDrawItem {
+	void    *pipeline;
+	void    *bind_groups[VOID_QUEUE_MAX_BIND_GROUPS]; // NULL = leave unset
+	void    *vertex_buffer;
+	void    *index_buffer;                           // NULL = non-indexed draw
+	uint32_t index_format;
+	uint32_t count;                                  // index or vertex count
+	uint32_t first;
+	int32_t  base_vertex;
+	uint32_t instance_count;
+	uint32_t first_instance;
+} VoidDrawItem;
+
+typedef struct VoidQueueStats {
+	uint32_t draws;
+	uint32_t pipeline_switches;
+	uint32_t bind_group_switches;
+	uint32_t buffer_switches;
+	uint32_t redundant_skipped;   // state calls dropped because nothing changed
+} VoidQueueStats;
+
+void *void_queue_create(uint32_t initial_capacity);
+void  void_queue_destroy(void *queue);
+
+// View depth range used to quantize depth into the key.
+void void_queue_set_depth_range(void *queue, float near_z, float far_z);
+
+// Clear recorded draws and per-frame stats (interned ids are kept so the
+// ordering stays stable between frames).
+void void_queue_begin(void *queue);
+
+// Record one draw. `depth` is view-space distance from the camera.
+// Returns the item index, usable with void_queue_set_bind_group.
+uint32_t void_queue_push(void *queue, uint32_t pass, int translucent, float depth,
+    void *pipeline, void *bind_group0, void *bind_group1,
+    void *vertex_buffer, void *index_buffer, uint32_t index_format,
+    uint32_t count, uint32_t instance_count);
+
+// Record a fully described draw (C callers).
+uint32_t void_queue_push_item(void *queue, uint32_t pass, int translucent, float depth,
+    const VoidDrawItem *item);
+
+// Extra bind group slots (2, 3) on an already pushed item.
+void void_queue_set_bind_group(void *queue, uint32_t item, uint32_t index, void *bind_group);
+
+// First vertex of an already pushed item (base vertex of indexed draws),
+// e.g. one instance inside a shared skinned vertex buffer.
+void void_queue_set_base_vertex(void *queue, uint32_t item, uint32_t base_vertex);
+
+// First index of an already pushed indexed draw, e.g. one LOD inside a
+// mesh's shared index buffer (see mesh.h).
+void void_queue_set_first_index(void *queue, uint32_t item, uint32_t first_index);
+
+// First instance of an already pushed item, e.g. the offset of its
+// instances in a per-instance table (see texarray.h).
+void void_queue_set_first_instance(void *queue, uint32_t item, uint32_t first_instance);
+
+// Radix-sort recorded keys (parallel across the job pool for large queues).
+void void_queue_sort(void *queue);
+
+// Replay every sorted draw of `pass` into a render pass encoder.
+void void_queue_submit(void *queue, void *render_pass, uint32_t pass);
+
+const VoidQueueStats *void_queue_stats(void *queue);
+uint32_t void_queue_stat_draws(void *queue);
+uint32_t void_queue_stat_pipeline_switches(void *queue);
+uint32_t void_queue_stat_bind_group_switches(void *queue);
+uint32_t void_queue_stat_redundant_skipped(void *queue);
+
+// Sort `count` 64-bit keys, carrying a 32-bit payload along.
+// `tmp_keys` / `tmp_values` must hold `count` entries each.
+void void_radix_sort_u64(uint64_t *keys, uint32_t *values,
+    uint64_t *tmp_keys, uint32_t *tmp_values, uint32_t count);
+
+#endif
@@ -0,0 +1,277 @@
+// Void Render — Dynamic resolution scaling
+
+#include "resolution.h"
+#include "../gpu/dawn.h"
+#include "../gpu/enums.h"
+#include "../gpu/cache.h"
+#include "../gpu/timer.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+// Weight of a new sample in the smoothed frame time
+#define SMOOTHING      0.15f
+// Frames to wait after a change: the timer reports VOID_GPU_TIMER_LATENCY
+// frames late, plus one for the frame already recorded at the old scale.
+#define SETTLE_FRAMES  (VOID_GPU_TIMER_LATENCY + 1)
+// Largest increase per change; decreases are not limited
+#define MAX_RAISE      0.05f
+// Smaller changes are not worth a visible jump
+#define MIN_CHANGE     0.01f
+
+// --- GPU layout (must match Upscale below) ---
+
+typedef struct UpscaleUniforms {
+	float uv_scale[2];     // render area / source size
+	float texel[2];        // 1 / source size
+	float uv_max[2];       // center of the last render-area texel
+	float sharpness;
+	float pad;
+} UpscaleUniforms;
+
+// --- WGSL ---
+
+static const char *s_upscale_wgsl =
+"struct Upscale {\n"
+"  uv_scale: vec2f,\n"
+"  texel: vec2f,\n"
+"  uv_max: vec2f,\n"
+"  sharpness: f32,\n"
+"  pad: f32,\n"
+"};\n"
+"@group(0) @binding(0) var<uniform> up: Upscale;\n"
+"@group(0) @binding(1) var up_src: texture_2d<f32>;\n"
+"@group(0) @binding(2) var up_samp: sampler;\n"
+"\n"
+"struct VsOut {\n"
+"  @builtin(position) pos: vec4f,\n"
+"  @location(0) uv: vec2f,\n"
+"};\n"
+"\n"
+"// One triangle covering the target\n"
+"@vertex fn vs_main(@builtin(vertex_index) vi: u32) -> VsOut {\n"
+"  let p = vec2f(f32((vi << 1u) & 2u), f32(vi & 2u));\n"
+"  var out: VsOut;\n"
+"  out.pos = vec4f(p * vec2f(2.0, -2.0) + vec2f(-1.0, 1.0), 0.0, 1.0);\n"
+"  out.uv = p;\n"
+"  return out;\n"
+"}\n"
+"\n"
+"// Bilinear fetch that never reads outside the rendered area\n"
+"fn up_fetch(uv: vec2f) -> vec3f {\n"
+"  return textureSampleLevel(up_src, up_samp, clamp(uv, up.texel * 0.5, up.uv_max), 0.0).rgb;\n"
+"}\n"
+"\n"
+"@fragment fn fs_main(in: VsOut) -> @location(0) vec4f {\n"
+"  let uv = in.uv * up.uv_scale;\n"
+"  let e = up_fetch(uv);\n"
+"  if (up.sharpness <= 0.0) {\n"
+"    return vec4f(e, 1.0);\n"
+"  }\n"
+"\n"
+"  // Contrast-adaptive sharpening on the source-texel cross: full strength\n"
+"  // in flat areas, backing off where the neighbourhood is already close to\n"
+"  // clipping, which keeps edges from ringing.\n"
+"  let b = up_fetch(uv - vec2f(0.0, up.texel.y));\n"
+"  let d = up_fetch(uv - vec2f(up.texel.x, 0.0));\n"
+"  let f = up_fetch(uv + vec2f(up.texel.x, 0.0));\n"
+"  let h = up_fetch(uv + vec2f(0.0, up.texel.y));\n"
+"  let mn = min(e, min(min(b, d), min(f, h)));\n"
+"  let mx = max(e, max(max(b, d), max(f, h)));\n"
+"  let amp = sqrt(clamp(min(mn, 1.0 - mx) / max(mx, vec3f(1e-4)), vec3f(0.0), vec3f(1.0)));\n"
+"  let w = -amp * mix(0.125, 0.2, up.sharpness);\n"
+"  let c = (e + (b + d + f + h) * w) / (1.0 + 4.0 * w);\n"
+"  return vec4f(clamp(c, vec3f(0.0), vec3f(1.0)), 1.0);\n"
+"}\n";
+
+// --- Resolution ---
+
+typedef struct Resolution {
+	void *device;
+
+	// Controller
+	float target_ms;
+	float headroom;
+	float min_scale;
+	float max_scale;
+	float scale;
+	float average_ms;      // 0 = no sample yet
+	uint32_t settle;
+
+	// Upscale
+	float sharpness;
+	void *shader;
+	void *pipeline;
+	void *uniform_buffer;
+	void *sampler;         // cached
+	void *layout;          // cached
+	void *pipeline_layout; // cached
+	void *group;           // cached, for group_view
+	void *group_view;
+} Resolution;
+
+static float clampf(float v, float lo, float hi) {
+	return v < lo ? lo : (v > hi ? hi : v);
+}
+
+void *void_resolution_create(void *device, uint32_t format) {
+	Resolution *r = calloc(1, sizeof(Resolution));
+	r->device = device;
+	r->target_ms = 16.0f;
+	r->headroom = 0.15f;
+	r->min_scale = 0.5f;
+	r->max_scale = 1.0f;
+	r->scale = 1.0f;
+	r->sharpness = 0.5f;
+
+	r->uniform_buffer = void_gpu_create_buffer(device, sizeof(UpscaleUniforms),
+		BUFFER_USAGE_UNIFORM | BUFFER_USAGE_COPY_DST, 0);
+	r->sampler = void_gpu_cached_sampler(device, ADDRESS_CLAMP, ADDRESS_CLAMP, ADDRESS_CLAMP,
+		FILTER_LINEAR, FILTER_LINEAR, MIPMAP_NEAREST, 0, 1);
+
+	void *b = void_gpu_layout_begin();
+	void_gpu_layout_buffer(b, 0, STAGE_FRAGMENT, BINDING_UNIFORM, sizeof(UpscaleUniforms), 0);
+	void_gpu_layout_texture(b, 1, STAGE_FRAGMENT, SAMPLE_TYPE_FLOAT, VIEW_2D, 0);
+	void_gpu_layout_sampler(b, 2, STAGE_FRAGMENT, SAMPLER_FILTERING);
+	r->layout = void_gpu_layout_finish(device, b);
+	r->pipeline_layout = void_gpu_cached_pipeline_layout_1(device, r->layout);
+
+	r->shader = void_gpu_create_shader(device, s_upscale_wgsl);
+	VoidRenderPipelineDesc d = {0};
+	d.shader = r->shader;
+	d.vs_entry = "vs_main";
+	d.fs_entry = "fs_main";
+	d.layout = r->pipeline_layout;
+	d.color_format = format;
+	r->pipeline = void_gpu_create_render_pipeline_desc(device, &d);
+	return r;
+}
+
+void void_resolution_destroy(void *resolution) {
+	Resolution *r = (Resolution *)resolution;
+	if (!r) return;
+	if (r->group) void_gpu_cache_release(r->group);
+	void_gpu_release_pipeline(r->pipeline);
+	void_gpu_release_shader(r->shader);
+	void_gpu_cache_release(r->pipeline_layout);
+	void_gpu_cache_release(r->layout);
+	void_gpu_cache_release(r->sampler);
+	void_gpu_release_buffer(r->uniform_buffer);
+	free(r);
+}
+
+// --- Controller ---
+
+void void_resolution_set_target(void *resolution, float target_ms, float headroom) {
+	Resolution *r = (Resolution *)resolution;
+	r->target_ms = target_ms > 0.1f ? target_ms : 0.1f;
+	r->headroom = clampf(headroom, 0.0f, 0.9f);
+}
+
+void void_resolution_set_range(void *resolution, float min_scale, float max_scale) {
+	Resolution *r = (Resolution *)resolution;
+	r->min_scale = clampf(min_scale, 0.1f, 1.0f);
+	r->max_scale = clampf(max_scale, r->min_scale, 2.0f);
+	r->scale = clampf(r->scale, r->min_scale, r->max_scale);
+}
+
+float void_resolution_update(void *resolution, float frame_ms) {
+	Resolution *r = (Resolution *)resolution;
+	if (frame_ms <= 0.0f) return r->scale;
+
+	r->average_ms = r->average_ms > 0.0f
+		? r->average_ms + (frame_ms - r->average_ms) * SMOOTHING
+		: frame_ms;
+	if (r->settle > 0) {
+		r->settle--;
+		return r->scale;
+	}
+
+	// Inside the band: hold. Outside: aim for the middle of the band.
+	float high = r->target_ms;
+	float low = r->target_ms * (1.0f - r->headroom);
+	if (r->average_ms <= high && r->average_ms >= low) return r->scale;
+
+	float aim = (high + low) * 0.5f;
+	float next = r->scale * sqrtf(aim / r->average_ms);
+	if (next > r->scale + MAX_RAISE) next = r->scale + MAX_RAISE;
+	next = clampf(next, r->min_scale, r->max_scale);
+	if (fabsf(next - r->scale) < MIN_CHANGE) return r->scale;
+
+	// Predict the new cost so the average does not have to relearn it
+	float ratio = next / r->scale;
+	r->average_ms *= ratio * ratio;
+	r->scale = next;
+	r->settle = SETTLE_FRAMES;
+	return r->scale;
+}
+
+float void_resolution_scale(void *resolution) {
+	return ((Resolution *)resolution)->scale;
+}
+
+void void_resolution_set_scale(void *resolution, float scale) {
+	Resolution *r = (Resolution *)resolution;
+	float next = clampf(scale, r->min_scale, r->max_scale);
+	if (r->average_ms > 0.0f) {
+		float ratio = next / r->scale;
+		r->average_ms *= ratio * ratio;
+	}
+	r->scale = next;
+	r->settle = SETTLE_FRAMES;
+}
+
+static uint32_t scaled(float scale, uint32_t full) {
+	if (full <= 8) return full;
+	uint32_t v = (uint32_t)(full * scale / 8.0f + 0.5f) * 8;
+	if (v < 8) v = 8;
+	return v > full ? full : v;
+}
+
+uint32_t void_resolution_width(void *resolution, uint32_t full_width) {
+	return scaled(((Resolution *)resolution)->scale, full_width);
+}
+
+uint32_t void_resolution_height(void *resolution, uint32_t full_height) {
+	return scaled(((Resolution *)resolution)->scale, full_height);
+}
+
+// --- Upscale ---
+
+void void_resolution_set_sharpness(void *resolution, float sharpness) {
+	((Resolution *)resolution)->sharpness = clampf(sharpness, 0.0f, 1.0f);
+}
+
+void void_resolution_upscale(void *resolution, void *queue, void *pass,
+	void *source_view, uint32_t source_w, uint32_t source_h,
+	uint32_t render_w, uint32_t render_h
+) {
+	Resolution *r = (Resolution *)resolution;
+	if (!source_view || !source_w || !source_h) return;
+
+	// Pool views change when the graph re-binds; the cache keeps the old
+	// group alive for a few frames, so a ping-pong between two still hits.
+	if (source_view != r->group_view) {
+		if (r->group) void_gpu_cache_release(r->group);
+		void *g = void_gpu_group_begin(r->layout);
+		void_gpu_group_buffer(g, 0, r->uniform_buffer, 0, 0);
+		void_gpu_group_texture(g, 1, source_view);
+		void_gpu_group_sampler(g, 2, r->sampler);
+		r->group = void_gpu_group_finish(r->device, g);
+		r->group_view = source_view;
+	}
+
+	UpscaleUniforms u = {0};
+	u.uv_scale[0] = (float)render_w / (float)source_w;
+	u.uv_scale[1] = (float)render_h / (float)source_h;
+	u.texel[0] = 1.0f / (float)source_w;
+	u.texel[1] = 1.0f / (float)source_h;
+	u.uv_max[0] = ((float)render_w - 0.5f) / (float)source_w;
+	u.uv_max[1] = ((float)render_h - 0.5f) / (float)source_h;
+	u.sharpness = r->sharpness;
+	void_gpu_queue_write_buffer(queue, r->uniform_buffer, 0, &u, sizeof(u));
+
+	void_gpu_render_pass_set_pipeline(pass, r->pipeline);
+	void_gpu_render_pass_set_bind_group(pass, 0, r->group);
+	void_gpu_render_pass_draw(pass, 3);
+}
@@ -0,0 +1,48 @@
+// Void Render — Dynamic resolution scaling
+// A controller turns measured GPU frame times into a render scale, and an
+// upscale pass draws the scaled scene onto the output with a bilinear fetch
+// plus contrast-adaptive sharpening.
+//
+// The scene target keeps its full size; only the top-left render area
+// (void_resolution_width/height) is rendered, through the render graph's
+// pass viewport, so a scale change never reallocates anything.
+//
+// Controller: GPU cost is taken as proportional to pixel count (scale^2).
+// Times are smoothed; over budget the scale drops at once to what the
+// smoothed time says fits, under (1 - headroom) of the budget it climbs back
+// slowly, and in between it holds. After a change it waits a few frames for
+// the (late) timings of the new scale before deciding again.
+
+#ifndef VOID_RENDER_RESOLUTION_H
+#define VOID_RENDER_RESOLUTION_H
+
+#include <stdint.h>
+
+// format = TextureFormat of the upscale pass's color target (0 = BGRA8Unorm)
+void *void_resolution_create(void *device, uint32_t format);
+void  void_resolution_destroy(void *resolution);
+
+// --- Controller ---
+// GPU time budget per frame, and the band below it where the scale holds.
+void void_resolution_set_target(void *resolution, float target_ms, float headroom);
+void void_resolution_set_range(void *resolution, float min_scale, float max_scale);
+// Feed one frame's GPU time; frame_ms <= 0 (no measurement) is ignored.
+// Returns the scale for the next frame.
+float void_resolution_update(void *resolution, float frame_ms);
+float void_resolution_scale(void *resolution);
+// Fix the scale (clamped to the range); the controller continues from it.
+void void_resolution_set_scale(void *resolution, float scale);
+// Render area for a full-size dimension (multiple of 8, at least 8)
+uint32_t void_resolution_width(void *resolution, uint32_t full_width);
+uint32_t void_resolution_height(void *resolution, uint32_t full_height);
+
+// --- Upscale ---
+// 0 = plain bilinear, 1 = strongest sharpening.
+void void_resolution_set_sharpness(void *resolution, float sharpness);
+// Draw the render area (render_w x render_h) of `source` (a source_w x
+// source_h view) over the whole render pass target.
+void void_resolution_upscale(void *resolution, void *queue, void *pass,
+    void *source_view, uint32_t source_w, uint32_t source_h,
+    uint32_t render_w, uint32_t render_h);
+
+#endif
@@ -0,0 +1,462 @@
+// Void Render — Cascaded shadow maps for the directional (sun) light
+
+#include "shadows.h"
+#include "../gpu/dawn.h"
+#include "../gpu/enums.h"
+#include "../gpu/cache.h"
+#include "../math/mat4.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define STR_(x) #x
+#define STR(x) STR_(x)
+
+// Per-cascade caster uniforms live at 256-byte offsets (uniform offset alignment)
+#define CASTER_STRIDE 256
+
+// Cached cascades are fitted this much larger than the slice they cover
+#define CACHE_MARGIN 1.5f
+
+// --- GPU layout (must match ShadowUniforms below) ---
+
+typedef struct ShadowUniforms {
+	float cascades[VOID_SHADOW_MAX_CASCADES][16];  // world -> light clip
+	float inv_view_proj[16];
+	float view_z[4];       // row 2 of the camera view matrix
+	float splits[4];       // far view distance of each cascade
+	float texel_world[4];  // world size of one texel, per cascade
+	float params[4];       // 1 / size, cascade count, depth bias, normal offset
+	float screen[4];       // width, height
+} ShadowUniforms;
+
+// --- WGSL ---
+
+static const char *s_caster_wgsl =
+"struct ShadowCaster {\n"
+"  view_proj: mat4x4f,\n"
+"};\n"
+"@group(" STR(VOID_SHADOW_CASTER_GROUP) ") @binding(0) var<uniform> shadow_caster: ShadowCaster;\n"
+"// Per-object uniforms (same buffer as base_mesh)\n"
+"struct Uniforms {\n"
+"  mvp: mat4x4f,\n"
+"  model: mat4x4f,\n"
+"};\n"
+"@group(0) @binding(0) var<uniform> u: Uniforms;\n";
+
+static const char *s_receiver_wgsl =
+"struct ShadowUniforms {\n"
+"  cascades: array<mat4x4f, " STR(VOID_SHADOW_MAX_CASCADES) ">,\n"
+"  inv_view_proj: mat4x4f,\n"
+"  view_z: vec4f,\n"
+"  splits: vec4f,\n"
+"  texel_world: vec4f,\n"
+"  params: vec4f,\n"
+"  screen: vec4f,\n"
+"};\n"
+"@group(" STR(VOID_SHADOW_GROUP) ") @binding(0) var<uniform> shadow_u: ShadowUniforms;\n"
+"@group(" STR(VOID_SHADOW_GROUP) ") @binding(1) var shadow_map: texture_depth_2d_array;\n"
+"@group(" STR(VOID_SHADOW_GROUP) ") @binding(2) var shadow_samp: sampler_comparison;\n"
+"\n"
+"fn shadow_visibility(frag_coord: vec4f) -> f32 {\n"
+"  let ndc = vec4f(frag_coord.x / shadow_u.screen.x * 2.0 - 1.0,\n"
+"                  1.0 - frag_coord.y / shadow_u.screen.y * 2.0, frag_coord.z, 1.0);\n"
+"  let wp = shadow_u.inv_view_proj * ndc;\n"
+"  let wpos = wp.xyz / wp.w;\n"
+"  let n = normalize(cross(dpdy(wpos), dpdx(wpos)));\n"
+"\n"
+"  let view_dist = -(dot(shadow_u.view_z.xyz, wpos) + shadow_u.view_z.w);\n"
+"  let count = u32(shadow_u.params.y);\n"
+"  var cascade = count;\n"
+"  for (var i = 0u; i < count; i++) {\n"
+"    if (view_dist < shadow_u.splits[i]) {\n"
+"      cascade = i;\n"
+"      break;\n"
+"    }\n"
+"  }\n"
+"  if (cascade >= count) {\n"
+"    return 1.0;\n"
+"  }\n"
+"\n"
+"  // Normal offset keeps lit surfaces from shadowing themselves (acne)\n"
+"  let p = wpos + n * shadow_u.texel_world[cascade] * shadow_u.params.w;\n"
+"  let sc = shadow_u.cascades[cascade] * vec4f(p, 1.0);\n"
+"  let uv = sc.xy * vec2f(0.5, -0.5) + 0.5;\n"
+"  let depth = sc.z - shadow_u.params.z;\n"
+"  if (any(uv < vec2f(0.0)) || any(uv > vec2f(1.0)) || depth > 1.0) {\n"
+"    return 1.0;\n"
+"  }\n"
+"\n"
+"  // 3x3 PCF over the hardware's bilinear 2x2 comparison\n"
+"  var lit = 0.0;\n"
+"  for (var y = -1; y <= 1; y++) {\n"
+"    for (var x = -1; x <= 1; x++) {\n"
+"      let o = vec2f(f32(x), f32(y)) * shadow_u.params.x;\n"
+"      lit += textureSampleCompareLevel(shadow_map, shadow_samp, uv + o, cascade, depth);\n"
+"    }\n"
+"  }\n"
+"  return lit / 9.0;\n"
+"}\n";
+
+// --- Shadows ---
+
+typedef struct Cascade {
+	float matrix[16];
+	float center[3];       // light space, texel-snapped
+	float radius;
+	float split;           // far view distance
+	int   fitted;          // cached cascades: bounds are valid
+	int   dirty;           // cached cascades: contents must be re-rendered
+	int   needs_render;
+	void *view;            // single-layer view for rendering
+	void *caster_group;    // cached
+} Cascade;
+
+typedef struct Shadows {
+	uint32_t size;
+	uint32_t count;
+	uint32_t first_cached;
+	float    dir[3];
+	float    basis[3][3];  // right, up, forward (light space axes)
+	float    max_distance;
+	float    lambda;
+	float    depth_bias;
+	float    normal_offset;
+	uint32_t rendered;
+
+	Cascade  cascades[VOID_SHADOW_MAX_CASCADES];
+
+	void *texture;
+	void *array_view;
+	void *caster_buffer;
+	void *uniform_buffer;
+	void *sampler;         // cached
+	void *caster_layout;   // cached
+	void *receiver_layout; // cached
+	void *receiver_group;  // cached
+} Shadows;
+
+static float dot3(const float *a, const float *b) {
+	return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static void normalize3(float *v) {
+	float len = sqrtf(dot3(v, v));
+	if (len < 1e-6f) return;
+	v[0] /= len; v[1] /= len; v[2] /= len;
+}
+
+static void cross3(float *out, const float *a, const float *b) {
+	float x = a[1] * b[2] - a[2] * b[1];
+	float y = a[2] * b[0] - a[0] * b[2];
+	float z = a[0] * b[1] - a[1] * b[0];
+	out[0] = x; out[1] = y; out[2] = z;
+}
+
+static void mark_cached_dirty(Shadows *s) {
+	for (uint32_t i = s->first_cached; i < s->count; i++) {
+		s->cascades[i].fitted = 0;
+		s->cascades[i].dirty = 1;
+	}
+}
+
+void *void_shadows_create(void *device, uint32_t size, uint32_t cascades) {
+	Shadows *s = calloc(1, sizeof(Shadows));
+	if (cascades < 1) cascades = 1;
+	if (cascades > VOID_SHADOW_MAX_CASCADES) cascades = VOID_SHADOW_MAX_CASCADES;
+	s->size = size ? size : 2048;
+	s->count = cascades;
+	s->first_cached = cascades;
+	s->max_distance = 50.0f;
+	s->lambda = 0.75f;
+	s->depth_bias = 0.0005f;
+	s->normal_offset = 1.5f;
+	void_shadows_set_light(s, -0.4f, -1.0f, -0.3f);
+
+	s->texture = void_gpu_create_texture_layers(device, s->size, s->size, cascades,
+		FMT_DEPTH32_FLOAT, TEXTURE_USAGE_RENDER_ATTACHMENT | TEXTURE_USAGE_TEXTURE_BINDING, 1);
+	s->array_view = void_gpu_create_texture_view_range(s->texture, VIEW_2D_ARRAY,
+		0, 1, 0, cascades, ASPECT_DEPTH_ONLY);
+	s->caster_buffer = void_gpu_create_buffer(device, CASTER_STRIDE * VOID_SHADOW_MAX_CASCADES,
+		BUFFER_USAGE_UNIFORM | BUFFER_USAGE_COPY_DST, 0);
+	s->uniform_buffer = void_gpu_create_buffer(device, sizeof(ShadowUniforms),
+		BUFFER_USAGE_UNIFORM | BUFFER_USAGE_COPY_DST, 0);
+	s->sampler = void_gpu_cached_sampler(device, ADDRESS_CLAMP, ADDRESS_CLAMP, ADDRESS_CLAMP,
+		FILTER_LINEAR, FILTER_LINEAR, MIPMAP_NEAREST, COMPARE_LESS_EQUAL, 1);
+
+	// Caster: one small bind group per cascade over its slice of the buffer
+	void *b = void_gpu_layout_begin();
+	void_gpu_layout_buffer(b, 0, STAGE_VERTEX, BINDING_UNIFORM, 64, 0);
+	s->caster_layout = void_gpu_layout_finish(device, b);
+	for (uint32_t i = 0; i < cascades; i++) {
+		Cascade *c = &s->cascades[i];
+		c->view = void_gpu_create_texture_view_range(s->texture, VIEW_2D, 0, 1, i, 1, ASPECT_DEPTH_ONLY);
+		void *g = void_gpu_group_begin(s->caster_layout);
+		void_gpu_group_buffer(g, 0, s->caster_buffer, (uint64_t)i * CASTER_STRIDE, 64);
+		c->caster_group = void_gpu_group_finish(device, g);
+		c->dirty = 1;
+	}
+
+	// Receiver
+	b = void_gpu_layout_begin();
+	void_gpu_layout_buffer(b, 0, STAGE_FRAGMENT, BINDING_UNIFORM, sizeof(ShadowUniforms), 0);
+	void_gpu_layout_texture(b, 1, STAGE_FRAGMENT, SAMPLE_TYPE_DEPTH, VIEW_2D_ARRAY, 0);
+	void_gpu_layout_sampler(b, 2, STAGE_FRAGMENT, SAMPLER_COMPARISON);
+	s->receiver_layout = void_gpu_layout_finish(device, b);
+
+	void *g = void_gpu_group_begin(s->receiver_layout);
+	void_gpu_group_buffer(g, 0, s->uniform_buffer, 0, 0);
+	void_gpu_group_texture(g, 1, s->array_view);
+	void_gpu_group_sampler(g, 2, s->sampler);
+	s->receiver_group = void_gpu_group_finish(device, g);
+
+	return s;
+}
+
+void void_shadows_destroy(void *shadows) {
+	Shadows *s = (Shadows *)shadows;
+	if (!s) return;
+	void_gpu_cache_release(s->receiver_group);
+	void_gpu_cache_release(s->receiver_layout);
+	for (uint32_t i = 0; i < s->count; i++) {
+		void_gpu_cache_release(s->cascades[i].caster_group);
+		void_gpu_release_texture_view(s->cascades[i].view);
+	}
+	void_gpu_cache_release(s->caster_layout);
+	void_gpu_cache_release(s->sampler);
+	void_gpu_release_buffer(s->uniform_buffer);
+	void_gpu_release_buffer(s->caster_buffer);
+	void_gpu_release_texture_view(s->array_view);
+	void_gpu_release_texture(s->texture);
+	free(s);
+}
+
+// --- Settings ---
+
+void void_shadows_set_light(void *shadows, float dirX, float dirY, float dirZ) {
+	Shadows *s = (Shadows *)shadows;
+	float d[3] = { dirX, dirY, dirZ };
+	normalize3(d);
+	if (d[0] == s->dir[0] && d[1] == s->dir[1] && d[2] == s->dir[2]) return;
+	memcpy(s->dir, d, sizeof(d));
+
+	// forward = light direction; pick an up that isn't parallel to it
+	float *right = s->basis[0], *up = s->basis[1], *fwd = s->basis[2];
+	memcpy(fwd, d, sizeof(d));
+	float ref[3] = { 0.0f, 1.0f, 0.0f };
+	if (fabsf(fwd[1]) > 0.99f) {
+		ref[0] = 1.0f;
+		ref[1] = 0.0f;
+	}
+	cross3(right, fwd, ref);
+	normalize3(right);
+	cross3(up, right, fwd);
+	mark_cached_dirty(s);
+}
+
+void void_shadows_set_range(void *shadows, float max_distance, float split_lambda) {
+	Shadows *s = (Shadows *)shadows;
+	if (max_distance == s->max_distance && split_lambda == s->lambda) return;
+	s->max_distance = max_distance;
+	s->lambda = split_lambda < 0.0f ? 0.0f : (split_lambda > 1.0f ? 1.0f : split_lambda);
+	mark_cached_dirty(s);
+}
+
+void void_shadows_set_first_cached(void *shadows, uint32_t first_cached) {
+	Shadows *s = (Shadows *)shadows;
+	s->first_cached = first_cached < s->count ? first_cached : s->count;
+	mark_cached_dirty(s);
+}
+
+void void_shadows_set_bias(void *shadows, float depth_bias, float normal_offset) {
+	Shadows *s = (Shadows *)shadows;
+	s->depth_bias = depth_bias;
+	s->normal_offset = normal_offset;
+}
+
+void void_shadows_invalidate(void *shadows) {
+	Shadows *s = (Shadows *)shadows;
+	for (uint32_t i = s->first_cached; i < s->count; i++) s->cascades[i].dirty = 1;
+}
+
+// --- Fitting ---
+
+// World -> light clip for an orthographic box around `center` (light space).
+// x/y cover ±radius; depth maps [center.z - radius, center.z + radius] to
+// [0, 1]. Casters in front of the box are clamped onto its near plane by
+// the caster shader, so the box never needs to reach back to the light.
+static void light_matrix(const Shadows *s, const float *center, float radius, float *m) {
+	const float *right = s->basis[0], *up = s->basis[1], *fwd = s->basis[2];
+	float zmin = center[2] - radius;
+	float zrange = 2.0f * radius;
+	memset(m, 0, 16 * sizeof(float));
+	for (int i = 0; i < 3; i++) {
+		m[i * 4 + 0] = right[i] / radius;
+		m[i * 4 + 1] = up[i] / radius;
+		m[i * 4 + 2] = fwd[i] / zrange;
+	}
+	m[12] = -center[0] / radius;
+	m[13] = -center[1] / radius;
+	m[14] = -zmin / zrange;
+	m[15] = 1.0f;
+}
+
+// Bounding sphere of the view slice [a, b] (exact for a symmetric frustum).
+// Its radius depends only on the projection, so it is stable while the
+// camera moves or turns.
+static float slice_sphere(const float *proj, const float *inv_view, float a, float b, float *center) {
+	float k2 = 1.0f / (proj[0] * proj[0]) + 1.0f / (proj[5] * proj[5]);
+	float c = 0.5f * (a + b) * (1.0f + k2);
+	if (c > b) c = b;
+	float r = sqrtf((b - c) * (b - c) + b * b * k2);
+
+	// View-space (0, 0, -c) to world
+	for (int i = 0; i < 3; i++) center[i] = inv_view[12 + i] - c * inv_view[8 + i];
+	return ceilf(r * 16.0f) / 16.0f;
+}
+
+void void_shadows_update(void *shadows, void *queue,
+	uint32_t width, uint32_t height, float nearZ, float farZ
+) {
+	Shadows *s = (Shadows *)shadows;
+	const float *view = (const float *)void_math_get_view();
+	const float *proj = (const float *)void_math_get_projection();
+	float inv_view[16], view_proj[16];
+	void_mat4_invert(inv_view, view);
+	void_mat4_multiply(view_proj, proj, view);
+
+	ShadowUniforms u;
+	memset(&u, 0, sizeof(u));
+	void_mat4_invert(u.inv_view_proj, view_proj);
+	u.view_z[0] = view[2];
+	u.view_z[1] = view[6];
+	u.view_z[2] = view[10];
+	u.view_z[3] = view[14];
+	u.params[0] = 1.0f / (float)s->size;
+	u.params[1] = (float)s->count;
+	u.params[2] = s->depth_bias;
+	u.params[3] = s->normal_offset;
+	u.screen[0] = width ? (float)width : 1.0f;
+	u.screen[1] = height ? (float)height : 1.0f;
+
+	// Practical split scheme: blend of logarithmic and uniform splits
+	float far_dist = s->max_distance < farZ ? s->max_distance : farZ;
+	float prev = nearZ;
+	s->rendered = 0;
+	for (uint32_t i = 0; i < s->count; i++) {
+		Cascade *c = &s->cascades[i];
+		float t = (float)(i + 1) / (float)s->count;
+		float log_split = nearZ * powf(far_dist / nearZ, t);
+		float uni_split = nearZ + (far_dist - nearZ) * t;
+		c->split = s->lambda * log_split + (1.0f - s->lambda) * uni_split;
+
+		float world_center[3];
+		float r = slice_sphere(proj, inv_view, prev, c->split, world_center);
+		float center[3] = {
+			dot3(s->basis[0], world_center),
+			dot3(s->basis[1], world_center),
+			dot3(s->basis[2], world_center),
+		};
+		prev = c->split;
+
+		// Cached cascades keep their box while the slice still fits inside it
+		int cached = i >= s->first_cached;
+		int keep = cached && c->fitted
+			&& fabsf(center[0] - c->center[0]) + r <= c->radius
+			&& fabsf(center[1] - c->center[1]) + r <= c->radius
+			&& fabsf(center[2] - c->center[2]) + r <= c->radius;
+		if (!keep) {
+			if (cached) {
+				r = ceilf(r * CACHE_MARGIN);
+				c->fitted = 1;
+				c->dirty = 1;
+			}
+			// Snap to whole texels so the map doesn't shimmer as the camera moves
+			float texel = 2.0f * r / (float)s->size;
+			center[0] = floorf(center[0] / texel) * texel;
+			center[1] = floorf(center[1] / texel) * texel;
+			memcpy(c->center, center, sizeof(center));
+			c->radius = r;
+			light_matrix(s, c->center, c->radius, c->matrix);
+		}
+		c->needs_render = cached ? c->dirty : 1;
+		float texel = 2.0f * c->radius / (float)s->size;
+
+		memcpy(u.cascades[i], c->matrix, sizeof(c->matrix));
+		u.splits[i] = c->split;
+		u.texel_world[i] = texel;
+		if (c->needs_render) {
+			void_gpu_queue_write_buffer(queue, s->caster_buffer,
+				(uint64_t)i * CASTER_STRIDE, c->matrix, sizeof(c->matrix));
+		}
+	}
+
+	void_gpu_queue_write_buffer(queue, s->uniform_buffer, 0, &u, sizeof(u));
+}
+
+uint32_t void_shadows_cascade_count(void *shadows) {
+	return ((Shadows *)shadows)->count;
+}
+
+int void_shadows_cascade_cached(void *shadows, uint32_t cascade) {
+	Shadows *s = (Shadows *)shadows;
+	return cascade < s->count && cascade >= s->first_cached;
+}
+
+int void_shadows_cascade_needs_render(void *shadows, uint32_t cascade) {
+	Shadows *s = (Shadows *)shadows;
+	return cascade < s->count && s->cascades[cascade].needs_render;
+}
+
+// --- Rendering ---
+
+void *void_shadows_begin_cascade(void *shadows, void *encoder, uint32_t cascade) {
+	Shadows *s = (Shadows *)shadows;
+	if (cascade >= s->count) return NULL;
+	Cascade *c = &s->cascades[cascade];
+
+	VoidRenderPassDesc d = {0};
+	d.depth_view = c->view;
+	d.depth_clear = 1;
+	d.depth_store = 1;
+	d.depth_clear_value = 1.0f;
+	void *pass = void_gpu_begin_render_pass_desc(encoder, &d);
+	void_gpu_render_pass_set_bind_group(pass, VOID_SHADOW_CASTER_GROUP, c->caster_group);
+
+	c->dirty = 0;
+	c->needs_render = 0;
+	s->rendered++;
+	return pass;
+}
+
+void void_shadows_end_cascade(void *shadows, void *pass) {
+	(void)shadows;
+	void_gpu_end_render_pass(pass);
+}
+
+uint32_t void_shadows_rendered_count(void *shadows) {
+	return ((Shadows *)shadows)->rendered;
+}
+
+// --- Binding ---
+
+void *void_shadows_caster_layout(void *shadows) {
+	return ((Shadows *)shadows)->caster_layout;
+}
+
+void *void_shadows_receiver_layout(void *shadows) {
+	return ((Shadows *)shadows)->receiver_layout;
+}
+
+void *void_shadows_receiver_group(void *shadows) {
+	return ((Shadows *)shadows)->receiver_group;
+}
+
+const char *void_shadows_caster_wgsl(void) {
+	return s_caster_wgsl;
+}
+
+const char *void_shadows_receiver_wgsl(void) {
+	return s_receiver_wgsl;
+}
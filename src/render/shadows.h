@@ -0,0 +1,75 @@
+// Void Render — Cascaded shadow maps for the directional (sun) light
+// The camera range [near, shadow distance] is split into up to
+// VOID_SHADOW_MAX_CASCADES slices, each fitted with a texel-snapped
+// orthographic light projection and rendered into one layer of a
+// Depth32Float array texture. Receivers pick their cascade by view distance
+// and take a 3x3 PCF of hardware comparison samples.
+//
+// Cascades from `first_cached` on hold static casters only and are kept
+// between frames: they are fitted with extra margin and re-rendered only
+// when the light turns, void_shadows_invalidate() is called (static geometry
+// changed), or the camera slice leaves the cached bounds.
+//
+// Bind groups:
+//   caster   (group VOID_SHADOW_CASTER_GROUP, bound by begin_cascade)
+//     0 uniform   cascade light view-projection
+//   receiver (group VOID_SHADOW_GROUP)
+//     0 uniform   cascade matrices, splits, camera reconstruction
+//     1 texture   texture_depth_2d_array
+//     2 sampler   sampler_comparison
+
+#ifndef VOID_RENDER_SHADOWS_H
+#define VOID_RENDER_SHADOWS_H
+
+#include <stdint.h>
+
+#define VOID_SHADOW_MAX_CASCADES  4
+#define VOID_SHADOW_CASTER_GROUP  2
+#define VOID_SHADOW_GROUP         3
+
+// size = resolution of each cascade; cascades = 1..VOID_SHADOW_MAX_CASCADES
+void *void_shadows_create(void *device, uint32_t size, uint32_t cascades);
+void  void_shadows_destroy(void *shadows);
+
+// --- Settings ---
+// Direction the light travels (match void_lighting_set_sun).
+void void_shadows_set_light(void *shadows, float dirX, float dirY, float dirZ);
+// Shadows end at max_distance; lambda blends uniform (0) and logarithmic (1) splits.
+void void_shadows_set_range(void *shadows, float max_distance, float split_lambda);
+// Cascades >= first_cached are cached static-caster cascades (cascades = none).
+void void_shadows_set_first_cached(void *shadows, uint32_t first_cached);
+// Receiver bias: depth (in [0,1] light depth) and normal offset (in texels).
+void void_shadows_set_bias(void *shadows, float depth_bias, float normal_offset);
+// Static casters changed: re-render the cached cascades.
+void void_shadows_invalidate(void *shadows);
+
+// --- Per frame ---
+// Fit cascades to the current view/projection (src/math/mat4) and upload.
+// near/far must match the projection.
+void void_shadows_update(void *shadows, void *queue,
+    uint32_t width, uint32_t height, float nearZ, float farZ);
+
+uint32_t void_shadows_cascade_count(void *shadows);
+int void_shadows_cascade_cached(void *shadows, uint32_t cascade);
+// 1 when the cascade must be rendered this frame (always for uncached ones)
+int void_shadows_cascade_needs_render(void *shadows, uint32_t cascade);
+
+// Depth-only render pass on the cascade's layer, cleared, with the caster
+// bind group set. Submit the casters, then end it with void_shadows_end_cascade.
+void *void_shadows_begin_cascade(void *shadows, void *encoder, uint32_t cascade);
+void  void_shadows_end_cascade(void *shadows, void *pass);
+
+// Cascades rendered since the last update (stats)
+uint32_t void_shadows_rendered_count(void *shadows);
+
+// --- Binding (owned by the shadows object) ---
+void *void_shadows_caster_layout(void *shadows);
+void *void_shadows_receiver_layout(void *shadows);
+void *void_shadows_receiver_group(void *shadows);
+
+// WGSL declarations for the caster fragment (cascade uniform binding) and
+// the receiver fragment (`fn shadow_visibility(frag_coord: vec4f) -> f32`).
+const char *void_shadows_caster_wgsl(void);
+const char *void_shadows_receiver_wgsl(void);
+
+#endif
@@ -0,0 +1,241 @@
+// Void Render — GPU skinning for crowds
+
+#include "skinning.h"
+#include "../gpu/dawn.h"
+#include "../gpu/enums.h"
+#include "../gpu/cache.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WORKGROUP_SIZE   64
+#define PALETTE_BYTES    48        // 3 x vec4f per joint
+#define MAX_DISPATCH_Y   65535     // instances per dispatch (y dimension)
+
+typedef struct SkinParams {
+	uint32_t vertex_count;
+	uint32_t instance_count;
+	uint32_t stride;
+	uint32_t position_offset;
+	uint32_t normal_offset;
+	uint32_t joint_count;
+	uint32_t pad[2];
+} SkinParams;
+
+// Workgroups: x over the vertices of one instance, y over instances
+static const char *s_skin_wgsl =
+"struct SkinParams {\n"
+"  vertex_count: u32,\n"
+"  instance_count: u32,\n"
+"  stride: u32,\n"
+"  position_offset: u32,\n"
+"  normal_offset: u32,\n"
+"  joint_count: u32,\n"
+"  pad0: u32,\n"
+"  pad1: u32,\n"
+"};\n"
+"@group(0) @binding(0) var<uniform> params: SkinParams;\n"
+"@group(0) @binding(1) var<storage, read> rest: array<f32>;\n"
+"// joints (4 x u8), weights (4 x unorm16), unused\n"
+"@group(0) @binding(2) var<storage, read> influences: array<vec4u>;\n"
+"// Rows of 3x4 joint matrices, instance-major\n"
+"@group(0) @binding(3) var<storage, read> palette: array<vec4f>;\n"
+"@group(0) @binding(4) var<storage, read_write> skinned: array<f32>;\n"
+"\n"
+"@compute @workgroup_size(64) fn skin(@builtin(global_invocation_id) gid: vec3u) {\n"
+"  let v = gid.x;\n"
+"  let inst = gid.y;\n"
+"  if (v >= params.vertex_count || inst >= params.instance_count) {\n"
+"    return;\n"
+"  }\n"
+"  let inf = influences[v];\n"
+"  let weights = vec4f(unpack2x16unorm(inf.y), unpack2x16unorm(inf.z));\n"
+"  let joints = vec4u(inf.x & 0xFFu, (inf.x >> 8u) & 0xFFu, (inf.x >> 16u) & 0xFFu, inf.x >> 24u);\n"
+"  let base = inst * params.joint_count;\n"
+"  var r0 = vec4f(0.0);\n"
+"  var r1 = vec4f(0.0);\n"
+"  var r2 = vec4f(0.0);\n"
+"  for (var i = 0u; i < 4u; i++) {\n"
+"    let row = (base + joints[i]) * 3u;\n"
+"    r0 += palette[row] * weights[i];\n"
+"    r1 += palette[row + 1u] * weights[i];\n"
+"    r2 += palette[row + 2u] * weights[i];\n"
+"  }\n"
+"\n"
+"  let src = v * params.stride;\n"
+"  let dst = (inst * params.vertex_count + v) * params.stride;\n"
+"  let po = params.position_offset;\n"
+"  let p = vec4f(rest[src + po], rest[src + po + 1u], rest[src + po + 2u], 1.0);\n"
+"  skinned[dst + po] = dot(r0, p);\n"
+"  skinned[dst + po + 1u] = dot(r1, p);\n"
+"  skinned[dst + po + 2u] = dot(r2, p);\n"
+"  let no = params.normal_offset;\n"
+"  if (no != 0xFFFFFFFFu) {\n"
+"    let n = vec4f(rest[src + no], rest[src + no + 1u], rest[src + no + 2u], 0.0);\n"
+"    let t = vec3f(dot(r0, n), dot(r1, n), dot(r2, n));\n"
+"    let len2 = dot(t, t);\n"
+"    let sn = select(t, t * inverseSqrt(len2), len2 > 0.0);\n"
+"    skinned[dst + no] = sn.x;\n"
+"    skinned[dst + no + 1u] = sn.y;\n"
+"    skinned[dst + no + 2u] = sn.z;\n"
+"  }\n"
+"}\n";
+
+typedef struct Skinning {
+	void    *device;
+	uint32_t vertex_count;
+	uint32_t stride;          // floats per vertex
+	uint32_t joint_count;
+	uint32_t max_instances;
+	SkinParams params;
+
+	void *param_buffer;
+	void *rest_buffer;
+	void *influence_buffer;
+	void *palette_buffer;     // max_instances x joint_count x 3 rows
+	void *output_buffer;      // max_instances x vertex_count vertices
+
+	void *layout;             // cached
+	void *pipeline_layout;    // cached
+	void *group;              // cached
+	void *shader;
+	void *pipeline;
+} Skinning;
+
+static uint32_t unorm16(float v) {
+	if (v < 0.0f) v = 0.0f;
+	if (v > 1.0f) v = 1.0f;
+	return (uint32_t)lrintf(v * 65535.0f);
+}
+
+void *void_skinning_create(void *device,
+	const float *vertices, uint32_t vertex_count, uint32_t stride,
+	uint32_t position_offset, uint32_t normal_offset,
+	const uint8_t *joints, const float *weights,
+	uint32_t joint_count, uint32_t max_instances
+) {
+	if (vertex_count == 0 || position_offset + 3 > stride ||
+		(normal_offset != VOID_SKINNING_NO_NORMAL && normal_offset + 3 > stride)) {
+		fprintf(stderr, "void_skinning: invalid vertex layout\n");
+		return NULL;
+	}
+	if (max_instances == 0) max_instances = 1;
+	if (max_instances > MAX_DISPATCH_Y) max_instances = MAX_DISPATCH_Y;
+
+	Skinning *s = calloc(1, sizeof(Skinning));
+	s->device = device;
+	s->vertex_count = vertex_count;
+	s->stride = stride;
+	s->joint_count = joint_count;
+	s->max_instances = max_instances;
+	s->params.vertex_count = vertex_count;
+	s->params.stride = stride;
+	s->params.position_offset = position_offset;
+	s->params.normal_offset = normal_offset;
+	s->params.joint_count = joint_count;
+
+	uint64_t vertex_bytes = (uint64_t)vertex_count * stride * sizeof(float);
+	s->param_buffer = void_gpu_create_buffer(device, sizeof(SkinParams),
+		BUFFER_USAGE_UNIFORM | BUFFER_USAGE_COPY_DST, 0);
+	s->rest_buffer = void_gpu_create_buffer(device, vertex_bytes,
+		BUFFER_USAGE_STORAGE | BUFFER_USAGE_COPY_DST, 0);
+	s->influence_buffer = void_gpu_create_buffer(device, (uint64_t)vertex_count * 16,
+		BUFFER_USAGE_STORAGE | BUFFER_USAGE_COPY_DST, 0);
+	s->palette_buffer = void_gpu_create_buffer(device,
+		(uint64_t)max_instances * (joint_count ? joint_count : 1) * PALETTE_BYTES,
+		BUFFER_USAGE_STORAGE | BUFFER_USAGE_COPY_DST, 0);
+	s->output_buffer = void_gpu_create_buffer(device, vertex_bytes * max_instances,
+		BUFFER_USAGE_VERTEX | BUFFER_USAGE_STORAGE | BUFFER_USAGE_COPY_DST, 0);
+
+	// Influences: indices clamped into the skeleton, weights normalised
+	uint32_t *packed = calloc(vertex_count, 4 * sizeof(uint32_t));
+	for (uint32_t v = 0; v < vertex_count; v++) {
+		const uint8_t *j = joints + v * 4;
+		const float *w = weights + v * 4;
+		float sum = w[0] + w[1] + w[2] + w[3];
+		float inv = sum > 0.0f ? 1.0f / sum : 0.0f;
+		uint32_t ji[4];
+		for (int i = 0; i < 4; i++) ji[i] = j[i] < joint_count ? j[i] : 0;
+		packed[v * 4 + 0] = ji[0] | ji[1] << 8 | ji[2] << 16 | ji[3] << 24;
+		packed[v * 4 + 1] = unorm16(sum > 0.0f ? w[0] * inv : 1.0f) | unorm16(w[1] * inv) << 16;
+		packed[v * 4 + 2] = unorm16(w[2] * inv) | unorm16(w[3] * inv) << 16;
+	}
+
+	// Unskinned attributes never change: every instance starts as the rest mesh
+	void *queue = void_gpu_get_queue(device);
+	void_gpu_queue_write_buffer(queue, s->rest_buffer, 0, vertices, vertex_bytes);
+	void_gpu_queue_write_buffer(queue, s->influence_buffer, 0, packed, (uint64_t)vertex_count * 16);
+	for (uint32_t i = 0; i < max_instances; i++) {
+		void_gpu_queue_write_buffer(queue, s->output_buffer, vertex_bytes * i, vertices, vertex_bytes);
+	}
+	void_gpu_release_queue(queue);
+	free(packed);
+
+	void *b = void_gpu_layout_begin();
+	void_gpu_layout_buffer(b, 0, STAGE_COMPUTE, BINDING_UNIFORM, sizeof(SkinParams), 0);
+	void_gpu_layout_buffer(b, 1, STAGE_COMPUTE, BINDING_READ_ONLY_STORAGE, 0, 0);
+	void_gpu_layout_buffer(b, 2, STAGE_COMPUTE, BINDING_READ_ONLY_STORAGE, 0, 0);
+	void_gpu_layout_buffer(b, 3, STAGE_COMPUTE, BINDING_READ_ONLY_STORAGE, 0, 0);
+	void_gpu_layout_buffer(b, 4, STAGE_COMPUTE, BINDING_STORAGE, 0, 0);
+	s->layout = void_gpu_layout_finish(device, b);
+	s->pipeline_layout = void_gpu_cached_pipeline_layout_1(device, s->layout);
+
+	void *g = void_gpu_group_begin(s->layout);
+	void_gpu_group_buffer(g, 0, s->param_buffer, 0, 0);
+	void_gpu_group_buffer(g, 1, s->rest_buffer, 0, 0);
+	void_gpu_group_buffer(g, 2, s->influence_buffer, 0, 0);
+	void_gpu_group_buffer(g, 3, s->palette_buffer, 0, 0);
+	void_gpu_group_buffer(g, 4, s->output_buffer, 0, 0);
+	s->group = void_gpu_group_finish(device, g);
+
+	s->shader = void_gpu_create_shader(device, s_skin_wgsl);
+	s->pipeline = void_gpu_create_compute_pipeline(device, s->shader, "skin", s->pipeline_layout);
+	return s;
+}
+
+void void_skinning_destroy(void *skinning) {
+	Skinning *s = (Skinning *)skinning;
+	if (!s) return;
+	void_gpu_release_compute_pipeline(s->pipeline);
+	void_gpu_release_shader(s->shader);
+	void_gpu_cache_release(s->group);
+	void_gpu_cache_release(s->pipeline_layout);
+	void_gpu_cache_release(s->layout);
+	void_gpu_release_buffer(s->output_buffer);
+	void_gpu_release_buffer(s->palette_buffer);
+	void_gpu_release_buffer(s->influence_buffer);
+	void_gpu_release_buffer(s->rest_buffer);
+	void_gpu_release_buffer(s->param_buffer);
+	free(s);
+}
+
+void void_skinning_update(void *skinning, void *queue, void *compute_pass,
+	const float *palettes, uint32_t instance_count
+) {
+	Skinning *s = (Skinning *)skinning;
+	if (instance_count > s->max_instances) instance_count = s->max_instances;
+	if (instance_count == 0 || s->joint_count == 0) return;
+
+	void_gpu_queue_write_buffer(queue, s->palette_buffer, 0, palettes,
+		(uint64_t)instance_count * s->joint_count * PALETTE_BYTES);
+	if (s->params.instance_count != instance_count) {
+		s->params.instance_count = instance_count;
+		void_gpu_queue_write_buffer(queue, s->param_buffer, 0, &s->params, sizeof(s->params));
+	}
+
+	void_gpu_compute_pass_set_pipeline(compute_pass, s->pipeline);
+	void_gpu_compute_pass_set_bind_group(compute_pass, 0, s->group);
+	void_gpu_compute_pass_dispatch(compute_pass,
+		(s->vertex_count + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE, instance_count, 1);
+}
+
+void *void_skinning_vertex_buffer(void *skinning) {
+	return ((Skinning *)skinning)->output_buffer;
+}
+
+uint32_t void_skinning_base_vertex(void *skinning, uint32_t instance) {
+	Skinning *s = (Skinning *)skinning;
+	return instance * s->vertex_count;
+}
@@ -0,0 +1,39 @@
+// Void Render — GPU skinning for crowds
+// One compute dispatch skins every instance of a mesh: joint palettes of
+// all instances live in one shared storage buffer (uploaded in one write,
+// see src/anim/skeleton) and the skinned vertices of all instances in one
+// vertex buffer, instance i at base vertex i x vertex_count. The output
+// keeps the rest mesh's interleaved layout, so skinned meshes draw with the
+// regular material pipelines (pos, normal skinned; other attributes copied).
+//
+// Per frame: update() in a compute pass → draw instance i with
+// vertex_buffer() and base_vertex(i) (indexed draws share the rest mesh's
+// index buffer).
+
+#ifndef VOID_RENDER_SKINNING_H
+#define VOID_RENDER_SKINNING_H
+
+#include <stdint.h>
+
+#define VOID_SKINNING_NO_NORMAL 0xFFFFFFFFu
+
+// vertices: vertex_count x stride floats (the material's vertex layout);
+// position_offset / normal_offset in floats (normal VOID_SKINNING_NO_NORMAL
+// when absent). joints: 4 joint indices per vertex; weights: 4 per vertex
+// (normalised on upload).
+void *void_skinning_create(void *device,
+    const float *vertices, uint32_t vertex_count, uint32_t stride,
+    uint32_t position_offset, uint32_t normal_offset,
+    const uint8_t *joints, const float *weights,
+    uint32_t joint_count, uint32_t max_instances);
+void  void_skinning_destroy(void *skinning);
+
+// Upload instance_count palettes (instance_count x joint_count x 12 floats)
+// and record the skinning dispatch into an open compute pass.
+void void_skinning_update(void *skinning, void *queue, void *compute_pass,
+    const float *palettes, uint32_t instance_count);
+
+void *void_skinning_vertex_buffer(void *skinning);
+uint32_t void_skinning_base_vertex(void *skinning, uint32_t instance);
+
+#endif
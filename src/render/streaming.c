@@ -0,0 +1,508 @@
+// Void Render — Mip-level texture streaming
+
+#include "streaming.h"
+#include "../gpu/dawn.h"
+#include "../gpu/enums.h"
+#include "../gpu/cache.h"
+#include "../gpu/memory.h"
+#include "../assets/pixels.h"
+
+#include <dawn/webgpu.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define STR_(x) #x
+#define STR(x) STR_(x)
+
+// Per-texture StreamInfo lives at 256-byte offsets (uniform offset alignment)
+#define INFO_STRIDE 256
+#define MAX_LEVELS  16    // 32768 px on the larger axis
+
+#define SLOT_IDLE     0    // free for recording
+#define SLOT_RESOLVED 1    // copy recorded, waiting for the submit
+#define SLOT_MAPPING  2    // map requested, GPU may still be busy
+#define SLOT_MAPPED   3    // results readable
+
+// --- Types ---
+
+typedef struct StreamInfo {
+	uint32_t slot;
+	uint32_t mip_count;
+	float    size[2];
+} StreamInfo;
+
+typedef struct StreamTexture {
+	uint32_t width, height;
+	uint32_t mip_count;
+	uint32_t tail;               // first level that is always resident
+	uint8_t *pixels;             // full chain, finest first
+	uint64_t offsets[MAX_LEVELS];
+
+	void    *texture;            // mips [resident, mip_count)
+	void    *view;
+	void    *group;
+	uint32_t resident;
+	uint32_t want;               // combined wish, kept between requests
+	uint32_t target;             // this update's decision
+	uint32_t screen_want;        // this frame's request, VOID_STREAM_NONE if none
+	uint32_t feedback_want;      // latest readback, VOID_STREAM_NONE if none
+	uint64_t last_seen;          // frame of the last request or feedback hit
+	uint64_t coarser_since;      // frame the wish went coarser, 0 = it did not
+} StreamTexture;
+
+typedef struct Readback {
+	void    *buffer;
+	int      state;
+	int      orphaned;           // streamer destroyed while mapping; the callback frees it
+	uint64_t frame;
+	uint32_t count;
+} Readback;
+
+typedef struct Streamer {
+	void          *device;
+	void          *sampler;
+	void          *layout;
+	void          *feedback;         // one u32 per texture, cleared every update
+	void          *info;             // StreamInfo per texture
+	uint32_t      *clear;            // VOID_STREAM_NONE × max
+
+	StreamTexture *textures;
+	uint32_t       count;
+	uint32_t       max;
+	uint32_t      *order;            // scratch for budget fitting
+
+	Readback      *slots[VOID_STREAM_LATENCY];
+	Readback      *current;          // NULL = this frame has no readback
+	uint64_t       frame;
+	uint64_t       result_frame;
+
+	uint64_t       budget;           // own cap, 0 = none
+	uint64_t       upload_budget;
+	uint64_t       limit;
+	uint64_t       uploaded;
+	uint64_t       evictions;
+} Streamer;
+
+// --- Shader ---
+
+static const char *s_wgsl =
+"struct StreamInfo {\n"
+"  slot: u32,\n"
+"  mip_count: u32,\n"
+"  size: vec2f,\n"
+"}\n"
+"@group(" STR(VOID_STREAM_GROUP) ") @binding(0) var stream_tex: texture_2d<f32>;\n"
+"@group(" STR(VOID_STREAM_GROUP) ") @binding(1) var stream_samp: sampler;\n"
+"@group(" STR(VOID_STREAM_GROUP) ") @binding(2) var<storage, read_write> stream_feedback: array<atomic<u32>>;\n"
+"@group(" STR(VOID_STREAM_GROUP) ") @binding(3) var<uniform> stream_info: StreamInfo;\n"
+"\n"
+"fn stream_sample(uv: vec2f, frag_coord: vec4f) -> vec4f {\n"
+"  // Sample and take derivatives in uniform control flow\n"
+"  let color = textureSample(stream_tex, stream_samp, uv);\n"
+"  let p = uv * stream_info.size;\n"
+"  let d = max(dot(dpdx(p), dpdx(p)), dot(dpdy(p), dpdy(p)));\n"
+"  // Finest level of the full chain these pixels would sample\n"
+"  let lod = max(0.5 * log2(max(d, 1e-8)), 0.0);\n"
+"  let px = vec2u(frag_coord.xy);\n"
+"  if ((px.x & 3u) == 0u && (px.y & 3u) == 0u) {\n"
+"    atomicMin(&stream_feedback[stream_info.slot], min(u32(lod), stream_info.mip_count - 1u));\n"
+"  }\n"
+"  return color;\n"
+"}\n";
+
+const char *void_stream_wgsl(void) {
+	return s_wgsl;
+}
+
+// --- Helpers ---
+
+static uint32_t level_size(uint32_t size, uint32_t level) {
+	uint32_t s = size >> level;
+	return s ? s : 1;
+}
+
+// GPU size of a texture holding mips [level, mip_count)
+static uint64_t chain_bytes(const StreamTexture *t, uint32_t level) {
+	return void_gpu_texture_bytes(level_size(t->width, level), level_size(t->height, level), 1,
+		FMT_RGBA8_UNORM, t->mip_count - level, 1);
+}
+
+// Replaces the texture's GPU copy with mips [level, mip_count) and
+// rebuilds its bind group. Returns the bytes uploaded.
+static uint64_t make_resident(Streamer *s, void *queue, uint32_t id, uint32_t level) {
+	StreamTexture *t = &s->textures[id];
+	uint32_t mips = t->mip_count - level;
+	void *texture = void_gpu_create_texture(s->device,
+		level_size(t->width, level), level_size(t->height, level),
+		FMT_RGBA8_UNORM, TEXTURE_USAGE_TEXTURE_BINDING | TEXTURE_USAGE_COPY_DST, mips);
+	if (!texture) {
+		fprintf(stderr, "void_stream: texture creation failed (%u x %u)\n",
+			level_size(t->width, level), level_size(t->height, level));
+		return 0;
+	}
+	void_gpu_memory_set_category(texture, VOID_GPU_MEM_STREAMING);
+
+	uint64_t uploaded = 0;
+	for (uint32_t m = 0; m < mips; m++) {
+		uint32_t w = level_size(t->width, level + m), h = level_size(t->height, level + m);
+		uint64_t size = (uint64_t)w * h * 4;
+		void_gpu_queue_write_texture_mip(queue, texture, m, t->pixels + t->offsets[level + m],
+			size, w * 4, w, h);
+		uploaded += size;
+	}
+
+	void *view = void_gpu_create_texture_view(texture);
+	void *g = void_gpu_group_begin(s->layout);
+	void_gpu_group_texture(g, 0, view);
+	void_gpu_group_sampler(g, 1, s->sampler);
+	void_gpu_group_buffer(g, 2, s->feedback, 0, 0);
+	void_gpu_group_buffer(g, 3, s->info, (uint64_t)id * INFO_STRIDE, sizeof(StreamInfo));
+	void *group = void_gpu_group_finish(s->device, g);
+
+	// The old group holds its own references; in-flight work keeps them alive
+	void_gpu_cache_release(t->group);
+	void_gpu_release_texture_view(t->view);
+	void_gpu_release_texture(t->texture);
+	t->texture = texture;
+	t->view = view;
+	t->group = group;
+	t->resident = level;
+	return uploaded;
+}
+
+static void on_mapped(WGPUMapAsyncStatus status, WGPUStringView message, void *u1, void *u2) {
+	(void)message; (void)u2;
+	Readback *r = (Readback *)u1;
+	if (r->orphaned) {
+		if (status == WGPUMapAsyncStatus_Success) wgpuBufferUnmap((WGPUBuffer)r->buffer);
+		void_gpu_release_buffer(r->buffer);
+		free(r);
+		return;
+	}
+	// A failed map just drops that frame's feedback
+	r->state = status == WGPUMapAsyncStatus_Success ? SLOT_MAPPED : SLOT_IDLE;
+}
+
+// --- Lifecycle ---
+
+void *void_stream_create(void *device, void *sampler, uint32_t max_textures) {
+	Streamer *s = calloc(1, sizeof(Streamer));
+	if (max_textures == 0) max_textures = 1;
+	s->device = device;
+	s->sampler = sampler;
+	s->max = max_textures;
+	s->upload_budget = VOID_STREAM_DEFAULT_UPLOAD;
+	s->textures = calloc(max_textures, sizeof(StreamTexture));
+	s->order = calloc(max_textures, sizeof(uint32_t));
+	s->clear = malloc(max_textures * sizeof(uint32_t));
+	memset(s->clear, 0xFF, max_textures * sizeof(uint32_t));
+
+	uint64_t feedback_size = (uint64_t)max_textures * sizeof(uint32_t);
+	s->feedback = void_gpu_create_buffer(device, feedback_size,
+		BUFFER_USAGE_STORAGE | BUFFER_USAGE_COPY_SRC | BUFFER_USAGE_COPY_DST, 0);
+	s->info = void_gpu_create_buffer(device, (uint64_t)max_textures * INFO_STRIDE,
+		BUFFER_USAGE_UNIFORM | BUFFER_USAGE_COPY_DST, 0);
+	for (uint32_t i = 0; i < VOID_STREAM_LATENCY; i++) {
+		s->slots[i] = calloc(1, sizeof(Readback));
+		s->slots[i]->buffer = void_gpu_create_buffer(device, feedback_size,
+			BUFFER_USAGE_MAP_READ | BUFFER_USAGE_COPY_DST, 0);
+	}
+
+	void *b = void_gpu_layout_begin();
+	void_gpu_layout_texture(b, 0, STAGE_FRAGMENT, SAMPLE_TYPE_FLOAT, VIEW_2D, 0);
+	void_gpu_layout_sampler(b, 1, STAGE_FRAGMENT, SAMPLER_FILTERING);
+	void_gpu_layout_buffer(b, 2, STAGE_FRAGMENT, BINDING_STORAGE, 0, 0);
+	void_gpu_layout_buffer(b, 3, STAGE_FRAGMENT, BINDING_UNIFORM, sizeof(StreamInfo), 0);
+	s->layout = void_gpu_layout_finish(device, b);
+	return s;
+}
+
+void void_stream_destroy(void *streamer) {
+	Streamer *s = (Streamer *)streamer;
+	if (!s) return;
+	for (uint32_t i = 0; i < s->count; i++) {
+		StreamTexture *t = &s->textures[i];
+		void_gpu_cache_release(t->group);
+		void_gpu_release_texture_view(t->view);
+		void_gpu_release_texture(t->texture);
+		free(t->pixels);
+	}
+	for (uint32_t i = 0; i < VOID_STREAM_LATENCY; i++) {
+		Readback *r = s->slots[i];
+		if (r->state == SLOT_MAPPING) {
+			r->orphaned = 1;
+			continue;
+		}
+		if (r->state == SLOT_MAPPED) wgpuBufferUnmap((WGPUBuffer)r->buffer);
+		void_gpu_release_buffer(r->buffer);
+		free(r);
+	}
+	void_gpu_cache_release(s->layout);
+	void_gpu_release_buffer(s->info);
+	void_gpu_release_buffer(s->feedback);
+	free(s->clear);
+	free(s->order);
+	free(s->textures);
+	free(s);
+}
+
+void void_stream_set_budget(void *streamer, uint64_t bytes) {
+	((Streamer *)streamer)->budget = bytes;
+}
+
+void void_stream_set_upload_budget(void *streamer, uint64_t bytes_per_frame) {
+	((Streamer *)streamer)->upload_budget = bytes_per_frame;
+}
+
+// --- Textures ---
+
+uint32_t void_stream_add_rgba8(void *streamer, void *queue, const void *pixels,
+	uint32_t width, uint32_t height
+) {
+	Streamer *s = (Streamer *)streamer;
+	if (s->count >= s->max || !pixels || width == 0 || height == 0) return VOID_STREAM_NONE;
+	uint32_t larger = width > height ? width : height;
+	if (larger >> MAX_LEVELS) {
+		fprintf(stderr, "void_stream: %u x %u is too large to stream\n", width, height);
+		return VOID_STREAM_NONE;
+	}
+
+	uint32_t id = s->count;
+	StreamTexture *t = &s->textures[id];
+	memset(t, 0, sizeof(*t));
+	t->width = width;
+	t->height = height;
+	t->mip_count = 1;
+	while ((larger >> t->mip_count) > 0) t->mip_count++;
+	t->tail = 0;
+	while (t->tail + 1 < t->mip_count &&
+		(level_size(width, t->tail) > VOID_STREAM_TAIL_SIZE || level_size(height, t->tail) > VOID_STREAM_TAIL_SIZE)) {
+		t->tail++;
+	}
+
+	uint64_t total = 0;
+	for (uint32_t m = 0; m < t->mip_count; m++) {
+		t->offsets[m] = total;
+		total += (uint64_t)level_size(width, m) * level_size(height, m) * 4;
+	}
+	t->pixels = malloc(total);
+	if (!t->pixels) return VOID_STREAM_NONE;
+	memcpy(t->pixels, pixels, (size_t)width * height * 4);
+	void_pixels_build_mips(t->pixels, width, height);
+
+	StreamInfo info = { id, t->mip_count, { (float)width, (float)height } };
+	void_gpu_queue_write_buffer(queue, s->info, (uint64_t)id * INFO_STRIDE, &info, sizeof(info));
+	if (!make_resident(s, queue, id, t->tail)) {
+		free(t->pixels);
+		t->pixels = NULL;
+		return VOID_STREAM_NONE;
+	}
+
+	t->want = t->target = t->tail;
+	t->screen_want = t->feedback_want = VOID_STREAM_NONE;
+	t->last_seen = s->frame;
+	s->count++;
+	return id;
+}
+
+// --- Per frame ---
+
+void void_stream_request(void *streamer, uint32_t id, float screen_pixels) {
+	Streamer *s = (Streamer *)streamer;
+	if (id >= s->count) return;
+	StreamTexture *t = &s->textures[id];
+	uint32_t larger = t->width > t->height ? t->width : t->height;
+	uint32_t level = t->tail;
+	if (screen_pixels >= (float)larger) level = 0;
+	else if (screen_pixels > 0.0f) level = (uint32_t)floorf(log2f((float)larger / screen_pixels));
+	if (level > t->tail) level = t->tail;
+	if (t->screen_want == VOID_STREAM_NONE || level < t->screen_want) t->screen_want = level;
+}
+
+static void read_feedback(Streamer *s, Readback *r) {
+	const uint32_t *fb = (const uint32_t *)wgpuBufferGetConstMappedRange(
+		(WGPUBuffer)r->buffer, 0, r->count * sizeof(uint32_t));
+	if (!fb) return;
+	for (uint32_t i = 0; i < r->count && i < s->count; i++) {
+		if (fb[i] != VOID_STREAM_NONE) s->textures[i].feedback_want = fb[i];
+	}
+	s->result_frame = r->frame;
+}
+
+// Texture ids by last_seen, least recently needed first
+static void sort_by_last_seen(Streamer *s) {
+	for (uint32_t i = 0; i < s->count; i++) {
+		uint32_t id = i, j = i;
+		while (j > 0 && s->textures[s->order[j - 1]].last_seen > s->textures[id].last_seen) {
+			s->order[j] = s->order[j - 1];
+			j--;
+		}
+		s->order[j] = id;
+	}
+}
+
+void void_stream_update(void *streamer, void *queue) {
+	Streamer *s = (Streamer *)streamer;
+	s->frame++;
+
+	// Finished feedback, oldest first so the newest wins
+	for (;;) {
+		Readback *oldest = NULL;
+		for (uint32_t i = 0; i < VOID_STREAM_LATENCY; i++) {
+			Readback *r = s->slots[i];
+			if (r->state == SLOT_MAPPED && (!oldest || r->frame < oldest->frame)) oldest = r;
+		}
+		if (!oldest) break;
+		if (oldest->frame > s->result_frame) read_feedback(s, oldest);
+		wgpuBufferUnmap((WGPUBuffer)oldest->buffer);
+		oldest->state = SLOT_IDLE;
+	}
+
+	// Wishes: the finer of screen request and feedback; none for a while
+	// drops to the tail. Coarser wishes wait out the drop delay.
+	for (uint32_t i = 0; i < s->count; i++) {
+		StreamTexture *t = &s->textures[i];
+		uint32_t wish = t->screen_want;
+		if (t->feedback_want < wish) wish = t->feedback_want;
+		t->screen_want = t->feedback_want = VOID_STREAM_NONE;
+		if (wish != VOID_STREAM_NONE) {
+			t->want = wish < t->tail ? wish : t->tail;
+			t->last_seen = s->frame;
+		} else if (s->frame - t->last_seen > VOID_STREAM_KEEP_FRAMES) {
+			t->want = t->tail;
+		}
+
+		t->target = t->want;
+		if (t->want > t->resident) {
+			if (t->coarser_since == 0) t->coarser_since = s->frame;
+			if (s->frame - t->coarser_since < VOID_STREAM_DROP_DELAY) t->target = t->resident;
+		} else {
+			t->coarser_since = 0;
+		}
+	}
+
+	// Pool limit: own cap, and what the global budget leaves after everything else
+	uint64_t budget = void_gpu_memory_budget();
+	uint64_t others = void_gpu_memory_used() - void_gpu_memory_used_in(VOID_GPU_MEM_STREAMING);
+	s->limit = budget > others ? budget - others : 0;
+	if (s->budget && s->budget < s->limit) s->limit = s->budget;
+
+	// Over the limit: coarsen the least recently needed first, a level at a
+	// time, until it fits or everything is down to its tail
+	uint64_t total = 0;
+	for (uint32_t i = 0; i < s->count; i++) total += chain_bytes(&s->textures[i], s->textures[i].target);
+	sort_by_last_seen(s);
+	int changed = 1;
+	while (total > s->limit && changed) {
+		changed = 0;
+		for (uint32_t k = 0; k < s->count && total > s->limit; k++) {
+			StreamTexture *t = &s->textures[s->order[k]];
+			if (t->target >= t->tail) continue;
+			total -= chain_bytes(t, t->target);
+			t->target++;
+			total += chain_bytes(t, t->target);
+			changed = 1;
+		}
+	}
+
+	// Evictions first (they free room), then one finer level per texture,
+	// most recently needed first, within the upload budget
+	for (uint32_t i = 0; i < s->count; i++) {
+		StreamTexture *t = &s->textures[i];
+		if (t->target > t->resident && make_resident(s, queue, i, t->target)) s->evictions++;
+	}
+	uint64_t uploaded = 0;
+	for (uint32_t k = s->count; k-- > 0;) {
+		uint32_t id = s->order[k];
+		StreamTexture *t = &s->textures[id];
+		if (t->target >= t->resident) continue;
+		uint64_t cost = chain_bytes(t, t->resident - 1);
+		if (uploaded > 0 && uploaded + cost > s->upload_budget) continue;
+		uploaded += make_resident(s, queue, id, t->resident - 1);
+	}
+	s->uploaded += uploaded;
+
+	// This frame's feedback
+	if (s->count) void_gpu_queue_write_buffer(queue, s->feedback, 0, s->clear, s->count * sizeof(uint32_t));
+	s->current = NULL;
+	for (uint32_t i = 0; i < VOID_STREAM_LATENCY; i++) {
+		if (s->slots[i]->state == SLOT_IDLE) {
+			s->current = s->slots[i];
+			break;
+		}
+	}
+}
+
+void void_stream_resolve(void *streamer, void *encoder) {
+	Streamer *s = (Streamer *)streamer;
+	Readback *r = s->current;
+	if (!r || s->count == 0) return;
+	wgpuCommandEncoderCopyBufferToBuffer((WGPUCommandEncoder)encoder,
+		(WGPUBuffer)s->feedback, 0, (WGPUBuffer)r->buffer, 0, s->count * sizeof(uint32_t));
+	r->count = s->count;
+	r->frame = s->frame;
+	r->state = SLOT_RESOLVED;
+}
+
+void void_stream_end_frame(void *streamer) {
+	Streamer *s = (Streamer *)streamer;
+	Readback *r = s->current;
+	s->current = NULL;
+	if (!r || r->state != SLOT_RESOLVED) return;
+
+	WGPUBufferMapCallbackInfo cb = {0};
+	cb.mode = WGPUCallbackMode_AllowProcessEvents;
+	cb.callback = on_mapped;
+	cb.userdata1 = r;
+	r->state = SLOT_MAPPING;
+	wgpuBufferMapAsync((WGPUBuffer)r->buffer, WGPUMapMode_Read, 0, r->count * sizeof(uint32_t), cb);
+}
+
+// --- Binding ---
+
+void *void_stream_bind_group_layout(void *streamer) {
+	return ((Streamer *)streamer)->layout;
+}
+
+void *void_stream_bind_group(void *streamer, uint32_t id) {
+	Streamer *s = (Streamer *)streamer;
+	return id < s->count ? s->textures[id].group : NULL;
+}
+
+// --- Statistics ---
+
+uint32_t void_stream_mip_count(void *streamer, uint32_t id) {
+	Streamer *s = (Streamer *)streamer;
+	return id < s->count ? s->textures[id].mip_count : 0;
+}
+
+uint32_t void_stream_resident_mip(void *streamer, uint32_t id) {
+	Streamer *s = (Streamer *)streamer;
+	return id < s->count ? s->textures[id].resident : 0;
+}
+
+uint32_t void_stream_wanted_mip(void *streamer, uint32_t id) {
+	Streamer *s = (Streamer *)streamer;
+	return id < s->count ? s->textures[id].want : 0;
+}
+
+uint64_t void_stream_resident_bytes(void *streamer) {
+	Streamer *s = (Streamer *)streamer;
+	uint64_t total = 0;
+	for (uint32_t i = 0; i < s->count; i++) total += chain_bytes(&s->textures[i], s->textures[i].resident);
+	return total;
+}
+
+uint64_t void_stream_pool_limit(void *streamer) {
+	return ((Streamer *)streamer)->limit;
+}
+
+uint64_t void_stream_uploaded_bytes(void *streamer) {
+	return ((Streamer *)streamer)->uploaded;
+}
+
+uint64_t void_stream_eviction_count(void *streamer) {
+	return ((Streamer *)streamer)->evictions;
+}
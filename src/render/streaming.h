@@ -0,0 +1,82 @@
+// Void Render — Mip-level texture streaming
+// Each streamed texture keeps its full mip chain in CPU memory and only the
+// levels it currently needs on the GPU: a texture holding mips [r, count)
+// of the chain, recreated when r changes. What a texture needs comes from
+// two sources, the finer one winning:
+//   - screen-space requests: the on-screen size of the texture's UV extent,
+//     reported by whoever draws it;
+//   - sampler feedback: the streamed-texture fragment records the finest mip
+//     its pixels would sample into a feedback buffer (atomicMin per texture,
+//     every 16th pixel), read back a few frames late like the GPU timer.
+// Levels at or below VOID_STREAM_TAIL_SIZE are always resident. Finer levels
+// are uploaded one level per texture per frame within an upload budget;
+// coarser wishes must persist VOID_STREAM_DROP_DELAY frames before levels
+// are dropped. The pool is limited by its own budget and by what the global
+// GPU memory budget (src/gpu/memory) leaves to streaming. Over the limit,
+// the least recently needed textures are coarsened first, immediately.
+//
+// Bind group (group VOID_STREAM_GROUP, replaces the plain texture group):
+//   0 texture_2d<f32>      resident mips
+//   1 sampler              the streamer's sampler
+//   2 storage, read_write  feedback (one u32 per texture)
+//   3 uniform              StreamInfo (slot, full size)
+//
+// Per frame: request → update(queue) → draws → resolve(encoder) → submit →
+// end_frame. Feedback readbacks complete through void_gpu_process_events.
+// Not thread-safe.
+
+#ifndef VOID_RENDER_STREAMING_H
+#define VOID_RENDER_STREAMING_H
+
+#include <stdint.h>
+
+#define VOID_STREAM_GROUP       1
+#define VOID_STREAM_NONE        0xFFFFFFFFu
+#define VOID_STREAM_TAIL_SIZE   64    // levels this size or smaller never leave
+#define VOID_STREAM_LATENCY     3     // feedback readbacks in flight
+#define VOID_STREAM_KEEP_FRAMES 120   // unrequested this long: drop to the tail
+#define VOID_STREAM_DROP_DELAY  30    // frames a coarser wish must last
+#define VOID_STREAM_DEFAULT_UPLOAD (4u << 20)  // upload bytes per frame
+
+// sampler: used in every streamed texture's bind group (not owned)
+void *void_stream_create(void *device, void *sampler, uint32_t max_textures);
+void  void_stream_destroy(void *streamer);
+
+// Pool cap in bytes (0 = no own cap; the global budget still applies)
+void void_stream_set_budget(void *streamer, uint64_t bytes);
+void void_stream_set_upload_budget(void *streamer, uint64_t bytes_per_frame);
+
+// RGBA8 pixels (copied); builds the mip chain and makes the tail resident.
+// Returns the texture id, VOID_STREAM_NONE when full.
+uint32_t void_stream_add_rgba8(void *streamer, void *queue, const void *pixels,
+    uint32_t width, uint32_t height);
+
+// --- Per frame ---
+// screen_pixels: on-screen size of the texture's full UV extent (larger axis)
+void void_stream_request(void *streamer, uint32_t id, float screen_pixels);
+// Reads finished feedback, picks resident levels, uploads / evicts, and
+// clears this frame's feedback.
+void void_stream_update(void *streamer, void *queue);
+// After the passes that sample streamed textures, before finishing the encoder
+void void_stream_resolve(void *streamer, void *encoder);
+// After the submit that contains the resolve: starts the readback
+void void_stream_end_frame(void *streamer);
+
+// --- Binding ---
+void *void_stream_bind_group_layout(void *streamer);
+// Valid until the texture's residency next changes (re-fetch every frame)
+void *void_stream_bind_group(void *streamer, uint32_t id);
+// WGSL declarations for group VOID_STREAM_GROUP and
+// `fn stream_sample(uv: vec2f, frag_coord: vec4f) -> vec4f`
+const char *void_stream_wgsl(void);
+
+// --- Statistics ---
+uint32_t void_stream_mip_count(void *streamer, uint32_t id);
+uint32_t void_stream_resident_mip(void *streamer, uint32_t id);  // finest resident level
+uint32_t void_stream_wanted_mip(void *streamer, uint32_t id);
+uint64_t void_stream_resident_bytes(void *streamer);
+uint64_t void_stream_pool_limit(void *streamer);   // last update's limit
+uint64_t void_stream_uploaded_bytes(void *streamer);
+uint64_t void_stream_eviction_count(void *streamer);
+
+#endif
@@ -0,0 +1,415 @@
+// Void Render — Texture arrays and a per-instance material table
+
+#include "texarray.h"
+#include "../gpu/dawn.h"
+#include "../gpu/enums.h"
+#include "../gpu/cache.h"
+#include "../gpu/memory.h"
+#include "../assets/pixels.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define STR_(x) #x
+#define STR(x) STR_(x)
+
+#define MAX_LEVELS 16
+
+// --- Types ---
+
+// Matches struct TexMaterial in the WGSL below (48 bytes)
+typedef struct TexMaterial {
+	uint32_t slot;       // array within its page
+	uint32_t layer;
+	uint32_t pad[2];
+	float    tint[4];
+	float    uv[4];      // scale.xy, offset.zw
+} TexMaterial;
+
+typedef struct TexEntry {
+	uint32_t format;
+	uint32_t width, height;
+	uint32_t mip_count;
+	uint8_t *data;       // until built
+	uint32_t array;      // VOID_TEXARRAY_NONE until built
+	uint32_t layer;
+} TexEntry;
+
+typedef struct TexArray {
+	uint32_t format;
+	uint32_t width, height;
+	uint32_t mip_count;
+	uint32_t layers;
+	void    *texture;
+	void    *view;
+} TexArray;
+
+typedef struct TexArraySet {
+	void *device;
+	void *sampler;
+	void *layout;
+	void *placeholder;          // 1x1 white, fills unused page slots
+	void *placeholder_view;
+
+	TexEntry *textures;
+	uint32_t  texture_count, texture_cap;
+	TexArray *arrays;
+	uint32_t  array_count, array_cap;
+	void    **groups;           // one per page
+	uint32_t  group_count;
+
+	TexMaterial *materials;
+	uint32_t    *material_array;
+	uint32_t     material_count, max_materials;
+	uint32_t    *instances;
+	uint32_t     max_instances;
+	void        *material_buffer;
+	void        *instance_buffer;
+	uint32_t     dirty_materials[2];   // [lo, hi)
+	uint32_t     dirty_instances[2];
+} TexArraySet;
+
+static const char *s_texarray_wgsl =
+"struct TexMaterial {\n"
+"  slot: u32,\n"
+"  layer: u32,\n"
+"  pad0: u32,\n"
+"  pad1: u32,\n"
+"  tint: vec4f,\n"
+"  uv: vec4f,\n"
+"};\n"
+"@group(" STR(VOID_TEXARRAY_GROUP) ") @binding(0) var ta_tex0: texture_2d_array<f32>;\n"
+"@group(" STR(VOID_TEXARRAY_GROUP) ") @binding(1) var ta_tex1: texture_2d_array<f32>;\n"
+"@group(" STR(VOID_TEXARRAY_GROUP) ") @binding(2) var ta_tex2: texture_2d_array<f32>;\n"
+"@group(" STR(VOID_TEXARRAY_GROUP) ") @binding(3) var ta_tex3: texture_2d_array<f32>;\n"
+"@group(" STR(VOID_TEXARRAY_GROUP) ") @binding(4) var ta_samp: sampler;\n"
+"@group(" STR(VOID_TEXARRAY_GROUP) ") @binding(5) var<storage, read> ta_materials: array<TexMaterial>;\n"
+"@group(" STR(VOID_TEXARRAY_GROUP) ") @binding(6) var<storage, read> ta_instances: array<u32>;\n"
+"\n"
+"// The material varies per instance, so derivatives are taken up front and\n"
+"// the array is picked with explicit-gradient samples\n"
+"fn texarray_sample(material: u32, uv: vec2f) -> vec4f {\n"
+"  let m = ta_materials[material];\n"
+"  let st = uv * m.uv.xy + m.uv.zw;\n"
+"  let dx = dpdx(st);\n"
+"  let dy = dpdy(st);\n"
+"  var c: vec4f;\n"
+"  switch m.slot {\n"
+"    case 0u: { c = textureSampleGrad(ta_tex0, ta_samp, st, m.layer, dx, dy); }\n"
+"    case 1u: { c = textureSampleGrad(ta_tex1, ta_samp, st, m.layer, dx, dy); }\n"
+"    case 2u: { c = textureSampleGrad(ta_tex2, ta_samp, st, m.layer, dx, dy); }\n"
+"    default: { c = textureSampleGrad(ta_tex3, ta_samp, st, m.layer, dx, dy); }\n"
+"  }\n"
+"  return c * m.tint;\n"
+"}\n";
+
+static uint32_t level_size(uint32_t size, uint32_t level) {
+	uint32_t s = size >> level;
+	return s ? s : 1;
+}
+
+// Bytes of one tightly packed level (block rows for compressed formats)
+static uint64_t level_bytes(uint32_t format, uint32_t width, uint32_t height) {
+	uint32_t block = void_gpu_format_block_size(format);
+	uint64_t bx = (width + block - 1) / block, by = (height + block - 1) / block;
+	return bx * by * void_gpu_format_block_bytes(format);
+}
+
+static void mark_dirty(uint32_t *range, uint32_t lo, uint32_t hi) {
+	if (range[0] >= range[1]) {
+		range[0] = lo;
+		range[1] = hi;
+		return;
+	}
+	if (lo < range[0]) range[0] = lo;
+	if (hi > range[1]) range[1] = hi;
+}
+
+// --- Lifecycle ---
+
+void *void_texarray_create(void *device, void *sampler,
+	uint32_t max_materials, uint32_t max_instances
+) {
+	TexArraySet *s = calloc(1, sizeof(TexArraySet));
+	s->device = device;
+	s->sampler = sampler;
+	s->max_materials = max_materials ? max_materials : 1;
+	s->max_instances = max_instances ? max_instances : 1;
+	s->materials = calloc(s->max_materials, sizeof(TexMaterial));
+	s->material_array = calloc(s->max_materials, sizeof(uint32_t));
+	s->instances = calloc(s->max_instances, sizeof(uint32_t));
+	s->material_buffer = void_gpu_create_buffer(device, (uint64_t)s->max_materials * sizeof(TexMaterial),
+		BUFFER_USAGE_STORAGE | BUFFER_USAGE_COPY_DST, 0);
+	s->instance_buffer = void_gpu_create_buffer(device, (uint64_t)s->max_instances * sizeof(uint32_t),
+		BUFFER_USAGE_STORAGE | BUFFER_USAGE_COPY_DST, 0);
+
+	static const uint8_t white[4] = { 255, 255, 255, 255 };
+	s->placeholder = void_gpu_create_texture_layers(device, 1, 1, 1, FMT_RGBA8_UNORM,
+		TEXTURE_USAGE_TEXTURE_BINDING | TEXTURE_USAGE_COPY_DST, 1);
+	s->placeholder_view = void_gpu_create_texture_view_range(s->placeholder, VIEW_2D_ARRAY, 0, 0, 0, 0, 0);
+	void *queue = void_gpu_get_queue(device);
+	void_gpu_queue_write_texture_level(queue, s->placeholder, FMT_RGBA8_UNORM, 0, 0, white, 4, 1, 1);
+	void_gpu_release_queue(queue);
+
+	void *b = void_gpu_layout_begin();
+	for (uint32_t i = 0; i < VOID_TEXARRAY_PAGE_ARRAYS; i++) {
+		void_gpu_layout_texture(b, i, STAGE_FRAGMENT, SAMPLE_TYPE_FLOAT, VIEW_2D_ARRAY, 0);
+	}
+	void_gpu_layout_sampler(b, 4, STAGE_FRAGMENT, SAMPLER_FILTERING);
+	void_gpu_layout_buffer(b, 5, STAGE_FRAGMENT, BINDING_READ_ONLY_STORAGE, 0, 0);
+	void_gpu_layout_buffer(b, 6, STAGE_VERTEX, BINDING_READ_ONLY_STORAGE, 0, 0);
+	s->layout = void_gpu_layout_finish(device, b);
+	return s;
+}
+
+void void_texarray_destroy(void *set) {
+	TexArraySet *s = (TexArraySet *)set;
+	if (!s) return;
+	for (uint32_t i = 0; i < s->group_count; i++) void_gpu_cache_release(s->groups[i]);
+	for (uint32_t i = 0; i < s->array_count; i++) {
+		void_gpu_release_texture_view(s->arrays[i].view);
+		void_gpu_release_texture(s->arrays[i].texture);
+	}
+	for (uint32_t i = 0; i < s->texture_count; i++) free(s->textures[i].data);
+	void_gpu_cache_release(s->layout);
+	void_gpu_release_texture_view(s->placeholder_view);
+	void_gpu_release_texture(s->placeholder);
+	void_gpu_release_buffer(s->instance_buffer);
+	void_gpu_release_buffer(s->material_buffer);
+	free(s->groups);
+	free(s->arrays);
+	free(s->textures);
+	free(s->instances);
+	free(s->material_array);
+	free(s->materials);
+	free(s);
+}
+
+// --- Textures ---
+
+uint32_t void_texarray_add(void *set, uint32_t format, uint32_t width, uint32_t height,
+	uint32_t mip_count, const void *data, uint64_t size
+) {
+	TexArraySet *s = (TexArraySet *)set;
+	if (!data || width == 0 || height == 0 || mip_count == 0 || mip_count > MAX_LEVELS ||
+		format == 0) {
+		fprintf(stderr, "void_texarray: invalid texture (format %u, %u x %u, %u mips)\n",
+			format, width, height, mip_count);
+		return VOID_TEXARRAY_NONE;
+	}
+	uint64_t total = 0;
+	for (uint32_t m = 0; m < mip_count; m++) {
+		total += level_bytes(format, level_size(width, m), level_size(height, m));
+	}
+	if (size < total) {
+		fprintf(stderr, "void_texarray: %llu bytes given, %llu needed\n",
+			(unsigned long long)size, (unsigned long long)total);
+		return VOID_TEXARRAY_NONE;
+	}
+
+	if (s->texture_count == s->texture_cap) {
+		s->texture_cap = s->texture_cap ? s->texture_cap * 2 : 64;
+		s->textures = realloc(s->textures, s->texture_cap * sizeof(TexEntry));
+	}
+	uint32_t id = s->texture_count++;
+	TexEntry *t = &s->textures[id];
+	t->format = format;
+	t->width = width;
+	t->height = height;
+	t->mip_count = mip_count;
+	t->data = malloc(total);
+	memcpy(t->data, data, total);
+	t->array = VOID_TEXARRAY_NONE;
+	t->layer = 0;
+	return id;
+}
+
+uint32_t void_texarray_add_rgba8(void *set, const void *pixels, uint32_t width, uint32_t height) {
+	if (!pixels || width == 0 || height == 0) return VOID_TEXARRAY_NONE;
+	uint32_t mips = void_pixels_mip_count(width, height);
+	if (mips > MAX_LEVELS) {
+		fprintf(stderr, "void_texarray: %u x %u is too large\n", width, height);
+		return VOID_TEXARRAY_NONE;
+	}
+
+	uint64_t total = void_pixels_mip_chain_bytes(width, height);
+	uint8_t *chain = malloc(total);
+	memcpy(chain, pixels, (size_t)width * height * 4);
+	void_pixels_build_mips(chain, width, height);
+	uint32_t id = void_texarray_add(set, FMT_RGBA8_UNORM, width, height, mips, chain, total);
+	free(chain);
+	return id;
+}
+
+uint32_t void_texarray_build(void *set, void *queue) {
+	TexArraySet *s = (TexArraySet *)set;
+	uint32_t first_new = s->array_count;
+
+	// Assign layers: same format, size and mip count share an array
+	for (uint32_t i = 0; i < s->texture_count; i++) {
+		TexEntry *t = &s->textures[i];
+		if (t->array != VOID_TEXARRAY_NONE) continue;
+		uint32_t a = first_new;
+		for (; a < s->array_count; a++) {
+			TexArray *arr = &s->arrays[a];
+			if (arr->format == t->format && arr->width == t->width && arr->height == t->height &&
+				arr->mip_count == t->mip_count && arr->layers < VOID_TEXARRAY_MAX_LAYERS) {
+				break;
+			}
+		}
+		if (a == s->array_count) {
+			if (s->array_count == s->array_cap) {
+				s->array_cap = s->array_cap ? s->array_cap * 2 : 16;
+				s->arrays = realloc(s->arrays, s->array_cap * sizeof(TexArray));
+			}
+			TexArray *arr = &s->arrays[s->array_count++];
+			memset(arr, 0, sizeof(*arr));
+			arr->format = t->format;
+			arr->width = t->width;
+			arr->height = t->height;
+			arr->mip_count = t->mip_count;
+		}
+		t->array = a;
+		t->layer = s->arrays[a].layers++;
+	}
+	if (s->array_count == first_new) return 0;
+
+	for (uint32_t a = first_new; a < s->array_count; a++) {
+		TexArray *arr = &s->arrays[a];
+		arr->texture = void_gpu_create_texture_layers(s->device, arr->width, arr->height, arr->layers,
+			arr->format, TEXTURE_USAGE_TEXTURE_BINDING | TEXTURE_USAGE_COPY_DST, arr->mip_count);
+		arr->view = void_gpu_create_texture_view_range(arr->texture, VIEW_2D_ARRAY, 0, 0, 0, 0, 0);
+	}
+
+	for (uint32_t i = 0; i < s->texture_count; i++) {
+		TexEntry *t = &s->textures[i];
+		if (!t->data) continue;
+		const uint8_t *level = t->data;
+		for (uint32_t m = 0; m < t->mip_count; m++) {
+			uint32_t w = level_size(t->width, m), h = level_size(t->height, m);
+			uint64_t bytes = level_bytes(t->format, w, h);
+			void_gpu_queue_write_texture_level(queue, s->arrays[t->array].texture, t->format,
+				m, t->layer, level, bytes, w, h);
+			level += bytes;
+		}
+		free(t->data);
+		t->data = NULL;
+	}
+
+	// Pages: every VOID_TEXARRAY_PAGE_ARRAYS arrays share a bind group
+	for (uint32_t p = 0; p < s->group_count; p++) void_gpu_cache_release(s->groups[p]);
+	s->group_count = (s->array_count + VOID_TEXARRAY_PAGE_ARRAYS - 1) / VOID_TEXARRAY_PAGE_ARRAYS;
+	s->groups = realloc(s->groups, s->group_count * sizeof(void *));
+	for (uint32_t p = 0; p < s->group_count; p++) {
+		void *g = void_gpu_group_begin(s->layout);
+		for (uint32_t i = 0; i < VOID_TEXARRAY_PAGE_ARRAYS; i++) {
+			uint32_t a = p * VOID_TEXARRAY_PAGE_ARRAYS + i;
+			void_gpu_group_texture(g, i, a < s->array_count ? s->arrays[a].view : s->placeholder_view);
+		}
+		void_gpu_group_sampler(g, 4, s->sampler);
+		void_gpu_group_buffer(g, 5, s->material_buffer, 0, 0);
+		void_gpu_group_buffer(g, 6, s->instance_buffer, 0, 0);
+		s->groups[p] = void_gpu_group_finish(s->device, g);
+	}
+	return s->array_count - first_new;
+}
+
+uint32_t void_texarray_array_count(void *set) {
+	return ((TexArraySet *)set)->array_count;
+}
+
+uint32_t void_texarray_texture_array(void *set, uint32_t texture) {
+	TexArraySet *s = (TexArraySet *)set;
+	return texture < s->texture_count ? s->textures[texture].array : VOID_TEXARRAY_NONE;
+}
+
+uint32_t void_texarray_texture_layer(void *set, uint32_t texture) {
+	TexArraySet *s = (TexArraySet *)set;
+	return texture < s->texture_count ? s->textures[texture].layer : 0;
+}
+
+// --- Materials ---
+
+void void_texarray_material_set(void *set, uint32_t material, uint32_t texture,
+	const float *tint, const float *uv
+) {
+	TexArraySet *s = (TexArraySet *)set;
+	if (material >= s->material_count) return;
+	if (texture >= s->texture_count || s->textures[texture].array == VOID_TEXARRAY_NONE) {
+		fprintf(stderr, "void_texarray: texture %u is not built\n", texture);
+		return;
+	}
+	static const float white[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+	static const float identity[4] = { 1.0f, 1.0f, 0.0f, 0.0f };
+	const TexEntry *t = &s->textures[texture];
+	TexMaterial *m = &s->materials[material];
+	m->slot = t->array % VOID_TEXARRAY_PAGE_ARRAYS;
+	m->layer = t->layer;
+	memcpy(m->tint, tint ? tint : white, sizeof(m->tint));
+	memcpy(m->uv, uv ? uv : identity, sizeof(m->uv));
+	s->material_array[material] = t->array;
+	mark_dirty(s->dirty_materials, material, material + 1);
+}
+
+uint32_t void_texarray_material_add(void *set, uint32_t texture, const float *tint, const float *uv) {
+	TexArraySet *s = (TexArraySet *)set;
+	if (s->material_count >= s->max_materials) return VOID_TEXARRAY_NONE;
+	if (texture >= s->texture_count || s->textures[texture].array == VOID_TEXARRAY_NONE) {
+		fprintf(stderr, "void_texarray: texture %u is not built\n", texture);
+		return VOID_TEXARRAY_NONE;
+	}
+	uint32_t id = s->material_count++;
+	void_texarray_material_set(set, id, texture, tint, uv);
+	return id;
+}
+
+uint32_t void_texarray_page(void *set, uint32_t material) {
+	TexArraySet *s = (TexArraySet *)set;
+	if (material >= s->material_count) return VOID_TEXARRAY_NONE;
+	return s->material_array[material] / VOID_TEXARRAY_PAGE_ARRAYS;
+}
+
+void void_texarray_set_instances(void *set, uint32_t first, const uint32_t *materials, uint32_t count) {
+	TexArraySet *s = (TexArraySet *)set;
+	if (first >= s->max_instances) return;
+	if (count > s->max_instances - first) count = s->max_instances - first;
+	if (count == 0) return;
+	memcpy(s->instances + first, materials, count * sizeof(uint32_t));
+	mark_dirty(s->dirty_instances, first, first + count);
+}
+
+void void_texarray_flush(void *set, void *queue) {
+	TexArraySet *s = (TexArraySet *)set;
+	uint32_t *m = s->dirty_materials;
+	if (m[0] < m[1]) {
+		void_gpu_queue_write_buffer(queue, s->material_buffer, (uint64_t)m[0] * sizeof(TexMaterial),
+			s->materials + m[0], (uint64_t)(m[1] - m[0]) * sizeof(TexMaterial));
+		m[0] = m[1] = 0;
+	}
+	uint32_t *i = s->dirty_instances;
+	if (i[0] < i[1]) {
+		void_gpu_queue_write_buffer(queue, s->instance_buffer, (uint64_t)i[0] * sizeof(uint32_t),
+			s->instances + i[0], (uint64_t)(i[1] - i[0]) * sizeof(uint32_t));
+		i[0] = i[1] = 0;
+	}
+}
+
+// --- Binding ---
+
+void *void_texarray_bind_group_layout(void *set) {
+	return ((TexArraySet *)set)->layout;
+}
+
+void *void_texarray_bind_group(void *set, uint32_t page) {
+	TexArraySet *s = (TexArraySet *)set;
+	return page < s->group_count ? s->groups[page] : NULL;
+}
+
+uint32_t void_texarray_page_count(void *set) {
+	return ((TexArraySet *)set)->group_count;
+}
+
+const char *void_texarray_wgsl(void) {
+	return s_texarray_wgsl;
+}
@@ -0,0 +1,83 @@
+// Void Render — Texture arrays and a per-instance material table
+// Textures added to a set are grouped by format, size and mip count into
+// 2D-array textures (one layer each, up to VOID_TEXARRAY_MAX_LAYERS per
+// array), so drawing objects with different textures no longer needs a bind
+// group per texture. Materials (texture + tint + UV transform) live in one
+// storage buffer; an instance table maps each instance to its material, so
+// one instanced or indirect draw can cover objects with different
+// materials: instance i of a draw with first instance f uses material
+// instances[f + i]. Indirect draws need first instance 0 unless the device
+// has the indirect-first-instance feature.
+//
+// Bind groups are handed out per page of VOID_TEXARRAY_PAGE_ARRAYS arrays;
+// every material of one draw must be on the same page (void_texarray_page).
+//
+// Bind group (group VOID_TEXARRAY_GROUP, replaces the plain texture group):
+//   0..3 texture_2d_array<f32>  the page's arrays (unused: 1x1 placeholder)
+//   4    sampler                the set's sampler
+//   5    storage, read          materials (TexMaterial, 48 bytes each)
+//   6    storage, read          instance -> material (u32 each)
+//
+// Flow: add textures → build(queue) → add materials / set instances →
+// flush(queue) → draws. Textures added after a build go into new arrays on
+// the next build. Cube maps: void_gpu_create_texture_layers with 6 layers
+// and a CUBE view, bound through void_gpu_create_bind_group_layout_1tex_1samp_dim.
+// Not thread-safe.
+
+#ifndef VOID_RENDER_TEXARRAY_H
+#define VOID_RENDER_TEXARRAY_H
+
+#include <stdint.h>
+
+#define VOID_TEXARRAY_GROUP       1
+#define VOID_TEXARRAY_NONE        0xFFFFFFFFu
+#define VOID_TEXARRAY_MAX_LAYERS  256   // WebGPU default maxTextureArrayLayers
+#define VOID_TEXARRAY_PAGE_ARRAYS 4     // arrays bound per bind group
+
+// sampler: used in every bind group of the set (not owned)
+void *void_texarray_create(void *device, void *sampler,
+    uint32_t max_materials, uint32_t max_instances);
+void  void_texarray_destroy(void *set);
+
+// --- Textures ---
+// Every mip level back to back, finest first, each tightly packed in
+// `format`'s blocks (as for void_gpu_queue_write_texture_level). Copied
+// until the next build. Returns the texture id, VOID_TEXARRAY_NONE on error.
+uint32_t void_texarray_add(void *set, uint32_t format, uint32_t width, uint32_t height,
+    uint32_t mip_count, const void *data, uint64_t size);
+// RGBA8 pixels (copied); builds the full mip chain
+uint32_t void_texarray_add_rgba8(void *set, const void *pixels, uint32_t width, uint32_t height);
+
+// Creates arrays for the textures added since the last build and uploads
+// them. Returns the number of arrays created.
+uint32_t void_texarray_build(void *set, void *queue);
+
+uint32_t void_texarray_array_count(void *set);
+uint32_t void_texarray_texture_array(void *set, uint32_t texture);  // NONE before build
+uint32_t void_texarray_texture_layer(void *set, uint32_t texture);
+
+// --- Materials ---
+// tint: 4 floats (NULL = white); uv: scale.xy, offset.zw (NULL = identity).
+// The texture must be built. Returns the material id, NONE when full.
+uint32_t void_texarray_material_add(void *set, uint32_t texture, const float *tint, const float *uv);
+void void_texarray_material_set(void *set, uint32_t material, uint32_t texture,
+    const float *tint, const float *uv);
+// Page whose bind group a draw using `material` must bind
+uint32_t void_texarray_page(void *set, uint32_t material);
+
+// Instance -> material entries [first, first + count)
+void void_texarray_set_instances(void *set, uint32_t first, const uint32_t *materials, uint32_t count);
+
+// Uploads materials and instance entries changed since the last flush
+void void_texarray_flush(void *set, void *queue);
+
+// --- Binding ---
+void *void_texarray_bind_group_layout(void *set);
+// Owned by the set; valid until the next build
+void *void_texarray_bind_group(void *set, uint32_t page);
+uint32_t void_texarray_page_count(void *set);
+// WGSL declarations for group VOID_TEXARRAY_GROUP and
+// `fn texarray_sample(material: u32, uv: vec2f) -> vec4f`
+const char *void_texarray_wgsl(void);
+
+#endif
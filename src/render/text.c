@@ -0,0 +1,613 @@
+// Void Render — SDF text
+
+#include "text.h"
+#include "../gpu/dawn.h"
+#include "../gpu/enums.h"
+#include "../gpu/cache.h"
+
+#define STB_TRUETYPE_IMPLEMENTATION
+#include "../../deps/stb/stb_truetype.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_GLYPHS     1024     // slots in a font's glyph table
+#define MAX_LAYOUTS    256      // cached strings per font
+#define LAYOUT_BUCKETS 512
+#define NO_QUAD        0xFFFFFFFFu   // whitespace, or the atlas is full
+#define SDF_ONEDGE     128
+
+// --- Font ---
+
+// Mirrors the WGSL Glyph struct (base-size pixels, y down from the baseline)
+typedef struct GlyphInfo {
+	float offset[2];
+	float size[2];
+	float uv0[2];
+	float uv1[2];
+} GlyphInfo;
+
+typedef struct LayoutGlyph {
+	float    x, y;           // pen position, base-size pixels from the text origin
+	uint32_t slot;
+} LayoutGlyph;
+
+typedef struct Layout {
+	char        *text;
+	uint32_t     hash;
+	int32_t      next;       // bucket chain
+	LayoutGlyph *glyphs;
+	uint32_t     count;
+	float        width;      // widest line, base-size pixels
+	uint64_t     last_use;
+} Layout;
+
+typedef struct Font {
+	void          *device;
+	void          *queue;
+	unsigned char *data;
+	stbtt_fontinfo info;
+	float          base_size;
+	float          scale;        // font units → base-size pixels
+	float          ascent;       // base-size pixels
+	float          line_height;
+	int            padding;      // SDF spread, base-size pixels
+
+	// Atlas (shelf packing: glyphs at one size have similar heights)
+	uint32_t  atlas_size;
+	uint32_t  shelf_x, shelf_y, shelf_h;
+	int       full_warned;
+	void     *texture;
+	void     *view;
+	void     *glyph_buffer;      // GlyphInfo x MAX_GLYPHS
+	void     *layout;            // cached
+	void     *sampler;           // cached
+	void     *group;             // cached
+	uint32_t  glyph_count;
+
+	// Codepoint → slot (open addressing, never shrinks)
+	uint32_t *map_keys;
+	uint32_t *map_slots;
+	uint32_t  map_capacity;
+	uint32_t  map_count;
+
+	Layout    layouts[MAX_LAYOUTS];
+	uint32_t  layout_count;
+	int32_t   buckets[LAYOUT_BUCKETS];
+	uint64_t  clock;
+	uint64_t  hits, misses;
+} Font;
+
+// Shared by every font and the text pipeline (deduplicated by the cache)
+static void *font_group_layout(void *device) {
+	void *b = void_gpu_layout_begin();
+	void_gpu_layout_texture(b, 0, STAGE_FRAGMENT, SAMPLE_TYPE_FLOAT, VIEW_2D, 0);
+	void_gpu_layout_sampler(b, 1, STAGE_FRAGMENT, SAMPLER_FILTERING);
+	void_gpu_layout_buffer(b, 2, STAGE_VERTEX, BINDING_READ_ONLY_STORAGE, 0, 0);
+	return void_gpu_layout_finish(device, b);
+}
+
+void *void_font_create(void *device, const char *path, float base_size, uint32_t atlas_size) {
+	FILE *file = fopen(path, "rb");
+	if (!file) {
+		fprintf(stderr, "void_font: cannot open %s\n", path);
+		return NULL;
+	}
+	fseek(file, 0, SEEK_END);
+	long file_size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	unsigned char *data = file_size > 0 ? malloc((size_t)file_size) : NULL;
+	if (!data || fread(data, 1, (size_t)file_size, file) != (size_t)file_size) {
+		fprintf(stderr, "void_font: cannot read %s\n", path);
+		fclose(file);
+		free(data);
+		return NULL;
+	}
+	fclose(file);
+
+	Font *f = calloc(1, sizeof(Font));
+	f->data = data;
+	int offset = stbtt_GetFontOffsetForIndex(data, 0);
+	if (offset < 0 || !stbtt_InitFont(&f->info, data, offset)) {
+		fprintf(stderr, "void_font: %s is not a TrueType font\n", path);
+		free(data);
+		free(f);
+		return NULL;
+	}
+
+	f->device = device;
+	f->queue = void_gpu_get_queue(device);
+	f->base_size = base_size > 0.0f ? base_size : 32.0f;
+	f->scale = stbtt_ScaleForPixelHeight(&f->info, f->base_size);
+	int ascent, descent, line_gap;
+	stbtt_GetFontVMetrics(&f->info, &ascent, &descent, &line_gap);
+	f->ascent = (float)ascent * f->scale;
+	f->line_height = (float)(ascent - descent + line_gap) * f->scale;
+	f->padding = (int)(f->base_size / 8.0f);
+	if (f->padding < 2) f->padding = 2;
+
+	f->atlas_size = atlas_size ? atlas_size : 1024;
+	f->texture = void_gpu_create_texture(device, f->atlas_size, f->atlas_size, FMT_R8_UNORM,
+		TEXTURE_USAGE_TEXTURE_BINDING | TEXTURE_USAGE_COPY_DST, 1);
+	f->view = void_gpu_create_texture_view(f->texture);
+	f->glyph_buffer = void_gpu_create_buffer(device, MAX_GLYPHS * sizeof(GlyphInfo),
+		BUFFER_USAGE_STORAGE | BUFFER_USAGE_COPY_DST, 0);
+	f->layout = font_group_layout(device);
+	f->sampler = void_gpu_cached_sampler(device, ADDRESS_CLAMP, ADDRESS_CLAMP, ADDRESS_CLAMP,
+		FILTER_LINEAR, FILTER_LINEAR, MIPMAP_NEAREST, 0, 1);
+	void *g = void_gpu_group_begin(f->layout);
+	void_gpu_group_texture(g, 0, f->view);
+	void_gpu_group_sampler(g, 1, f->sampler);
+	void_gpu_group_buffer(g, 2, f->glyph_buffer, 0, 0);
+	f->group = void_gpu_group_finish(device, g);
+
+	f->map_capacity = MAX_GLYPHS * 2;
+	f->map_keys = malloc(f->map_capacity * sizeof(uint32_t));
+	f->map_slots = malloc(f->map_capacity * sizeof(uint32_t));
+	memset(f->map_keys, 0xFF, f->map_capacity * sizeof(uint32_t));
+	memset(f->buckets, 0xFF, sizeof(f->buckets));
+	return f;
+}
+
+void void_font_destroy(void *font) {
+	Font *f = (Font *)font;
+	if (!f) return;
+	for (uint32_t i = 0; i < f->layout_count; i++) {
+		free(f->layouts[i].text);
+		free(f->layouts[i].glyphs);
+	}
+	free(f->map_keys);
+	free(f->map_slots);
+	void_gpu_cache_release(f->group);
+	void_gpu_cache_release(f->sampler);
+	void_gpu_cache_release(f->layout);
+	void_gpu_release_buffer(f->glyph_buffer);
+	void_gpu_release_texture_view(f->view);
+	void_gpu_release_texture(f->texture);
+	void_gpu_release_queue(f->queue);
+	free(f->data);
+	free(f);
+}
+
+static int shelf_pack(Font *f, uint32_t w, uint32_t h, uint32_t *x, uint32_t *y) {
+	if (w > f->atlas_size) return 0;
+	if (f->shelf_x + w > f->atlas_size) {
+		f->shelf_y += f->shelf_h;
+		f->shelf_x = 0;
+		f->shelf_h = 0;
+	}
+	if (f->shelf_y + h > f->atlas_size) return 0;
+	*x = f->shelf_x;
+	*y = f->shelf_y;
+	f->shelf_x += w;
+	if (h > f->shelf_h) f->shelf_h = h;
+	return 1;
+}
+
+// Slot of a codepoint's glyph, rasterizing it into the atlas on first use
+static uint32_t glyph_slot(Font *f, uint32_t codepoint, int glyph) {
+	uint32_t mask = f->map_capacity - 1;
+	uint32_t i = (codepoint * 2654435761u) & mask;
+	while (f->map_keys[i] != 0xFFFFFFFFu) {
+		if (f->map_keys[i] == codepoint) return f->map_slots[i];
+		i = (i + 1) & mask;
+	}
+
+	uint32_t slot = NO_QUAD;
+	if (!stbtt_IsGlyphEmpty(&f->info, glyph)) {
+		int w = 0, h = 0, xoff = 0, yoff = 0;
+		unsigned char *sdf = f->glyph_count < MAX_GLYPHS
+			? stbtt_GetGlyphSDF(&f->info, f->scale, glyph, f->padding, SDF_ONEDGE,
+				(float)SDF_ONEDGE / (float)f->padding, &w, &h, &xoff, &yoff)
+			: NULL;
+		uint32_t x, y;
+		if (sdf && shelf_pack(f, (uint32_t)w + 1, (uint32_t)h + 1, &x, &y)) {
+			void_gpu_queue_write_texture_region(f->queue, f->texture, x, y,
+				sdf, (uint64_t)w * h, (uint32_t)w, (uint32_t)w, (uint32_t)h);
+			float inv = 1.0f / (float)f->atlas_size;
+			GlyphInfo info = {
+				{ (float)xoff, (float)yoff },
+				{ (float)w, (float)h },
+				{ (float)x * inv, (float)y * inv },
+				{ (float)(x + w) * inv, (float)(y + h) * inv },
+			};
+			slot = f->glyph_count++;
+			void_gpu_queue_write_buffer(f->queue, f->glyph_buffer,
+				(uint64_t)slot * sizeof(GlyphInfo), &info, sizeof(info));
+		} else if (!f->full_warned) {
+			fprintf(stderr, "void_font: glyph atlas full, U+%04X and later glyphs are skipped\n", codepoint);
+			f->full_warned = 1;
+		}
+		if (sdf) stbtt_FreeSDF(sdf, NULL);
+	}
+
+	// Whitespace and overflow are remembered too, so they are never retried
+	if (f->map_count < f->map_capacity - 1) {
+		f->map_keys[i] = codepoint;
+		f->map_slots[i] = slot;
+		f->map_count++;
+	}
+	return slot;
+}
+
+// Next codepoint of a UTF-8 string (U+FFFD for malformed input)
+static uint32_t utf8_next(const unsigned char **s) {
+	const unsigned char *p = *s;
+	uint32_t c = p[0];
+	int extra = c < 0x80 ? 0 : (c & 0xE0) == 0xC0 ? 1 : (c & 0xF0) == 0xE0 ? 2 : (c & 0xF8) == 0xF0 ? 3 : -1;
+	if (extra < 0) {
+		*s = p + 1;
+		return 0xFFFD;
+	}
+	c &= extra ? (0x3Fu >> extra) : 0x7Fu;
+	for (int k = 1; k <= extra; k++) {
+		if ((p[k] & 0xC0) != 0x80) {
+			*s = p + k;
+			return 0xFFFD;
+		}
+		c = (c << 6) | (p[k] & 0x3F);
+	}
+	*s = p + 1 + extra;
+	return c;
+}
+
+static void layout_unlink(Font *f, uint32_t index) {
+	Layout *l = &f->layouts[index];
+	int32_t *link = &f->buckets[l->hash & (LAYOUT_BUCKETS - 1)];
+	while (*link != (int32_t)index) link = &f->layouts[*link].next;
+	*link = l->next;
+}
+
+// Cached layout of a string (glyphs placed in base-size pixels)
+static Layout *font_layout(Font *f, const char *utf8) {
+	uint32_t hash = 2166136261u;
+	size_t len = 0;
+	for (const unsigned char *p = (const unsigned char *)utf8; *p; p++, len++) {
+		hash = (hash ^ *p) * 16777619u;
+	}
+	int32_t *bucket = &f->buckets[hash & (LAYOUT_BUCKETS - 1)];
+	for (int32_t i = *bucket; i >= 0; i = f->layouts[i].next) {
+		Layout *l = &f->layouts[i];
+		if (l->hash == hash && strcmp(l->text, utf8) == 0) {
+			l->last_use = ++f->clock;
+			f->hits++;
+			return l;
+		}
+	}
+	f->misses++;
+
+	// Reuse the least recently used entry once the cache is full
+	uint32_t index;
+	if (f->layout_count < MAX_LAYOUTS) {
+		index = f->layout_count++;
+	} else {
+		index = 0;
+		for (uint32_t i = 1; i < MAX_LAYOUTS; i++) {
+			if (f->layouts[i].last_use < f->layouts[index].last_use) index = i;
+		}
+		layout_unlink(f, index);
+		free(f->layouts[index].text);
+		free(f->layouts[index].glyphs);
+	}
+
+	Layout *l = &f->layouts[index];
+	memset(l, 0, sizeof(*l));
+	l->text = malloc(len + 1);
+	memcpy(l->text, utf8, len + 1);
+	l->hash = hash;
+	l->glyphs = malloc((len ? len : 1) * sizeof(LayoutGlyph));   // at most one glyph per byte
+	l->last_use = ++f->clock;
+
+	float pen_x = 0.0f, pen_y = f->ascent;
+	int prev = -1;
+	const unsigned char *p = (const unsigned char *)utf8;
+	while (*p) {
+		uint32_t cp = utf8_next(&p);
+		if (cp == '\n') {
+			if (pen_x > l->width) l->width = pen_x;
+			pen_x = 0.0f;
+			pen_y += f->line_height;
+			prev = -1;
+			continue;
+		}
+		int glyph = stbtt_FindGlyphIndex(&f->info, (int)cp);
+		if (prev >= 0) pen_x += (float)stbtt_GetGlyphKernAdvance(&f->info, prev, glyph) * f->scale;
+		uint32_t slot = glyph_slot(f, cp, glyph);
+		if (slot != NO_QUAD) {
+			l->glyphs[l->count++] = (LayoutGlyph){ pen_x, pen_y, slot };
+		}
+		int advance, bearing;
+		stbtt_GetGlyphHMetrics(&f->info, glyph, &advance, &bearing);
+		pen_x += (float)advance * f->scale;
+		prev = glyph;
+	}
+	if (pen_x > l->width) l->width = pen_x;
+
+	l->next = *bucket;
+	*bucket = (int32_t)index;
+	return l;
+}
+
+float void_font_line_height(void *font, float size) {
+	Font *f = (Font *)font;
+	return f->line_height * size / f->base_size;
+}
+
+float void_font_text_width(void *font, const char *utf8, float size) {
+	Font *f = (Font *)font;
+	return font_layout(f, utf8)->width * size / f->base_size;
+}
+
+uint32_t void_font_glyph_count(void *font) {
+	return ((Font *)font)->glyph_count;
+}
+
+uint64_t void_font_layout_hits(void *font) {
+	return ((Font *)font)->hits;
+}
+
+uint64_t void_font_layout_misses(void *font) {
+	return ((Font *)font)->misses;
+}
+
+// --- Text batch ---
+
+typedef struct GlyphInstance {
+	float    pos[2];         // target pixels of the glyph's pen position
+	float    scale;          // size / base size
+	uint32_t slot;
+	uint32_t color;          // RGBA8, red in the low byte
+} GlyphInstance;
+
+typedef struct View2D {
+	float size[2];
+	float pad[2];
+} View2D;
+
+typedef struct TextRun {
+	Font    *font;
+	uint32_t first;
+	uint32_t count;
+} TextRun;
+
+static const char *s_text_wgsl =
+"struct View2D {\n"
+"  size: vec2f,\n"
+"  pad: vec2f,\n"
+"};\n"
+"struct Glyph {\n"
+"  offset: vec2f,\n"
+"  size: vec2f,\n"
+"  uv0: vec2f,\n"
+"  uv1: vec2f,\n"
+"};\n"
+"@group(0) @binding(0) var<uniform> view2d: View2D;\n"
+"@group(1) @binding(0) var sdf_tex: texture_2d<f32>;\n"
+"@group(1) @binding(1) var sdf_samp: sampler;\n"
+"@group(1) @binding(2) var<storage, read> glyphs: array<Glyph>;\n"
+"\n"
+"struct VIn {\n"
+"  @builtin(vertex_index) vid: u32,\n"
+"  @location(0) pos: vec2f,\n"
+"  @location(1) scale: f32,\n"
+"  @location(2) slot: u32,\n"
+"  @location(3) color: vec4f,\n"
+"};\n"
+"struct VOut {\n"
+"  @builtin(position) pos: vec4f,\n"
+"  @location(0) uv: vec2f,\n"
+"  @location(1) color: vec4f,\n"
+"};\n"
+"\n"
+"@vertex fn vs_main(in: VIn) -> VOut {\n"
+"  // Two triangles: corners (0,0) (1,0) (1,1) / (0,0) (1,1) (0,1)\n"
+"  let cx = array<f32, 6>(0.0, 1.0, 1.0, 0.0, 1.0, 0.0);\n"
+"  let cy = array<f32, 6>(0.0, 0.0, 1.0, 0.0, 1.0, 1.0);\n"
+"  let corner = vec2f(cx[in.vid], cy[in.vid]);\n"
+"  let g = glyphs[in.slot];\n"
+"  let p = in.pos + (g.offset + corner * g.size) * in.scale;\n"
+"  var out: VOut;\n"
+"  out.pos = vec4f(p / view2d.size * vec2f(2.0, -2.0) + vec2f(-1.0, 1.0), 0.0, 1.0);\n"
+"  out.uv = mix(g.uv0, g.uv1, corner);\n"
+"  out.color = in.color;\n"
+"  return out;\n"
+"}\n"
+"\n"
+"@fragment fn fs_main(in: VOut) -> @location(0) vec4f {\n"
+"  // Distance 0.5 is the outline; the ramp stays one screen pixel wide at any size\n"
+"  let d = textureSample(sdf_tex, sdf_samp, in.uv).r;\n"
+"  let w = max(fwidth(d) * 0.5, 1e-4);\n"
+"  let a = smoothstep(0.5 - w, 0.5 + w, d);\n"
+"  return vec4f(in.color.rgb, in.color.a * a);\n"
+"}\n";
+
+typedef struct Text {
+	void          *device;
+	uint32_t       max_glyphs;
+
+	// Frame
+	GlyphInstance *instances;
+	GlyphInstance *uploaded;     // what the instance buffer holds
+	uint32_t       uploaded_count;
+	uint32_t       count;
+	uint32_t       flushed;
+	TextRun       *runs;
+	uint32_t       run_count;
+	uint32_t       run_capacity;
+	uint32_t       first_run;
+	uint32_t       width, height;
+	int            view_dirty;
+	View2D         view;
+	uint32_t       draws;
+
+	void *instance_buffer;
+	void *uniform_buffer;
+	void *view_layout;           // cached
+	void *font_layout;           // cached
+	void *view_group;            // cached
+	void *pipeline_layout;       // cached
+	void *shader;
+	void *pipeline;
+} Text;
+
+void *void_text_create(void *device, uint32_t color_format, uint32_t samples, uint32_t max_glyphs) {
+	Text *t = calloc(1, sizeof(Text));
+	t->device = device;
+	t->max_glyphs = max_glyphs ? max_glyphs : 1;
+	t->instances = malloc(t->max_glyphs * sizeof(GlyphInstance));
+	t->uploaded = malloc(t->max_glyphs * sizeof(GlyphInstance));
+	t->run_capacity = 8;
+	t->runs = malloc(t->run_capacity * sizeof(TextRun));
+
+	t->instance_buffer = void_gpu_create_buffer(device, (uint64_t)t->max_glyphs * sizeof(GlyphInstance),
+		BUFFER_USAGE_VERTEX | BUFFER_USAGE_COPY_DST, 0);
+	t->uniform_buffer = void_gpu_create_buffer(device, sizeof(View2D),
+		BUFFER_USAGE_UNIFORM | BUFFER_USAGE_COPY_DST, 0);
+
+	void *lb = void_gpu_layout_begin();
+	void_gpu_layout_buffer(lb, 0, STAGE_VERTEX, BINDING_UNIFORM, sizeof(View2D), 0);
+	t->view_layout = void_gpu_layout_finish(device, lb);
+	t->font_layout = font_group_layout(device);
+	t->pipeline_layout = void_gpu_cached_pipeline_layout_2(device, t->view_layout, t->font_layout);
+	void *g = void_gpu_group_begin(t->view_layout);
+	void_gpu_group_buffer(g, 0, t->uniform_buffer, 0, 0);
+	t->view_group = void_gpu_group_finish(device, g);
+
+	t->shader = void_gpu_create_shader(device, s_text_wgsl);
+	VoidRenderPipelineDesc d = {0};
+	d.shader = t->shader;
+	d.vs_entry = "vs_main";
+	d.fs_entry = "fs_main";
+	d.layout = t->pipeline_layout;
+	d.stride = sizeof(GlyphInstance);
+	d.instanced = 1;
+	d.attr_count = 4;
+	d.attrs[0] = (VoidVertexAttr){ VFMT_FLOAT32X2, 0, 0 };
+	d.attrs[1] = (VoidVertexAttr){ VFMT_FLOAT32, 8, 1 };
+	d.attrs[2] = (VoidVertexAttr){ VFMT_UINT32, 12, 2 };
+	d.attrs[3] = (VoidVertexAttr){ VFMT_UNORM8X4, 16, 3 };
+	d.color_format = color_format;
+	d.sample_count = samples;
+	d.has_blend = 1;
+	d.blend_color_src = BLEND_SRC_ALPHA;
+	d.blend_color_dst = BLEND_ONE_MINUS_SRC_ALPHA;
+	d.blend_color_op = BLEND_OP_ADD;
+	d.blend_alpha_src = BLEND_ONE;
+	d.blend_alpha_dst = BLEND_ONE_MINUS_SRC_ALPHA;
+	d.blend_alpha_op = BLEND_OP_ADD;
+	t->pipeline = void_gpu_create_render_pipeline_desc(device, &d);
+	return t;
+}
+
+void void_text_destroy(void *text) {
+	Text *t = (Text *)text;
+	if (!t) return;
+	void_gpu_release_pipeline(t->pipeline);
+	void_gpu_release_shader(t->shader);
+	void_gpu_cache_release(t->view_group);
+	void_gpu_cache_release(t->pipeline_layout);
+	void_gpu_cache_release(t->font_layout);
+	void_gpu_cache_release(t->view_layout);
+	void_gpu_release_buffer(t->uniform_buffer);
+	void_gpu_release_buffer(t->instance_buffer);
+	free(t->runs);
+	free(t->uploaded);
+	free(t->instances);
+	free(t);
+}
+
+void void_text_begin(void *text, uint32_t width, uint32_t height) {
+	Text *t = (Text *)text;
+	t->count = 0;
+	t->flushed = 0;
+	t->run_count = 0;
+	t->first_run = 0;
+	t->draws = 0;
+	if (width != t->width || height != t->height) {
+		t->width = width;
+		t->height = height;
+		t->view.size[0] = (float)(width ? width : 1);
+		t->view.size[1] = (float)(height ? height : 1);
+		t->view_dirty = 1;
+	}
+}
+
+float void_text_draw(void *text, void *font, const char *utf8,
+	float x, float y, float size, uint32_t color
+) {
+	Text *t = (Text *)text;
+	Font *f = (Font *)font;
+	if (!f || !utf8) return 0.0f;
+	const Layout *l = font_layout(f, utf8);
+	float scale = size / f->base_size;
+	uint32_t n = l->count;
+	if (n > t->max_glyphs - t->count) n = t->max_glyphs - t->count;
+	if (n == 0) return l->width * scale;
+
+	TextRun *run = t->run_count > t->first_run ? &t->runs[t->run_count - 1] : NULL;
+	if (!run || run->font != f) {
+		if (t->run_count >= t->run_capacity) {
+			t->run_capacity *= 2;
+			t->runs = realloc(t->runs, t->run_capacity * sizeof(TextRun));
+		}
+		run = &t->runs[t->run_count++];
+		run->font = f;
+		run->first = t->count;
+		run->count = 0;
+	}
+
+	// 0xRRGGBBAA -> bytes r, g, b, a in memory (Unorm8x4)
+	uint32_t c = (color >> 24) | ((color >> 8) & 0xFF00u) | ((color << 8) & 0xFF0000u) | (color << 24);
+	GlyphInstance *out = &t->instances[t->count];
+	for (uint32_t i = 0; i < n; i++) {
+		out[i].pos[0] = x + l->glyphs[i].x * scale;
+		out[i].pos[1] = y + l->glyphs[i].y * scale;
+		out[i].scale = scale;
+		out[i].slot = l->glyphs[i].slot;
+		out[i].color = c;
+	}
+	t->count += n;
+	run->count += n;
+	return l->width * scale;
+}
+
+void void_text_flush(void *text, void *queue, void *render_pass) {
+	Text *t = (Text *)text;
+	if (t->first_run >= t->run_count) return;
+
+	if (t->view_dirty) {
+		void_gpu_queue_write_buffer(queue, t->uniform_buffer, 0, &t->view, sizeof(t->view));
+		t->view_dirty = 0;
+	}
+	// Static overlays produce the same instances every frame: skip the upload
+	uint32_t first = t->flushed, n = t->count - t->flushed;
+	size_t bytes = (size_t)n * sizeof(GlyphInstance);
+	if (first + n > t->uploaded_count || memcmp(&t->uploaded[first], &t->instances[first], bytes) != 0) {
+		void_gpu_queue_write_buffer(queue, t->instance_buffer,
+			(uint64_t)first * sizeof(GlyphInstance), &t->instances[first], bytes);
+		memcpy(&t->uploaded[first], &t->instances[first], bytes);
+		if (first + n > t->uploaded_count) t->uploaded_count = first + n;
+	}
+	t->flushed = t->count;
+
+	void_gpu_render_pass_set_pipeline(render_pass, t->pipeline);
+	void_gpu_render_pass_set_bind_group(render_pass, 0, t->view_group);
+	void_gpu_render_pass_set_vertex_buffer(render_pass, 0, t->instance_buffer, 0,
+		(uint64_t)t->max_glyphs * sizeof(GlyphInstance));
+	for (uint32_t r = t->first_run; r < t->run_count; r++) {
+		const TextRun *run = &t->runs[r];
+		void_gpu_render_pass_set_bind_group(render_pass, 1, run->font->group);
+		void_gpu_render_pass_draw_instanced(render_pass, 6, run->count, 0, run->first);
+		t->draws++;
+	}
+	t->first_run = t->run_count;
+}
+
+uint32_t void_text_glyph_count(void *text) {
+	return ((Text *)text)->count;
+}
+
+uint32_t void_text_draw_count(void *text) {
+	return ((Text *)text)->draws;
+}
@@ -0,0 +1,50 @@
+// Void Render — SDF text
+// Font: a TTF file whose glyphs are rasterized on first use (stb_truetype)
+// as signed distance fields at a base size into the font's R8 atlas, so one
+// atlas serves every size. Laid-out strings (codepoints, kerning, line
+// breaks) are cached per font by string: layout is in base-size units, so
+// the same entry serves every size and color.
+// Text batch: draws place cached layouts as instances (one per glyph, the
+// glyph's quad and UVs come from a table on the GPU) and flush() draws them
+// with one instanced draw per run of the same font. An unchanged frame
+// re-uses the previous upload.
+//
+// Per frame: begin(target size) → draw calls → flush() in a render pass.
+// Coordinates are pixels, origin top-left, y = top of the first line.
+// Colors are 0xRRGGBBAA.
+
+#ifndef VOID_RENDER_TEXT_H
+#define VOID_RENDER_TEXT_H
+
+#include <stdint.h>
+
+// --- Font ---
+// base_size: SDF rasterization size in pixels (0 = 32); atlas_size: width
+// and height of the glyph atlas (0 = 1024). NULL when the file is unusable.
+void *void_font_create(void *device, const char *path, float base_size, uint32_t atlas_size);
+void  void_font_destroy(void *font);
+
+float void_font_line_height(void *font, float size);
+// Widest line of utf8 at size (laid out and cached like a draw)
+float void_font_text_width(void *font, const char *utf8, float size);
+
+uint32_t void_font_glyph_count(void *font);     // rasterized so far
+uint64_t void_font_layout_hits(void *font);
+uint64_t void_font_layout_misses(void *font);
+
+// --- Text batch ---
+// color_format / samples: the pass flush() records into. max_glyphs per frame.
+void *void_text_create(void *device, uint32_t color_format, uint32_t samples, uint32_t max_glyphs);
+void  void_text_destroy(void *text);
+
+void  void_text_begin(void *text, uint32_t width, uint32_t height);
+// Returns the width of the widest line
+float void_text_draw(void *text, void *font, const char *utf8,
+    float x, float y, float size, uint32_t color);
+// Upload (when changed) and draw everything added since the last flush
+void  void_text_flush(void *text, void *queue, void *render_pass);
+
+uint32_t void_text_glyph_count(void *text);     // this frame
+uint32_t void_text_draw_count(void *text);
+
+#endif